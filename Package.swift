@@ -7,6 +7,7 @@ var sources = ["src/parser.c"]
 if FileManager.default.fileExists(atPath: "src/scanner.c") {
     sources.append("src/scanner.c")
 }
+sources += ["inline/src/parser.c", "inline/src/scanner.c"]
 
 let package = Package(
     name: "TreeSitterQuarto",
@@ -0,0 +1,69 @@
+// Parsing a Buffer in place against parsing the same document as a string.
+//
+//   node bench/buffer_input.js [file] [--sizes 1,5,10,25,50]
+//
+// The file, example-file.qmd by default, is repeated up to each size in
+// MB. A document that arrives as a Buffer is parsed as:
+// - "string": buffer.toString() passed to parse(), which converts it back
+//   to UTF-8 in the binding
+// - "buffer": the Buffer passed to parse() as is, read through a TSInput
+// - "tree-sitter": buffer.toString() passed to node-tree-sitter, if it is
+//   installed, for reference
+// Both parse() modes build span tables if the runtime is linked, and
+// outlines otherwise. Prints one JSON object per line.
+
+const fs = require("node:fs");
+const path = require("node:path");
+const { performance } = require("node:perf_hooks");
+const { parseArgs } = require("node:util");
+
+const quarto = require(path.join(__dirname, "..", "bindings", "node"));
+
+const REPEATS = 3;
+
+const { values, positionals } = parseArgs({
+  allowPositionals: true,
+  options: {
+    sizes: { type: "string", default: "1,5,10,25,50" },
+  },
+});
+
+const file = positionals[0] ?? path.join(__dirname, "..", "example-file.qmd");
+const text = fs.readFileSync(file, "utf8") + "\n";
+const options = { result: quarto.spanTypes ? "spans" : "outline" };
+
+let parser = null;
+try {
+  const Parser = require("tree-sitter");
+  parser = new Parser();
+  parser.setLanguage(quarto);
+} catch (_) {}
+
+function bestOf(run) {
+  let best = Infinity;
+  for (let i = 0; i < REPEATS; i++) {
+    const start = performance.now();
+    run();
+    best = Math.min(best, performance.now() - start);
+  }
+  return best / 1000;
+}
+
+function report(mode, buffer, seconds) {
+  console.log(JSON.stringify({
+    mode,
+    result: options.result,
+    mb: Math.round((buffer.length / 1e6) * 10) / 10,
+    seconds: Math.round(seconds * 1e6) / 1e6,
+    mb_per_s: Math.round((buffer.length / seconds / 1e6) * 100) / 100,
+  }));
+}
+
+for (const size of values.sizes.split(",").map(Number)) {
+  const buffer = Buffer.from(text.repeat(Math.max(1, Math.floor((size * 1024 * 1024) / text.length))));
+  report("string", buffer, bestOf(() => quarto.parse(buffer.toString(), options)));
+  report("buffer", buffer, bestOf(() => quarto.parse(buffer, options)));
+  if (parser) {
+    report("tree-sitter", buffer, bestOf(() => parser.parse(buffer.toString())));
+  }
+}
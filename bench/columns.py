@@ -0,0 +1,115 @@
+"""Columnar node export against walking Node objects from Python.
+
+    python bench/columns.py [file] [--size KB]
+
+The file defaults to the largest file of test/corpus and
+inline/test/corpus. That is only a few KB, so it is repeated up to the
+given size, 1024 KB by default. Both sides collect the symbol, start byte,
+end byte, parent and depth of every named node of both grammars. Prints
+one JSON object per line. If NumPy is installed, it also times turning the
+columns into arrays, which should not copy.
+"""
+
+import json
+import time
+from argparse import ArgumentParser
+from glob import glob
+from os import path
+
+import tree_sitter
+import tree_sitter_quarto
+
+REPEATS = 3
+
+
+def best_of(function):
+    best = float("inf")
+    for _ in range(REPEATS):
+        start = time.perf_counter()
+        function()
+        best = min(best, time.perf_counter() - start)
+    return best
+
+
+def largest_corpus_file():
+    files = glob("test/corpus/*.txt") + glob("inline/test/corpus/*.txt")
+    return max(files, key=path.getsize)
+
+
+def python_columns(parser, inline_parser, inline_offset, document):
+    symbols, start_bytes, end_bytes, parents, depths = [], [], [], [], []
+
+    def add(node, offset, parent, depth, symbol_offset):
+        index = len(symbols)
+        symbols.append(node.kind_id + symbol_offset)
+        start_bytes.append(offset + node.start_byte)
+        end_bytes.append(offset + node.end_byte)
+        parents.append(parent)
+        depths.append(depth)
+        return index
+
+    def walk(node, offset, parent, depth, is_inline):
+        for child in node.children:
+            if not child.is_named:
+                walk(child, offset, parent, depth + 1, is_inline)
+                continue
+            index = add(child, offset, parent, depth + 1, inline_offset if is_inline else 0)
+            if not is_inline and child.type == "inline":
+                text = document[child.start_byte:child.end_byte]
+                tree = inline_parser.parse(text)
+                walk(tree.root_node, child.start_byte, index, depth + 1, True)
+            walk(child, offset, index, depth + 1, is_inline)
+
+    root = parser.parse(document).root_node
+    walk(root, 0, add(root, 0, -1, 0, 0), 0, False)
+    return symbols, start_bytes, end_bytes, parents, depths
+
+
+def report(mode, seconds, nodes, size):
+    print(json.dumps({
+        "mode": mode,
+        "seconds": round(seconds, 6),
+        "nodes": nodes,
+        "mb_per_s": round(size / seconds / 1e6, 2),
+        "ns_per_node": round(seconds / nodes * 1e9, 1),
+    }), flush=True)
+
+
+def main():
+    arguments = ArgumentParser()
+    arguments.add_argument("file", nargs="?", default=None)
+    arguments.add_argument("--size", type=int, default=1024, help="document size in KB")
+    options = arguments.parse_args()
+
+    with open(options.file or largest_corpus_file(), "rb") as file:
+        text = file.read() + b"\n"
+    document = text * max(1, options.size * 1024 // len(text))
+
+    language = tree_sitter.Language(tree_sitter_quarto.language())
+    parser = tree_sitter.Parser(language)
+    inline_parser = tree_sitter.Parser(tree_sitter.Language(tree_sitter_quarto.inline_language()))
+    inline_offset = language.node_kind_count
+
+    [columns] = tree_sitter_quarto.parse_many([document], result="columns")
+    nodes = len(columns["symbol"])
+    report("python-nodes", best_of(
+        lambda: python_columns(parser, inline_parser, inline_offset, document)),
+        nodes, len(document))
+    report("columns", best_of(
+        lambda: tree_sitter_quarto.parse_many([document], result="columns")),
+        nodes, len(document))
+
+    try:
+        import numpy
+    except ImportError:
+        return
+
+    def to_arrays():
+        [columns] = tree_sitter_quarto.parse_many([document], result="columns")
+        return {name: numpy.asarray(column) for name, column in columns.items()}
+
+    report("columns-numpy", best_of(to_arrays), nodes, len(document))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,78 @@
+"""Criterion baselines of the Rust benches as one JSON file per release.
+
+    cargo bench --bench parse -- --save-baseline v0.1.0
+    python bench/criterion_baseline.py export v0.1.0 > v0.1.0.json
+    python bench/criterion_baseline.py compare v0.1.0.json v0.2.0.json
+
+`export` collects the estimates criterion saved under
+target/criterion/<benchmark>/<baseline> into a JSON object keyed by
+benchmark id, with times in nanoseconds. `compare` prints one JSON object
+per line for the benchmarks of both files, with the change of the mean.
+"""
+
+import json
+import sys
+from argparse import ArgumentParser
+from pathlib import Path
+
+
+def export(target, baseline):
+    results = {}
+    for path in sorted(Path(target, "criterion").glob(f"**/{baseline}/benchmark.json")):
+        with open(path) as file:
+            benchmark = json.load(file)
+        with open(path.with_name("estimates.json")) as file:
+            estimates = json.load(file)
+        result = {
+            "mean_ns": estimates["mean"]["point_estimate"],
+            "mean_low_ns": estimates["mean"]["confidence_interval"]["lower_bound"],
+            "mean_high_ns": estimates["mean"]["confidence_interval"]["upper_bound"],
+            "median_ns": estimates["median"]["point_estimate"],
+        }
+        throughput = benchmark.get("throughput") or {}
+        if "Bytes" in throughput:
+            result["mb_per_s"] = round(throughput["Bytes"] / result["mean_ns"] * 1e3, 2)
+        if "Elements" in throughput:
+            result["elements_per_s"] = round(throughput["Elements"] / result["mean_ns"] * 1e9, 1)
+        results[benchmark["full_id"]] = result
+    if not results:
+        sys.exit(f"no baseline {baseline!r} under {target}/criterion")
+    return results
+
+
+def compare(old, new):
+    for name in sorted(old.keys() & new.keys()):
+        before, after = old[name]["mean_ns"], new[name]["mean_ns"]
+        # outside both confidence intervals
+        significant = (after > old[name]["mean_high_ns"] and before < new[name]["mean_low_ns"]) or (
+            after < old[name]["mean_low_ns"] and before > new[name]["mean_high_ns"])
+        print(json.dumps({
+            "benchmark": name,
+            "old_ns": round(before, 1),
+            "new_ns": round(after, 1),
+            "change": round(after / before - 1, 4),
+            "significant": significant,
+        }))
+
+
+def main():
+    arguments = ArgumentParser()
+    commands = arguments.add_subparsers(dest="command", required=True)
+    export_command = commands.add_parser("export")
+    export_command.add_argument("baseline")
+    export_command.add_argument("--target-dir", default="target")
+    compare_command = commands.add_parser("compare")
+    compare_command.add_argument("old")
+    compare_command.add_argument("new")
+    options = arguments.parse_args()
+
+    if options.command == "export":
+        json.dump(export(options.target_dir, options.baseline), sys.stdout, indent=2, sort_keys=True)
+        print()
+    else:
+        with open(options.old) as old, open(options.new) as new:
+            compare(json.load(old), json.load(new))
+
+
+if __name__ == "__main__":
+    main()
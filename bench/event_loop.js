@@ -0,0 +1,98 @@
+// Event loop delay while documents are parsed, on the event loop with
+// node-tree-sitter and on the thread pool with parseAsync().
+//
+//   node bench/event_loop.js [file] [--size MB] [--seconds S] [--concurrency N]
+//
+// The file, example-file.qmd by default, is repeated up to the given size,
+// 2 MB by default. Each mode keeps `concurrency` parses going for the given
+// time while the event loop delay is sampled with monitorEventLoopDelay().
+// Prints one JSON object per line. The thread pool has UV_THREADPOOL_SIZE
+// threads, 4 by default.
+
+const fs = require("node:fs");
+const path = require("node:path");
+const { monitorEventLoopDelay, performance } = require("node:perf_hooks");
+const { parseArgs } = require("node:util");
+
+const quarto = require(path.join(__dirname, "..", "bindings", "node"));
+
+const { values, positionals } = parseArgs({
+  allowPositionals: true,
+  options: {
+    size: { type: "string", default: "2" },
+    seconds: { type: "string", default: "5" },
+    concurrency: { type: "string", default: "4" },
+  },
+});
+
+const file = positionals[0] ?? path.join(__dirname, "..", "example-file.qmd");
+const text = fs.readFileSync(file, "utf8") + "\n";
+const document = text.repeat(Math.max(1, Math.floor((Number(values.size) * 1024 * 1024) / text.length)));
+const buffer = Buffer.from(document);
+const seconds = Number(values.seconds);
+const concurrency = Number(values.concurrency);
+
+function report(mode, histogram, parses, elapsed) {
+  const ms = (nanoseconds) => Math.round(nanoseconds / 1e4) / 100;
+  console.log(JSON.stringify({
+    mode,
+    concurrency,
+    parses,
+    parses_per_s: Math.round((parses / elapsed) * 10) / 10,
+    mb_per_s: Math.round(((parses * buffer.length) / elapsed / 1e6) * 100) / 100,
+    delay_p50_ms: ms(histogram.percentile(50)),
+    delay_p99_ms: ms(histogram.percentile(99)),
+    delay_max_ms: ms(histogram.max),
+  }));
+}
+
+// keeps `concurrency` parses going until the time is up
+function run(mode, parse) {
+  return new Promise((resolve) => {
+    const histogram = monitorEventLoopDelay({ resolution: 1 });
+    const start = performance.now();
+    const end = start + seconds * 1000;
+    let parses = 0;
+    let running = 0;
+    let reported = false;
+    histogram.enable();
+
+    const next = () => {
+      if (performance.now() >= end) {
+        if (running === 0 && !reported) {
+          reported = true;
+          histogram.disable();
+          report(mode, histogram, parses, (performance.now() - start) / 1000);
+          resolve();
+        }
+        return;
+      }
+      running++;
+      parse().then(() => {
+        running--;
+        parses++;
+        // let timers run between parses, as a server would
+        setImmediate(next);
+      });
+    };
+    for (let i = 0; i < concurrency; i++) next();
+  });
+}
+
+async function main() {
+  let Parser = null;
+  try {
+    Parser = require("tree-sitter");
+  } catch (_) {}
+  if (Parser) {
+    const parser = new Parser();
+    parser.setLanguage(quarto);
+    await run("sync-parse", async () => parser.parse(document));
+  }
+  await run("async-outline", () => quarto.parseAsync(buffer));
+  if (quarto.spanTypes) {
+    await run("async-spans", () => quarto.parseAsync(buffer, { result: "spans" }));
+  }
+}
+
+main();
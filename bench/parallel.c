@@ -0,0 +1,102 @@
+// Scaling of tree_sitter_quarto_parse_parallel() from 1 to 16 threads.
+//
+//   quarto-parallel-bench [file] [megabytes]
+//
+// The file, example-file.qmd by default, is repeated up to the given size,
+// 5 MB by default. Prints one JSON object per line: a plain single parser
+// run, then one per thread count.
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "tree_sitter/tree-sitter-quarto.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <tree_sitter/api.h>
+
+#define REPEATS 5
+
+static double now(void) {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+static char *read_document(const char *path, uint32_t size, uint32_t *length) {
+  FILE *file = fopen(path, "rb");
+  if (!file) return NULL;
+  fseek(file, 0, SEEK_END);
+  long file_length = ftell(file);
+  rewind(file);
+  char *text = malloc(file_length + 1);
+  if (!text || fread(text, 1, file_length, file) != (size_t)file_length || file_length == 0) {
+    fclose(file);
+    free(text);
+    return NULL;
+  }
+  fclose(file);
+  text[file_length] = '\n';
+
+  char *document = malloc(size + file_length + 1);
+  *length = 0;
+  while (document && *length < size) {
+    memcpy(document + *length, text, file_length + 1);
+    *length += file_length + 1;
+  }
+  free(text);
+  return document;
+}
+
+static void report(const char *mode, uint32_t threads, uint32_t sections, double seconds,
+                   double baseline, uint32_t length) {
+  printf("{\"mode\":\"%s\",\"threads\":%u,\"sections\":%u,\"seconds\":%.6f,"
+         "\"mb_per_s\":%.2f,\"speedup\":%.2f}\n",
+         mode, threads, sections, seconds, length / seconds / 1e6, baseline / seconds);
+}
+
+int main(int argc, char **argv) {
+  const char *path = argc > 1 ? argv[1] : "example-file.qmd";
+  uint32_t size = (argc > 2 ? atoi(argv[2]) : 5) * 1024 * 1024;
+  uint32_t length;
+  char *document = read_document(path, size, &length);
+  if (!document) {
+    fprintf(stderr, "cannot read %s\n", path);
+    return 1;
+  }
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_quarto());
+  double baseline = 1e9;
+  for (int i = 0; i < REPEATS; i++) {
+    double start = now();
+    TSTree *tree = ts_parser_parse_string(parser, NULL, document, length);
+    double seconds = now() - start;
+    ts_tree_delete(tree);
+    if (seconds < baseline) baseline = seconds;
+  }
+  ts_parser_delete(parser);
+  report("single", 1, 1, baseline, baseline, length);
+
+  for (uint32_t threads = 1; threads <= 16; threads *= 2) {
+    double best = 1e9;
+    uint32_t sections = 0;
+    for (int i = 0; i < REPEATS; i++) {
+      double start = now();
+      TSQuartoDocument *parsed = tree_sitter_quarto_parse_parallel(document, length, threads);
+      double seconds = now() - start;
+      if (!parsed) {
+        fprintf(stderr, "parse failed with %u threads\n", threads);
+        return 1;
+      }
+      sections = tree_sitter_quarto_document_section_count(parsed);
+      tree_sitter_quarto_document_delete(parsed);
+      if (seconds < best) best = seconds;
+    }
+    report("parallel", threads, sections, best, baseline, length);
+  }
+
+  free(document);
+  return 0;
+}
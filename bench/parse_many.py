@@ -0,0 +1,102 @@
+"""parse_many() against a Python loop over tree_sitter.Parser.
+
+    python bench/parse_many.py [file] [--copies N] [--size KB] [--workers 1,2,4,8]
+
+The file, example-file.qmd by default, is repeated up to the given size
+and parsed as N separate documents. Prints one JSON object per line: the
+Python loop, with and without walking the tree for the same spans
+parse_many() returns, then parse_many() for each result kind and worker
+count.
+"""
+
+import json
+import time
+from argparse import ArgumentParser
+
+import tree_sitter
+import tree_sitter_quarto
+
+REPEATS = 3
+
+
+def best_of(function):
+    best = float("inf")
+    for _ in range(REPEATS):
+        start = time.perf_counter()
+        function()
+        best = min(best, time.perf_counter() - start)
+    return best
+
+
+def python_spans(parser, inline_parser, document):
+    spans = []
+
+    def walk(cursor, offset, base_depth, is_inline=False):
+        depth = 0
+        while True:
+            if cursor.goto_first_child():
+                depth += 1
+            else:
+                while not cursor.goto_next_sibling():
+                    if depth <= 1 or not cursor.goto_parent():
+                        return
+                    depth -= 1
+            node = cursor.node
+            if not node.is_named:
+                continue
+            spans.append((node.type, offset + node.start_byte, offset + node.end_byte,
+                          base_depth + depth))
+            if not is_inline and node.type == "inline":
+                text = document[node.start_byte:node.end_byte]
+                tree = inline_parser.parse(text)
+                walk(tree.walk(), node.start_byte, base_depth + depth, True)
+
+    tree = parser.parse(document)
+    root = tree.root_node
+    spans.append((root.type, root.start_byte, root.end_byte, 0))
+    walk(tree.walk(), 0, 0)
+    return spans
+
+
+def report(mode, workers, seconds, documents):
+    size = sum(len(document) for document in documents)
+    print(json.dumps({
+        "mode": mode,
+        "workers": workers,
+        "documents": len(documents),
+        "seconds": round(seconds, 6),
+        "mb_per_s": round(size / seconds / 1e6, 2),
+        "documents_per_s": round(len(documents) / seconds, 1),
+    }), flush=True)
+
+
+def main():
+    arguments = ArgumentParser()
+    arguments.add_argument("file", nargs="?", default="example-file.qmd")
+    arguments.add_argument("--copies", type=int, default=2000)
+    arguments.add_argument("--size", type=int, default=16, help="document size in KB")
+    arguments.add_argument("--workers", default="1,2,4,8")
+    options = arguments.parse_args()
+
+    with open(options.file, "rb") as file:
+        text = file.read() + b"\n"
+    document = text * max(1, options.size * 1024 // len(text))
+    documents = [document] * options.copies
+    worker_counts = [int(workers) for workers in options.workers.split(",")]
+
+    parser = tree_sitter.Parser(tree_sitter.Language(tree_sitter_quarto.language()))
+    inline_parser = tree_sitter.Parser(tree_sitter.Language(tree_sitter_quarto.inline_language()))
+    report("python-parse", 1, best_of(lambda: [parser.parse(d) for d in documents]), documents)
+    report("python-spans", 1,
+           best_of(lambda: [python_spans(parser, inline_parser, d) for d in documents]),
+           documents)
+
+    for result in ("outline", "spans", "sexp"):
+        for workers in worker_counts:
+            seconds = best_of(
+                lambda: tree_sitter_quarto.parse_many(documents, workers=workers, result=result))
+            report(f"parse_many-{result}", workers, seconds, documents)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,1282 @@
+// Parse throughput of both grammars over a set of inputs, and how parse
+// time grows with the size of generated worst cases. Built with the
+// TREE_SITTER_QUARTO_BENCH CMake option.
+//
+//   quarto-bench [--repeats N] [--seed N] [--corpus DIR] [--inline-corpus DIR]
+//                [--file PATH] [--generated MB] [--adversarial KIND[:MB]]
+//                [--curve KIND|all] [--curve-max MB] [--edits N]
+//                [--edit-script PATH] [--stack-versions] [--outline]...
+//
+// Inputs may be repeated. With none and no curve, the inputs are
+// test/corpus, inline/test/corpus, example-file.qmd, simple.qmd,
+// generated documents of 1 and 10 MB, 1 MB of math and 100k `[`. The examples of a corpus file are
+// one input and are parsed with the grammar of their corpus. Other
+// documents are parsed with the block grammar, then each `inline` node
+// with the inline grammar, as an editor would. The kinds of generated
+// documents are listed above `Kind`.
+//
+// Prints one JSON object per input:
+// - mb_per_s, ns_per_byte: the best of `repeats` runs, 5 by default
+// - nodes_per_kb: the nodes of all trees, not counting the root of each
+//   inline tree, which is the block tree's `inline` node again
+// - tree_bytes_per_kb: the memory of those trees, what the runtime frees
+//   when each is deleted
+// - scanner_calls_per_kb: calls to the external scanners of both grammars
+// - peak_rss_kb: the peak RSS of the process so far, so it never drops
+//   from one input to the next
+// - inline_scanner: with the TREE_SITTER_QUARTO_COUNTERS CMake option,
+//   the inline scanner's counters for the last run, see
+//   `TSQuartoScannerCounters`. Like peak_rss_kb, peak_results is the peak
+//   so far.
+// - max_stack_versions, avg_stack_versions: with `--stack-versions`, the
+//   most parse stacks the runtime kept at once, and their average over
+//   its steps. Read from its debug log in a parse of its own, untimed.
+//   Over 1 means the parse forked on a grammar conflict.
+//
+// `--outline` times `tree_sitter_quarto_outline()` over each document
+// input against the full parse above, and prints one JSON object per
+// input with outline_ns_per_byte, parse_ns_per_byte and outline_speedup.
+// An outline less than 10 times faster than the parse is flagged as slow
+// and makes the exit status 1.
+//
+// bench/quarto_compare.py puts the time, nodes and tree memory of two
+// runs side by side, such as runs before and after a grammar change.
+//
+// A curve measures documents of a kind from 16 KB, doubling up to
+// `--curve-max` MB (1 by default) or until one takes over 10 seconds, then
+// prints the exponent of the fitted `seconds = c * bytes^exponent`. An
+// exponent over 1.25 is flagged as superlinear and makes the exit status 1.
+//
+// `--edits N` replays a synthetic typing session of N edits on each
+// document input, and `--edit-script` a recorded one on the input before
+// it, see `read_edit_script()`. Each edit is applied with `ts_tree_edit()`
+// and timed with the reparse of the block tree and of the `inline` nodes
+// it touches. Prints one JSON object per document:
+// - p50_us, p99_us, max_us: the latency of an edit
+// - relexed_bytes_per_edit, relexed_bytes_max: the bytes the parsers read
+//   for an edit. The block parser reads in chunks of at most 64 bytes, so
+//   this is an upper bound of what was lexed again, close enough to
+//   compare scanner changes
+// - scanner_calls_per_edit: calls to the external scanners
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "tree_sitter/tree-sitter-quarto.h"
+
+#include <dirent.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <tree_sitter/api.h>
+// after api.h, for the definition of TSLanguage
+#include "tree_sitter/parser.h"
+
+#define DEFAULT_REPEATS 5
+#define DEFAULT_SEED 1
+#define DEFAULT_CURVE_MAX_MB 1
+#define CURVE_MIN_MB (1.0 / 64)
+#define CURVE_BUDGET_SECONDS 10
+#define SUPERLINEAR_EXPONENT 1.25
+#define OUTLINE_MIN_SPEEDUP 10
+#define EDIT_CHUNK 64
+
+typedef struct {
+  char *text;
+  uint32_t length;
+} Document;
+
+typedef struct {
+  char *name;
+  bool is_inline;
+  Document *documents;
+  uint32_t count;
+  uint64_t bytes;
+  const char *edit_script;
+} Input;
+
+typedef struct {
+  uint64_t nodes;
+  uint64_t tree_bytes;
+  uint64_t scanner_calls;
+  bool has_inline_scanner;
+  TSQuartoScannerCounters inline_scanner;
+  uint32_t max_stack_versions;
+  uint64_t stack_versions;
+  uint64_t steps;
+} Counts;
+
+static double now(void) {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+// Tree memory is counted by handing the runtime an allocator that keeps
+// the size of each block in front of it.
+
+static size_t allocated;
+
+#define HEADER_SIZE sizeof(max_align_t)
+
+static void *count_malloc(size_t size) {
+  size_t *block = malloc(HEADER_SIZE + size);
+  if (!block) return NULL;
+  *block = size;
+  allocated += size;
+  return (char *)block + HEADER_SIZE;
+}
+
+static void *count_calloc(size_t count, size_t size) {
+  void *pointer = count_malloc(count * size);
+  if (pointer) memset(pointer, 0, count * size);
+  return pointer;
+}
+
+static void *count_realloc(void *pointer, size_t size) {
+  if (!pointer) return count_malloc(size);
+  size_t *block = (size_t *)((char *)pointer - HEADER_SIZE);
+  size_t old_size = *block;
+  block = realloc(block, HEADER_SIZE + size);
+  if (!block) return NULL;
+  *block = size;
+  allocated = allocated - old_size + size;
+  return (char *)block + HEADER_SIZE;
+}
+
+static void count_free(void *pointer) {
+  if (!pointer) return;
+  size_t *block = (size_t *)((char *)pointer - HEADER_SIZE);
+  allocated -= *block;
+  free(block);
+}
+
+/// deletes `tree` and returns the bytes that freed
+static uint64_t delete_tree(TSTree *tree) {
+  size_t before = allocated;
+  ts_tree_delete(tree);
+  return before - allocated;
+}
+
+// Scanner calls are counted by parsing with a copy of each language whose
+// external scanner is wrapped.
+
+typedef struct {
+  TSLanguage language;
+  bool (*scan)(void *, TSLexer *, const bool *);
+  uint64_t calls;
+} CountedLanguage;
+
+static CountedLanguage counted[2];
+
+static bool scan_block(void *payload, TSLexer *lexer, const bool *valid_symbols) {
+  counted[0].calls++;
+  return counted[0].scan(payload, lexer, valid_symbols);
+}
+
+static bool scan_inline(void *payload, TSLexer *lexer, const bool *valid_symbols) {
+  counted[1].calls++;
+  return counted[1].scan(payload, lexer, valid_symbols);
+}
+
+static const TSLanguage *count_scanner_calls(uint32_t index, const TSLanguage *language) {
+  static bool (*const wrappers[2])(void *, TSLexer *, const bool *) = {scan_block, scan_inline};
+  CountedLanguage *self = &counted[index];
+  self->language = *language;
+  self->scan = language->external_scanner.scan;
+  if (self->scan) self->language.external_scanner.scan = wrappers[index];
+  return &self->language;
+}
+
+static uint64_t scanner_calls(void) {
+  return counted[0].calls + counted[1].calls;
+}
+
+/// the inline scanner's counters since `before`, except the peak, which is
+/// the peak so far
+static bool inline_scanner_counters(TSQuartoScannerCounters *counters,
+                                    const TSQuartoScannerCounters *before) {
+  if (!tree_sitter_quarto_inline_scanner_counters(counters)) return false;
+  counters->scan_calls -= before->scan_calls;
+  counters->new_line_calls -= before->new_line_calls;
+  counters->star_calls -= before->star_calls;
+  counters->under_calls -= before->under_calls;
+  counters->advanced -= before->advanced;
+  counters->backtracked -= before->backtracked;
+  counters->serialized_bytes -= before->serialized_bytes;
+  counters->deserialize_calls -= before->deserialize_calls;
+  return true;
+}
+
+// Inputs
+
+static char *read_file(const char *path, uint32_t *length) {
+  FILE *file = fopen(path, "rb");
+  if (!file) return NULL;
+  fseek(file, 0, SEEK_END);
+  long file_length = ftell(file);
+  rewind(file);
+  char *text = malloc(file_length + 1);
+  if (text && fread(text, 1, file_length, file) != (size_t)file_length) {
+    free(text);
+    text = NULL;
+  }
+  if (text) text[file_length] = '\0';
+  fclose(file);
+  *length = (uint32_t)file_length;
+  return text;
+}
+
+static void add_document(Input *input, char *text, uint32_t length) {
+  input->documents = realloc(input->documents, (input->count + 1) * sizeof(Document));
+  input->documents[input->count++] = (Document){text, length};
+  input->bytes += length;
+}
+
+static bool is_rule(const char *line, char marker) {
+  int count = 0;
+  while (*line == marker) {
+    line++;
+    count++;
+  }
+  return count >= 3 && (*line == '\n' || *line == '\0');
+}
+
+/// adds the input of every example in a corpus file: the text between the
+/// header's closing `===` line and the `---` line
+static void read_corpus_file(Input *input, const char *path) {
+  uint32_t length;
+  char *text = read_file(path, &length);
+  if (!text) return;
+  int rules = 0;
+  char *example = NULL;
+  for (char *line = text; *line;) {
+    char *end = strchr(line, '\n');
+    char *next = end ? end + 1 : line + strlen(line);
+    if (is_rule(line, '=')) {
+      rules++;
+      if (rules % 2 == 0) example = next;
+    } else if (example && is_rule(line, '-')) {
+      uint32_t example_length = (uint32_t)(line - example);
+      char *copy = malloc(example_length + 1);
+      memcpy(copy, example, example_length);
+      copy[example_length] = '\0';
+      add_document(input, copy, example_length);
+      example = NULL;
+    }
+    line = next;
+  }
+  free(text);
+}
+
+static int compare_names(const void *a, const void *b) {
+  return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+/// adds an input for each corpus file of `dir`, in name order
+static bool read_corpus(Input **inputs, uint32_t *count, const char *dir, bool is_inline) {
+  DIR *directory = opendir(dir);
+  if (!directory) return false;
+  char **names = NULL;
+  uint32_t name_count = 0;
+  struct dirent *entry;
+  while ((entry = readdir(directory))) {
+    size_t length = strlen(entry->d_name);
+    if (length < 4 || strcmp(entry->d_name + length - 4, ".txt") != 0) continue;
+    names = realloc(names, (name_count + 1) * sizeof(char *));
+    names[name_count] = malloc(strlen(dir) + length + 2);
+    sprintf(names[name_count++], "%s/%s", dir, entry->d_name);
+  }
+  closedir(directory);
+  qsort(names, name_count, sizeof(char *), compare_names);
+
+  for (uint32_t i = 0; i < name_count; i++) {
+    *inputs = realloc(*inputs, (*count + 1) * sizeof(Input));
+    Input *input = &(*inputs)[(*count)++];
+    *input = (Input){names[i], is_inline, NULL, 0, 0, NULL};
+    read_corpus_file(input, names[i]);
+  }
+  free(names);
+  return true;
+}
+
+// Generated documents, from a seed so runs are comparable. The mixed kind
+// is headings and paragraphs using every inline construct, and the math
+// kind paragraphs dense with inline math, display math between them, as
+// in a thesis. The others are worst cases for the inline scanner, each a
+// single paragraph and so a single `inline` node:
+// - unmatched: emphasis, link, span and code openers that are never closed
+// - alternating: runs of alternating `*` and `_` around words
+// - long-line: mixed inline constructs on one line
+// - nesting: emphasis and links nested as deep as the size allows, then
+//   closed in reverse
+// - escapes: backslash escapes of every inline syntax character
+// - brackets: `[` and nothing else, on one line
+// - destinations: links and images whose destination is never closed
+// - citations: citation keys, bare or after a `[` never closed, on one line
+
+typedef enum {
+  MIXED,
+  MATH,
+  UNMATCHED,
+  ALTERNATING,
+  LONG_LINE,
+  NESTING,
+  ESCAPES,
+  BRACKETS,
+  DESTINATIONS,
+  CITATIONS,
+  KIND_COUNT,
+} Kind;
+
+static const char *const kind_names[KIND_COUNT] = {
+  "mixed", "math", "unmatched", "alternating", "long-line", "nesting", "escapes", "brackets",
+  "destinations", "citations",
+};
+
+static int find_kind(const char *name, size_t length) {
+  for (int kind = 0; kind < KIND_COUNT; kind++) {
+    if (strlen(kind_names[kind]) == length && strncmp(kind_names[kind], name, length) == 0) {
+      return kind;
+    }
+  }
+  return -1;
+}
+
+typedef struct {
+  char *text;
+  uint32_t length;
+  uint32_t capacity;
+  uint32_t line_start;
+  uint64_t state;
+} Generator;
+
+static uint32_t next_random(Generator *self, uint32_t bound) {
+  // xorshift64
+  self->state ^= self->state << 13;
+  self->state ^= self->state >> 7;
+  self->state ^= self->state << 17;
+  return (uint32_t)(self->state % bound);
+}
+
+static void emit(Generator *self, const char *text) {
+  uint32_t length = (uint32_t)strlen(text);
+  if (self->length + length + 1 > self->capacity) {
+    self->capacity = 2 * (self->length + length + 1);
+    self->text = realloc(self->text, self->capacity);
+  }
+  memcpy(self->text + self->length, text, length + 1);
+  self->length += length;
+}
+
+static const char *const words[] = {
+  "quarto", "document", "render", "figure", "table", "output", "code", "cell",
+  "section", "result", "plot", "data", "model", "value", "the", "a", "of", "and",
+};
+
+static const char *word(Generator *self) {
+  return words[next_random(self, sizeof(words) / sizeof(words[0]))];
+}
+
+static void emit_inline(Generator *self, uint32_t word_count) {
+  char buffer[256];
+  for (uint32_t i = 0; i < word_count; i++) {
+    if (i > 0) emit(self, " ");
+    const char *a = word(self), *b = word(self);
+    switch (next_random(self, 16)) {
+      case 0: snprintf(buffer, sizeof(buffer), "*%s %s*", a, b); break;
+      case 1: snprintf(buffer, sizeof(buffer), "**%s**", a); break;
+      case 2: snprintf(buffer, sizeof(buffer), "_%s_", a); break;
+      case 3: snprintf(buffer, sizeof(buffer), "[%s](https://%s.org)", a, b); break;
+      case 4: snprintf(buffer, sizeof(buffer), "![%s](%s.png)", a, b); break;
+      case 5: snprintf(buffer, sizeof(buffer), "[%s]{.%s}", a, b); break;
+      case 6: snprintf(buffer, sizeof(buffer), "[@%s; @%s]", a, b); break;
+      case 7: snprintf(buffer, sizeof(buffer), "{{< %s %s >}}", a, b); break;
+      case 8: snprintf(buffer, sizeof(buffer), "%s,", a); break;
+      case 9: snprintf(buffer, sizeof(buffer), "%s.", a); break;
+      default: snprintf(buffer, sizeof(buffer), "%s", a); break;
+    }
+    emit(self, buffer);
+  }
+}
+
+static void generate_mixed(Generator *self, uint32_t size) {
+  emit(self, "---\ntitle: \"Generated\"\n---\n\n");
+  while (self->length < size) {
+    uint32_t kind = next_random(self, 10);
+    if (kind == 0) {
+      static const char *const markers[] = {"# ", "## ", "### "};
+      emit(self, markers[next_random(self, 3)]);
+      emit_inline(self, 1 + next_random(self, 5));
+      if (next_random(self, 2)) {
+        emit(self, " {#sec-");
+        emit(self, word(self));
+        emit(self, "}");
+      }
+      emit(self, "\n\n");
+    } else if (kind == 1) {
+      emit_inline(self, 1 + next_random(self, 5));
+      emit(self, "\n---\n\n");
+    } else if (kind == 2) {
+      emit(self, "<!-- ");
+      emit(self, word(self));
+      emit(self, " -->\n\n");
+    } else {
+      uint32_t lines = 1 + next_random(self, 6);
+      for (uint32_t i = 0; i < lines; i++) {
+        emit_inline(self, 3 + next_random(self, 12));
+        emit(self, next_random(self, 8) == 0 ? "\\\n" : "\n");
+      }
+      emit(self, "\n");
+    }
+  }
+}
+
+static const char *const formulas[] = {
+  "x_i", "x^2", "a * b", "\\alpha_{i,j}", "\\sum_{k=1}^{n} k^2", "f(x_1, x_2)",
+  "\\mathbb{E}[X_t]", "\\frac{a_1}{b_2}", "\\hat{\\beta}_{*}", "\\|v\\|_2",
+};
+
+static const char *formula(Generator *self) {
+  return formulas[next_random(self, sizeof(formulas) / sizeof(formulas[0]))];
+}
+
+static void generate_math(Generator *self, uint32_t size) {
+  while (self->length < size) {
+    for (uint32_t lines = 1 + next_random(self, 6); lines > 0; lines--) {
+      for (uint32_t count = 3 + next_random(self, 12); count > 0; count--) {
+        switch (next_random(self, 8)) {
+          case 0:
+          case 1:
+            emit(self, "$");
+            emit(self, formula(self));
+            emit(self, "$");
+            break;
+          case 2:
+            // an amount, which opens no math
+            emit(self, "$20");
+            break;
+          default:
+            emit(self, word(self));
+            break;
+        }
+        emit(self, count > 1 ? " " : "\n");
+      }
+    }
+    if (next_random(self, 2)) {
+      emit(self, "\n$$\n");
+      emit(self, formula(self));
+      emit(self, " = ");
+      emit(self, formula(self));
+      emit(self, "\n$$\n");
+    }
+    emit(self, "\n");
+  }
+}
+
+/// a space between words, or a line break once the line is 80 bytes long
+static void emit_space(Generator *self, bool wrap) {
+  if (wrap && self->length - self->line_start >= 80) {
+    emit(self, "\n");
+    self->line_start = self->length;
+  } else {
+    emit(self, " ");
+  }
+}
+
+static void emit_run(Generator *self, uint32_t length) {
+  uint32_t marker = next_random(self, 2);
+  for (uint32_t i = 0; i < length; i++) emit(self, (i + marker) % 2 ? "_" : "*");
+}
+
+static void generate_nesting(Generator *self, uint32_t size) {
+  static const char *const openers[] = {"*", "_", "**", "["};
+  static const char *const closers[] = {"*", "_", "**", "]"};
+  uint8_t *stack = malloc(size / 2 + 1);
+  uint32_t depth = 0;
+  while (self->length < size / 2) {
+    if (depth > 0) emit_space(self, true);
+    uint8_t opener = (uint8_t)next_random(self, 4);
+    stack[depth++] = opener;
+    emit(self, openers[opener]);
+    emit(self, word(self));
+  }
+  while (depth > 0) {
+    emit_space(self, true);
+    emit(self, word(self));
+    emit(self, closers[stack[--depth]]);
+  }
+  free(stack);
+}
+
+static void generate_adversarial(Generator *self, Kind kind, uint32_t size) {
+  static const char *const openers[] = {"*", "**", "_", "__", "[", "![", "[@", "{{< ", "`", "$"};
+  static const char *const escapes[] = {"\\*", "\\_", "\\[", "\\]", "\\`", "\\$", "\\\\", "\\{", "\\@"};
+  bool wrap = kind != LONG_LINE && kind != CITATIONS;
+  while (self->length < size) {
+    if (self->length > 0) emit_space(self, wrap);
+    switch (kind) {
+      case UNMATCHED:
+        emit(self, openers[next_random(self, sizeof(openers) / sizeof(openers[0]))]);
+        emit(self, word(self));
+        break;
+      case ALTERNATING:
+        emit_run(self, 1 + next_random(self, 8));
+        emit(self, word(self));
+        emit_run(self, 1 + next_random(self, 8));
+        break;
+      case ESCAPES:
+        for (uint32_t i = 1 + next_random(self, 4); i > 0; i--) {
+          emit(self, escapes[next_random(self, sizeof(escapes) / sizeof(escapes[0]))]);
+        }
+        if (next_random(self, 2)) emit(self, word(self));
+        break;
+      case DESTINATIONS:
+        emit(self, next_random(self, 2) ? "[" : "![");
+        emit(self, word(self));
+        emit(self, "](");
+        emit(self, word(self));
+        break;
+      case CITATIONS:
+        emit(self, next_random(self, 2) ? "@" : "[@");
+        emit(self, word(self));
+        break;
+      default:
+        emit_inline(self, 1);
+        break;
+    }
+  }
+}
+
+static char *generate(Kind kind, uint32_t size, uint64_t seed, uint32_t *length) {
+  Generator self = {NULL, 0, 0, 0, seed ? seed : DEFAULT_SEED};
+  if (kind == MIXED) {
+    generate_mixed(&self, size);
+  } else if (kind == MATH) {
+    generate_math(&self, size);
+  } else {
+    if (kind == NESTING) {
+      generate_nesting(&self, size);
+    } else if (kind == BRACKETS) {
+      while (self.length < size) emit(&self, "[");
+    } else {
+      generate_adversarial(&self, kind, size);
+    }
+    emit(&self, "\n");
+  }
+  *length = self.length;
+  return self.text;
+}
+
+// Parsing
+
+static void parse_inline_nodes(TSParser *inline_parser, TSSymbol inline_symbol,
+                               const Document *document, TSTree *tree, Counts *counts) {
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  bool descend = true;
+  while (true) {
+    if (descend && ts_tree_cursor_goto_first_child(&cursor)) {
+      // moved down
+    } else if (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) break;
+      descend = false;
+      continue;
+    }
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    descend = ts_node_symbol(node) != inline_symbol;
+    if (!descend) {
+      uint32_t start = ts_node_start_byte(node);
+      TSTree *inline_tree = ts_parser_parse_string(
+        inline_parser, NULL, document->text + start, ts_node_end_byte(node) - start);
+      counts->nodes += ts_node_descendant_count(ts_tree_root_node(inline_tree)) - 1;
+      counts->tree_bytes += delete_tree(inline_tree);
+    }
+  }
+  ts_tree_cursor_delete(&cursor);
+}
+
+static Counts parse_input(TSParser *block, TSParser *inline_parser, TSSymbol inline_symbol,
+                          const Input *input) {
+  Counts counts = {0};
+  uint64_t calls = scanner_calls();
+  TSQuartoScannerCounters before;
+  inline_scanner_counters(&before, &(TSQuartoScannerCounters){0});
+  for (uint32_t i = 0; i < input->count; i++) {
+    const Document *document = &input->documents[i];
+    TSTree *tree = ts_parser_parse_string(input->is_inline ? inline_parser : block, NULL,
+                                          document->text, document->length);
+    counts.nodes += ts_node_descendant_count(ts_tree_root_node(tree));
+    if (!input->is_inline) {
+      parse_inline_nodes(inline_parser, inline_symbol, document, tree, &counts);
+    }
+    counts.tree_bytes += delete_tree(tree);
+  }
+  counts.scanner_calls = scanner_calls() - calls;
+  counts.has_inline_scanner = inline_scanner_counters(&counts.inline_scanner, &before);
+  return counts;
+}
+
+static long peak_rss_kb(void) {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+}
+
+static void print_string(const char *string) {
+  putchar('"');
+  for (; *string; string++) {
+    if (*string == '"' || *string == '\\') putchar('\\');
+    putchar(*string);
+  }
+  putchar('"');
+}
+
+/// The runtime logs "process version:N, version_count:M, ..." for each
+/// stack version it advances, version 0 first, so each of those is one
+/// step.
+static void log_stack_versions(void *payload, TSLogType type, const char *message) {
+  static const char prefix[] = "process version:0, version_count:";
+  Counts *counts = payload;
+  if (type != TSLogTypeParse || strncmp(message, prefix, sizeof(prefix) - 1) != 0) return;
+  uint32_t versions = (uint32_t)strtoul(message + sizeof(prefix) - 1, NULL, 10);
+  if (versions > counts->max_stack_versions) counts->max_stack_versions = versions;
+  counts->stack_versions += versions;
+  counts->steps++;
+}
+
+static void report(const Input *input, double seconds, Counts counts) {
+  double kb = input->bytes / 1024.0;
+  printf("{\"input\":");
+  print_string(input->name);
+  printf(",\"grammar\":\"%s\",\"documents\":%u,\"bytes\":%llu,\"seconds\":%.6f,"
+         "\"mb_per_s\":%.2f,\"ns_per_byte\":%.2f,\"nodes_per_kb\":%.1f,"
+         "\"tree_bytes_per_kb\":%.0f,\"scanner_calls_per_kb\":%.1f,\"peak_rss_kb\":%ld",
+         input->is_inline ? "inline" : "block", input->count,
+         (unsigned long long)input->bytes, seconds, input->bytes / seconds / 1e6,
+         seconds * 1e9 / input->bytes, counts.nodes / kb, counts.tree_bytes / kb,
+         counts.scanner_calls / kb, peak_rss_kb());
+  if (counts.has_inline_scanner) {
+    const TSQuartoScannerCounters *c = &counts.inline_scanner;
+    printf(",\"inline_scanner\":{\"scan_calls\":%llu,\"new_line_calls\":%llu,"
+           "\"star_calls\":%llu,\"under_calls\":%llu,\"advanced\":%llu,"
+           "\"backtracked\":%llu,\"peak_results\":%llu,\"serialized_bytes\":%llu,"
+           "\"deserialize_calls\":%llu}",
+           (unsigned long long)c->scan_calls, (unsigned long long)c->new_line_calls,
+           (unsigned long long)c->star_calls, (unsigned long long)c->under_calls,
+           (unsigned long long)c->advanced, (unsigned long long)c->backtracked,
+           (unsigned long long)c->peak_results, (unsigned long long)c->serialized_bytes,
+           (unsigned long long)c->deserialize_calls);
+  }
+  if (counts.steps > 0) {
+    printf(",\"max_stack_versions\":%u,\"avg_stack_versions\":%.3f", counts.max_stack_versions,
+           (double)counts.stack_versions / counts.steps);
+  }
+  printf("}\n");
+  fflush(stdout);
+}
+
+static Input *add_input(Input **inputs, uint32_t *count, char *name) {
+  *inputs = realloc(*inputs, (*count + 1) * sizeof(Input));
+  Input *input = &(*inputs)[(*count)++];
+  *input = (Input){name, false, NULL, 0, 0, NULL};
+  return input;
+}
+
+static bool add_file(Input **inputs, uint32_t *count, const char *path) {
+  uint32_t length;
+  char *text = read_file(path, &length);
+  if (!text) return false;
+  add_document(add_input(inputs, count, strdup(path)), text, length);
+  return true;
+}
+
+static Input *generated_input(Input **inputs, uint32_t *count, Kind kind, double megabytes,
+                              uint64_t seed) {
+  char name[64];
+  snprintf(name, sizeof(name), "%s:%g", kind == MIXED ? "generated" : kind_names[kind], megabytes);
+  uint32_t length;
+  char *text = generate(kind, (uint32_t)(megabytes * 1024 * 1024), seed, &length);
+  Input *input = add_input(inputs, count, strdup(name));
+  add_document(input, text, length);
+  return input;
+}
+
+/// `KIND` or `KIND:MB`, 1 MB by default
+static bool add_adversarial(Input **inputs, uint32_t *count, const char *value, uint64_t seed) {
+  const char *colon = strchr(value, ':');
+  int kind = find_kind(value, colon ? (size_t)(colon - value) : strlen(value));
+  double megabytes = colon ? atof(colon + 1) : 1;
+  if (kind < 0 || megabytes <= 0) return false;
+  generated_input(inputs, count, (Kind)kind, megabytes, seed);
+  return true;
+}
+
+static int usage(const char *program) {
+  fprintf(stderr,
+          "usage: %s [--repeats N] [--seed N] [--corpus DIR] [--inline-corpus DIR]\n"
+          "       [--file PATH] [--generated MB] [--adversarial KIND[:MB]]\n"
+          "       [--curve KIND|all] [--curve-max MB] [--edits N] [--edit-script PATH]\n"
+          "       [--stack-versions] [--outline]...\n"
+          "kinds:",
+          program);
+  for (int kind = 0; kind < KIND_COUNT; kind++) fprintf(stderr, " %s", kind_names[kind]);
+  fprintf(stderr, "\n");
+  return 2;
+}
+
+typedef struct {
+  TSParser *block;
+  TSParser *inline_parser;
+  TSSymbol inline_symbol;
+  int repeats;
+  bool stack_versions;
+  bool outline;
+} Bench;
+
+/// reports an input and returns its best time
+static double measure(const Bench *bench, const Input *input) {
+  Counts counts = {0};
+  double best = 1e9;
+  for (int repeat = 0; repeat < bench->repeats; repeat++) {
+    double start = now();
+    counts = parse_input(bench->block, bench->inline_parser, bench->inline_symbol, input);
+    double seconds = now() - start;
+    if (seconds < best) best = seconds;
+  }
+  if (bench->stack_versions) {
+    Counts versions = {0};
+    TSLogger logger = {&versions, log_stack_versions};
+    ts_parser_set_logger(bench->block, logger);
+    ts_parser_set_logger(bench->inline_parser, logger);
+    parse_input(bench->block, bench->inline_parser, bench->inline_symbol, input);
+    ts_parser_set_logger(bench->block, (TSLogger){NULL, NULL});
+    ts_parser_set_logger(bench->inline_parser, (TSLogger){NULL, NULL});
+    counts.max_stack_versions = versions.max_stack_versions;
+    counts.stack_versions = versions.stack_versions;
+    counts.steps = versions.steps;
+  }
+  report(input, best, counts);
+  return best;
+}
+
+/// times the outline of a document input against `parse_seconds`, its
+/// full parse. Returns whether the outline was flagged as slow.
+static bool measure_outline(const Bench *bench, const Input *input, double parse_seconds) {
+  uint64_t headings = 0;
+  double best = 1e9;
+  for (int repeat = 0; repeat < bench->repeats; repeat++) {
+    headings = 0;
+    double start = now();
+    for (uint32_t i = 0; i < input->count; i++) {
+      const Document *document = &input->documents[i];
+      headings += tree_sitter_quarto_outline(document->text, document->length, NULL, 0).heading_count;
+    }
+    double seconds = now() - start;
+    if (seconds < best) best = seconds;
+  }
+  double speedup = parse_seconds / best;
+  bool slow = speedup < OUTLINE_MIN_SPEEDUP;
+  printf("{\"input\":");
+  print_string(input->name);
+  printf(",\"headings\":%llu,\"outline_ns_per_byte\":%.2f,\"parse_ns_per_byte\":%.2f,"
+         "\"outline_speedup\":%.1f,\"slow\":%s}\n",
+         (unsigned long long)headings, best * 1e9 / input->bytes,
+         parse_seconds * 1e9 / input->bytes, speedup, slow ? "true" : "false");
+  fflush(stdout);
+  return slow;
+}
+
+static void free_inputs(Input *inputs, uint32_t count) {
+  for (uint32_t i = 0; i < count; i++) {
+    for (uint32_t j = 0; j < inputs[i].count; j++) free(inputs[i].documents[j].text);
+    free(inputs[i].documents);
+    free(inputs[i].name);
+  }
+  free(inputs);
+}
+
+/// measures a kind at doubling sizes up to `max_megabytes` and fits
+/// seconds = c * bytes^exponent by least squares on the logarithms.
+/// Returns whether the exponent shows superlinear growth.
+static bool run_curve(const Bench *bench, Kind kind, double max_megabytes, uint64_t seed) {
+  double sum_x = 0, sum_y = 0, sum_xx = 0, sum_xy = 0;
+  uint32_t points = 0;
+  for (double megabytes = CURVE_MIN_MB; megabytes <= max_megabytes; megabytes *= 2) {
+    Input *inputs = NULL;
+    uint32_t count = 0;
+    const Input *input = generated_input(&inputs, &count, kind, megabytes, seed);
+    double seconds = measure(bench, input);
+    double x = log((double)input->bytes), y = log(seconds);
+    free_inputs(inputs, count);
+    sum_x += x;
+    sum_y += y;
+    sum_xx += x * x;
+    sum_xy += x * y;
+    points++;
+    // a superlinear kind would take too long at the next size
+    if (seconds > CURVE_BUDGET_SECONDS) break;
+  }
+
+  double exponent = 0;
+  if (points >= 2) {
+    exponent = (points * sum_xy - sum_x * sum_y) / (points * sum_xx - sum_x * sum_x);
+  }
+  bool superlinear = exponent > SUPERLINEAR_EXPONENT;
+  printf("{\"curve\":\"%s\",\"sizes\":%u,\"exponent\":%.3f,\"superlinear\":%s}\n",
+         kind_names[kind], points, exponent, superlinear ? "true" : "false");
+  fflush(stdout);
+  return superlinear;
+}
+
+// Edits. A document is kept in a gap buffer, as an editor would, and read
+// by the parser in chunks of at most EDIT_CHUNK bytes, so the bytes it
+// reads after an edit show how much of the document was lexed again.
+
+typedef struct {
+  char *text;
+  uint32_t gap_start;
+  uint32_t gap_end;
+  uint32_t capacity;
+} GapBuffer;
+
+typedef struct {
+  const GapBuffer *buffer;
+  uint32_t start;
+  uint32_t end;
+  uint64_t bytes_read;
+} GapInput;
+
+typedef struct {
+  uint32_t start;
+  uint32_t old_length;
+  const char *text;
+  uint32_t length;
+} Edit;
+
+static uint32_t gap_length(const GapBuffer *self) {
+  return self->capacity - (self->gap_end - self->gap_start);
+}
+
+static char gap_byte(const GapBuffer *self, uint32_t byte) {
+  return self->text[byte < self->gap_start ? byte : byte + self->gap_end - self->gap_start];
+}
+
+static void gap_move(GapBuffer *self, uint32_t byte) {
+  if (byte < self->gap_start) {
+    uint32_t length = self->gap_start - byte;
+    memmove(self->text + self->gap_end - length, self->text + byte, length);
+    self->gap_start -= length;
+    self->gap_end -= length;
+  } else if (byte > self->gap_start) {
+    uint32_t length = byte - self->gap_start;
+    memmove(self->text + self->gap_start, self->text + self->gap_end, length);
+    self->gap_start += length;
+    self->gap_end += length;
+  }
+}
+
+static void gap_replace(GapBuffer *self, const Edit *edit) {
+  gap_move(self, edit->start);
+  self->gap_end += edit->old_length;
+  if (self->gap_end - self->gap_start < edit->length) {
+    uint32_t tail = self->capacity - self->gap_end;
+    uint32_t capacity = 2 * (self->capacity + edit->length);
+    self->text = realloc(self->text, capacity);
+    memmove(self->text + capacity - tail, self->text + self->gap_end, tail);
+    self->gap_end = capacity - tail;
+    self->capacity = capacity;
+  }
+  memcpy(self->text + self->gap_start, edit->text, edit->length);
+  self->gap_start += edit->length;
+}
+
+static const char *gap_read(void *payload, uint32_t byte, TSPoint point, uint32_t *bytes_read) {
+  GapInput *self = payload;
+  const GapBuffer *buffer = self->buffer;
+  uint32_t start = self->start + byte, end = self->end;
+  if (start >= end) {
+    *bytes_read = 0;
+    return "";
+  }
+  // offsets into the text around the gap
+  if (start < buffer->gap_start) {
+    if (end > buffer->gap_start) end = buffer->gap_start;
+  } else {
+    start += buffer->gap_end - buffer->gap_start;
+    end += buffer->gap_end - buffer->gap_start;
+  }
+  *bytes_read = end - start < EDIT_CHUNK ? end - start : EDIT_CHUNK;
+  self->bytes_read += *bytes_read;
+  return buffer->text + start;
+}
+
+static TSInput gap_input(GapInput *input) {
+  return (TSInput){.payload = input, .read = gap_read, .encoding = TSInputEncodingUTF8};
+}
+
+static void advance_point(TSPoint *point, const char *text, uint32_t length) {
+  const char *end = text + length;
+  for (const char *newline; (newline = memchr(text, '\n', end - text)); text = newline + 1) {
+    point->row++;
+    point->column = 0;
+  }
+  point->column += (uint32_t)(end - text);
+}
+
+static TSPoint gap_point(const GapBuffer *self, uint32_t byte) {
+  TSPoint point = {0, 0};
+  uint32_t before = byte < self->gap_start ? byte : self->gap_start;
+  advance_point(&point, self->text, before);
+  advance_point(&point, self->text + self->gap_end, byte - before);
+  return point;
+}
+
+static TSInputEdit input_edit(const GapBuffer *self, const Edit *edit) {
+  TSInputEdit input_edit = {
+    .start_byte = edit->start,
+    .old_end_byte = edit->start + edit->old_length,
+    .new_end_byte = edit->start + edit->length,
+    .start_point = gap_point(self, edit->start),
+  };
+  input_edit.old_end_point = gap_point(self, input_edit.old_end_byte);
+  input_edit.new_end_point = input_edit.start_point;
+  advance_point(&input_edit.new_end_point, edit->text, edit->length);
+  return input_edit;
+}
+
+// Synthetic typing sessions: mostly keystrokes at a cursor, with
+// backspaces, jumps to the end of another line, pasted paragraphs and `*`
+// toggled around the word at the cursor. The generator's text holds the
+// text of the current edit.
+
+typedef struct {
+  Generator generator;
+  uint32_t cursor;
+  const char *typing;
+} Session;
+
+static bool is_word_byte(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+}
+
+static void session_jump(Session *self, const GapBuffer *buffer) {
+  uint32_t length = gap_length(buffer);
+  self->cursor = length ? next_random(&self->generator, length) : 0;
+  while (self->cursor < length && gap_byte(buffer, self->cursor) != '\n') self->cursor++;
+  self->typing = "";
+}
+
+/// wraps the word at the cursor in `*`, or unwraps it
+static bool session_toggle(Session *self, const GapBuffer *buffer, Edit *edit) {
+  uint32_t length = gap_length(buffer), start = self->cursor, end = self->cursor;
+  while (start > 0 && is_word_byte(gap_byte(buffer, start - 1))) start--;
+  while (end < length && is_word_byte(gap_byte(buffer, end))) end++;
+  if (start == end || end - start > 64) return false;
+  char word[72];
+  for (uint32_t i = start; i < end; i++) word[i - start] = gap_byte(buffer, i);
+  word[end - start] = '\0';
+
+  Generator *generator = &self->generator;
+  generator->length = 0;
+  if (start > 0 && end < length && gap_byte(buffer, start - 1) == '*' &&
+      gap_byte(buffer, end) == '*') {
+    emit(generator, word);
+    *edit = (Edit){start - 1, end - start + 2, generator->text, generator->length};
+  } else {
+    emit(generator, "*");
+    emit(generator, word);
+    emit(generator, "*");
+    *edit = (Edit){start, end - start, generator->text, generator->length};
+  }
+  return true;
+}
+
+static void session_next(Session *self, const GapBuffer *buffer, Edit *edit) {
+  Generator *generator = &self->generator;
+  uint32_t action = next_random(generator, 100);
+  if (action < 2) {
+    generator->length = 0;
+    emit(generator, "\n\n");
+    for (uint32_t lines = 1 + next_random(generator, 6); lines > 0; lines--) {
+      emit_inline(generator, 3 + next_random(generator, 12));
+      emit(generator, "\n");
+    }
+    *edit = (Edit){self->cursor, 0, generator->text, generator->length};
+  } else if (action < 7 && session_toggle(self, buffer, edit)) {
+    // toggled
+  } else if (action < 15 && self->cursor > 0) {
+    uint32_t start = self->cursor - 1;
+    // not inside a UTF-8 sequence
+    while (start > 0 && (gap_byte(buffer, start) & 0xc0) == 0x80) start--;
+    *edit = (Edit){start, self->cursor - start, "", 0};
+  } else {
+    if (action >= 15 && action < 20) session_jump(self, buffer);
+    if (!*self->typing) {
+      self->typing = word(generator);
+      *edit = (Edit){self->cursor, 0, " ", 1};
+    } else {
+      *edit = (Edit){self->cursor, 0, self->typing++, 1};
+    }
+  }
+  self->cursor = edit->start + edit->length;
+}
+
+/// reads a recorded edit script: one edit per line, `START DELETED TEXT`,
+/// where TEXT is the rest of the line with `\n`, `\t` and `\\` escaped.
+/// Offsets are bytes of the document as edited so far. Lines starting
+/// with `#` are comments.
+static Edit *read_edit_script(const char *path, uint32_t *count) {
+  uint32_t length;
+  char *text = read_file(path, &length);
+  if (!text) return NULL;
+  Edit *edits = malloc(sizeof(Edit));
+  *count = 0;
+  for (char *line = text, *next; *line; line = next) {
+    char *end = strchr(line, '\n');
+    next = end ? end + 1 : line + strlen(line);
+    if (end) *end = '\0';
+    if (*line == '#' || *line == '\0') continue;
+    char *rest;
+    unsigned long start = strtoul(line, &rest, 10);
+    unsigned long old_length = strtoul(rest, &rest, 10);
+    if (*rest == ' ') rest++;
+    char *inserted = malloc(strlen(rest) + 1), *out = inserted;
+    for (; *rest; rest++) {
+      if (*rest == '\\' && rest[1]) {
+        rest++;
+        *out++ = *rest == 'n' ? '\n' : *rest == 't' ? '\t' : *rest;
+      } else {
+        *out++ = *rest;
+      }
+    }
+    edits = realloc(edits, (*count + 1) * sizeof(Edit));
+    edits[(*count)++] =
+      (Edit){(uint32_t)start, (uint32_t)old_length, inserted, (uint32_t)(out - inserted)};
+  }
+  free(text);
+  return edits;
+}
+
+/// reparses each `inline` node below the cursor's node that overlaps
+/// [start, end]
+static void reparse_inline_nodes(TSParser *inline_parser, TSSymbol inline_symbol,
+                                 TSTreeCursor *cursor, GapInput *input, uint32_t start,
+                                 uint32_t end) {
+  if (ts_tree_cursor_goto_first_child_for_byte(cursor, start) < 0) return;
+  do {
+    TSNode node = ts_tree_cursor_current_node(cursor);
+    if (ts_node_start_byte(node) > end) break;
+    if (ts_node_symbol(node) == inline_symbol) {
+      GapInput inline_input = {input->buffer, ts_node_start_byte(node), ts_node_end_byte(node), 0};
+      ts_tree_delete(ts_parser_parse(inline_parser, NULL, gap_input(&inline_input)));
+      input->bytes_read += inline_input.bytes_read;
+    } else {
+      reparse_inline_nodes(inline_parser, inline_symbol, cursor, input, start, end);
+    }
+  } while (ts_tree_cursor_goto_next_sibling(cursor));
+  ts_tree_cursor_goto_parent(cursor);
+}
+
+static int compare_doubles(const void *a, const void *b) {
+  double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+/// replays `count` edits on a document, from `script` or from a synthetic
+/// session, timing each edit and reparse of the block tree and the inline
+/// nodes it touches
+static bool replay_edits(const Bench *bench, const Input *input, const Edit *script,
+                         uint32_t count, uint64_t seed) {
+  const Document *document = &input->documents[0];
+  GapBuffer buffer = {malloc(document->length), document->length, document->length,
+                      document->length};
+  memcpy(buffer.text, document->text, document->length);
+  Session session = {{NULL, 0, 0, 0, seed ? seed : DEFAULT_SEED}, 0, ""};
+  session_jump(&session, &buffer);
+
+  GapInput gap = {&buffer, 0, gap_length(&buffer), 0};
+  TSTree *tree = ts_parser_parse(bench->block, NULL, gap_input(&gap));
+  double *latencies = malloc(count * sizeof(double));
+  uint64_t bytes_read = 0, most_bytes_read = 0, calls = scanner_calls();
+  uint32_t done = 0;
+  for (; done < count; done++) {
+    Edit edit;
+    if (script) {
+      edit = script[done];
+      if (edit.start + edit.old_length > gap_length(&buffer)) {
+        fprintf(stderr, "%s: edit %u is past the end of the document\n", input->name, done + 1);
+        break;
+      }
+    } else {
+      session_next(&session, &buffer, &edit);
+    }
+    TSInputEdit change = input_edit(&buffer, &edit);
+    gap_replace(&buffer, &edit);
+    gap = (GapInput){&buffer, 0, gap_length(&buffer), 0};
+
+    double start = now();
+    ts_tree_edit(tree, &change);
+    TSTree *edited = ts_parser_parse(bench->block, tree, gap_input(&gap));
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(edited));
+    reparse_inline_nodes(bench->inline_parser, bench->inline_symbol, &cursor, &gap,
+                         change.start_byte, change.new_end_byte);
+    latencies[done] = now() - start;
+
+    ts_tree_cursor_delete(&cursor);
+    ts_tree_delete(tree);
+    tree = edited;
+    bytes_read += gap.bytes_read;
+    if (gap.bytes_read > most_bytes_read) most_bytes_read = gap.bytes_read;
+  }
+  calls = scanner_calls() - calls;
+
+  if (done > 0) {
+    qsort(latencies, done, sizeof(double), compare_doubles);
+    printf("{\"input\":");
+    print_string(input->name);
+    printf(",\"edits\":%u,\"source\":\"%s\",\"p50_us\":%.1f,\"p99_us\":%.1f,\"max_us\":%.1f,"
+           "\"relexed_bytes_per_edit\":%.1f,\"relexed_bytes_max\":%llu,"
+           "\"scanner_calls_per_edit\":%.1f}\n",
+           done, script ? "script" : "synthetic", latencies[(done - 1) / 2] * 1e6,
+           latencies[(uint32_t)((done - 1) * 0.99)] * 1e6, latencies[done - 1] * 1e6,
+           (double)bytes_read / done, (unsigned long long)most_bytes_read,
+           (double)calls / done);
+    fflush(stdout);
+  }
+  ts_tree_delete(tree);
+  free(latencies);
+  free(session.generator.text);
+  free(buffer.text);
+  return done == count;
+}
+
+int main(int argc, char **argv) {
+  Input *inputs = NULL;
+  uint32_t count = 0;
+  int repeats = DEFAULT_REPEATS;
+  uint64_t seed = DEFAULT_SEED;
+  bool curves[KIND_COUNT] = {false};
+  bool any_curve = false;
+  double curve_max = DEFAULT_CURVE_MAX_MB;
+  uint32_t edits = 0;
+  bool stack_versions = false;
+  bool outline = false;
+
+  // the seed applies to the generated inputs after it, and to all curves
+  // and synthetic edits. An edit script applies to the input before it.
+  for (int i = 1; i < argc; i++) {
+    const char *option = argv[i];
+    if (strcmp(option, "--stack-versions") == 0) {
+      stack_versions = true;
+      continue;
+    }
+    if (strcmp(option, "--outline") == 0) {
+      outline = true;
+      continue;
+    }
+    if (i + 1 == argc) return usage(argv[0]);
+    const char *value = argv[++i];
+    bool ok = true;
+    if (strcmp(option, "--repeats") == 0) {
+      repeats = atoi(value);
+      ok = repeats > 0;
+    } else if (strcmp(option, "--seed") == 0) {
+      seed = strtoull(value, NULL, 10);
+    } else if (strcmp(option, "--corpus") == 0) {
+      ok = read_corpus(&inputs, &count, value, false);
+    } else if (strcmp(option, "--inline-corpus") == 0) {
+      ok = read_corpus(&inputs, &count, value, true);
+    } else if (strcmp(option, "--file") == 0) {
+      ok = add_file(&inputs, &count, value);
+    } else if (strcmp(option, "--generated") == 0) {
+      ok = atof(value) > 0;
+      if (ok) generated_input(&inputs, &count, MIXED, atof(value), seed);
+    } else if (strcmp(option, "--adversarial") == 0) {
+      ok = add_adversarial(&inputs, &count, value, seed);
+    } else if (strcmp(option, "--curve") == 0) {
+      int kind = find_kind(value, strlen(value));
+      ok = kind >= 0 || strcmp(value, "all") == 0;
+      for (int k = 0; k < KIND_COUNT; k++) curves[k] |= kind < 0 || k == kind;
+      any_curve |= ok;
+    } else if (strcmp(option, "--curve-max") == 0) {
+      curve_max = atof(value);
+      ok = curve_max >= CURVE_MIN_MB;
+    } else if (strcmp(option, "--edits") == 0) {
+      edits = (uint32_t)strtoul(value, NULL, 10);
+    } else if (strcmp(option, "--edit-script") == 0) {
+      ok = count > 0 && !inputs[count - 1].is_inline && inputs[count - 1].count == 1;
+      if (ok) inputs[count - 1].edit_script = value;
+    } else {
+      return usage(argv[0]);
+    }
+    if (!ok) {
+      fprintf(stderr, "%s: bad value or unreadable input %s\n", option, value);
+      return 2;
+    }
+  }
+
+  if (count == 0 && !any_curve) {
+    const char *source_dir = QUARTO_SOURCE_DIR;
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/test/corpus", source_dir);
+    read_corpus(&inputs, &count, path, false);
+    snprintf(path, sizeof(path), "%s/inline/test/corpus", source_dir);
+    read_corpus(&inputs, &count, path, true);
+    snprintf(path, sizeof(path), "%s/example-file.qmd", source_dir);
+    add_file(&inputs, &count, path);
+    snprintf(path, sizeof(path), "%s/simple.qmd", source_dir);
+    add_file(&inputs, &count, path);
+    generated_input(&inputs, &count, MIXED, 1, seed);
+    generated_input(&inputs, &count, MIXED, 10, seed);
+    generated_input(&inputs, &count, MATH, 1, seed);
+    generated_input(&inputs, &count, BRACKETS, 100000 / (1024.0 * 1024), seed);
+  }
+
+  ts_set_allocator(count_malloc, count_calloc, count_realloc, count_free);
+  const TSLanguage *block_language = count_scanner_calls(0, tree_sitter_quarto());
+  Bench bench = {ts_parser_new(), ts_parser_new(), 0, repeats, stack_versions, outline};
+  ts_parser_set_language(bench.block, block_language);
+  ts_parser_set_language(bench.inline_parser, count_scanner_calls(1, tree_sitter_quarto_inline()));
+  bench.inline_symbol =
+    ts_language_symbol_for_name(block_language, "inline", sizeof("inline") - 1, true);
+
+  bool failed = false;
+  for (uint32_t i = 0; i < count; i++) {
+    if (inputs[i].bytes == 0) continue;
+    double seconds = measure(&bench, &inputs[i]);
+    if (outline && !inputs[i].is_inline) failed |= measure_outline(&bench, &inputs[i], seconds);
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    const Input *input = &inputs[i];
+    if (input->is_inline || input->count != 1) continue;
+    if (input->edit_script) {
+      uint32_t script_length;
+      Edit *script = read_edit_script(input->edit_script, &script_length);
+      if (!script) {
+        fprintf(stderr, "--edit-script: unreadable script %s\n", input->edit_script);
+        failed = true;
+        continue;
+      }
+      failed |= !replay_edits(&bench, input, script, script_length, seed);
+      for (uint32_t j = 0; j < script_length; j++) free((char *)script[j].text);
+      free(script);
+    } else if (edits > 0) {
+      failed |= !replay_edits(&bench, input, NULL, edits, seed);
+    }
+  }
+  for (int kind = 0; kind < KIND_COUNT; kind++) {
+    if (curves[kind]) failed |= run_curve(&bench, (Kind)kind, curve_max, seed);
+  }
+
+  ts_parser_delete(bench.block);
+  ts_parser_delete(bench.inline_parser);
+  free_inputs(inputs, count);
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,57 @@
+"""Before and after numbers of two quarto-bench runs.
+
+    quarto-bench > before.jsonl    # built at the revision before a change
+    quarto-bench > after.jsonl
+    python bench/quarto_compare.py before.jsonl after.jsonl
+
+Prints one JSON object per line for each input measured by both runs,
+with the old and new parse time, node count and tree memory, and the
+change of each. A metric the older quarto-bench did not report is null.
+"""
+
+import json
+import sys
+from argparse import ArgumentParser
+
+METRICS = ["ns_per_byte", "nodes_per_kb", "tree_bytes_per_kb"]
+
+
+def read_run(path):
+    """the throughput objects of a run, keyed by input"""
+    results = {}
+    with open(path) as file:
+        for line in file:
+            line = line.strip()
+            if not line.startswith("{"):
+                continue
+            result = json.loads(line)
+            if "input" in result and "ns_per_byte" in result:
+                results[result["input"]] = result
+    return results
+
+
+def compare(old, new):
+    for name in [name for name in old if name in new]:
+        comparison = {"input": name}
+        for metric in METRICS:
+            before, after = old[name].get(metric), new[name].get(metric)
+            comparison[f"old_{metric}"] = before
+            comparison[f"new_{metric}"] = after
+            comparison[f"{metric}_change"] = (
+                round(after / before - 1, 4) if before and after is not None else None)
+        print(json.dumps(comparison))
+
+
+def main():
+    arguments = ArgumentParser()
+    arguments.add_argument("old")
+    arguments.add_argument("new")
+    options = arguments.parse_args()
+    old, new = read_run(options.old), read_run(options.new)
+    if not old.keys() & new.keys():
+        sys.exit("no input was measured by both runs")
+    compare(old, new)
+
+
+if __name__ == "__main__":
+    main()
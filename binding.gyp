@@ -7,19 +7,34 @@
       ],
       "include_dirs": [
         "src",
+        "bindings/c",
       ],
       "sources": [
         "bindings/node/binding.cc",
+        "bindings/node/parse.cc",
+        "bindings/c/outline.c",
         "src/parser.c",
-        "src/scanner.c"
+        "src/scanner.c",
+        "inline/src/parser.c",
+        "inline/src/scanner.c"
       ],
       "variables": {
-        "has_scanner": "<!(node -p \"fs.existsSync('src/scanner.c')\")"
+        "has_scanner": "<!(node -p \"fs.existsSync('src/scanner.c')\")",
+        # parseAsync() only finds outlines without the tree-sitter runtime
+        "has_runtime": "<!(node -p \"try { require('child_process').execSync('pkg-config --exists tree-sitter'); true } catch (_) { false }\")"
       },
       "conditions": [
         ["has_scanner=='true'", {
           "sources+": ["src/scanner.c"],
         }],
+        ["has_runtime=='true'", {
+          "defines": ["TREE_SITTER_QUARTO_RUNTIME"],
+          "sources+": ["bindings/c/spans.c"],
+          "include_dirs+": [
+            "<!@(node -p \"require('child_process').execSync('pkg-config --cflags-only-I tree-sitter').toString().replace(/-I/g, '')\")",
+          ],
+          "libraries+": ["<!@(pkg-config --libs tree-sitter)"],
+        }],
         ["OS!='win'", {
           "cflags_c": [
             "-std=c11",
@@ -0,0 +1,213 @@
+#include "tree_sitter/tree-sitter-quarto.h"
+
+#include <string.h>
+#include "heading.h"
+
+/// a TSLexer over a byte buffer, so the heading recognition of the block
+/// scanner can run without a parser. Lookahead is a byte rather than a
+/// code point, which is all the heading syntax needs.
+typedef struct {
+  TSLexer lexer;
+  const char *source;
+  uint32_t length;
+  uint32_t position;
+  uint32_t end;
+} BufferLexer;
+
+static void buffer_move(BufferLexer *self, uint32_t position) {
+  self->position = position;
+  self->lexer.lookahead = position < self->length ? (unsigned char)self->source[position] : 0;
+}
+
+/// starts a new token at `position`
+static void buffer_seek(BufferLexer *self, uint32_t position) {
+  buffer_move(self, position);
+  self->end = position;
+}
+
+static void buffer_advance(TSLexer *lexer, bool skip) {
+  (void)skip;
+  BufferLexer *self = (BufferLexer *)lexer;
+  if (self->position < self->length) {
+    // the token end only moves on mark_end()
+    buffer_move(self, self->position + 1);
+  }
+}
+
+static void buffer_mark_end(TSLexer *lexer) {
+  BufferLexer *self = (BufferLexer *)lexer;
+  self->end = self->position;
+}
+
+static uint32_t buffer_get_column(TSLexer *lexer) {
+  (void)lexer;
+  return 0;
+}
+
+static bool buffer_is_at_included_range_start(const TSLexer *lexer) {
+  (void)lexer;
+  return false;
+}
+
+static bool buffer_eof(const TSLexer *lexer) {
+  const BufferLexer *self = (const BufferLexer *)lexer;
+  return self->position >= self->length;
+}
+
+/// returns the offset of the next line, just past its '\n'
+static uint32_t next_line(const char *source, uint32_t length, uint32_t position) {
+  const char *newline = memchr(source + position, '\n', length - position);
+  return newline ? (uint32_t)(newline - source) + 1 : length;
+}
+
+static uint32_t skip_blanks(const char *source, uint32_t end, uint32_t position) {
+  while (position < end && is_blank((unsigned char)source[position])) {
+    position++;
+  }
+  return position;
+}
+
+static uint32_t trim_end(const char *source, uint32_t start, uint32_t end) {
+  while (end > start && (is_blank((unsigned char)source[end - 1]) || source[end - 1] == '\n')) {
+    end--;
+  }
+  return end;
+}
+
+/// reads the front matter starting at line `position`, which is a `---`
+/// line, and fills in the title. Returns the offset after the front
+/// matter, or `position` if the `---` does not open one.
+static uint32_t scan_front_matter(const char *source, uint32_t length, uint32_t position,
+                                  TSQuartoOutline *outline) {
+  uint32_t line = next_line(source, length, position);
+  if (trim_end(source, position, line) != position + 3) {
+    return position;
+  }
+  while (line < length) {
+    uint32_t end = next_line(source, length, line);
+    uint32_t text_end = trim_end(source, line, end);
+    if (text_end == line + 3 &&
+        (memcmp(source + line, "---", 3) == 0 || memcmp(source + line, "...", 3) == 0)) {
+      return end;
+    }
+    if (text_end - line > 6 && memcmp(source + line, "title:", 6) == 0) {
+      uint32_t start = skip_blanks(source, text_end, line + 6);
+      if (text_end - start >= 2 && (source[start] == '"' || source[start] == '\'') &&
+          source[text_end - 1] == source[start]) {
+        start++;
+        text_end--;
+      }
+      outline->title_start_byte = start;
+      outline->title_end_byte = text_end;
+    }
+    line = end;
+  }
+  // never closed, so not front matter after all
+  outline->title_start_byte = outline->title_end_byte = 0;
+  return position;
+}
+
+/// splits a trailing `{...}` off the heading text
+static void split_attributes(const char *source, TSQuartoHeading *heading) {
+  uint32_t end = heading->end_byte;
+  heading->attribute_start_byte = heading->attribute_end_byte = end;
+  if (end == heading->start_byte || source[end - 1] != '}') {
+    return;
+  }
+  for (uint32_t brace = end - 1; brace > heading->start_byte; brace--) {
+    if (source[brace - 1] == '{') {
+      heading->attribute_start_byte = brace - 1;
+      heading->end_byte = trim_end(source, heading->start_byte, brace - 1);
+      return;
+    }
+  }
+}
+
+static void add_heading(TSQuartoOutline *outline, TSQuartoHeading *headings, uint32_t count,
+                        const char *source, uint8_t level, uint32_t start, uint32_t end) {
+  if (outline->heading_count < count) {
+    TSQuartoHeading *heading = &headings[outline->heading_count];
+    *heading = (TSQuartoHeading){level, start, end, end, end};
+    split_attributes(source, heading);
+  }
+  outline->heading_count++;
+}
+
+TSQuartoOutline tree_sitter_quarto_outline(
+  const char *source,
+  uint32_t length,
+  TSQuartoHeading *headings,
+  uint32_t count
+) {
+  TSQuartoOutline outline = {0, 0, 0};
+  BufferLexer buffer = {
+    .lexer = {
+      .advance = buffer_advance,
+      .mark_end = buffer_mark_end,
+      .get_column = buffer_get_column,
+      .is_at_included_range_start = buffer_is_at_included_range_start,
+      .eof = buffer_eof,
+    },
+    .source = source,
+    .length = length,
+  };
+  TSLexer *lexer = &buffer.lexer;
+
+  uint32_t line = 0;
+  if (length >= 3 && memcmp(source, "---", 3) == 0) {
+    line = scan_front_matter(source, length, 0, &outline);
+  }
+
+  // the first line of the paragraph being read, a setext heading's text
+  // if the next line underlines it
+  bool in_paragraph = false;
+  uint32_t first_line = 0, first_line_end = 0;
+  while (line < length) {
+    uint32_t end = next_line(source, length, line);
+    uint32_t start = skip_blanks(source, end, line);
+    if (start == end || source[start] == '\n') {
+      in_paragraph = false;
+      line = end;
+      continue;
+    }
+
+    buffer_seek(&buffer, start);
+    if (source[start] == '#') {
+      uint8_t level = scan_atx_marker(lexer);
+      if (level > 0) {
+        uint32_t text = skip_blanks(source, end, buffer.position);
+        buffer_seek(&buffer, text);
+        scan_atx_heading_text(lexer);
+        add_heading(&outline, headings, count, source, level, text, buffer.end);
+        in_paragraph = false;
+        line = end;
+        continue;
+      }
+      buffer_seek(&buffer, start);
+    }
+
+    // as in scan_paragraph, an underline must start at the beginning of
+    // its line, an indented one is paragraph text
+    if (in_paragraph && first_line_end > first_line) {
+      buffer_seek(&buffer, line);
+      uint8_t level = scan_setext_underline(lexer);
+      if (level > 0) {
+        add_heading(&outline, headings, count, source, level, first_line, first_line_end);
+        in_paragraph = false;
+        line = end;
+        continue;
+      }
+    }
+
+    // paragraph text, only its first line is kept
+    if (in_paragraph) {
+      first_line = first_line_end = 0;
+    } else {
+      in_paragraph = true;
+      first_line = start;
+      first_line_end = trim_end(source, start, end);
+    }
+    line = end;
+  }
+  return outline;
+}
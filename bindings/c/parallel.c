@@ -0,0 +1,206 @@
+#include "tree_sitter/tree-sitter-quarto.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <tree_sitter/api.h>
+
+// sections smaller than this are merged with the next, so that tiny
+// sections do not each pay for a parse
+#define MIN_SECTION_BYTES (16 * 1024)
+// sections per thread, to even out sections of different sizes
+#define SECTIONS_PER_THREAD 4
+
+typedef struct {
+  TSRange range;
+  TSTree *tree;
+} Section;
+
+struct TSQuartoDocument {
+  Section *sections;
+  uint32_t section_count;
+  const char *source;
+  uint32_t length;
+  atomic_uint next;
+};
+
+/// returns the offset of the line holding `position`
+static uint32_t line_start(const char *source, uint32_t position) {
+  while (position > 0 && source[position - 1] != '\n') {
+    position--;
+  }
+  return position;
+}
+
+/// true if the heading has a '#' marker before its text. Setext headings
+/// are not split at: whether a line is one depends on the lines before
+/// it, so only ATX headings are boundaries on their own.
+static bool is_atx(const char *source, uint32_t line, const TSQuartoHeading *heading) {
+  while (source[line] == ' ' || source[line] == '\t') {
+    line++;
+  }
+  return source[line] == '#' && heading->start_byte > line;
+}
+
+static uint32_t count_lines(const char *source, uint32_t start, uint32_t end) {
+  uint32_t rows = 0;
+  const char *newline;
+  while (start < end && (newline = memchr(source + start, '\n', end - start))) {
+    rows++;
+    start = (uint32_t)(newline - source) + 1;
+  }
+  return rows;
+}
+
+/// splits the document at the lines that start ATX headings, which are
+/// boundaries between the children of `source_file` unless two or more
+/// blank lines come before them, see tree-sitter-quarto.h. The block
+/// scanner keeps no state, so each section otherwise parses the same on
+/// its own. Sections are merged up to a target size derived from the
+/// thread count.
+static bool split_sections(TSQuartoDocument *self, uint32_t thread_count) {
+  const char *source = self->source;
+  uint32_t length = self->length;
+  // a guess that fits most documents, so the outline is read once
+  uint32_t capacity = length / 256 + 64;
+  TSQuartoHeading *headings = malloc(capacity * sizeof(TSQuartoHeading));
+  if (!headings) return false;
+  uint32_t heading_count = tree_sitter_quarto_outline(source, length, headings, capacity).heading_count;
+  if (heading_count > capacity) {
+    free(headings);
+    headings = malloc(heading_count * sizeof(TSQuartoHeading));
+    if (!headings) return false;
+    tree_sitter_quarto_outline(source, length, headings, heading_count);
+  }
+  self->sections = malloc((heading_count + 1) * sizeof(Section));
+  if (!self->sections) {
+    free(headings);
+    return false;
+  }
+
+  uint32_t target = length / (thread_count * SECTIONS_PER_THREAD);
+  if (target < MIN_SECTION_BYTES) target = MIN_SECTION_BYTES;
+
+  uint32_t start = 0, row = 0;
+  for (uint32_t i = 0; i <= heading_count; i++) {
+    uint32_t end = length;
+    if (i < heading_count) {
+      end = line_start(source, headings[i].start_byte);
+      if (end - start < target || !is_atx(source, end, &headings[i])) {
+        continue;
+      }
+    }
+    uint32_t rows = count_lines(source, start, end);
+    uint32_t column = 0;
+    if (end == length) {
+      column = end - line_start(source, end);
+    }
+    self->sections[self->section_count++] = (Section){
+      .range = {
+        .start_point = {row, 0},
+        .end_point = {row + rows, column},
+        .start_byte = start,
+        .end_byte = end,
+      },
+    };
+    start = end;
+    row += rows;
+  }
+  free(headings);
+  return true;
+}
+
+static void *parse_sections(void *payload) {
+  TSQuartoDocument *self = payload;
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_quarto());
+  while (true) {
+    uint32_t i = atomic_fetch_add(&self->next, 1);
+    if (i >= self->section_count) break;
+    Section *section = &self->sections[i];
+    ts_parser_set_included_ranges(parser, &section->range, 1);
+    section->tree = ts_parser_parse_string(parser, NULL, self->source, self->length);
+  }
+  ts_parser_delete(parser);
+  return NULL;
+}
+
+TSQuartoDocument *tree_sitter_quarto_parse_parallel(
+  const char *source,
+  uint32_t length,
+  uint32_t thread_count
+) {
+  TSQuartoDocument *self = calloc(1, sizeof(TSQuartoDocument));
+  if (!self) return NULL;
+  if (thread_count == 0) thread_count = 1;
+  self->source = source;
+  self->length = length;
+  atomic_init(&self->next, 0);
+  if (!split_sections(self, thread_count)) {
+    tree_sitter_quarto_document_delete(self);
+    return NULL;
+  }
+
+  // the calling thread is one of the workers
+  if (thread_count > self->section_count) thread_count = self->section_count;
+  pthread_t *threads = calloc(thread_count, sizeof(pthread_t));
+  uint32_t started = 0;
+  while (threads && started + 1 < thread_count &&
+         pthread_create(&threads[started], NULL, parse_sections, self) == 0) {
+    started++;
+  }
+  parse_sections(self);
+  for (uint32_t i = 0; i < started; i++) {
+    pthread_join(threads[i], NULL);
+  }
+  free(threads);
+
+  for (uint32_t i = 0; i < self->section_count; i++) {
+    if (!self->sections[i].tree) {
+      tree_sitter_quarto_document_delete(self);
+      return NULL;
+    }
+  }
+  self->source = NULL;
+  return self;
+}
+
+void tree_sitter_quarto_document_delete(TSQuartoDocument *self) {
+  if (!self) return;
+  for (uint32_t i = 0; i < self->section_count; i++) {
+    if (self->sections[i].tree) ts_tree_delete(self->sections[i].tree);
+  }
+  free(self->sections);
+  free(self);
+}
+
+uint32_t tree_sitter_quarto_document_section_count(const TSQuartoDocument *self) {
+  return self->section_count;
+}
+
+const TSTree *tree_sitter_quarto_document_section(
+  const TSQuartoDocument *self,
+  uint32_t index,
+  uint32_t *start_byte,
+  uint32_t *end_byte
+) {
+  if (index >= self->section_count) return NULL;
+  const Section *section = &self->sections[index];
+  if (start_byte) *start_byte = section->range.start_byte;
+  if (end_byte) *end_byte = section->range.end_byte;
+  return section->tree;
+}
+
+uint32_t tree_sitter_quarto_document_section_at(const TSQuartoDocument *self, uint32_t byte) {
+  uint32_t low = 0, high = self->section_count;
+  while (high - low > 1) {
+    uint32_t middle = low + (high - low) / 2;
+    if (self->sections[middle].range.start_byte <= byte) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
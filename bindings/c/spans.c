@@ -0,0 +1,142 @@
+#include "tree_sitter/tree-sitter-quarto.h"
+
+#include <stdlib.h>
+#include <tree_sitter/api.h>
+
+typedef struct {
+  TSQuartoSpanTable *table;
+  const char *source;
+  TSParser *inline_parser;
+  TSSymbol inline_symbol;
+  // added to the symbols of the inline grammar
+  uint16_t inline_offset;
+} Walk;
+
+static bool add_span(TSQuartoSpanTable *table, TSNode node, uint16_t symbol_offset,
+                     uint32_t depth, uint32_t offset) {
+  if (table->count == table->capacity) {
+    uint32_t capacity = table->capacity ? 2 * table->capacity : 256;
+    TSQuartoSpan *spans = realloc(table->spans, capacity * sizeof(TSQuartoSpan));
+    if (!spans) return false;
+    table->spans = spans;
+    table->capacity = capacity;
+  }
+  table->spans[table->count++] = (TSQuartoSpan){
+    .symbol = ts_node_symbol(node) + symbol_offset,
+    .depth = depth,
+    .start_byte = offset + ts_node_start_byte(node),
+    .end_byte = offset + ts_node_end_byte(node),
+    .parent = -1,
+  };
+  return true;
+}
+
+/// adds the named descendants of the cursor's node in preorder, not the
+/// node itself. In the block tree, the text of each `inline` node is
+/// parsed and its nodes added below it.
+static bool add_spans(Walk *walk, TSTreeCursor *cursor, bool is_inline, uint32_t base_depth,
+                      uint32_t offset) {
+  uint16_t symbol_offset = is_inline ? walk->inline_offset : 0;
+  uint32_t depth = 0;
+  while (true) {
+    if (ts_tree_cursor_goto_first_child(cursor)) {
+      depth++;
+    } else {
+      while (!ts_tree_cursor_goto_next_sibling(cursor)) {
+        if (depth <= 1 || !ts_tree_cursor_goto_parent(cursor)) return true;
+        depth--;
+      }
+    }
+    TSNode node = ts_tree_cursor_current_node(cursor);
+    if (!ts_node_is_named(node)) continue;
+    if (!add_span(walk->table, node, symbol_offset, base_depth + depth, offset)) return false;
+
+    if (!is_inline && ts_node_symbol(node) == walk->inline_symbol) {
+      uint32_t start = ts_node_start_byte(node);
+      TSTree *tree = ts_parser_parse_string(walk->inline_parser, NULL, walk->source + start,
+                                            ts_node_end_byte(node) - start);
+      if (!tree) return false;
+      // the inline tree's root is the `inline` node again
+      TSTreeCursor inline_cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+      bool ok = add_spans(walk, &inline_cursor, true, base_depth + depth, start);
+      ts_tree_cursor_delete(&inline_cursor);
+      ts_tree_delete(tree);
+      if (!ok) return false;
+    }
+  }
+}
+
+/// a span's parent is the last span before it with a smaller depth, as
+/// the spans are in preorder
+static bool link_parents(TSQuartoSpanTable *table) {
+  int32_t *ancestors = malloc(table->count * sizeof(int32_t));
+  if (!ancestors) return false;
+  uint32_t count = 0;
+  for (uint32_t i = 0; i < table->count; i++) {
+    TSQuartoSpan *span = &table->spans[i];
+    while (count > 0 && table->spans[ancestors[count - 1]].depth >= span->depth) {
+      count--;
+    }
+    span->parent = count > 0 ? ancestors[count - 1] : -1;
+    ancestors[count++] = (int32_t)i;
+  }
+  free(ancestors);
+  return true;
+}
+
+bool tree_sitter_quarto_span_table_read(
+  TSQuartoSpanTable *self,
+  const TSTree *tree,
+  TSParser *inline_parser,
+  const char *source
+) {
+  const TSLanguage *block = tree_sitter_quarto();
+  Walk walk = {
+    .table = self,
+    .source = source,
+    .inline_parser = inline_parser,
+    .inline_symbol = ts_language_symbol_for_name(block, "inline", sizeof("inline") - 1, true),
+    .inline_offset = (uint16_t)ts_language_symbol_count(block),
+  };
+  self->count = 0;
+  TSNode root = ts_tree_root_node(tree);
+  TSTreeCursor cursor = ts_tree_cursor_new(root);
+  bool ok = add_span(self, root, 0, 0, 0) &&
+            add_spans(&walk, &cursor, false, 0, 0) &&
+            link_parents(self);
+  ts_tree_cursor_delete(&cursor);
+  return ok;
+}
+
+bool tree_sitter_quarto_span_table_parse(
+  TSQuartoSpanTable *self,
+  TSParser *parser,
+  TSParser *inline_parser,
+  const char *source,
+  uint32_t length
+) {
+  self->count = 0;
+  TSTree *tree = ts_parser_parse_string(parser, NULL, source, length);
+  if (!tree) return false;
+  bool ok = tree_sitter_quarto_span_table_read(self, tree, inline_parser, source);
+  ts_tree_delete(tree);
+  return ok;
+}
+
+void tree_sitter_quarto_span_table_delete(TSQuartoSpanTable *self) {
+  free(self->spans);
+  *self = (TSQuartoSpanTable){NULL, 0, 0};
+}
+
+uint32_t tree_sitter_quarto_span_type_count(void) {
+  return ts_language_symbol_count(tree_sitter_quarto()) +
+         ts_language_symbol_count(tree_sitter_quarto_inline());
+}
+
+const char *tree_sitter_quarto_span_type(uint16_t symbol) {
+  uint32_t block_count = ts_language_symbol_count(tree_sitter_quarto());
+  if (symbol < block_count) {
+    return ts_language_symbol_name(tree_sitter_quarto(), symbol);
+  }
+  return ts_language_symbol_name(tree_sitter_quarto_inline(), symbol - block_count);
+}
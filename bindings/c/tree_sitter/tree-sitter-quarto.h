@@ -1,7 +1,12 @@
 #ifndef TREE_SITTER_QUARTO_H_
 #define TREE_SITTER_QUARTO_H_
 
+#include <stdbool.h>
+#include <stdint.h>
+
 typedef struct TSLanguage TSLanguage;
+typedef struct TSParser TSParser;
+typedef struct TSTree TSTree;
 
 #ifdef __cplusplus
 extern "C" {
@@ -9,6 +14,239 @@ extern "C" {
 
 const TSLanguage *tree_sitter_quarto(void);
 
+// the grammar for the text of paragraphs and headings, see `inline/`
+const TSLanguage *tree_sitter_quarto_inline(void);
+
+// Outline parsing
+//
+// Finds the headings and the front matter title of a document without
+// parsing it. Only line starts are looked at: paragraph text and the rest
+// of the front matter are skipped a line at a time. Headings are
+// recognised the same way as by the block scanner, closing '#' run
+// included. Like the block grammar, the outline has no notion of code
+// cells, so a `#` comment line inside one is read as a heading.
+
+// a heading of the given level whose text is [start_byte, end_byte). A
+// trailing `{...}` attribute block is split off into
+// [attribute_start_byte, attribute_end_byte), which is empty if there is
+// none.
+typedef struct {
+  uint8_t level;
+  uint32_t start_byte;
+  uint32_t end_byte;
+  uint32_t attribute_start_byte;
+  uint32_t attribute_end_byte;
+} TSQuartoHeading;
+
+// the value of the front matter `title:` is [title_start_byte,
+// title_end_byte), without quotes, and empty if there is none.
+// heading_count is the number of headings in the document.
+typedef struct {
+  uint32_t title_start_byte;
+  uint32_t title_end_byte;
+  uint32_t heading_count;
+} TSQuartoOutline;
+
+// find the outline of `length` bytes of `source`, writing the first
+// `count` headings to `headings` in document order.
+TSQuartoOutline tree_sitter_quarto_outline(
+  const char *source,
+  uint32_t length,
+  TSQuartoHeading *headings,
+  uint32_t count
+);
+
+// Scanner counters
+//
+// Built with the TREE_SITTER_QUARTO_COUNTERS CMake option, the inline
+// scanner counts what it does, to tell why a document is slow to parse.
+// The counts are kept per thread, summed over every inline parser that
+// ran on it, and only grow from when the thread started: take the
+// difference of two reads around a parse. The inline scanner includes
+// this header for the struct, so both sides share one definition.
+
+typedef struct TSQuartoScannerCounters {
+  uint64_t scan_calls;
+  // lines pre-parsed for emphasis, links, spans and the like
+  uint64_t new_line_calls;
+  // calls of the `*` and `_` delimiter parsers
+  uint64_t star_calls;
+  uint64_t under_calls;
+  // characters the pre-parser moved forward over, and back over again
+  uint64_t advanced;
+  uint64_t backtracked;
+  // the most pre-parsed results held at once
+  uint64_t peak_results;
+  uint64_t serialized_bytes;
+  uint64_t deserialize_calls;
+} TSQuartoScannerCounters;
+
+// copy the counters of the calling thread to `counters`. Returns false,
+// with the counters zeroed, when they were not compiled in.
+bool tree_sitter_quarto_inline_scanner_counters(TSQuartoScannerCounters *counters);
+
+// Viewport inline parsing
+//
+// The functions below are in the `tree-sitter-quarto2-viewport` library,
+// which is built with the TREE_SITTER_QUARTO_VIEWPORT CMake option and
+// links against the tree-sitter runtime.
+//
+// A document is parsed with `tree_sitter_quarto()` alone, which only finds
+// its paragraphs and headings. The text of those is parsed on demand, for
+// the part of the document that is on screen, and kept in a cache keyed
+// by the text, so scrolling back or editing another paragraph does not
+// parse it again.
+
+typedef struct TSQuartoInlineCache TSQuartoInlineCache;
+
+// an inline tree for the `inline` node covering [start_byte, end_byte)
+// of the document. The tree was parsed from that text alone, so its
+// positions are relative to start_byte.
+typedef struct {
+  const TSTree *tree;
+  uint32_t start_byte;
+  uint32_t end_byte;
+} TSQuartoInlineTree;
+
+// create a cache holding up to `capacity` inline trees, 0 for a default.
+// It grows past that when a single viewport needs more.
+TSQuartoInlineCache *tree_sitter_quarto_inline_cache_new(uint32_t capacity);
+
+void tree_sitter_quarto_inline_cache_delete(TSQuartoInlineCache *self);
+
+// find the `inline` nodes of `block_tree` that intersect
+// [start_byte, end_byte), in document order, and write an inline tree for
+// each of the first `count` of them to `trees`. `source` is the document
+// text `block_tree` was parsed from. Returns the number of nodes found,
+// which may be larger than `count`.
+//
+// The trees belong to the cache and stay valid until the next call with
+// the same cache; use `ts_tree_copy()` to keep one longer. Returns 0 if an
+// inline tree could not be parsed.
+uint32_t tree_sitter_quarto_inline_trees(
+  TSQuartoInlineCache *self,
+  const TSTree *block_tree,
+  const char *source,
+  uint32_t start_byte,
+  uint32_t end_byte,
+  TSQuartoInlineTree *trees,
+  uint32_t count
+);
+
+// Parallel parsing
+//
+// The functions below are in the `tree-sitter-quarto2-parallel` library,
+// which is built with the TREE_SITTER_QUARTO_PARALLEL CMake option and
+// links against the tree-sitter runtime and pthreads.
+//
+// A large document is split into sections at the lines starting ATX
+// headings, found with `tree_sitter_quarto_outline()`. The sections are
+// parsed at the same time and kept in document order. Each section's tree
+// is parsed with its byte range as the included range, so its positions
+// are positions in the whole document.
+//
+// Limitations:
+// - Only ATX headings split the document. One without them, or whose
+//   only headings are setext ones, is parsed as a single section on one
+//   thread.
+// - The result is a list of section trees, each with its own
+//   `source_file` root, not one tree of the document. Queries and
+//   cursors run on each section, and an edit means parsing again.
+// - A section tree is the subtree a whole-document parse would give,
+//   except around an ATX heading after two or more blank lines. The
+//   block grammar reads such a heading as a paragraph, but the section
+//   starting with it reads a heading, and the one before ends in blank
+//   lines with a missing `inline`.
+
+typedef struct TSQuartoDocument TSQuartoDocument;
+
+// parse `length` bytes of `source` using up to `thread_count` threads,
+// including the calling one. The source is not kept. Returns NULL if a
+// section could not be parsed.
+TSQuartoDocument *tree_sitter_quarto_parse_parallel(
+  const char *source,
+  uint32_t length,
+  uint32_t thread_count
+);
+
+void tree_sitter_quarto_document_delete(TSQuartoDocument *self);
+
+uint32_t tree_sitter_quarto_document_section_count(const TSQuartoDocument *self);
+
+// the tree of section `index`, which covers [start_byte, end_byte) of the
+// document. Either pointer may be NULL.
+const TSTree *tree_sitter_quarto_document_section(
+  const TSQuartoDocument *self,
+  uint32_t index,
+  uint32_t *start_byte,
+  uint32_t *end_byte
+);
+
+// the index of the section holding `byte`
+uint32_t tree_sitter_quarto_document_section_at(const TSQuartoDocument *self, uint32_t byte);
+
+// Span tables
+//
+// The functions below are in `bindings/c/spans.c`, which needs the
+// tree-sitter runtime. It is in the `tree-sitter-quarto2-viewport`
+// library, and the Python and Node bindings build it in when they find
+// the runtime.
+//
+// A span table lists the named nodes of a document in preorder, as plain
+// structs that are cheap to hand to another language. The text of each
+// `inline` node is parsed with the inline grammar and its nodes are
+// listed below it, with positions in the whole document.
+
+// `symbol` is a symbol of `tree_sitter_quarto()`, or one of
+// `tree_sitter_quarto_inline()` plus the symbol count of the former, see
+// `tree_sitter_quarto_span_type()`. `depth` counts anonymous ancestors
+// too. `parent` is the index of the closest named ancestor, -1 for the
+// root.
+typedef struct {
+  uint16_t symbol;
+  uint32_t depth;
+  uint32_t start_byte;
+  uint32_t end_byte;
+  int32_t parent;
+} TSQuartoSpan;
+
+// zero-initialize a table before its first use; it is reused by later
+// calls
+typedef struct {
+  TSQuartoSpan *spans;
+  uint32_t count;
+  uint32_t capacity;
+} TSQuartoSpanTable;
+
+// replace the contents of the table with the spans of `tree`, a tree of
+// `tree_sitter_quarto()` parsed from `source`. `inline_parser` must have
+// `tree_sitter_quarto_inline()` set. Returns false if an inline parse or
+// an allocation failed.
+bool tree_sitter_quarto_span_table_read(
+  TSQuartoSpanTable *self,
+  const TSTree *tree,
+  TSParser *inline_parser,
+  const char *source
+);
+
+// parse `length` bytes of `source` with `parser`, which must have
+// `tree_sitter_quarto()` set, and read the spans of the tree
+bool tree_sitter_quarto_span_table_parse(
+  TSQuartoSpanTable *self,
+  TSParser *parser,
+  TSParser *inline_parser,
+  const char *source,
+  uint32_t length
+);
+
+void tree_sitter_quarto_span_table_delete(TSQuartoSpanTable *self);
+
+// the number of span symbols, those of both grammars
+uint32_t tree_sitter_quarto_span_type_count(void);
+
+// the node type name of a span symbol
+const char *tree_sitter_quarto_span_type(uint16_t symbol);
+
 #ifdef __cplusplus
 }
 #endif
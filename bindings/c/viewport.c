@@ -0,0 +1,230 @@
+#include "tree_sitter/tree-sitter-quarto.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <tree_sitter/api.h>
+
+#define DEFAULT_CAPACITY 256
+#define NONE UINT32_MAX
+
+typedef struct {
+  uint64_t hash;
+  // a copy of the text the tree was parsed from
+  char *text;
+  uint32_t length;
+  TSTree *tree;
+  // the call that last returned this tree
+  uint64_t used;
+  // the next entry in the same bucket, or NONE
+  uint32_t next;
+  // the neighbours in the list of entries by last use, or NONE
+  uint32_t newer;
+  uint32_t older;
+} Entry;
+
+struct TSQuartoInlineCache {
+  TSParser *parser;
+  Entry *entries;
+  uint32_t size;
+  uint32_t capacity;
+  // the first entry of each chain of entries by hash, with at least twice
+  // as many buckets as entries
+  uint32_t *buckets;
+  uint32_t bucket_mask;
+  // the ends of the list of entries by last use
+  uint32_t newest;
+  uint32_t oldest;
+  uint64_t call;
+};
+
+/// FNV-1a, enough to tell apart the paragraphs of one document
+static uint64_t hash_text(const char *text, uint32_t length) {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (uint32_t i = 0; i < length; i++) {
+    hash ^= (unsigned char)text[i];
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+/// sizes the buckets for the capacity and chains every entry again
+static bool cache_rehash(TSQuartoInlineCache *self) {
+  uint32_t count = 1;
+  while (count < 2 * self->capacity) count *= 2;
+  uint32_t *buckets = realloc(self->buckets, count * sizeof(uint32_t));
+  if (!buckets) return false;
+  self->buckets = buckets;
+  self->bucket_mask = count - 1;
+  memset(self->buckets, 0xff, count * sizeof(uint32_t));
+  for (uint32_t i = 0; i < self->size; i++) {
+    uint32_t *bucket = &self->buckets[self->entries[i].hash & self->bucket_mask];
+    self->entries[i].next = *bucket;
+    *bucket = i;
+  }
+  return true;
+}
+
+TSQuartoInlineCache *tree_sitter_quarto_inline_cache_new(uint32_t capacity) {
+  TSQuartoInlineCache *self = calloc(1, sizeof(TSQuartoInlineCache));
+  if (!self) return NULL;
+  self->capacity = capacity > 0 ? capacity : DEFAULT_CAPACITY;
+  self->newest = self->oldest = NONE;
+  self->entries = calloc(self->capacity, sizeof(Entry));
+  self->parser = ts_parser_new();
+  if (!self->entries || !cache_rehash(self) || !self->parser ||
+      !ts_parser_set_language(self->parser, tree_sitter_quarto_inline())) {
+    tree_sitter_quarto_inline_cache_delete(self);
+    return NULL;
+  }
+  return self;
+}
+
+void tree_sitter_quarto_inline_cache_delete(TSQuartoInlineCache *self) {
+  if (!self) return;
+  for (uint32_t i = 0; i < self->size; i++) {
+    ts_tree_delete(self->entries[i].tree);
+    free(self->entries[i].text);
+  }
+  if (self->parser) ts_parser_delete(self->parser);
+  free(self->entries);
+  free(self->buckets);
+  free(self);
+}
+
+/// removes the entry at `index` from its bucket's chain
+static void cache_unlink(TSQuartoInlineCache *self, uint32_t index) {
+  uint32_t *link = &self->buckets[self->entries[index].hash & self->bucket_mask];
+  while (*link != index) link = &self->entries[*link].next;
+  *link = self->entries[index].next;
+}
+
+/// removes the entry at `index` from the list by last use
+static void cache_unlink_used(TSQuartoInlineCache *self, uint32_t index) {
+  Entry *entry = &self->entries[index];
+  if (entry->newer != NONE) self->entries[entry->newer].older = entry->older;
+  else self->newest = entry->older;
+  if (entry->older != NONE) self->entries[entry->older].newer = entry->newer;
+  else self->oldest = entry->newer;
+}
+
+/// puts the entry at `index` at the newest end of the list by last use
+static void cache_push_used(TSQuartoInlineCache *self, uint32_t index) {
+  Entry *entry = &self->entries[index];
+  entry->newer = NONE;
+  entry->older = self->newest;
+  if (self->newest != NONE) self->entries[self->newest].newer = index;
+  else self->oldest = index;
+  self->newest = index;
+}
+
+/// returns the index of a free entry, evicting the least recently used
+/// tree that was not returned by the current call, or growing the cache if
+/// all were. The list by last use makes the oldest entry the only one to
+/// look at. Returns NONE if the cache could not grow.
+static uint32_t cache_slot(TSQuartoInlineCache *self) {
+  if (self->size < self->capacity) {
+    return self->size++;
+  }
+  uint32_t oldest = self->oldest;
+  if (self->entries[oldest].used < self->call) {
+    cache_unlink(self, oldest);
+    cache_unlink_used(self, oldest);
+    ts_tree_delete(self->entries[oldest].tree);
+    free(self->entries[oldest].text);
+    return oldest;
+  }
+  Entry *entries = realloc(self->entries, 2 * self->capacity * sizeof(Entry));
+  if (!entries) return NONE;
+  self->entries = entries;
+  self->capacity *= 2;
+  if (!cache_rehash(self)) {
+    self->capacity /= 2;
+    return NONE;
+  }
+  return self->size++;
+}
+
+/// returns the inline tree for `length` bytes of `text`, parsing it if it
+/// is not in the cache. A tree is only returned for the same text, not
+/// just the same hash.
+static const TSTree *cache_get(TSQuartoInlineCache *self, const char *text, uint32_t length) {
+  uint64_t hash = hash_text(text, length);
+  for (uint32_t i = self->buckets[hash & self->bucket_mask]; i != NONE;
+       i = self->entries[i].next) {
+    Entry *entry = &self->entries[i];
+    if (entry->hash == hash && entry->length == length &&
+        memcmp(entry->text, text, length) == 0) {
+      entry->used = self->call;
+      cache_unlink_used(self, i);
+      cache_push_used(self, i);
+      return entry->tree;
+    }
+  }
+  TSTree *tree = ts_parser_parse_string(self->parser, NULL, text, length);
+  if (!tree) return NULL;
+  char *copy = malloc(length > 0 ? length : 1);
+  uint32_t index = copy ? cache_slot(self) : NONE;
+  if (index == NONE) {
+    free(copy);
+    ts_tree_delete(tree);
+    return NULL;
+  }
+  memcpy(copy, text, length);
+  uint32_t *bucket = &self->buckets[hash & self->bucket_mask];
+  self->entries[index] = (Entry){hash, copy, length, tree, self->call, *bucket, NONE, NONE};
+  *bucket = index;
+  cache_push_used(self, index);
+  return tree;
+}
+
+uint32_t tree_sitter_quarto_inline_trees(
+  TSQuartoInlineCache *self,
+  const TSTree *block_tree,
+  const char *source,
+  uint32_t start_byte,
+  uint32_t end_byte,
+  TSQuartoInlineTree *trees,
+  uint32_t count
+) {
+  self->call++;
+  const TSLanguage *language = ts_tree_language(block_tree);
+  TSSymbol inline_symbol = ts_language_symbol_for_name(language, "inline", 6, true);
+
+  // only the nodes intersecting the range are visited, the children
+  // before it are skipped by byte offset
+  uint32_t found = 0;
+  bool failed = false;
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(block_tree));
+  while (true) {
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    uint32_t node_start = ts_node_start_byte(node);
+    uint32_t node_end = ts_node_end_byte(node);
+    if (node_start >= end_byte) {
+      break;
+    }
+    if (node_end > start_byte) {
+      if (ts_node_symbol(node) == inline_symbol) {
+        if (found < count) {
+          const TSTree *tree = cache_get(self, source + node_start, node_end - node_start);
+          if (!tree) {
+            failed = true;
+            break;
+          }
+          trees[found] = (TSQuartoInlineTree){tree, node_start, node_end};
+        }
+        found++;
+      } else if (ts_tree_cursor_goto_first_child_for_byte(&cursor, start_byte) >= 0) {
+        continue;
+      }
+    }
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        goto done;
+      }
+    }
+  }
+done:
+  ts_tree_cursor_delete(&cursor);
+  return failed ? 0 : found;
+}
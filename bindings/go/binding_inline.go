@@ -0,0 +1,14 @@
+package tree_sitter_quarto
+
+// #cgo CFLAGS: -std=c11 -fPIC
+// #include "../../inline/src/parser.c"
+// #include "../../inline/src/scanner.c"
+import "C"
+
+import "unsafe"
+
+// Get the tree-sitter Language for the inline grammar, which parses the
+// text of the `inline` nodes produced by Language().
+func InlineLanguage() unsafe.Pointer {
+	return unsafe.Pointer(C.tree_sitter_quarto_inline())
+}
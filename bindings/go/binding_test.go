@@ -1,6 +1,12 @@
 package tree_sitter_quarto_test
 
 import (
+	"bytes"
+	"errors"
+	"os"
+	"reflect"
+	"runtime"
+	"strings"
 	"testing"
 
 	tree_sitter "github.com/tree-sitter/go-tree-sitter"
@@ -13,3 +19,196 @@ func TestCanLoadGrammar(t *testing.T) {
 		t.Errorf("Error loading Quarto grammar")
 	}
 }
+
+func TestCanLoadInlineGrammar(t *testing.T) {
+	language := tree_sitter.NewLanguage(tree_sitter_quarto.InlineLanguage())
+	if language == nil {
+		t.Errorf("Error loading Quarto inline grammar")
+	}
+}
+
+const document = "---\ntitle: \"A title\"\n---\n\n# One {#sec-one}\n\nText\n\nTwo\n---\n"
+
+func TestParseOutline(t *testing.T) {
+	outline, err := tree_sitter_quarto.ParseOutline([]byte(document))
+	if err != nil {
+		t.Fatal(err)
+	}
+	expected := tree_sitter_quarto.Outline{
+		Title: "A title",
+		Headings: []tree_sitter_quarto.Heading{
+			{Level: 1, Text: "One", Attributes: "{#sec-one}", StartByte: 28, EndByte: 31},
+			{Level: 2, Text: "Two", StartByte: 50, EndByte: 53},
+		},
+	}
+	if !reflect.DeepEqual(outline, expected) {
+		t.Errorf("got %+v, expected %+v", outline, expected)
+	}
+}
+
+func parseSpans(t testing.TB, source []byte) []tree_sitter_quarto.Span {
+	spans, err := tree_sitter_quarto.ParseSpans(source)
+	if errors.Is(err, tree_sitter_quarto.ErrNoRuntime) {
+		t.Skip("built without the tree-sitter runtime")
+	}
+	if err != nil {
+		t.Fatal(err)
+	}
+	return spans
+}
+
+func TestParseSpans(t *testing.T) {
+	spans := parseSpans(t, []byte("# One\n"))
+	types := tree_sitter_quarto.SpanTypes()
+	root := spans[0]
+	if types[root.Symbol] != "source_file" || root.StartByte != 0 || root.EndByte != 6 || root.Parent != -1 {
+		t.Errorf("unexpected root %+v", root)
+	}
+	found := false
+	for _, span := range spans {
+		found = found || types[span.Symbol] == "inline"
+	}
+	if !found {
+		t.Errorf("no inline span in %+v", spans)
+	}
+}
+
+func TestParseBatch(t *testing.T) {
+	documents := make([][]byte, 100)
+	for i := range documents {
+		documents[i] = []byte(document + strings.Repeat("word ", i))
+	}
+	results := tree_sitter_quarto.ParseBatch(documents, 4)
+	for i, result := range results {
+		if errors.Is(result.Err, tree_sitter_quarto.ErrNoRuntime) {
+			t.Skip("built without the tree-sitter runtime")
+		}
+		if result.Err != nil {
+			t.Fatal(result.Err)
+		}
+		if expected := parseSpans(t, documents[i]); !reflect.DeepEqual(result.Spans, expected) {
+			t.Errorf("document %d: got %+v, expected %+v", i, result.Spans, expected)
+		}
+	}
+}
+
+// example-file.qmd repeated up to about 1 MB
+func benchmarkDocument(b *testing.B) []byte {
+	text, err := os.ReadFile("../../example-file.qmd")
+	if err != nil {
+		b.Fatal(err)
+	}
+	text = append(text, '\n')
+	return bytes.Repeat(text, max(1, (1<<20)/len(text)))
+}
+
+func reportBytes(b *testing.B, size int) {
+	b.SetBytes(int64(size))
+	b.ReportAllocs()
+	b.ResetTimer()
+	b.Cleanup(func() {
+		b.ReportMetric(float64(b.Elapsed().Nanoseconds())/float64(b.N)/float64(size), "ns/byte")
+	})
+}
+
+func BenchmarkParseOutline(b *testing.B) {
+	source := benchmarkDocument(b)
+	reportBytes(b, len(source))
+	for i := 0; i < b.N; i++ {
+		tree_sitter_quarto.ParseOutline(source)
+	}
+}
+
+// one cgo call per document, into a reused slice
+func BenchmarkAppendSpans(b *testing.B) {
+	source := benchmarkDocument(b)
+	parser, err := tree_sitter_quarto.NewSpanParser()
+	if err != nil {
+		b.Skip(err)
+	}
+	defer parser.Close()
+	spans, _ := parser.AppendSpans(nil, source)
+	reportBytes(b, len(source))
+	for i := 0; i < b.N; i++ {
+		spans, _ = parser.AppendSpans(spans[:0], source)
+	}
+}
+
+// the same table built from Go, a few cgo calls per node
+func BenchmarkWalkTree(b *testing.B) {
+	source := benchmarkDocument(b)
+	language := tree_sitter.NewLanguage(tree_sitter_quarto.Language())
+	inlineLanguage := tree_sitter.NewLanguage(tree_sitter_quarto.InlineLanguage())
+	inlineKind := language.IdForNodeKind("inline", true)
+	inlineOffset := uint16(language.NodeKindCount())
+	parser := tree_sitter.NewParser()
+	defer parser.Close()
+	parser.SetLanguage(language)
+	inlineParser := tree_sitter.NewParser()
+	defer inlineParser.Close()
+	inlineParser.SetLanguage(inlineLanguage)
+
+	var spans []tree_sitter_quarto.Span
+	var walk func(cursor *tree_sitter.TreeCursor, offset uint32, symbolOffset uint16, depth uint32, parent int32)
+	walk = func(cursor *tree_sitter.TreeCursor, offset uint32, symbolOffset uint16, depth uint32, parent int32) {
+		if !cursor.GotoFirstChild() {
+			return
+		}
+		for {
+			node := cursor.Node()
+			index := parent
+			if node.IsNamed() {
+				index = int32(len(spans))
+				spans = append(spans, tree_sitter_quarto.Span{
+					Symbol:    node.KindId() + symbolOffset,
+					Depth:     depth + 1,
+					StartByte: offset + uint32(node.StartByte()),
+					EndByte:   offset + uint32(node.EndByte()),
+					Parent:    parent,
+				})
+				if symbolOffset == 0 && node.KindId() == inlineKind {
+					tree := inlineParser.Parse(source[node.StartByte():node.EndByte()], nil)
+					inlineCursor := tree.Walk()
+					walk(inlineCursor, uint32(node.StartByte()), inlineOffset, depth+1, index)
+					inlineCursor.Close()
+					tree.Close()
+				}
+			}
+			walk(cursor, offset, symbolOffset, depth+1, index)
+			if !cursor.GotoNextSibling() {
+				break
+			}
+		}
+		cursor.GotoParent()
+	}
+
+	reportBytes(b, len(source))
+	for i := 0; i < b.N; i++ {
+		spans = spans[:0]
+		tree := parser.Parse(source, nil)
+		root := tree.RootNode()
+		spans = append(spans, tree_sitter_quarto.Span{
+			Symbol: root.KindId(), EndByte: uint32(root.EndByte()), Parent: -1,
+		})
+		cursor := tree.Walk()
+		walk(cursor, 0, 0, 0, 0)
+		cursor.Close()
+		tree.Close()
+	}
+}
+
+func BenchmarkParseBatch(b *testing.B) {
+	source := benchmarkDocument(b)[:64<<10]
+	documents := make([][]byte, 64)
+	for i := range documents {
+		documents[i] = source
+	}
+	if result := tree_sitter_quarto.ParseBatch(documents[:1], 1)[0]; result.Err != nil {
+		b.Skip(result.Err)
+	}
+	reportBytes(b, len(source)*len(documents))
+	b.ReportMetric(float64(runtime.GOMAXPROCS(0)), "workers")
+	for i := 0; i < b.N; i++ {
+		tree_sitter_quarto.ParseBatch(documents, 0)
+	}
+}
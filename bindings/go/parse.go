@@ -0,0 +1,192 @@
+package tree_sitter_quarto
+
+// #cgo CFLAGS: -I${SRCDIR}/../c -I${SRCDIR}/../../src
+// #include "../c/outline.c"
+import "C"
+
+import (
+	"errors"
+	"math"
+	"runtime"
+	"sync"
+	"sync/atomic"
+	"unsafe"
+)
+
+// Walking a tree from Go costs a cgo call per node. The functions below
+// return compact results instead, in one cgo call per document:
+//
+//   - ParseOutline finds the title and headings without parsing, see
+//     `tree_sitter_quarto_outline()`.
+//   - SpanParser and ParseBatch return span tables, see
+//     `tree_sitter_quarto_span_table_read()`. They need the tree-sitter
+//     runtime, which is linked with `-tags tree_sitter_quarto_runtime`
+//     when pkg-config finds it.
+
+var (
+	// ErrNoRuntime is returned for span tables when the package was built
+	// without the tree-sitter runtime.
+	ErrNoRuntime = errors.New("tree_sitter_quarto: span tables need the tree-sitter runtime, build with -tags tree_sitter_quarto_runtime")
+	// ErrParse is returned when a document or one of its inline nodes
+	// could not be parsed.
+	ErrParse = errors.New("tree_sitter_quarto: could not parse the document")
+	// ErrTooLarge is returned for documents of 4 GiB or more.
+	ErrTooLarge = errors.New("tree_sitter_quarto: documents are limited to 4 GiB")
+)
+
+// A Heading of level Level whose text is [StartByte, EndByte) of the
+// document. Attributes is its trailing `{...}` attribute block, if any.
+type Heading struct {
+	Level      uint8
+	Text       string
+	Attributes string
+	StartByte  uint32
+	EndByte    uint32
+}
+
+// An Outline is the front matter title and the headings of a document,
+// in document order.
+type Outline struct {
+	Title    string
+	Headings []Heading
+}
+
+// A Span is a named node of a document. Symbol is a symbol of Language(),
+// or one of InlineLanguage() plus the symbol count of the former, see
+// SpanTypes(). Depth counts anonymous ancestors too. Parent is the index
+// of the closest named ancestor, -1 for the root. Its layout is that of
+// TSQuartoSpan, so a table is copied out of C memory in one piece.
+type Span struct {
+	Symbol    uint16
+	Depth     uint32
+	StartByte uint32
+	EndByte   uint32
+	Parent    int32
+}
+
+func cSource(source []byte) (*C.char, C.uint32_t, error) {
+	if uint64(len(source)) > math.MaxUint32 {
+		return nil, 0, ErrTooLarge
+	}
+	return (*C.char)(unsafe.Pointer(unsafe.SliceData(source))), C.uint32_t(len(source)), nil
+}
+
+func text(source []byte, start, end C.uint32_t) string {
+	return string(source[start:end])
+}
+
+// ParseOutline finds the outline of a document.
+func ParseOutline(source []byte) (Outline, error) {
+	data, length, err := cSource(source)
+	if err != nil {
+		return Outline{}, err
+	}
+	// a guess that fits most documents, so the outline is read once
+	headings := make([]C.TSQuartoHeading, len(source)/256+64)
+	outline := C.tree_sitter_quarto_outline(data, length, &headings[0], C.uint32_t(len(headings)))
+	if int(outline.heading_count) > len(headings) {
+		headings = make([]C.TSQuartoHeading, outline.heading_count)
+		outline = C.tree_sitter_quarto_outline(data, length, &headings[0], outline.heading_count)
+	}
+
+	result := Outline{
+		Title:    text(source, outline.title_start_byte, outline.title_end_byte),
+		Headings: make([]Heading, outline.heading_count),
+	}
+	for i, heading := range headings[:outline.heading_count] {
+		result.Headings[i] = Heading{
+			Level:      uint8(heading.level),
+			Text:       text(source, heading.start_byte, heading.end_byte),
+			Attributes: text(source, heading.attribute_start_byte, heading.attribute_end_byte),
+			StartByte:  uint32(heading.start_byte),
+			EndByte:    uint32(heading.end_byte),
+		}
+	}
+	return result, nil
+}
+
+// A SpanParser parses documents into span tables. It keeps its parsers
+// and its table for later calls, and must not be used by two goroutines
+// at once.
+type SpanParser struct {
+	parser *spanParser
+}
+
+// NewSpanParser returns a parser, or ErrNoRuntime. Close it when done.
+func NewSpanParser() (*SpanParser, error) {
+	parser, err := newSpanParser()
+	if err != nil {
+		return nil, err
+	}
+	return &SpanParser{parser}, nil
+}
+
+// Close frees the parser's C memory.
+func (p *SpanParser) Close() {
+	if p.parser != nil {
+		p.parser.close()
+		p.parser = nil
+	}
+}
+
+// AppendSpans parses a document and appends its spans to spans. Reusing
+// the returned slice for the next document avoids allocating.
+func (p *SpanParser) AppendSpans(spans []Span, source []byte) ([]Span, error) {
+	return p.parser.appendSpans(spans, source)
+}
+
+// ParseSpans returns the span table of one document.
+func ParseSpans(source []byte) ([]Span, error) {
+	parser, err := NewSpanParser()
+	if err != nil {
+		return nil, err
+	}
+	defer parser.Close()
+	return parser.AppendSpans(nil, source)
+}
+
+// A BatchResult is the span table of one document of a batch, or the
+// error that stopped it.
+type BatchResult struct {
+	Spans []Span
+	Err   error
+}
+
+// ParseBatch parses documents on a pool of goroutines, each with its own
+// SpanParser, and returns their results in the same order. Idle
+// goroutines take the next document, so a few large documents do not
+// hold up the rest. workers is the pool size, GOMAXPROCS if it is 0 or
+// less. The documents must not change until it returns.
+func ParseBatch(documents [][]byte, workers int) []BatchResult {
+	results := make([]BatchResult, len(documents))
+	if workers <= 0 {
+		workers = runtime.GOMAXPROCS(0)
+	}
+	workers = min(workers, len(documents))
+
+	var next atomic.Int64
+	var group sync.WaitGroup
+	group.Add(workers)
+	for worker := 0; worker < workers; worker++ {
+		go func() {
+			defer group.Done()
+			parser, err := NewSpanParser()
+			if err == nil {
+				defer parser.Close()
+			}
+			for {
+				i := int(next.Add(1) - 1)
+				if i >= len(documents) {
+					return
+				}
+				if err != nil {
+					results[i].Err = err
+					continue
+				}
+				results[i].Spans, results[i].Err = parser.AppendSpans(nil, documents[i])
+			}
+		}()
+	}
+	group.Wait()
+	return results
+}
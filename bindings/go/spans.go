@@ -0,0 +1,90 @@
+//go:build tree_sitter_quarto_runtime
+
+package tree_sitter_quarto
+
+// #cgo pkg-config: tree-sitter
+// #include <stdlib.h>
+// #include "../c/spans.c"
+//
+// typedef struct {
+//   TSParser *parser;
+//   TSParser *inline_parser;
+//   TSQuartoSpanTable table;
+// } SpanParser;
+//
+// static SpanParser *span_parser_new(void) {
+//   SpanParser *self = calloc(1, sizeof(SpanParser));
+//   if (!self) return NULL;
+//   self->parser = ts_parser_new();
+//   self->inline_parser = ts_parser_new();
+//   ts_parser_set_language(self->parser, tree_sitter_quarto());
+//   ts_parser_set_language(self->inline_parser, tree_sitter_quarto_inline());
+//   return self;
+// }
+//
+// static void span_parser_delete(SpanParser *self) {
+//   ts_parser_delete(self->parser);
+//   ts_parser_delete(self->inline_parser);
+//   tree_sitter_quarto_span_table_delete(&self->table);
+//   free(self);
+// }
+//
+// static bool span_parser_parse(SpanParser *self, const char *source, uint32_t length) {
+//   return tree_sitter_quarto_span_table_parse(&self->table, self->parser, self->inline_parser,
+//                                              source, length);
+// }
+import "C"
+
+import (
+	"sync"
+	"unsafe"
+)
+
+// a compile time check that Span and TSQuartoSpan are the same size
+var _ [unsafe.Sizeof(Span{}) - unsafe.Sizeof(C.TSQuartoSpan{})]struct{}
+var _ [unsafe.Sizeof(C.TSQuartoSpan{}) - unsafe.Sizeof(Span{})]struct{}
+
+// the C parsers and table, kept in C memory so that a parse passes Go
+// memory to C only for the source
+type spanParser struct {
+	c *C.SpanParser
+}
+
+func newSpanParser() (*spanParser, error) {
+	parser := C.span_parser_new()
+	if parser == nil {
+		return nil, ErrParse
+	}
+	return &spanParser{parser}, nil
+}
+
+func (p *spanParser) close() {
+	C.span_parser_delete(p.c)
+}
+
+func (p *spanParser) appendSpans(spans []Span, source []byte) ([]Span, error) {
+	data, length, err := cSource(source)
+	if err != nil {
+		return spans, err
+	}
+	if !C.span_parser_parse(p.c, data, length) {
+		return spans, ErrParse
+	}
+	table := unsafe.Slice((*Span)(unsafe.Pointer(p.c.table.spans)), p.c.table.count)
+	return append(spans, table...), nil
+}
+
+var spanTypes = sync.OnceValue(func() []string {
+	types := make([]string, C.tree_sitter_quarto_span_type_count())
+	for symbol := range types {
+		types[symbol] = C.GoString(C.tree_sitter_quarto_span_type(C.uint16_t(symbol)))
+	}
+	return types
+})
+
+// SpanTypes returns the node type name of each span symbol, or nil
+// without the tree-sitter runtime. The slice is shared and must not be
+// modified.
+func SpanTypes() []string {
+	return spanTypes()
+}
@@ -0,0 +1,22 @@
+//go:build !tree_sitter_quarto_runtime
+
+package tree_sitter_quarto
+
+type spanParser struct{}
+
+func newSpanParser() (*spanParser, error) {
+	return nil, ErrNoRuntime
+}
+
+func (p *spanParser) close() {}
+
+func (p *spanParser) appendSpans(spans []Span, source []byte) ([]Span, error) {
+	return spans, ErrNoRuntime
+}
+
+// SpanTypes returns the node type name of each span symbol, or nil
+// without the tree-sitter runtime. The slice is shared and must not be
+// modified.
+func SpanTypes() []string {
+	return nil
+}
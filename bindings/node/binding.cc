@@ -3,6 +3,10 @@
 typedef struct TSLanguage TSLanguage;
 
 extern "C" TSLanguage *tree_sitter_quarto();
+extern "C" TSLanguage *tree_sitter_quarto_inline();
+
+// see parse.cc
+void InitParse(Napi::Env env, Napi::Object exports);
 
 // "tree-sitter", "language" hashed with BLAKE2
 const napi_type_tag LANGUAGE_TYPE_TAG = {
@@ -13,6 +17,12 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     auto language = Napi::External<TSLanguage>::New(env, tree_sitter_quarto());
     language.TypeTag(&LANGUAGE_TYPE_TAG);
     exports["language"] = language;
+
+    auto inline_language = Napi::External<TSLanguage>::New(env, tree_sitter_quarto_inline());
+    inline_language.TypeTag(&LANGUAGE_TYPE_TAG);
+    exports["inline_language"] = inline_language;
+
+    InitParse(env, exports);
     return exports;
 }
 
@@ -7,3 +7,39 @@ test("can load grammar", () => {
   const parser = new Parser();
   assert.doesNotThrow(() => parser.setLanguage(require(".")));
 });
+
+test("can load inline grammar", () => {
+  const parser = new Parser();
+  assert.doesNotThrow(() => parser.setLanguage(require(".").inline));
+});
+
+test("parses an outline off the main thread", async () => {
+  const { parseAsync } = require(".");
+  const document = Buffer.from("---\ntitle: Title\n---\n\n# One {#sec-one}\n\nTwo\n---\n");
+  const outline = await parseAsync(document);
+  assert.strictEqual(outline.title, "Title");
+  assert.deepStrictEqual(outline.headings.map((heading) => [heading.level, heading.text, heading.attributes]), [
+    [1, "One", "{#sec-one}"],
+    [2, "Two", null],
+  ]);
+  assert.deepStrictEqual(await parseAsync(document.toString()), outline);
+});
+
+test("parses a span table off the main thread", async (t) => {
+  const { parseAsync, spanTypes } = require(".");
+  if (!spanTypes) return t.skip("built without the tree-sitter runtime");
+  const spans = await parseAsync(Buffer.from("# One\n"), { result: "spans" });
+  assert.strictEqual(spanTypes[spans.symbol[0]], "source_file");
+  assert.strictEqual(spans.parent[0], -1);
+  assert.ok(Array.from(spans.symbol, (symbol) => spanTypes[symbol]).includes("inline"));
+});
+
+test("parses buffers in place", async (t) => {
+  const { parse, parseAsync, spanTypes } = require(".");
+  const text = "# One\n\nSome *text*\n";
+  const bytes = new TextEncoder().encode(text);
+  assert.deepStrictEqual(parse(bytes), await parseAsync(text));
+  assert.deepStrictEqual(parse(bytes.buffer), parse(text));
+  if (!spanTypes) return t.skip("built without the tree-sitter runtime");
+  assert.deepStrictEqual(parse(bytes, { result: "spans" }), parse(text, { result: "spans" }));
+});
@@ -23,5 +23,45 @@ type Language = {
   nodeTypeInfo: NodeInfo[];
 };
 
-declare const language: Language;
+type Heading = {
+  level: number;
+  text: string | null;
+  // a trailing `{...}` attribute block, split off the text
+  attributes: string | null;
+  startIndex: number;
+  endIndex: number;
+};
+
+type Outline = {
+  title: string | null;
+  headings: Heading[];
+};
+
+// the named nodes of a document in preorder, one array item per node.
+// Nodes of the inline grammar are below the `inline` node they were
+// parsed from. Symbols index `spanTypes`, parents are -1 for the root.
+type SpanTable = {
+  symbol: Uint16Array;
+  startIndex: Uint32Array;
+  endIndex: Uint32Array;
+  parent: Int32Array;
+  depth: Uint32Array;
+};
+
+type Input = string | Uint8Array | ArrayBuffer;
+
+declare const language: Language & {
+  inline: Language;
+  // Parse on the calling thread. Binary inputs are read in place, with
+  // no copy and no conversion to a string. "spans" needs a build that
+  // links the tree-sitter runtime.
+  parse(input: Input, options?: { result?: "outline" }): Outline;
+  parse(input: Input, options: { result: "spans" }): SpanTable;
+  // Parse on the libuv thread pool. Binary inputs must not change until
+  // the promise settles.
+  parseAsync(input: Input, options?: { result?: "outline" }): Promise<Outline>;
+  parseAsync(input: Input, options: { result: "spans" }): Promise<SpanTable>;
+  // the node type name of each span symbol, if the runtime is linked
+  spanTypes?: string[];
+};
 export = language;
@@ -11,3 +11,9 @@ module.exports =
 try {
   module.exports.nodeTypeInfo = require("../../src/node-types.json");
 } catch (_) {}
+
+// the inline grammar, for the text of `inline` nodes
+module.exports.inline = { language: module.exports.inline_language };
+try {
+  module.exports.inline.nodeTypeInfo = require("../../inline/src/node-types.json");
+} catch (_) {}
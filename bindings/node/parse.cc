@@ -0,0 +1,292 @@
+#include <napi.h>
+
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "tree_sitter/tree-sitter-quarto.h"
+
+#ifdef TREE_SITTER_QUARTO_RUNTIME
+#include <tree_sitter/api.h>
+#endif
+
+// parse(input, { result }) and parseAsync(input, { result }) return a
+// compact result rather than a tree. parseAsync() runs on the libuv thread
+// pool, so a large document does not block the event loop. `input` is a
+// Buffer, another Uint8Array, an ArrayBuffer or a string. Binary inputs
+// are read in place through a TSInput, without a copy or a conversion
+// from UTF-16, so they must not change until the promise settles.
+//
+// result: "outline" (the default) finds the title and headings without
+// parsing, see `tree_sitter_quarto_outline()`. result: "spans" returns a
+// span table as typed arrays, see `tree_sitter_quarto_span_table_read()`,
+// and needs the tree-sitter runtime, which binding.gyp links when
+// pkg-config finds it.
+
+namespace {
+
+enum class ResultKind { Outline, Spans };
+
+#ifdef TREE_SITTER_QUARTO_RUNTIME
+
+struct ParserDeleter {
+    void operator()(TSParser *parser) const { ts_parser_delete(parser); }
+};
+
+// each thread keeps its parsers for later calls
+TSParser *thread_parser(const TSLanguage *language, bool is_inline) {
+    thread_local std::unique_ptr<TSParser, ParserDeleter> parsers[2];
+    auto &parser = parsers[is_inline];
+    if (!parser) {
+        parser.reset(ts_parser_new());
+        ts_parser_set_language(parser.get(), language);
+    }
+    return parser.get();
+}
+
+struct BufferInput {
+    const char *data;
+    uint32_t length;
+};
+
+// hands the parser the rest of the buffer from `byte_index` on
+const char *ReadBuffer(void *payload, uint32_t byte_index, TSPoint, uint32_t *bytes_read) {
+    auto *buffer = static_cast<const BufferInput *>(payload);
+    if (byte_index >= buffer->length) {
+        *bytes_read = 0;
+        return "";
+    }
+    *bytes_read = buffer->length - byte_index;
+    return buffer->data + byte_index;
+}
+
+#endif
+
+// one document's parse. The constructor and Result() use the JS heap,
+// Run() does not and may be called on another thread.
+class ParseJob {
+  public:
+    ParseJob(Napi::Env env, Napi::Value input, ResultKind kind) : kind_(kind) {
+        if (input.IsString()) {
+            text_ = input.As<Napi::String>().Utf8Value();
+            source_ = text_.data();
+            length_ = text_.size();
+        } else if (input.IsArrayBuffer()) {
+            auto buffer = input.As<Napi::ArrayBuffer>();
+            source_ = static_cast<const char *>(buffer.Data());
+            length_ = buffer.ByteLength();
+            input_ = Napi::Persistent(input.As<Napi::Object>());
+        } else {
+            auto array = input.As<Napi::Uint8Array>();
+            source_ = reinterpret_cast<const char *>(array.Data());
+            length_ = array.ByteLength();
+            input_ = Napi::Persistent(input.As<Napi::Object>());
+        }
+        if (length_ > UINT32_MAX) {
+            throw Napi::RangeError::New(env, "documents are limited to 4 GiB");
+        }
+    }
+
+    ~ParseJob() {
+#ifdef TREE_SITTER_QUARTO_RUNTIME
+        tree_sitter_quarto_span_table_delete(&spans_);
+#endif
+    }
+
+    // returns an error message, or nullptr
+    const char *Run() {
+        try {
+            if (kind_ == ResultKind::Outline) {
+                FindOutline();
+                return nullptr;
+            }
+#ifdef TREE_SITTER_QUARTO_RUNTIME
+            if (!ReadSpans()) return "could not parse the document";
+#endif
+            return nullptr;
+        } catch (const std::bad_alloc &) {
+            return "out of memory";
+        }
+    }
+
+    Napi::Value Result(Napi::Env env) const {
+#ifdef TREE_SITTER_QUARTO_RUNTIME
+        if (kind_ == ResultKind::Spans) return SpansResult(env);
+#endif
+        return OutlineResult(env);
+    }
+
+  private:
+    void FindOutline() {
+        uint32_t length = static_cast<uint32_t>(length_);
+        // a guess that fits most documents, so the outline is read once
+        headings_.resize(length / 256 + 64);
+        outline_ = tree_sitter_quarto_outline(source_, length, headings_.data(),
+                                              static_cast<uint32_t>(headings_.size()));
+        if (outline_.heading_count > headings_.size()) {
+            headings_.resize(outline_.heading_count);
+            tree_sitter_quarto_outline(source_, length, headings_.data(), outline_.heading_count);
+        }
+        headings_.resize(outline_.heading_count);
+    }
+
+    Napi::Value Text(Napi::Env env, uint32_t start, uint32_t end) const {
+        if (start == end) return env.Null();
+        return Napi::String::New(env, source_ + start, end - start);
+    }
+
+    Napi::Object OutlineResult(Napi::Env env) const {
+        auto headings = Napi::Array::New(env, headings_.size());
+        for (uint32_t i = 0; i < headings_.size(); i++) {
+            const TSQuartoHeading &heading = headings_[i];
+            auto item = Napi::Object::New(env);
+            item["level"] = Napi::Number::New(env, heading.level);
+            item["text"] = Text(env, heading.start_byte, heading.end_byte);
+            item["attributes"] = Text(env, heading.attribute_start_byte, heading.attribute_end_byte);
+            item["startIndex"] = Napi::Number::New(env, heading.start_byte);
+            item["endIndex"] = Napi::Number::New(env, heading.end_byte);
+            headings[i] = item;
+        }
+        auto result = Napi::Object::New(env);
+        result["title"] = Text(env, outline_.title_start_byte, outline_.title_end_byte);
+        result["headings"] = headings;
+        return result;
+    }
+
+#ifdef TREE_SITTER_QUARTO_RUNTIME
+    bool ReadSpans() {
+        BufferInput buffer = {source_, static_cast<uint32_t>(length_)};
+        TSInput input{};
+        input.payload = &buffer;
+        input.read = ReadBuffer;
+        input.encoding = TSInputEncodingUTF8;
+        TSTree *tree = ts_parser_parse(thread_parser(tree_sitter_quarto(), false), nullptr, input);
+        if (!tree) return false;
+        bool ok = tree_sitter_quarto_span_table_read(
+            &spans_, tree, thread_parser(tree_sitter_quarto_inline(), true), source_);
+        ts_tree_delete(tree);
+        return ok;
+    }
+
+    template <typename T, typename Field>
+    Napi::TypedArrayOf<T> Column(Napi::Env env, Field field) const {
+        auto column = Napi::TypedArrayOf<T>::New(env, spans_.count);
+        T *data = column.Data();
+        for (uint32_t i = 0; i < spans_.count; i++) {
+            data[i] = field(spans_.spans[i]);
+        }
+        return column;
+    }
+
+    Napi::Object SpansResult(Napi::Env env) const {
+        auto result = Napi::Object::New(env);
+        result["symbol"] = Column<uint16_t>(env, [](const TSQuartoSpan &span) { return span.symbol; });
+        result["startIndex"] =
+            Column<uint32_t>(env, [](const TSQuartoSpan &span) { return span.start_byte; });
+        result["endIndex"] =
+            Column<uint32_t>(env, [](const TSQuartoSpan &span) { return span.end_byte; });
+        result["parent"] = Column<int32_t>(env, [](const TSQuartoSpan &span) { return span.parent; });
+        result["depth"] = Column<uint32_t>(env, [](const TSQuartoSpan &span) { return span.depth; });
+        return result;
+    }
+
+    TSQuartoSpanTable spans_ = {nullptr, 0, 0};
+#endif
+
+    ResultKind kind_;
+    // keeps a binary input alive while it is read
+    Napi::ObjectReference input_;
+    std::string text_;
+    const char *source_ = nullptr;
+    size_t length_ = 0;
+    TSQuartoOutline outline_ = {0, 0, 0};
+    std::vector<TSQuartoHeading> headings_;
+};
+
+class ParseWorker : public Napi::AsyncWorker {
+  public:
+    ParseWorker(Napi::Env env, Napi::Value input, ResultKind kind)
+        : Napi::AsyncWorker(env, "tree-sitter-quarto:parseAsync"),
+          deferred_(Napi::Promise::Deferred::New(env)), job_(env, input, kind) {}
+
+    Napi::Promise Promise() const { return deferred_.Promise(); }
+
+  protected:
+    void Execute() override {
+        if (const char *error = job_.Run()) SetError(error);
+    }
+
+    void OnOK() override { deferred_.Resolve(job_.Result(Env())); }
+
+    void OnError(const Napi::Error &error) override { deferred_.Reject(error.Value()); }
+
+  private:
+    Napi::Promise::Deferred deferred_;
+    ParseJob job_;
+};
+
+bool IsBinary(Napi::Value value) {
+    return value.IsArrayBuffer() ||
+           (value.IsTypedArray() &&
+            value.As<Napi::TypedArray>().TypedArrayType() == napi_uint8_array);
+}
+
+ResultKind ParseOptions(Napi::Env env, Napi::Value options) {
+    if (options.IsUndefined()) return ResultKind::Outline;
+    if (!options.IsObject()) {
+        throw Napi::TypeError::New(env, "options must be an object");
+    }
+    Napi::Value result = options.As<Napi::Object>().Get("result");
+    if (result.IsUndefined()) return ResultKind::Outline;
+    std::string name = result.IsString() ? result.As<Napi::String>().Utf8Value() : "";
+    if (name == "outline") return ResultKind::Outline;
+    if (name == "spans") {
+#ifndef TREE_SITTER_QUARTO_RUNTIME
+        throw Napi::Error::New(
+            env, "result \"spans\" needs the tree-sitter runtime, which this build does not link");
+#endif
+        return ResultKind::Spans;
+    }
+    throw Napi::TypeError::New(env, "result must be \"outline\" or \"spans\"");
+}
+
+void CheckInput(Napi::Env env, Napi::Value input) {
+    if (!input.IsString() && !IsBinary(input)) {
+        throw Napi::TypeError::New(env, "input must be a string, a Uint8Array or an ArrayBuffer");
+    }
+}
+
+Napi::Value Parse(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    CheckInput(env, info[0]);
+    ParseJob job(env, info[0], ParseOptions(env, info[1]));
+    if (const char *error = job.Run()) throw Napi::Error::New(env, error);
+    return job.Result(env);
+}
+
+Napi::Value ParseAsync(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    CheckInput(env, info[0]);
+    ResultKind kind = ParseOptions(env, info[1]);
+    auto *worker = new ParseWorker(env, info[0], kind);
+    Napi::Promise promise = worker->Promise();
+    worker->Queue();
+    return promise;
+}
+
+} // namespace
+
+void InitParse(Napi::Env env, Napi::Object exports) {
+    exports["parse"] = Napi::Function::New(env, Parse, "parse");
+    exports["parseAsync"] = Napi::Function::New(env, ParseAsync, "parseAsync");
+#ifdef TREE_SITTER_QUARTO_RUNTIME
+    // the node type name of each span symbol
+    uint32_t count = tree_sitter_quarto_span_type_count();
+    auto types = Napi::Array::New(env, count);
+    for (uint32_t symbol = 0; symbol < count; symbol++) {
+        types[symbol] = Napi::String::New(env, tree_sitter_quarto_span_type(symbol));
+    }
+    exports["spanTypes"] = types;
+#endif
+}
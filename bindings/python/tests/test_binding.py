@@ -1,3 +1,4 @@
+from tempfile import NamedTemporaryFile
 from unittest import TestCase
 
 import tree_sitter
@@ -10,3 +11,59 @@ class TestLanguage(TestCase):
             tree_sitter.Language(tree_sitter_quarto.language())
         except Exception:
             self.fail("Error loading Quarto grammar")
+
+    def test_can_load_inline_grammar(self):
+        try:
+            tree_sitter.Language(tree_sitter_quarto.inline_language())
+        except Exception:
+            self.fail("Error loading Quarto inline grammar")
+
+
+class TestParseMany(TestCase):
+    document = b"---\ntitle: \"A title\"\n---\n\n# One {#sec-one}\n\nText\n\nTwo\n---\n"
+
+    def test_outline(self):
+        [outline] = tree_sitter_quarto.parse_many([self.document], workers=2)
+        self.assertEqual(outline, ("A title", [
+            (1, "One", "{#sec-one}", 28, 31),
+            (2, "Two", None, 50, 53),
+        ]))
+
+    def test_keeps_order(self):
+        documents = [b"# %d\n" % i for i in range(100)]
+        outlines = tree_sitter_quarto.parse_many(documents, workers=4)
+        self.assertEqual([headings[0][1] for _, headings in outlines],
+                         [str(i) for i in range(100)])
+
+    def test_reads_paths(self):
+        with NamedTemporaryFile(suffix=".qmd") as file:
+            file.write(self.document)
+            file.flush()
+            [from_path] = tree_sitter_quarto.parse_many([file.name])
+        self.assertEqual(from_path, tree_sitter_quarto.parse_many([self.document])[0])
+
+    def test_missing_path(self):
+        with self.assertRaises(FileNotFoundError):
+            tree_sitter_quarto.parse_many(["does/not/exist.qmd"])
+
+    def test_spans(self):
+        try:
+            [spans] = tree_sitter_quarto.parse_many([b"# One\n"], result="spans")
+        except RuntimeError:
+            self.skipTest("built without the tree-sitter runtime")
+        self.assertEqual(spans[0][:3], ("source_file", 0, 6))
+        self.assertIn("inline", [span[0] for span in spans])
+
+    def test_columns(self):
+        try:
+            [columns] = tree_sitter_quarto.parse_many([b"# One\n\nTwo\n"], result="columns")
+        except RuntimeError:
+            self.skipTest("built without the tree-sitter runtime")
+        [spans] = tree_sitter_quarto.parse_many([b"# One\n\nTwo\n"], result="spans")
+        types = tree_sitter_quarto.node_types()
+        self.assertEqual([types[symbol] for symbol in columns["symbol"]],
+                         [span[0] for span in spans])
+        self.assertEqual(list(columns["start_byte"]), [span[1] for span in spans])
+        self.assertEqual(list(columns["depth"]), [span[3] for span in spans])
+        self.assertEqual(columns["parent"][0], -1)
+        self.assertEqual(columns["end_byte"].format, "I")
@@ -2,7 +2,7 @@
 
 from importlib.resources import files as _files
 
-from ._binding import language
+from ._binding import inline_language, language, node_types, parse_many
 
 
 def _get_query(name, file):
@@ -16,8 +16,8 @@ def __getattr__(name):
 
     # if name == "HIGHLIGHTS_QUERY":
     #     return _get_query("HIGHLIGHTS_QUERY", "highlights.scm")
-    # if name == "INJECTIONS_QUERY":
-    #     return _get_query("INJECTIONS_QUERY", "injections.scm")
+    if name == "INJECTIONS_QUERY":
+        return _get_query("INJECTIONS_QUERY", "injections.scm")
     # if name == "LOCALS_QUERY":
     #     return _get_query("LOCALS_QUERY", "locals.scm")
     # if name == "TAGS_QUERY":
@@ -28,8 +28,11 @@ def __getattr__(name):
 
 __all__ = [
     "language",
+    "inline_language",
+    "parse_many",
+    "node_types",
     # "HIGHLIGHTS_QUERY",
-    # "INJECTIONS_QUERY",
+    "INJECTIONS_QUERY",
     # "LOCALS_QUERY",
     # "TAGS_QUERY",
 ]
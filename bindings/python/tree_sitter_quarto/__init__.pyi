@@ -1,10 +1,42 @@
-from typing import Final
+from os import PathLike
+from typing import Final, Iterable, Literal, TypeAlias, overload
 
 # NOTE: uncomment these to include any queries that this grammar contains:
 
 # HIGHLIGHTS_QUERY: Final[str]
-# INJECTIONS_QUERY: Final[str]
+INJECTIONS_QUERY: Final[str]
 # LOCALS_QUERY: Final[str]
 # TAGS_QUERY: Final[str]
 
 def language() -> object: ...
+def inline_language() -> object: ...
+
+Source: TypeAlias = bytes | str | PathLike[str] | PathLike[bytes]
+
+# level, text, attributes, start byte, end byte
+Heading: TypeAlias = tuple[int, str | None, str | None, int, int]
+# title, headings
+Outline: TypeAlias = tuple[str | None, list[Heading]]
+# node type, start byte, end byte, depth
+Span: TypeAlias = tuple[str, int, int, int]
+# "symbol", "start_byte", "end_byte", "parent" and "depth", one item per
+# node in preorder. Symbols index node_types(), parents are -1 for the root.
+Columns: TypeAlias = dict[str, memoryview]
+
+@overload
+def parse_many(
+    sources: Iterable[Source], *, workers: int = 0, result: Literal["outline"] = "outline"
+) -> list[Outline]: ...
+@overload
+def parse_many(
+    sources: Iterable[Source], *, workers: int = 0, result: Literal["spans"]
+) -> list[list[Span]]: ...
+@overload
+def parse_many(
+    sources: Iterable[Source], *, workers: int = 0, result: Literal["sexp"]
+) -> list[str]: ...
+@overload
+def parse_many(
+    sources: Iterable[Source], *, workers: int = 0, result: Literal["columns"]
+) -> list[Columns]: ...
+def node_types() -> list[str]: ...
@@ -0,0 +1,522 @@
+#include <Python.h>
+#include <pythread.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tree_sitter/tree-sitter-quarto.h"
+
+#ifdef TREE_SITTER_QUARTO_RUNTIME
+#include <tree_sitter/api.h>
+#endif
+
+// parse_many(sources, *, workers=0, result="outline")
+//
+// Documents are read and parsed on native threads without the GIL, and
+// only turned into Python objects once every thread is done. Spans and
+// S-expressions need the tree-sitter runtime, which setup.py links when
+// pkg-config finds it. Outlines do not parse at all, see
+// `tree_sitter_quarto_outline()`, and spans are read with
+// `tree_sitter_quarto_span_table_parse()`.
+//
+// Columns hold the same nodes as spans, one buffer per field, so that
+// NumPy or Arrow can use them without a Python object per node.
+
+typedef enum {
+    RESULT_OUTLINE,
+    RESULT_SPANS,
+    RESULT_SEXP,
+    RESULT_COLUMNS,
+} ResultKind;
+
+typedef struct {
+    // a file to read, or NULL for a bytes object's contents in `source`
+    const char *path;
+    const char *source;
+    uint32_t length;
+    char *contents;
+    // errno of the failed read or allocation, -1 if it did not parse
+    int error;
+    TSQuartoOutline outline;
+    TSQuartoHeading *headings;
+    TSQuartoSpanTable spans;
+    char *sexp;
+} Document;
+
+typedef struct {
+    Document *documents;
+    Py_ssize_t count;
+    ResultKind kind;
+    // guards `next` and `running`
+    PyThread_type_lock lock;
+    // held until the last worker is done
+    PyThread_type_lock done;
+    Py_ssize_t next;
+    Py_ssize_t running;
+} Batch;
+
+static int read_document(Document *document) {
+    FILE *file = fopen(document->path, "rb");
+    if (!file) return errno;
+    long length = -1;
+    if (fseek(file, 0, SEEK_END) == 0) length = ftell(file);
+    if (length < 0 || (unsigned long)length > UINT32_MAX) {
+        fclose(file);
+        return length < 0 ? EIO : EFBIG;
+    }
+    rewind(file);
+    document->contents = malloc(length + 1);
+    if (!document->contents) {
+        fclose(file);
+        return ENOMEM;
+    }
+    size_t read = fread(document->contents, 1, length, file);
+    int error = ferror(file) ? EIO : 0;
+    fclose(file);
+    document->source = document->contents;
+    document->length = (uint32_t)read;
+    return error;
+}
+
+static int find_outline(Document *document) {
+    // a guess that fits most documents, so the outline is read once
+    uint32_t capacity = document->length / 256 + 64;
+    document->headings = malloc(capacity * sizeof(TSQuartoHeading));
+    if (!document->headings) return ENOMEM;
+    document->outline = tree_sitter_quarto_outline(
+        document->source, document->length, document->headings, capacity);
+    if (document->outline.heading_count > capacity) {
+        capacity = document->outline.heading_count;
+        free(document->headings);
+        document->headings = malloc(capacity * sizeof(TSQuartoHeading));
+        if (!document->headings) return ENOMEM;
+        tree_sitter_quarto_outline(document->source, document->length, document->headings, capacity);
+    }
+    return 0;
+}
+
+#ifdef TREE_SITTER_QUARTO_RUNTIME
+
+static int parse_document(Document *document, ResultKind kind, TSParser *parser,
+                          TSParser *inline_parser) {
+    TSTree *tree = ts_parser_parse_string(parser, NULL, document->source, document->length);
+    if (!tree) return -1;
+    int error = 0;
+    TSNode root = ts_tree_root_node(tree);
+    if (kind == RESULT_SEXP) {
+        document->sexp = ts_node_string(root);
+        if (!document->sexp) error = ENOMEM;
+    } else if (!tree_sitter_quarto_span_table_read(&document->spans, tree, inline_parser,
+                                                   document->source)) {
+        error = -1;
+    }
+    ts_tree_delete(tree);
+    return error;
+}
+
+#endif
+
+static void run_worker(void *payload) {
+    Batch *batch = payload;
+#ifdef TREE_SITTER_QUARTO_RUNTIME
+    TSParser *parser = NULL, *inline_parser = NULL;
+    if (batch->kind != RESULT_OUTLINE) {
+        parser = ts_parser_new();
+        ts_parser_set_language(parser, tree_sitter_quarto());
+        inline_parser = ts_parser_new();
+        ts_parser_set_language(inline_parser, tree_sitter_quarto_inline());
+    }
+#endif
+    while (true) {
+        PyThread_acquire_lock(batch->lock, WAIT_LOCK);
+        Py_ssize_t i = batch->next++;
+        PyThread_release_lock(batch->lock);
+        if (i >= batch->count) break;
+
+        Document *document = &batch->documents[i];
+        if (document->path) {
+            document->error = read_document(document);
+            if (document->error) continue;
+        }
+        if (batch->kind == RESULT_OUTLINE) {
+            document->error = find_outline(document);
+        }
+#ifdef TREE_SITTER_QUARTO_RUNTIME
+        else {
+            document->error = parse_document(document, batch->kind, parser, inline_parser);
+        }
+#endif
+    }
+#ifdef TREE_SITTER_QUARTO_RUNTIME
+    if (parser) ts_parser_delete(parser);
+    if (inline_parser) ts_parser_delete(inline_parser);
+#endif
+
+    PyThread_acquire_lock(batch->lock, WAIT_LOCK);
+    bool last = --batch->running == 0;
+    PyThread_release_lock(batch->lock);
+    if (last) PyThread_release_lock(batch->done);
+}
+
+/// runs the batch on `workers` threads, the calling one included, and
+/// returns once all of them are done
+static void run_batch(Batch *batch, Py_ssize_t workers) {
+    PyThread_acquire_lock(batch->done, WAIT_LOCK);
+    batch->running = 1;
+    for (Py_ssize_t i = 1; i < workers; i++) {
+        PyThread_acquire_lock(batch->lock, WAIT_LOCK);
+        batch->running++;
+        PyThread_release_lock(batch->lock);
+        // PYTHREAD_INVALID_THREAD_ID, which the limited API does not define
+        if (PyThread_start_new_thread(run_worker, batch) == (unsigned long)-1) {
+            PyThread_acquire_lock(batch->lock, WAIT_LOCK);
+            batch->running--;
+            PyThread_release_lock(batch->lock);
+            break;
+        }
+    }
+    run_worker(batch);
+    PyThread_acquire_lock(batch->done, WAIT_LOCK);
+    PyThread_release_lock(batch->done);
+}
+
+static PyObject *decode(const char *source, uint32_t start, uint32_t end) {
+    if (start == end) Py_RETURN_NONE;
+    return PyUnicode_DecodeUTF8(source + start, end - start, "replace");
+}
+
+static PyObject *outline_result(const Document *document) {
+    const TSQuartoOutline *outline = &document->outline;
+    PyObject *headings = PyList_New(outline->heading_count);
+    if (!headings) return NULL;
+    for (uint32_t i = 0; i < outline->heading_count; i++) {
+        const TSQuartoHeading *heading = &document->headings[i];
+        PyObject *item = Py_BuildValue(
+            "(iNNII)", heading->level,
+            decode(document->source, heading->start_byte, heading->end_byte),
+            decode(document->source, heading->attribute_start_byte, heading->attribute_end_byte),
+            heading->start_byte, heading->end_byte);
+        if (!item) {
+            Py_DECREF(headings);
+            return NULL;
+        }
+        PyList_SetItem(headings, i, item);
+    }
+    return Py_BuildValue(
+        "(NN)", decode(document->source, outline->title_start_byte, outline->title_end_byte),
+        headings);
+}
+
+#ifdef TREE_SITTER_QUARTO_RUNTIME
+
+/// the interned names of the span symbols
+typedef struct {
+    PyObject **names;
+    uint32_t count;
+} TypeNames;
+
+static PyObject *type_name(TypeNames *self, const TSQuartoSpan *span) {
+    if (span->symbol >= self->count) {
+        PyErr_SetString(PyExc_RuntimeError, "node symbol out of range");
+        return NULL;
+    }
+    PyObject **name = &self->names[span->symbol];
+    if (!*name) *name = PyUnicode_InternFromString(tree_sitter_quarto_span_type(span->symbol));
+    Py_XINCREF(*name);
+    return *name;
+}
+
+static PyObject *spans_result(const Document *document, TypeNames *names) {
+    PyObject *spans = PyList_New(document->spans.count);
+    if (!spans) return NULL;
+    for (uint32_t i = 0; i < document->spans.count; i++) {
+        const TSQuartoSpan *span = &document->spans.spans[i];
+        PyObject *name = type_name(names, span);
+        PyObject *item = name ? Py_BuildValue("(NIII)", name, span->start_byte, span->end_byte,
+                                              span->depth)
+                              : NULL;
+        if (!item) {
+            Py_DECREF(spans);
+            return NULL;
+        }
+        PyList_SetItem(spans, i, item);
+    }
+    return spans;
+}
+
+/// a column is filled in through `data`, and then viewed as `format`
+typedef struct {
+    const char *name;
+    const char *format;
+    size_t item_size;
+    PyObject *bytes;
+    char *data;
+} Column;
+
+/// a dict of typed memoryviews over one bytes object per field
+static PyObject *columns_result(const Document *document) {
+    Column columns[] = {
+        {"symbol", "H", sizeof(uint16_t), NULL, NULL},
+        {"start_byte", "I", sizeof(uint32_t), NULL, NULL},
+        {"end_byte", "I", sizeof(uint32_t), NULL, NULL},
+        {"parent", "i", sizeof(int32_t), NULL, NULL},
+        {"depth", "I", sizeof(uint32_t), NULL, NULL},
+    };
+    const size_t column_count = sizeof(columns) / sizeof(Column);
+    PyObject *result = PyDict_New();
+    bool ok = result != NULL;
+    for (size_t i = 0; ok && i < column_count; i++) {
+        columns[i].bytes = PyBytes_FromStringAndSize(NULL, document->spans.count * columns[i].item_size);
+        ok = columns[i].bytes != NULL;
+        if (ok) columns[i].data = PyBytes_AsString(columns[i].bytes);
+    }
+
+    if (ok) {
+        uint16_t *symbols = (uint16_t *)columns[0].data;
+        uint32_t *start_bytes = (uint32_t *)columns[1].data;
+        uint32_t *end_bytes = (uint32_t *)columns[2].data;
+        int32_t *parents = (int32_t *)columns[3].data;
+        uint32_t *depths = (uint32_t *)columns[4].data;
+        for (uint32_t i = 0; i < document->spans.count; i++) {
+            const TSQuartoSpan *span = &document->spans.spans[i];
+            symbols[i] = span->symbol;
+            start_bytes[i] = span->start_byte;
+            end_bytes[i] = span->end_byte;
+            parents[i] = span->parent;
+            depths[i] = span->depth;
+        }
+    }
+
+    for (size_t i = 0; i < column_count; i++) {
+        if (ok) {
+            PyObject *view = PyMemoryView_FromObject(columns[i].bytes);
+            PyObject *typed = view ? PyObject_CallMethod(view, "cast", "s", columns[i].format) : NULL;
+            ok = typed && PyDict_SetItemString(result, columns[i].name, typed) == 0;
+            Py_XDECREF(typed);
+            Py_XDECREF(view);
+        }
+        Py_XDECREF(columns[i].bytes);
+    }
+    if (!ok) Py_CLEAR(result);
+    return result;
+}
+
+#endif
+
+static void free_document(Document *document) {
+    free(document->contents);
+    free(document->headings);
+    free(document->sexp);
+#ifdef TREE_SITTER_QUARTO_RUNTIME
+    tree_sitter_quarto_span_table_delete(&document->spans);
+#endif
+}
+
+static Py_ssize_t default_workers(void) {
+    Py_ssize_t workers = 1;
+    PyObject *os = PyImport_ImportModule("os");
+    if (!os) return -1;
+    PyObject *count = PyObject_CallMethod(os, "cpu_count", NULL);
+    Py_DECREF(os);
+    if (!count) return -1;
+    if (count != Py_None) workers = PyLong_AsSsize_t(count);
+    Py_DECREF(count);
+    return workers;
+}
+
+/// fills in the source or path of `document` from a bytes object or a
+/// path. The objects the pointers point into are appended to `keep`.
+static bool prepare_document(Document *document, PyObject *item, PyObject *keep) {
+    PyObject *bytes;
+    if (PyBytes_Check(item)) {
+        Py_INCREF(item);
+        bytes = item;
+    } else {
+        PyObject *path = PyOS_FSPath(item);
+        if (!path) return false;
+        if (PyUnicode_Check(path)) {
+            bytes = PyUnicode_EncodeFSDefault(path);
+            Py_DECREF(path);
+            if (!bytes) return false;
+        } else {
+            bytes = path;
+        }
+    }
+    int appended = PyList_Append(keep, bytes);
+    Py_DECREF(bytes);
+    if (appended < 0) return false;
+
+    char *buffer;
+    Py_ssize_t length;
+    if (PyBytes_AsStringAndSize(bytes, &buffer, &length) < 0) return false;
+    if (PyBytes_Check(item)) {
+        if ((size_t)length > UINT32_MAX) {
+            PyErr_SetString(PyExc_OverflowError, "documents are limited to 4 GiB");
+            return false;
+        }
+        document->source = buffer;
+        document->length = (uint32_t)length;
+    } else {
+        if ((size_t)length != strlen(buffer)) {
+            PyErr_SetString(PyExc_ValueError, "embedded null byte in path");
+            return false;
+        }
+        document->path = buffer;
+    }
+    return true;
+}
+
+PyObject *_binding_parse_many(PyObject *Py_UNUSED(self), PyObject *args, PyObject *kwargs) {
+    static char *keywords[] = {"sources", "workers", "result", NULL};
+    PyObject *sources;
+    Py_ssize_t workers = 0;
+    const char *result = "outline";
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|$ns:parse_many", keywords,
+                                     &sources, &workers, &result)) {
+        return NULL;
+    }
+
+    ResultKind kind;
+    if (strcmp(result, "outline") == 0) {
+        kind = RESULT_OUTLINE;
+    } else if (strcmp(result, "spans") == 0) {
+        kind = RESULT_SPANS;
+    } else if (strcmp(result, "sexp") == 0) {
+        kind = RESULT_SEXP;
+    } else if (strcmp(result, "columns") == 0) {
+        kind = RESULT_COLUMNS;
+    } else {
+        PyErr_Format(PyExc_ValueError,
+                     "result must be 'outline', 'spans', 'sexp' or 'columns', not '%s'", result);
+        return NULL;
+    }
+#ifndef TREE_SITTER_QUARTO_RUNTIME
+    if (kind != RESULT_OUTLINE) {
+        PyErr_Format(PyExc_RuntimeError,
+                     "result='%s' needs the tree-sitter runtime, which this build does not link",
+                     result);
+        return NULL;
+    }
+#endif
+    if (workers <= 0) {
+        workers = default_workers();
+        if (workers < 0) return NULL;
+    }
+
+    PyObject *items = PySequence_List(sources);
+    if (!items) return NULL;
+    Py_ssize_t count = PyList_Size(items);
+    PyObject *keep = PyList_New(0);
+    PyObject *results = NULL;
+    Batch batch = {
+        .documents = PyMem_Calloc(count ? count : 1, sizeof(Document)),
+        .count = count,
+        .kind = kind,
+        .lock = PyThread_allocate_lock(),
+        .done = PyThread_allocate_lock(),
+    };
+    if (!keep || !batch.documents || !batch.lock || !batch.done) {
+        PyErr_NoMemory();
+        goto exit;
+    }
+    for (Py_ssize_t i = 0; i < count; i++) {
+        if (!prepare_document(&batch.documents[i], PyList_GetItem(items, i), keep)) goto exit;
+    }
+
+    if (workers > count) workers = count;
+    Py_BEGIN_ALLOW_THREADS
+    run_batch(&batch, workers);
+    Py_END_ALLOW_THREADS
+
+    for (Py_ssize_t i = 0; i < count; i++) {
+        int error = batch.documents[i].error;
+        if (error == ENOMEM) {
+            PyErr_NoMemory();
+            goto exit;
+        } else if (error == -1) {
+            PyErr_Format(PyExc_RuntimeError, "could not parse document %zd", i);
+            goto exit;
+        } else if (error) {
+            errno = error;
+            PyErr_SetFromErrnoWithFilenameObject(PyExc_OSError, PyList_GetItem(items, i));
+            goto exit;
+        }
+    }
+
+#ifdef TREE_SITTER_QUARTO_RUNTIME
+    TypeNames names = {NULL, tree_sitter_quarto_span_type_count()};
+    if (kind == RESULT_SPANS) {
+        names.names = PyMem_Calloc(names.count, sizeof(PyObject *));
+        if (!names.names) {
+            PyErr_NoMemory();
+            goto exit;
+        }
+    }
+#endif
+    results = PyList_New(count);
+    for (Py_ssize_t i = 0; results && i < count; i++) {
+        const Document *document = &batch.documents[i];
+        PyObject *item = NULL;
+        if (kind == RESULT_OUTLINE) {
+            item = outline_result(document);
+        }
+#ifdef TREE_SITTER_QUARTO_RUNTIME
+        else if (kind == RESULT_SPANS) {
+            item = spans_result(document, &names);
+        } else if (kind == RESULT_COLUMNS) {
+            item = columns_result(document);
+        } else {
+            item = PyUnicode_FromString(document->sexp);
+        }
+#endif
+        if (!item) {
+            Py_CLEAR(results);
+            break;
+        }
+        PyList_SetItem(results, i, item);
+    }
+#ifdef TREE_SITTER_QUARTO_RUNTIME
+    if (kind == RESULT_SPANS) {
+        for (uint32_t symbol = 0; symbol < names.count; symbol++) {
+            Py_XDECREF(names.names[symbol]);
+        }
+        PyMem_Free(names.names);
+    }
+#endif
+
+exit:
+    if (batch.documents) {
+        for (Py_ssize_t i = 0; i < count; i++) {
+            free_document(&batch.documents[i]);
+        }
+        PyMem_Free(batch.documents);
+    }
+    if (batch.lock) PyThread_free_lock(batch.lock);
+    if (batch.done) PyThread_free_lock(batch.done);
+    Py_XDECREF(keep);
+    Py_DECREF(items);
+    return results;
+}
+
+PyObject *_binding_node_types(PyObject *Py_UNUSED(self), PyObject *Py_UNUSED(args)) {
+#ifdef TREE_SITTER_QUARTO_RUNTIME
+    uint32_t count = tree_sitter_quarto_span_type_count();
+    PyObject *types = PyList_New(count);
+    for (uint32_t symbol = 0; types && symbol < count; symbol++) {
+        PyObject *name = PyUnicode_InternFromString(tree_sitter_quarto_span_type(symbol));
+        if (!name) {
+            Py_CLEAR(types);
+            break;
+        }
+        PyList_SetItem(types, symbol, name);
+    }
+    return types;
+#else
+    PyErr_SetString(PyExc_RuntimeError,
+                    "node_types() needs the tree-sitter runtime, which this build does not link");
+    return NULL;
+#endif
+}
@@ -3,11 +3,20 @@
 typedef struct TSLanguage TSLanguage;
 
 TSLanguage *tree_sitter_quarto(void);
+TSLanguage *tree_sitter_quarto_inline(void);
+
+// see batch.c
+PyObject *_binding_parse_many(PyObject *self, PyObject *args, PyObject *kwargs);
+PyObject *_binding_node_types(PyObject *self, PyObject *args);
 
 static PyObject* _binding_language(PyObject *Py_UNUSED(self), PyObject *Py_UNUSED(args)) {
     return PyCapsule_New(tree_sitter_quarto(), "tree_sitter.Language", NULL);
 }
 
+static PyObject* _binding_inline_language(PyObject *Py_UNUSED(self), PyObject *Py_UNUSED(args)) {
+    return PyCapsule_New(tree_sitter_quarto_inline(), "tree_sitter.Language", NULL);
+}
+
 static struct PyModuleDef_Slot slots[] = {
 #ifdef Py_GIL_DISABLED
     {Py_mod_gil, Py_MOD_GIL_NOT_USED},
@@ -18,6 +27,12 @@ static struct PyModuleDef_Slot slots[] = {
 static PyMethodDef methods[] = {
     {"language", _binding_language, METH_NOARGS,
      "Get the tree-sitter language for this grammar."},
+    {"inline_language", _binding_inline_language, METH_NOARGS,
+     "Get the tree-sitter language for the text of inline nodes."},
+    {"parse_many", (PyCFunction)(void(*)(void))_binding_parse_many, METH_VARARGS | METH_KEYWORDS,
+     "Parse many documents on native threads, without holding the GIL."},
+    {"node_types", _binding_node_types, METH_NOARGS,
+     "Get the node type names of the symbol ids in parse_many() columns."},
     {NULL, NULL, 0, NULL}
 };
 
@@ -0,0 +1,71 @@
+//! Files per second from `parse_corpus()` as the thread count grows.
+//!
+//!     cargo bench --features parallel --bench corpus
+//!
+//! The corpus is every `.qmd` file under `QUARTO_BENCH_CORPUS` if it is
+//! set. Otherwise it is `example-file.qmd` and the files of `test/corpus`
+//! and `inline/test/corpus`, each listed 32 times so there is enough work
+//! for every core. The thread counts are 1, 2, 4 and so on up to the
+//! number of cores.
+
+use std::path::{Path, PathBuf};
+use std::{env, fs};
+
+use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use tree_sitter_quarto2::parse_corpus;
+
+const REPEATS: usize = 32;
+
+fn qmd_files(dir: &Path, files: &mut Vec<PathBuf>) {
+    let Ok(entries) = fs::read_dir(dir) else {
+        return;
+    };
+    for entry in entries.flatten() {
+        let path = entry.path();
+        if path.is_dir() {
+            qmd_files(&path, files);
+        } else if path.extension().is_some_and(|extension| extension == "qmd") {
+            files.push(path);
+        }
+    }
+}
+
+fn corpus() -> Vec<PathBuf> {
+    let mut files = Vec::new();
+    if let Some(dir) = env::var_os("QUARTO_BENCH_CORPUS") {
+        qmd_files(Path::new(&dir), &mut files);
+        assert!(!files.is_empty(), "no .qmd files under {}", dir.to_string_lossy());
+        return files;
+    }
+    let root = Path::new(env!("CARGO_MANIFEST_DIR"));
+    files.push(root.join("example-file.qmd"));
+    for dir in ["test/corpus", "inline/test/corpus"] {
+        files.extend(fs::read_dir(root.join(dir)).unwrap().flatten().map(|entry| entry.path()));
+    }
+    (0..REPEATS).flat_map(|_| files.iter().cloned()).collect()
+}
+
+fn thread_counts() -> Vec<usize> {
+    let cores = std::thread::available_parallelism().map_or(1, |cores| cores.get());
+    let mut counts: Vec<usize> = (0..).map(|power| 1 << power).take_while(|&count| count < cores).collect();
+    counts.push(cores);
+    counts
+}
+
+fn bench_parse_corpus(c: &mut Criterion) {
+    let files = corpus();
+    let mut group = c.benchmark_group("parse_corpus");
+    group.throughput(Throughput::Elements(files.len() as u64));
+    for threads in thread_counts() {
+        let pool = rayon::ThreadPoolBuilder::new().num_threads(threads).build().unwrap();
+        // the first pass creates each worker's parsers
+        pool.install(|| parse_corpus(&files));
+        group.bench_with_input(BenchmarkId::from_parameter(threads), &files, |b, files| {
+            b.iter(|| pool.install(|| parse_corpus(files)));
+        });
+    }
+    group.finish();
+}
+
+criterion_group!(benches, bench_parse_corpus);
+criterion_main!(benches);
@@ -0,0 +1,233 @@
+//! Full parses, incremental reparses and queries.
+//!
+//!     cargo bench --bench parse -- --save-baseline <name>
+//!
+//! - parse/<file>: the examples of a corpus file, each with the grammar of
+//!   its corpus
+//! - parse/synthetic: example-file.qmd repeated up to 10 MB
+//! - reparse/block: a single character inserted at a random position of
+//!   the synthetic document, reparsed from the tree of the unedited one
+//! - reparse/inline: the same, then the `inline` node holding the edit
+//!   reparsed with the inline grammar, as an editor would
+//! - query/<name>: every query of `queries/` that compiles against the
+//!   block grammar, run over the synthetic document
+//!
+//! Positions come from a fixed seed, so runs are comparable. See
+//! bench/criterion_baseline.py for turning saved baselines into JSON
+//! files that can be diffed between releases.
+
+use std::path::Path;
+use std::time::{Duration, Instant};
+use std::{fs, hint};
+
+use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use tree_sitter::{InputEdit, Language, Parser, Point, Query, QueryCursor, StreamingIterator, Tree};
+
+const SYNTHETIC_SIZE: usize = 10 * 1024 * 1024;
+const SEED: u64 = 0x2545_f491_4f6c_dd1d;
+
+fn root() -> &'static Path {
+    Path::new(env!("CARGO_MANIFEST_DIR"))
+}
+
+fn parser(language: tree_sitter_language::LanguageFn) -> Parser {
+    let mut parser = Parser::new();
+    parser.set_language(&language.into()).expect("Error loading Quarto parser");
+    parser
+}
+
+fn is_rule(line: &str, c: char) -> bool {
+    line.len() >= 3 && line.chars().all(|d| d == c)
+}
+
+/// the input of every example in a corpus file: the text between the
+/// header's closing `===` line and the `---` line
+fn examples(path: &Path) -> Vec<String> {
+    let text = fs::read_to_string(path).unwrap();
+    let mut examples = Vec::new();
+    let mut rules = 0;
+    let mut input: Option<String> = None;
+    for line in text.split_inclusive('\n') {
+        let trimmed = line.trim_end_matches('\n');
+        if is_rule(trimmed, '=') {
+            rules += 1;
+            if rules % 2 == 0 {
+                input = Some(String::new());
+            }
+        } else if input.is_some() && is_rule(trimmed, '-') {
+            examples.extend(input.take());
+        } else if let Some(input) = &mut input {
+            input.push_str(line);
+        }
+    }
+    examples
+}
+
+fn synthetic() -> Vec<u8> {
+    let mut text = fs::read(root().join("example-file.qmd")).unwrap();
+    text.push(b'\n');
+    text.repeat((SYNTHETIC_SIZE / text.len()).max(1))
+}
+
+/// xorshift64, enough for spreading edits over a document
+struct Random(u64);
+
+impl Random {
+    fn below(&mut self, bound: usize) -> usize {
+        self.0 ^= self.0 << 13;
+        self.0 ^= self.0 >> 7;
+        self.0 ^= self.0 << 17;
+        (self.0 % bound as u64) as usize
+    }
+}
+
+fn point(text: &[u8], byte: usize) -> Point {
+    let before = &text[..byte];
+    let row = before.iter().filter(|&&b| b == b'\n').count();
+    let line_start = before.iter().rposition(|&b| b == b'\n').map_or(0, |newline| newline + 1);
+    Point::new(row, byte - line_start)
+}
+
+fn bench_parse(c: &mut Criterion) {
+    let mut group = c.benchmark_group("parse");
+    for (dir, language) in [
+        ("test/corpus", tree_sitter_quarto2::LANGUAGE),
+        ("inline/test/corpus", tree_sitter_quarto2::INLINE_LANGUAGE),
+    ] {
+        let mut parser = parser(language);
+        let mut paths: Vec<_> = fs::read_dir(root().join(dir))
+            .unwrap()
+            .flatten()
+            .map(|entry| entry.path())
+            .filter(|path| path.extension().is_some_and(|extension| extension == "txt"))
+            .collect();
+        paths.sort();
+        for path in paths {
+            let examples = examples(&path);
+            let name = path.file_stem().unwrap().to_string_lossy().into_owned();
+            group.throughput(Throughput::Bytes(examples.iter().map(String::len).sum::<usize>() as u64));
+            group.bench_with_input(BenchmarkId::from_parameter(name), &examples, |b, examples| {
+                b.iter(|| {
+                    for example in examples {
+                        hint::black_box(parser.parse(example, None));
+                    }
+                });
+            });
+        }
+    }
+
+    let text = synthetic();
+    let mut parser = parser(tree_sitter_quarto2::LANGUAGE);
+    group.sample_size(10);
+    group.throughput(Throughput::Bytes(text.len() as u64));
+    group.bench_function("synthetic", |b| b.iter(|| hint::black_box(parser.parse(&text, None))));
+    group.finish();
+}
+
+/// inserts a character at a random position of `text`, reparses it from
+/// `tree` and times `reparse`, then takes the character out again
+fn time_edits(
+    text: &mut Vec<u8>,
+    tree: &Tree,
+    iterations: u64,
+    mut reparse: impl FnMut(&[u8], &Tree, usize) -> Tree,
+) -> Duration {
+    let mut random = Random(SEED);
+    let mut total = Duration::ZERO;
+    for _ in 0..iterations {
+        let mut byte = random.below(text.len());
+        // not inside a UTF-8 sequence
+        while text[byte] & 0xc0 == 0x80 {
+            byte += 1;
+        }
+        let start_position = point(text, byte);
+        text.insert(byte, b'x');
+        let mut edited = tree.clone();
+        edited.edit(&InputEdit {
+            start_byte: byte,
+            old_end_byte: byte,
+            new_end_byte: byte + 1,
+            start_position,
+            old_end_position: start_position,
+            new_end_position: Point::new(start_position.row, start_position.column + 1),
+        });
+        let start = Instant::now();
+        hint::black_box(reparse(text, &edited, byte));
+        total += start.elapsed();
+        text.remove(byte);
+    }
+    total
+}
+
+fn bench_reparse(c: &mut Criterion) {
+    let mut text = synthetic();
+    let mut block = parser(tree_sitter_quarto2::LANGUAGE);
+    let mut inline = parser(tree_sitter_quarto2::INLINE_LANGUAGE);
+    let tree = block.parse(&text, None).unwrap();
+
+    let mut group = c.benchmark_group("reparse");
+    group.bench_function("block", |b| {
+        b.iter_custom(|iterations| {
+            time_edits(&mut text, &tree, iterations, |text, edited, _| {
+                block.parse(text, Some(edited)).unwrap()
+            })
+        });
+    });
+    group.bench_function("inline", |b| {
+        b.iter_custom(|iterations| {
+            time_edits(&mut text, &tree, iterations, |text, edited, byte| {
+                let tree = block.parse(text, Some(edited)).unwrap();
+                let node = tree.root_node().descendant_for_byte_range(byte, byte + 1).unwrap();
+                let inline_node = std::iter::successors(Some(node), |node| node.parent())
+                    .find(|node| node.kind() == "inline");
+                if let Some(node) = inline_node {
+                    hint::black_box(inline.parse(&text[node.byte_range()], None));
+                }
+                tree
+            })
+        });
+    });
+    group.finish();
+}
+
+fn bench_query(c: &mut Criterion) {
+    let text = synthetic();
+    let language: Language = tree_sitter_quarto2::LANGUAGE.into();
+    let tree = parser(tree_sitter_quarto2::LANGUAGE).parse(&text, None).unwrap();
+    let mut paths: Vec<_> = fs::read_dir(root().join("queries"))
+        .unwrap()
+        .flatten()
+        .map(|entry| entry.path())
+        .filter(|path| path.extension().is_some_and(|extension| extension == "scm"))
+        .collect();
+    paths.sort();
+
+    let mut group = c.benchmark_group("query");
+    group.sample_size(10);
+    group.throughput(Throughput::Bytes(text.len() as u64));
+    for path in paths {
+        let name = path.file_stem().unwrap().to_string_lossy().into_owned();
+        let query = match Query::new(&language, &fs::read_to_string(&path).unwrap()) {
+            Ok(query) => query,
+            Err(error) => {
+                eprintln!("skipping {name}: {error}");
+                continue;
+            }
+        };
+        let mut cursor = QueryCursor::new();
+        group.bench_function(name, |b| {
+            b.iter(|| {
+                let mut captures = 0;
+                let mut matches = cursor.matches(&query, tree.root_node(), text.as_slice());
+                while let Some(query_match) = matches.next() {
+                    captures += query_match.captures.len();
+                }
+                captures
+            });
+        });
+    }
+    group.finish();
+}
+
+criterion_group!(benches, bench_parse, bench_reparse, bench_query);
+criterion_main!(benches);
@@ -17,5 +17,29 @@ fn main() {
         println!("cargo:rerun-if-changed={}", scanner_path.to_str().unwrap());
     }
 
+    // parse_corpus() finds outlines with the C helper the other bindings use
+    if std::env::var_os("CARGO_FEATURE_PARALLEL").is_some() {
+        let outline_path = std::path::Path::new("bindings").join("c").join("outline.c");
+        c_config.include(std::path::Path::new("bindings").join("c"));
+        c_config.file(&outline_path);
+        println!("cargo:rerun-if-changed={}", outline_path.to_str().unwrap());
+    }
+
     c_config.compile("tree-sitter-quarto2");
+
+    let inline_dir = std::path::Path::new("inline").join("src");
+
+    let mut inline_config = cc::Build::new();
+    inline_config.std("c11").include(&inline_dir);
+
+    #[cfg(target_env = "msvc")]
+    inline_config.flag("-utf-8");
+
+    for name in ["parser.c", "scanner.c"] {
+        let path = inline_dir.join(name);
+        inline_config.file(&path);
+        println!("cargo:rerun-if-changed={}", path.to_str().unwrap());
+    }
+
+    inline_config.compile("tree-sitter-quarto2-inline");
 }
@@ -0,0 +1,246 @@
+//! Parsing many documents at once, behind the `parallel` feature.
+//!
+//! [`parse_corpus`] reads and parses a list of files on the rayon thread
+//! pool, one file per task. Each worker thread keeps a block and an inline
+//! parser for the files it is given. Run it inside
+//! [`rayon::ThreadPool::install`] to choose the number of threads. How the
+//! files per second grow with the thread count has not been measured yet;
+//! `benches/corpus.rs` measures it.
+
+use std::cell::RefCell;
+use std::fmt;
+use std::fs;
+use std::io;
+use std::ops::Range;
+use std::os::raw::c_char;
+use std::path::{Path, PathBuf};
+
+use rayon::prelude::*;
+use tree_sitter::{Node, Parser, Tree};
+
+#[repr(C)]
+#[derive(Clone, Copy, Default)]
+struct TSQuartoHeading {
+    level: u8,
+    start_byte: u32,
+    end_byte: u32,
+    attribute_start_byte: u32,
+    attribute_end_byte: u32,
+}
+
+#[repr(C)]
+struct TSQuartoOutline {
+    title_start_byte: u32,
+    title_end_byte: u32,
+    heading_count: u32,
+}
+
+extern "C" {
+    fn tree_sitter_quarto_outline(
+        source: *const c_char,
+        length: u32,
+        headings: *mut TSQuartoHeading,
+        count: u32,
+    ) -> TSQuartoOutline;
+}
+
+/// A heading of a document.
+#[derive(Clone, Debug, PartialEq, Eq)]
+pub struct Heading {
+    pub level: u8,
+    pub text: String,
+    /// The trailing `{...}` attribute block, if there is one.
+    pub attributes: Option<String>,
+    /// The bytes of `text` in the document.
+    pub byte_range: Range<usize>,
+}
+
+/// The front matter title and the headings of a document, in document
+/// order.
+#[derive(Clone, Debug, Default, PartialEq, Eq)]
+pub struct Outline {
+    pub title: Option<String>,
+    pub headings: Vec<Heading>,
+}
+
+#[derive(Clone, Debug, PartialEq, Eq)]
+pub enum DiagnosticKind {
+    /// Text the parser could not make sense of.
+    Error,
+    /// A node of the given kind that the parser had to assume, such as a
+    /// closing delimiter.
+    Missing(&'static str),
+}
+
+/// A syntax error in a document, from either grammar.
+#[derive(Clone, Debug, PartialEq, Eq)]
+pub struct Diagnostic {
+    pub kind: DiagnosticKind,
+    pub range: tree_sitter::Range,
+}
+
+impl Diagnostic {
+    fn new(node: Node) -> Self {
+        let kind = if node.is_missing() {
+            DiagnosticKind::Missing(node.kind())
+        } else {
+            DiagnosticKind::Error
+        };
+        Diagnostic { kind, range: node.range() }
+    }
+}
+
+impl fmt::Display for Diagnostic {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        let point = self.range.start_point;
+        write!(f, "{}:{}: ", point.row + 1, point.column + 1)?;
+        match self.kind {
+            DiagnosticKind::Error => write!(f, "syntax error"),
+            DiagnosticKind::Missing(kind) => write!(f, "missing {kind}"),
+        }
+    }
+}
+
+/// The outline and diagnostics of one file.
+#[derive(Clone, Debug)]
+pub struct Document {
+    pub path: PathBuf,
+    pub outline: Outline,
+    pub diagnostics: Vec<Diagnostic>,
+}
+
+struct Parsers {
+    block: Parser,
+    inline: Parser,
+    inline_kind: u16,
+}
+
+impl Parsers {
+    fn new() -> Self {
+        let language: tree_sitter::Language = crate::LANGUAGE.into();
+        let inline_kind = language.id_for_node_kind("inline", true);
+        let mut block = Parser::new();
+        block.set_language(&language).expect("Error loading Quarto parser");
+        let mut inline = Parser::new();
+        inline
+            .set_language(&crate::INLINE_LANGUAGE.into())
+            .expect("Error loading Quarto inline parser");
+        Parsers { block, inline, inline_kind }
+    }
+}
+
+thread_local! {
+    // each rayon worker keeps its parsers for the files it is given
+    static PARSERS: RefCell<Parsers> = RefCell::new(Parsers::new());
+}
+
+/// Reads and parses the given files in parallel, returning a result for
+/// each one in the same order.
+pub fn parse_corpus<P: AsRef<Path> + Sync>(paths: &[P]) -> Vec<io::Result<Document>> {
+    paths.par_iter().map(|path| parse_file(path.as_ref())).collect()
+}
+
+/// Reads and parses one file on the current thread.
+pub fn parse_file(path: &Path) -> io::Result<Document> {
+    let source = fs::read(path)
+        .map_err(|error| io::Error::new(error.kind(), format!("{}: {error}", path.display())))?;
+    let (outline, diagnostics) = parse_source(&source).ok_or_else(|| {
+        io::Error::new(
+            io::ErrorKind::InvalidData,
+            format!("{}: documents are limited to 4 GiB", path.display()),
+        )
+    })?;
+    Ok(Document { path: path.to_owned(), outline, diagnostics })
+}
+
+/// The outline and the diagnostics of a document, or `None` if it is too
+/// large to parse.
+pub fn parse_source(source: &[u8]) -> Option<(Outline, Vec<Diagnostic>)> {
+    let length = u32::try_from(source.len()).ok()?;
+    let outline = outline(source, length);
+    let diagnostics = PARSERS.with(|parsers| diagnostics(&mut parsers.borrow_mut(), source));
+    Some((outline, diagnostics))
+}
+
+fn text(source: &[u8], start: u32, end: u32) -> Option<String> {
+    (start != end).then(|| String::from_utf8_lossy(&source[start as usize..end as usize]).into_owned())
+}
+
+fn outline(source: &[u8], length: u32) -> Outline {
+    // a guess that fits most documents, so the outline is read once
+    let mut headings = vec![TSQuartoHeading::default(); source.len() / 256 + 64];
+    let read = |headings: &mut Vec<TSQuartoHeading>| unsafe {
+        tree_sitter_quarto_outline(
+            source.as_ptr().cast(),
+            length,
+            headings.as_mut_ptr(),
+            headings.len() as u32,
+        )
+    };
+    let mut outline = read(&mut headings);
+    if outline.heading_count as usize > headings.len() {
+        headings.resize(outline.heading_count as usize, TSQuartoHeading::default());
+        outline = read(&mut headings);
+    }
+    headings.truncate(outline.heading_count as usize);
+
+    Outline {
+        title: text(source, outline.title_start_byte, outline.title_end_byte),
+        headings: headings
+            .iter()
+            .map(|heading| Heading {
+                level: heading.level,
+                text: text(source, heading.start_byte, heading.end_byte).unwrap_or_default(),
+                attributes: text(source, heading.attribute_start_byte, heading.attribute_end_byte),
+                byte_range: heading.start_byte as usize..heading.end_byte as usize,
+            })
+            .collect(),
+    }
+}
+
+/// calls `visit` with the nodes of `tree` in preorder, skipping the
+/// descendants of a node if it returns false
+fn walk<'t>(tree: &'t Tree, mut visit: impl FnMut(Node<'t>) -> bool) {
+    let mut cursor = tree.walk();
+    loop {
+        if visit(cursor.node()) && cursor.goto_first_child() {
+            continue;
+        }
+        while !cursor.goto_next_sibling() {
+            if !cursor.goto_parent() {
+                return;
+            }
+        }
+    }
+}
+
+fn diagnostics(parsers: &mut Parsers, source: &[u8]) -> Vec<Diagnostic> {
+    let mut diagnostics = Vec::new();
+    let Some(tree) = parsers.block.parse(source, None) else {
+        return diagnostics;
+    };
+    let Parsers { inline, inline_kind, .. } = parsers;
+    walk(&tree, |node| {
+        if node.is_error() || node.is_missing() {
+            diagnostics.push(Diagnostic::new(node));
+            return false;
+        }
+        if node.kind_id() == *inline_kind {
+            // parsed in place, so the positions are those in the document
+            if inline.set_included_ranges(&[node.range()]).is_ok() {
+                if let Some(inline_tree) = inline.parse(source, None) {
+                    walk(&inline_tree, |node| {
+                        if node.is_error() || node.is_missing() {
+                            diagnostics.push(Diagnostic::new(node));
+                            return false;
+                        }
+                        node.has_error()
+                    });
+                }
+            }
+            return false;
+        }
+        true
+    });
+    diagnostics
+}
@@ -15,13 +15,23 @@
 //! assert!(!tree.root_node().has_error());
 //! ```
 //!
+//! With the `parallel` feature, [`parse_corpus`] parses many files at once
+//! and returns the outline and the syntax errors of each one.
+//!
 //! [`Parser`]: https://docs.rs/tree-sitter/0.25.4/tree_sitter/struct.Parser.html
 //! [tree-sitter]: https://tree-sitter.github.io/
 
 use tree_sitter_language::LanguageFn;
 
+#[cfg(feature = "parallel")]
+mod corpus;
+
+#[cfg(feature = "parallel")]
+pub use corpus::*;
+
 extern "C" {
     fn tree_sitter_quarto() -> *const ();
+    fn tree_sitter_quarto_inline() -> *const ();
 }
 
 /// The tree-sitter [`LanguageFn`] for this grammar.
@@ -32,10 +42,19 @@ pub const LANGUAGE: LanguageFn = unsafe { LanguageFn::from_raw(tree_sitter_quart
 /// [`node-types.json`]: https://tree-sitter.github.io/tree-sitter/using-parsers/6-static-node-types
 pub const NODE_TYPES: &str = include_str!("../../src/node-types.json");
 
+/// The tree-sitter [`LanguageFn`] for the text of `inline` nodes. Each one
+/// is parsed on its own, see [`INJECTIONS_QUERY`].
+pub const INLINE_LANGUAGE: LanguageFn = unsafe { LanguageFn::from_raw(tree_sitter_quarto_inline) };
+
+/// The content of the [`node-types.json`] file for the inline grammar.
+///
+/// [`node-types.json`]: https://tree-sitter.github.io/tree-sitter/using-parsers/6-static-node-types
+pub const INLINE_NODE_TYPES: &str = include_str!("../../inline/src/node-types.json");
+
 // NOTE: uncomment these to include any queries that this grammar contains:
 
 // pub const HIGHLIGHTS_QUERY: &str = include_str!("../../queries/highlights.scm");
-// pub const INJECTIONS_QUERY: &str = include_str!("../../queries/injections.scm");
+pub const INJECTIONS_QUERY: &str = include_str!("../../queries/injections.scm");
 // pub const LOCALS_QUERY: &str = include_str!("../../queries/locals.scm");
 // pub const TAGS_QUERY: &str = include_str!("../../queries/tags.scm");
 
@@ -48,4 +67,73 @@ mod tests {
             .set_language(&super::LANGUAGE.into())
             .expect("Error loading Quarto parser");
     }
+
+    #[test]
+    fn test_can_load_inline_grammar() {
+        let mut parser = tree_sitter::Parser::new();
+        parser
+            .set_language(&super::INLINE_LANGUAGE.into())
+            .expect("Error loading Quarto inline parser");
+    }
+
+    #[test]
+    fn test_attribute_ranges() {
+        let mut parser = tree_sitter::Parser::new();
+        parser
+            .set_language(&super::INLINE_LANGUAGE.into())
+            .expect("Error loading Quarto inline parser");
+        let code = "[text]{  #my-id   .a\t.b  key=val  }\n";
+        let tree = parser.parse(code, None).unwrap();
+
+        let mut pieces = Vec::new();
+        let mut cursor = tree.walk();
+        'walk: loop {
+            let node = cursor.node();
+            if node.kind().starts_with("attribute_") && node.kind() != "attribute_block" {
+                pieces.push((node.kind(), node.utf8_text(code.as_bytes()).unwrap()));
+            }
+            if cursor.goto_first_child() || cursor.goto_next_sibling() {
+                continue;
+            }
+            while cursor.goto_parent() {
+                if cursor.goto_next_sibling() {
+                    continue 'walk;
+                }
+            }
+            break;
+        }
+        assert_eq!(
+            pieces,
+            [
+                ("attribute_start", "{"),
+                ("attribute_id", "#my-id"),
+                ("attribute_class", ".a"),
+                ("attribute_class", ".b"),
+                ("attribute_key", "key"),
+                ("attribute_value", "val"),
+                ("attribute_end", "}"),
+            ]
+        );
+    }
+
+    #[cfg(feature = "parallel")]
+    #[test]
+    fn test_parse_corpus() {
+        let root = std::path::Path::new(env!("CARGO_MANIFEST_DIR"));
+        let paths = [root.join("example-file.qmd"), root.join("missing.qmd")];
+        let results = super::parse_corpus(&paths);
+        assert_eq!(results.len(), 2);
+
+        let document = results[0].as_ref().expect("Error parsing example-file.qmd");
+        assert_eq!(document.path, paths[0]);
+        let headings = &document.outline.headings;
+        assert_eq!(headings[0].level, 1);
+        assert_eq!(headings[0].text, "title");
+        assert_eq!(headings[0].attributes.as_deref(), Some("{#sec-main, .class, hello=\"world\"}"));
+        assert_eq!(headings[1].level, 2);
+        assert_eq!(headings[1].text, "subsection");
+
+        let error = results[1].as_ref().unwrap_err();
+        assert_eq!(error.kind(), std::io::ErrorKind::NotFound);
+    }
 }
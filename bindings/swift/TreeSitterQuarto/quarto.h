@@ -9,6 +9,9 @@ extern "C" {
 
 const TSLanguage *tree_sitter_quarto(void);
 
+// the grammar for the text of paragraphs and headings, see `inline/`
+const TSLanguage *tree_sitter_quarto_inline(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -9,4 +9,11 @@ final class TreeSitterQuartoTests: XCTestCase {
         XCTAssertNoThrow(try parser.setLanguage(language),
                          "Error loading Quarto grammar")
     }
+
+    func testCanLoadInlineGrammar() throws {
+        let parser = Parser()
+        let language = Language(language: tree_sitter_quarto_inline())
+        XCTAssertNoThrow(try parser.setLanguage(language),
+                         "Error loading Quarto inline grammar")
+    }
 }
@@ -7,6 +7,9 @@
 /// <reference types="tree-sitter-cli/dsl" />
 // @ts-check
 
+// Block structure only. The text of paragraphs and headings is emitted by
+// the scanner as `inline` nodes, which are parsed by the grammar in
+// `inline/` so that an edit only needs the affected node reparsed.
 module.exports = grammar({
   name: "quarto",
 
@@ -17,17 +20,19 @@ module.exports = grammar({
   ],
 
   externals: ($) => [
-    $._line_start,
     $.line_end,
-    $._emph_star_start,
-    $._emph_star_end,
-    $._emph_under_start,
-    $._emph_under_end,
-    $._strong_star_start,
-    $._strong_star_end,
-    $._strong_under_start,
-    $._strong_under_end,
-    $._no_parse,
+    $.inline,
+    $._atx_heading_inline,
+    $._setext_heading_inline,
+    $.atx_h1_marker,
+    $.atx_h2_marker,
+    $.atx_h3_marker,
+    $.atx_h4_marker,
+    $.atx_h5_marker,
+    $.atx_h6_marker,
+    $.setext_h1_underline,
+    $.setext_h2_underline,
+    $._atx_closing_sequence,
     $._unused_error,
   ],
 
@@ -37,14 +42,12 @@ module.exports = grammar({
     comment: ($) => token(seq("<!--", /.*/, "-->")),
 
     _yaml: ($) => choice(),
-    paragraph: ($) => prec.right(3, seq(repeat1($._line), $.paragraph_end)),
-    line_break: ($) =>
+    // the inline node holds every line of the paragraph, up to the blank
+    // line that ends it
+    paragraph: ($) =>
       prec.right(
-        2,
-        choice(
-          seq(token.immediate("\\"), $.line_end),
-          seq(token.immediate("  "), $.line_end),
-        ),
+        3,
+        seq($.inline, optional(seq($.line_end, optional($.paragraph_end)))),
       ),
     paragraph_end: ($) =>
       prec.right(
@@ -55,121 +58,39 @@ module.exports = grammar({
         //   seq($.line_end, repeat1($.line_end)),
         // ),
       ),
-    _line_content: ($) =>
-      repeat1(
-        choice(
-          $.strong,
-          $.emph,
-          $.word,
-          $.puncuation,
-          $.literal,
-          $.symbols,
-          alias($._no_parse, $.literal),
-        ),
-      ), //, $.whitespace)), //prec(1, repeat1(choice($.word, $.whitespace))),
-    _line: ($) =>
-      prec.right(
-        2,
-        seq($._line_start, $._line_content, choice($.line_break, $.line_end)),
-      ), //prec.right(seq($._line, optional($.line_end))),
-    word: ($) => /[\p{L}\p{N}]+/,
-    puncuation: ($) =>
-      choice(
-        $.period,
-        $.comma,
-        $.question,
-        $.exclamation,
-        $.colon,
-        $.semi_colon,
-        $.quotation,
-      ),
-    period: ($) => ".",
-    comma: ($) => ",",
-    exclamation: ($) => "!",
-    question: ($) => "?",
-    colon: ($) => ":",
-    semi_colon: ($) => ";",
-    quotation: ($) => choice($.single_quote, $.double_quote),
-    single_quote: ($) => "'",
-    double_quote: ($) => '"',
-    symbols: ($) => /[@#\$%\^\&\*\(\)_\+\=\-/><~\\]/,
-    literal: ($) => prec(10, /\\[@#\$%\^\&\*\(\)_\+\=\-/><~\\ ]/),
     content: ($) => prec.right(seq(repeat($.line_end), repeat1($.paragraph))),
     _section: ($) =>
       prec.right(choice(seq($.heading, $.content), $.heading, $.content)),
+    // the scanner emits a setext heading's text in place of a paragraph
+    // when the next line is an underline
     heading: ($) =>
-      seq(
-        $._line_start,
-        choice(
-          $.heading_1,
-          $.heading_2,
-          $.heading_3,
-          $.heading_4,
-          $.heading_5,
-          $.heading_6,
-        ),
-      ),
-    heading_1: ($) => prec.right(seq("#", $._line, repeat($.line_end))),
-    heading_2: ($) => prec.right(seq("##", $._line, repeat($.line_end))),
-    heading_3: ($) => prec.right(seq("###", $._line, repeat($.line_end))),
-    heading_4: ($) => prec.right(seq("####", $._line, repeat($.line_end))),
-    heading_5: ($) => prec.right(seq("#####", $._line, repeat($.line_end))),
-    heading_6: ($) => prec.right(seq("######", $._line, repeat($.line_end))),
-
-    emph: ($) => choice(prec(3, $._emph_star), prec(3, $._emph_under)),
-    _emph_star: ($) =>
-      seq(
-        alias($._emph_star_start, $.emph_start),
-        $._line_content,
-        alias($._emph_star_end, $.emph_end),
-      ),
-    _emph_under: ($) =>
-      seq(
-        alias($._emph_under_start, $.emph_start),
-        $._line_content,
-        alias($._emph_under_end, $.emph_end),
-      ),
-    _emph_content: ($) =>
       prec.right(
-        repeat1(
-          seq(
-            repeat1(
-              choice($.word, $.puncuation, $.literal, $.symbols, $.strong),
+        seq(
+          choice(
+            seq(
+              choice(
+                $.atx_h1_marker,
+                $.atx_h2_marker,
+                $.atx_h3_marker,
+                $.atx_h4_marker,
+                $.atx_h5_marker,
+                $.atx_h6_marker,
+              ),
+              optional(alias($._atx_heading_inline, $.inline)),
+              optional($._atx_closing_sequence),
+            ),
+            seq(
+              alias($._setext_heading_inline, $.inline),
+              $.line_end,
+              choice($.setext_h1_underline, $.setext_h2_underline),
             ),
-            optional(choice($.line_break, $.line_end)),
-          ),
-        ),
-      ),
-    strong: ($) => choice(prec(3, $._strong_star), prec(3, $._strong_under)),
-    // strong: ($) => $._strong_star,
-    _strong_star: ($) =>
-      seq(
-        alias($._strong_star_start, $.strong_start),
-        $._strong_content,
-        alias($._strong_star_end, $.strong_end),
-      ),
-    _strong_under: ($) =>
-      seq(
-        alias($._strong_under_start, $.strong_start),
-        $._strong_content,
-        alias($._strong_under_end, $.strong_end),
-      ),
-    _strong_content: ($) =>
-      prec.right(
-        repeat1(
-          seq(
-            repeat1(choice($.word, $.puncuation, $.literal, $.symbols, $.emph)),
-            optional(choice($.line_break, $.line_end)),
           ),
+          repeat($.line_end),
         ),
       ),
   },
 
-  conflicts: ($) => [
-    [$._emph_content],
-    [$._strong_content],
-    // [$.paragraph],
-    // [$.paragraph, $.line],
-    // [$.paragraph, $.word],
-  ],
+  // none are needed: every entry of the generated table has a single
+  // action, so the parser never forks a second stack
+  conflicts: ($) => [],
 });
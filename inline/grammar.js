@@ -0,0 +1,204 @@
+/**
+ * @file Quarto inline syntax, parsed within the inline ranges of the
+ * block grammar
+ * @author jtlandis <jtlandis314@gmail.com>
+ * @license MIT
+ */
+
+/// <reference types="tree-sitter-cli/dsl" />
+// @ts-check
+
+module.exports = grammar({
+  name: "quarto_inline",
+
+  extras: ($) => [
+    // The below symbol matches any whitespace character (spaces, tabs, line breaks, etc.)
+    /\s+/,
+    $.comment,
+  ],
+
+  externals: ($) => [
+    $._line_start,
+    $.line_end,
+    $._emph_star_start,
+    $._emph_star_end,
+    $._emph_under_start,
+    $._emph_under_end,
+    $._strong_star_start,
+    $._strong_star_end,
+    $._strong_under_start,
+    $._strong_under_end,
+    $._no_parse,
+    $._link_start,
+    $._image_start,
+    $._link_end,
+    $.link_destination,
+    $._span_start,
+    $._attribute_start,
+    $.attribute_id,
+    $.attribute_class,
+    $.attribute_key,
+    $.attribute_value,
+    $._attribute_end,
+    $.inline_math,
+    $.display_math,
+    $.citation,
+    $.cross_reference,
+    $._citation_group_start,
+    $.citation_prefix,
+    $.citation_locator,
+    $._shortcode_start,
+    $.shortcode_name,
+    $.shortcode_argument,
+    $._shortcode_end,
+    $.shortcode_escaped,
+    $.text,
+    $._trailing_attribute_start,
+    $._unused_error,
+  ],
+
+  rules: {
+    // the text of one inline node of the block grammar: the lines of a
+    // paragraph, or a heading with its trailing attributes
+    inline: ($) =>
+      seq(
+        $._line,
+        repeat(seq(choice($.line_break, $.line_end), $._line)),
+        optional(alias($._trailing_attribute_block, $.attribute_block)),
+        optional(choice($.line_break, $.line_end)),
+      ),
+
+    comment: ($) => token(seq("<!--", /.*/, "-->")),
+
+    line_break: ($) =>
+      prec.right(
+        2,
+        choice(
+          seq(token.immediate("\\"), $.line_end),
+          seq(token.immediate("  "), $.line_end),
+        ),
+      ),
+    _line_content: ($) =>
+      repeat1(
+        choice(
+          $.strong,
+          $.emph,
+          $.link,
+          $.image,
+          $.span,
+          $.inline_math,
+          $.display_math,
+          $.citation,
+          $.cross_reference,
+          $.citation_group,
+          $.shortcode,
+          $.shortcode_escaped,
+          $.text,
+          $.literal,
+          $.symbols,
+          alias($._no_parse, $.literal),
+        ),
+      ), //, $.whitespace)), //prec(1, repeat1(choice($.word, $.whitespace))),
+    _line: ($) => seq($._line_start, $._line_content),
+    // separates the items of a citation group. Elsewhere punctuation is
+    // part of the surrounding text run.
+    semi_colon: ($) => ";",
+    symbols: ($) => /[@#\$%\^\&\*\(\)_\+\=\-/><~\\\[\]\{\}]/,
+    literal: ($) => prec(10, /\\[@#\$%\^\&\*\(\)_\+\=\-/><~\\ ]/),
+
+    emph: ($) => choice(prec(3, $._emph_star), prec(3, $._emph_under)),
+    _emph_star: ($) =>
+      seq(
+        alias($._emph_star_start, $.emph_start),
+        $._inline_content,
+        alias($._emph_star_end, $.emph_end),
+      ),
+    _emph_under: ($) =>
+      seq(
+        alias($._emph_under_start, $.emph_start),
+        $._inline_content,
+        alias($._emph_under_end, $.emph_end),
+      ),
+    // content of emphasis and strong. Unlike a line it may run on past a
+    // line end, which always separates two runs of line content.
+    _inline_content: ($) =>
+      seq(
+        $._line_content,
+        repeat(seq(choice($.line_break, $.line_end), $._line_content)),
+      ),
+    link: ($) =>
+      seq(
+        alias($._link_start, $.link_start),
+        optional($._line_content),
+        alias($._link_end, $.link_end),
+        $.link_destination,
+        optional($.attribute_block),
+      ),
+    image: ($) =>
+      seq(
+        alias($._image_start, $.image_start),
+        optional($._line_content),
+        alias($._link_end, $.link_end),
+        $.link_destination,
+        optional($.attribute_block),
+      ),
+    span: ($) =>
+      seq(
+        alias($._span_start, $.span_start),
+        optional($._line_content),
+        alias($._link_end, $.span_end),
+        $.attribute_block,
+      ),
+    attribute_block: ($) =>
+      seq(
+        alias($._attribute_start, $.attribute_start),
+        repeat(choice($.attribute_id, $.attribute_class, $.attribute)),
+        alias($._attribute_end, $.attribute_end),
+      ),
+    _trailing_attribute_block: ($) =>
+      seq(
+        alias($._trailing_attribute_start, $.attribute_start),
+        repeat(choice($.attribute_id, $.attribute_class, $.attribute)),
+        alias($._attribute_end, $.attribute_end),
+      ),
+    attribute: ($) => seq($.attribute_key, "=", $.attribute_value),
+    citation_group: ($) =>
+      seq(
+        alias($._citation_group_start, $.citation_group_start),
+        $.citation_item,
+        repeat(seq($.semi_colon, $.citation_item)),
+        alias($._link_end, $.citation_group_end),
+      ),
+    citation_item: ($) =>
+      seq(
+        optional($.citation_prefix),
+        choice($.citation, $.cross_reference),
+        optional($.citation_locator),
+      ),
+    shortcode: ($) =>
+      seq(
+        alias($._shortcode_start, $.shortcode_start),
+        $.shortcode_name,
+        repeat($.shortcode_argument),
+        alias($._shortcode_end, $.shortcode_end),
+      ),
+    strong: ($) => choice(prec(3, $._strong_star), prec(3, $._strong_under)),
+    // strong: ($) => $._strong_star,
+    _strong_star: ($) =>
+      seq(
+        alias($._strong_star_start, $.strong_start),
+        $._inline_content,
+        alias($._strong_star_end, $.strong_end),
+      ),
+    _strong_under: ($) =>
+      seq(
+        alias($._strong_under_start, $.strong_start),
+        $._inline_content,
+        alias($._strong_under_end, $.strong_end),
+      ),
+  },
+
+  // none are needed: every entry of the generated table has a single
+  // action, so the parser never forks a second stack
+  conflicts: ($) => [],
+});
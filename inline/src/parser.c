@@ -0,0 +1,11772 @@
+/* Automatically @generated from src/grammar.json for tree-sitter v0.25.4 (ABI 15) */
+
+#include "tree_sitter/parser.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+#endif
+
+#define LANGUAGE_VERSION 15
+#define STATE_COUNT 371
+#define LARGE_STATE_COUNT 16
+#define SYMBOL_COUNT 71
+#define ALIAS_COUNT 2
+#define TOKEN_COUNT 45
+#define EXTERNAL_TOKEN_COUNT 37
+#define FIELD_COUNT 0
+#define MAX_ALIAS_SEQUENCE_LENGTH 5
+#define MAX_RESERVED_WORD_SET_SIZE 0
+#define PRODUCTION_ID_COUNT 5
+#define SUPERTYPE_COUNT 0
+
+enum ts_symbol_identifiers {
+  sym_comment = 1,
+  anon_sym_BSLASH = 2,
+  anon_sym_ = 3,
+  sym_semi_colon = 4,
+  sym_symbols = 5,
+  aux_sym_literal_token1 = 6,
+  anon_sym_EQ = 7,
+  sym__line_start = 8,
+  sym_line_end = 9,
+  sym__emph_star_start = 10,
+  sym__emph_star_end = 11,
+  sym__emph_under_start = 12,
+  sym__emph_under_end = 13,
+  sym__strong_star_start = 14,
+  sym__strong_star_end = 15,
+  sym__strong_under_start = 16,
+  sym__strong_under_end = 17,
+  sym__no_parse = 18,
+  sym__link_start = 19,
+  sym__image_start = 20,
+  sym__link_end = 21,
+  sym_link_destination = 22,
+  sym__span_start = 23,
+  sym__attribute_start = 24,
+  sym_attribute_id = 25,
+  sym_attribute_class = 26,
+  sym_attribute_key = 27,
+  sym_attribute_value = 28,
+  sym__attribute_end = 29,
+  sym_inline_math = 30,
+  sym_display_math = 31,
+  sym_citation = 32,
+  sym_cross_reference = 33,
+  sym__citation_group_start = 34,
+  sym_citation_prefix = 35,
+  sym_citation_locator = 36,
+  sym__shortcode_start = 37,
+  sym_shortcode_name = 38,
+  sym_shortcode_argument = 39,
+  sym__shortcode_end = 40,
+  sym_shortcode_escaped = 41,
+  sym_text = 42,
+  sym__trailing_attribute_start = 43,
+  sym__unused_error = 44,
+  sym_inline = 45,
+  sym_line_break = 46,
+  aux_sym__line_content = 47,
+  sym__line = 48,
+  sym_literal = 49,
+  sym_emph = 50,
+  sym__emph_star = 51,
+  sym__emph_under = 52,
+  sym__inline_content = 53,
+  sym_link = 54,
+  sym_image = 55,
+  sym_span = 56,
+  sym_attribute_block = 57,
+  sym__trailing_attribute_block = 58,
+  sym_attribute = 59,
+  sym_citation_group = 60,
+  sym_citation_item = 61,
+  sym_shortcode = 62,
+  sym_strong = 63,
+  sym__strong_star = 64,
+  sym__strong_under = 65,
+  aux_sym_inline_repeat1 = 66,
+  aux_sym__inline_content_repeat1 = 67,
+  aux_sym_attribute_block_repeat1 = 68,
+  aux_sym_citation_group_repeat1 = 69,
+  aux_sym_shortcode_repeat1 = 70,
+  alias_sym_citation_group_end = 71,
+  alias_sym_span_end = 72,
+};
+
+static const char * const ts_symbol_names[] = {
+  [ts_builtin_sym_end] = "end",
+  [sym_comment] = "comment",
+  [anon_sym_BSLASH] = "\\",
+  [anon_sym_] = "  ",
+  [sym_semi_colon] = "semi_colon",
+  [sym_symbols] = "symbols",
+  [aux_sym_literal_token1] = "literal_token1",
+  [anon_sym_EQ] = "=",
+  [sym__line_start] = "_line_start",
+  [sym_line_end] = "line_end",
+  [sym__emph_star_start] = "emph_start",
+  [sym__emph_star_end] = "emph_end",
+  [sym__emph_under_start] = "emph_start",
+  [sym__emph_under_end] = "emph_end",
+  [sym__strong_star_start] = "strong_start",
+  [sym__strong_star_end] = "strong_end",
+  [sym__strong_under_start] = "strong_start",
+  [sym__strong_under_end] = "strong_end",
+  [sym__no_parse] = "literal",
+  [sym__link_start] = "link_start",
+  [sym__image_start] = "image_start",
+  [sym__link_end] = "link_end",
+  [sym_link_destination] = "link_destination",
+  [sym__span_start] = "span_start",
+  [sym__attribute_start] = "attribute_start",
+  [sym_attribute_id] = "attribute_id",
+  [sym_attribute_class] = "attribute_class",
+  [sym_attribute_key] = "attribute_key",
+  [sym_attribute_value] = "attribute_value",
+  [sym__attribute_end] = "attribute_end",
+  [sym_inline_math] = "inline_math",
+  [sym_display_math] = "display_math",
+  [sym_citation] = "citation",
+  [sym_cross_reference] = "cross_reference",
+  [sym__citation_group_start] = "citation_group_start",
+  [sym_citation_prefix] = "citation_prefix",
+  [sym_citation_locator] = "citation_locator",
+  [sym__shortcode_start] = "shortcode_start",
+  [sym_shortcode_name] = "shortcode_name",
+  [sym_shortcode_argument] = "shortcode_argument",
+  [sym__shortcode_end] = "shortcode_end",
+  [sym_shortcode_escaped] = "shortcode_escaped",
+  [sym_text] = "text",
+  [sym__trailing_attribute_start] = "attribute_start",
+  [sym__unused_error] = "_unused_error",
+  [sym_inline] = "inline",
+  [sym_line_break] = "line_break",
+  [aux_sym__line_content] = "_line_content",
+  [sym__line] = "_line",
+  [sym_literal] = "literal",
+  [sym_emph] = "emph",
+  [sym__emph_star] = "_emph_star",
+  [sym__emph_under] = "_emph_under",
+  [sym__inline_content] = "_inline_content",
+  [sym_link] = "link",
+  [sym_image] = "image",
+  [sym_span] = "span",
+  [sym_attribute_block] = "attribute_block",
+  [sym__trailing_attribute_block] = "attribute_block",
+  [sym_attribute] = "attribute",
+  [sym_citation_group] = "citation_group",
+  [sym_citation_item] = "citation_item",
+  [sym_shortcode] = "shortcode",
+  [sym_strong] = "strong",
+  [sym__strong_star] = "_strong_star",
+  [sym__strong_under] = "_strong_under",
+  [aux_sym_inline_repeat1] = "inline_repeat1",
+  [aux_sym__inline_content_repeat1] = "_inline_content_repeat1",
+  [aux_sym_attribute_block_repeat1] = "attribute_block_repeat1",
+  [aux_sym_citation_group_repeat1] = "citation_group_repeat1",
+  [aux_sym_shortcode_repeat1] = "shortcode_repeat1",
+  [alias_sym_citation_group_end] = "citation_group_end",
+  [alias_sym_span_end] = "span_end",
+};
+
+static const TSSymbol ts_symbol_map[] = {
+  [ts_builtin_sym_end] = ts_builtin_sym_end,
+  [sym_comment] = sym_comment,
+  [anon_sym_BSLASH] = anon_sym_BSLASH,
+  [anon_sym_] = anon_sym_,
+  [sym_semi_colon] = sym_semi_colon,
+  [sym_symbols] = sym_symbols,
+  [aux_sym_literal_token1] = aux_sym_literal_token1,
+  [anon_sym_EQ] = anon_sym_EQ,
+  [sym__line_start] = sym__line_start,
+  [sym_line_end] = sym_line_end,
+  [sym__emph_star_start] = sym__emph_star_start,
+  [sym__emph_star_end] = sym__emph_star_end,
+  [sym__emph_under_start] = sym__emph_star_start,
+  [sym__emph_under_end] = sym__emph_star_end,
+  [sym__strong_star_start] = sym__strong_star_start,
+  [sym__strong_star_end] = sym__strong_star_end,
+  [sym__strong_under_start] = sym__strong_star_start,
+  [sym__strong_under_end] = sym__strong_star_end,
+  [sym__no_parse] = sym_literal,
+  [sym__link_start] = sym__link_start,
+  [sym__image_start] = sym__image_start,
+  [sym__link_end] = sym__link_end,
+  [sym_link_destination] = sym_link_destination,
+  [sym__span_start] = sym__span_start,
+  [sym__attribute_start] = sym__attribute_start,
+  [sym_attribute_id] = sym_attribute_id,
+  [sym_attribute_class] = sym_attribute_class,
+  [sym_attribute_key] = sym_attribute_key,
+  [sym_attribute_value] = sym_attribute_value,
+  [sym__attribute_end] = sym__attribute_end,
+  [sym_inline_math] = sym_inline_math,
+  [sym_display_math] = sym_display_math,
+  [sym_citation] = sym_citation,
+  [sym_cross_reference] = sym_cross_reference,
+  [sym__citation_group_start] = sym__citation_group_start,
+  [sym_citation_prefix] = sym_citation_prefix,
+  [sym_citation_locator] = sym_citation_locator,
+  [sym__shortcode_start] = sym__shortcode_start,
+  [sym_shortcode_name] = sym_shortcode_name,
+  [sym_shortcode_argument] = sym_shortcode_argument,
+  [sym__shortcode_end] = sym__shortcode_end,
+  [sym_shortcode_escaped] = sym_shortcode_escaped,
+  [sym_text] = sym_text,
+  [sym__trailing_attribute_start] = sym__attribute_start,
+  [sym__unused_error] = sym__unused_error,
+  [sym_inline] = sym_inline,
+  [sym_line_break] = sym_line_break,
+  [aux_sym__line_content] = aux_sym__line_content,
+  [sym__line] = sym__line,
+  [sym_literal] = sym_literal,
+  [sym_emph] = sym_emph,
+  [sym__emph_star] = sym__emph_star,
+  [sym__emph_under] = sym__emph_under,
+  [sym__inline_content] = sym__inline_content,
+  [sym_link] = sym_link,
+  [sym_image] = sym_image,
+  [sym_span] = sym_span,
+  [sym_attribute_block] = sym_attribute_block,
+  [sym__trailing_attribute_block] = sym_attribute_block,
+  [sym_attribute] = sym_attribute,
+  [sym_citation_group] = sym_citation_group,
+  [sym_citation_item] = sym_citation_item,
+  [sym_shortcode] = sym_shortcode,
+  [sym_strong] = sym_strong,
+  [sym__strong_star] = sym__strong_star,
+  [sym__strong_under] = sym__strong_under,
+  [aux_sym_inline_repeat1] = aux_sym_inline_repeat1,
+  [aux_sym__inline_content_repeat1] = aux_sym__inline_content_repeat1,
+  [aux_sym_attribute_block_repeat1] = aux_sym_attribute_block_repeat1,
+  [aux_sym_citation_group_repeat1] = aux_sym_citation_group_repeat1,
+  [aux_sym_shortcode_repeat1] = aux_sym_shortcode_repeat1,
+  [alias_sym_citation_group_end] = alias_sym_citation_group_end,
+  [alias_sym_span_end] = alias_sym_span_end,
+};
+
+static const TSSymbolMetadata ts_symbol_metadata[] = {
+  [ts_builtin_sym_end] = {
+    .visible = false,
+    .named = true,
+  },
+  [sym_comment] = {
+    .visible = true,
+    .named = true,
+  },
+  [anon_sym_BSLASH] = {
+    .visible = true,
+    .named = false,
+  },
+  [anon_sym_] = {
+    .visible = true,
+    .named = false,
+  },
+  [sym_semi_colon] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_symbols] = {
+    .visible = true,
+    .named = true,
+  },
+  [aux_sym_literal_token1] = {
+    .visible = false,
+    .named = false,
+  },
+  [anon_sym_EQ] = {
+    .visible = true,
+    .named = false,
+  },
+  [sym__line_start] = {
+    .visible = false,
+    .named = true,
+  },
+  [sym_line_end] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__emph_star_start] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__emph_star_end] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__emph_under_start] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__emph_under_end] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__strong_star_start] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__strong_star_end] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__strong_under_start] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__strong_under_end] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__no_parse] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__link_start] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__image_start] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__link_end] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_link_destination] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__span_start] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__attribute_start] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_attribute_id] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_attribute_class] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_attribute_key] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_attribute_value] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__attribute_end] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_inline_math] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_display_math] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_citation] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_cross_reference] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__citation_group_start] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_citation_prefix] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_citation_locator] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__shortcode_start] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_shortcode_name] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_shortcode_argument] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__shortcode_end] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_shortcode_escaped] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_text] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__trailing_attribute_start] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__unused_error] = {
+    .visible = false,
+    .named = true,
+  },
+  [sym_inline] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_line_break] = {
+    .visible = true,
+    .named = true,
+  },
+  [aux_sym__line_content] = {
+    .visible = false,
+    .named = false,
+  },
+  [sym__line] = {
+    .visible = false,
+    .named = true,
+  },
+  [sym_literal] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_emph] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__emph_star] = {
+    .visible = false,
+    .named = true,
+  },
+  [sym__emph_under] = {
+    .visible = false,
+    .named = true,
+  },
+  [sym__inline_content] = {
+    .visible = false,
+    .named = true,
+  },
+  [sym_link] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_image] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_span] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_attribute_block] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__trailing_attribute_block] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_attribute] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_citation_group] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_citation_item] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_shortcode] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_strong] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__strong_star] = {
+    .visible = false,
+    .named = true,
+  },
+  [sym__strong_under] = {
+    .visible = false,
+    .named = true,
+  },
+  [aux_sym_inline_repeat1] = {
+    .visible = false,
+    .named = false,
+  },
+  [aux_sym__inline_content_repeat1] = {
+    .visible = false,
+    .named = false,
+  },
+  [aux_sym_attribute_block_repeat1] = {
+    .visible = false,
+    .named = false,
+  },
+  [aux_sym_citation_group_repeat1] = {
+    .visible = false,
+    .named = false,
+  },
+  [aux_sym_shortcode_repeat1] = {
+    .visible = false,
+    .named = false,
+  },
+  [alias_sym_citation_group_end] = {
+    .visible = true,
+    .named = true,
+  },
+  [alias_sym_span_end] = {
+    .visible = true,
+    .named = true,
+  },
+};
+
+static const TSSymbol ts_alias_sequences[PRODUCTION_ID_COUNT][MAX_ALIAS_SEQUENCE_LENGTH] = {
+  [0] = {0},
+  [1] = {
+    [1] = alias_sym_span_end,
+  },
+  [2] = {
+    [2] = alias_sym_citation_group_end,
+  },
+  [3] = {
+    [2] = alias_sym_span_end,
+  },
+  [4] = {
+    [3] = alias_sym_citation_group_end,
+  },
+};
+
+static const uint16_t ts_non_terminal_alias_map[] = {
+  0,
+};
+
+static const TSStateId ts_primary_state_ids[STATE_COUNT] = {
+  [0] = 0,
+  [1] = 1,
+  [2] = 2,
+  [3] = 2,
+  [4] = 2,
+  [5] = 2,
+  [6] = 6,
+  [7] = 7,
+  [8] = 8,
+  [9] = 7,
+  [10] = 8,
+  [11] = 7,
+  [12] = 8,
+  [13] = 7,
+  [14] = 8,
+  [15] = 7,
+  [16] = 16,
+  [17] = 17,
+  [18] = 18,
+  [19] = 19,
+  [20] = 20,
+  [21] = 21,
+  [22] = 22,
+  [23] = 23,
+  [24] = 24,
+  [25] = 25,
+  [26] = 7,
+  [27] = 16,
+  [28] = 17,
+  [29] = 18,
+  [30] = 19,
+  [31] = 20,
+  [32] = 21,
+  [33] = 22,
+  [34] = 23,
+  [35] = 24,
+  [36] = 25,
+  [37] = 16,
+  [38] = 17,
+  [39] = 18,
+  [40] = 19,
+  [41] = 20,
+  [42] = 21,
+  [43] = 22,
+  [44] = 23,
+  [45] = 24,
+  [46] = 25,
+  [47] = 16,
+  [48] = 17,
+  [49] = 18,
+  [50] = 19,
+  [51] = 20,
+  [52] = 21,
+  [53] = 22,
+  [54] = 23,
+  [55] = 24,
+  [56] = 25,
+  [57] = 16,
+  [58] = 17,
+  [59] = 18,
+  [60] = 19,
+  [61] = 20,
+  [62] = 21,
+  [63] = 22,
+  [64] = 23,
+  [65] = 24,
+  [66] = 25,
+  [67] = 16,
+  [68] = 17,
+  [69] = 18,
+  [70] = 19,
+  [71] = 20,
+  [72] = 21,
+  [73] = 22,
+  [74] = 23,
+  [75] = 24,
+  [76] = 25,
+  [77] = 77,
+  [78] = 78,
+  [79] = 78,
+  [80] = 78,
+  [81] = 78,
+  [82] = 82,
+  [83] = 83,
+  [84] = 84,
+  [85] = 85,
+  [86] = 82,
+  [87] = 83,
+  [88] = 84,
+  [89] = 85,
+  [90] = 82,
+  [91] = 83,
+  [92] = 84,
+  [93] = 85,
+  [94] = 82,
+  [95] = 83,
+  [96] = 84,
+  [97] = 85,
+  [98] = 82,
+  [99] = 83,
+  [100] = 84,
+  [101] = 85,
+  [102] = 102,
+  [103] = 103,
+  [104] = 104,
+  [105] = 105,
+  [106] = 106,
+  [107] = 107,
+  [108] = 108,
+  [109] = 109,
+  [110] = 110,
+  [111] = 111,
+  [112] = 112,
+  [113] = 113,
+  [114] = 114,
+  [115] = 115,
+  [116] = 116,
+  [117] = 117,
+  [118] = 118,
+  [119] = 119,
+  [120] = 120,
+  [121] = 102,
+  [122] = 103,
+  [123] = 104,
+  [124] = 105,
+  [125] = 106,
+  [126] = 107,
+  [127] = 108,
+  [128] = 109,
+  [129] = 110,
+  [130] = 111,
+  [131] = 112,
+  [132] = 113,
+  [133] = 114,
+  [134] = 115,
+  [135] = 116,
+  [136] = 117,
+  [137] = 118,
+  [138] = 119,
+  [139] = 120,
+  [140] = 102,
+  [141] = 103,
+  [142] = 104,
+  [143] = 105,
+  [144] = 106,
+  [145] = 107,
+  [146] = 108,
+  [147] = 109,
+  [148] = 110,
+  [149] = 111,
+  [150] = 112,
+  [151] = 113,
+  [152] = 114,
+  [153] = 115,
+  [154] = 116,
+  [155] = 117,
+  [156] = 118,
+  [157] = 119,
+  [158] = 120,
+  [159] = 102,
+  [160] = 103,
+  [161] = 104,
+  [162] = 105,
+  [163] = 106,
+  [164] = 107,
+  [165] = 108,
+  [166] = 109,
+  [167] = 110,
+  [168] = 111,
+  [169] = 112,
+  [170] = 113,
+  [171] = 114,
+  [172] = 115,
+  [173] = 116,
+  [174] = 117,
+  [175] = 118,
+  [176] = 119,
+  [177] = 120,
+  [178] = 102,
+  [179] = 103,
+  [180] = 104,
+  [181] = 105,
+  [182] = 106,
+  [183] = 107,
+  [184] = 108,
+  [185] = 109,
+  [186] = 110,
+  [187] = 111,
+  [188] = 112,
+  [189] = 113,
+  [190] = 114,
+  [191] = 115,
+  [192] = 116,
+  [193] = 117,
+  [194] = 118,
+  [195] = 119,
+  [196] = 120,
+  [197] = 82,
+  [198] = 83,
+  [199] = 84,
+  [200] = 85,
+  [201] = 102,
+  [202] = 103,
+  [203] = 104,
+  [204] = 105,
+  [205] = 106,
+  [206] = 107,
+  [207] = 108,
+  [208] = 109,
+  [209] = 110,
+  [210] = 111,
+  [211] = 112,
+  [212] = 113,
+  [213] = 114,
+  [214] = 115,
+  [215] = 116,
+  [216] = 117,
+  [217] = 118,
+  [218] = 119,
+  [219] = 120,
+  [220] = 220,
+  [221] = 221,
+  [222] = 222,
+  [223] = 223,
+  [224] = 224,
+  [225] = 225,
+  [226] = 226,
+  [227] = 227,
+  [228] = 228,
+  [229] = 229,
+  [230] = 230,
+  [231] = 226,
+  [232] = 229,
+  [233] = 226,
+  [234] = 229,
+  [235] = 226,
+  [236] = 229,
+  [237] = 227,
+  [238] = 230,
+  [239] = 227,
+  [240] = 230,
+  [241] = 227,
+  [242] = 230,
+  [243] = 227,
+  [244] = 230,
+  [245] = 227,
+  [246] = 230,
+  [247] = 247,
+  [248] = 248,
+  [249] = 249,
+  [250] = 250,
+  [251] = 251,
+  [252] = 252,
+  [253] = 253,
+  [254] = 254,
+  [255] = 250,
+  [256] = 250,
+  [257] = 250,
+  [258] = 250,
+  [259] = 250,
+  [260] = 260,
+  [261] = 261,
+  [262] = 262,
+  [263] = 263,
+  [264] = 264,
+  [265] = 265,
+  [266] = 266,
+  [267] = 267,
+  [268] = 268,
+  [269] = 269,
+  [270] = 262,
+  [271] = 263,
+  [272] = 266,
+  [273] = 267,
+  [274] = 262,
+  [275] = 263,
+  [276] = 266,
+  [277] = 267,
+  [278] = 262,
+  [279] = 263,
+  [280] = 266,
+  [281] = 267,
+  [282] = 262,
+  [283] = 263,
+  [284] = 266,
+  [285] = 267,
+  [286] = 262,
+  [287] = 263,
+  [288] = 266,
+  [289] = 267,
+  [290] = 290,
+  [291] = 291,
+  [292] = 220,
+  [293] = 293,
+  [294] = 294,
+  [295] = 295,
+  [296] = 296,
+  [297] = 297,
+  [298] = 290,
+  [299] = 293,
+  [300] = 290,
+  [301] = 293,
+  [302] = 290,
+  [303] = 293,
+  [304] = 290,
+  [305] = 293,
+  [306] = 290,
+  [307] = 293,
+  [308] = 308,
+  [309] = 309,
+  [310] = 310,
+  [311] = 311,
+  [312] = 312,
+  [313] = 313,
+  [314] = 314,
+  [315] = 315,
+  [316] = 316,
+  [317] = 317,
+  [318] = 318,
+  [319] = 319,
+  [320] = 320,
+  [321] = 321,
+  [322] = 322,
+  [323] = 220,
+  [324] = 310,
+  [325] = 311,
+  [326] = 312,
+  [327] = 313,
+  [328] = 314,
+  [329] = 315,
+  [330] = 316,
+  [331] = 319,
+  [332] = 320,
+  [333] = 310,
+  [334] = 311,
+  [335] = 312,
+  [336] = 313,
+  [337] = 314,
+  [338] = 315,
+  [339] = 316,
+  [340] = 319,
+  [341] = 320,
+  [342] = 311,
+  [343] = 312,
+  [344] = 313,
+  [345] = 314,
+  [346] = 315,
+  [347] = 316,
+  [348] = 319,
+  [349] = 320,
+  [350] = 311,
+  [351] = 312,
+  [352] = 313,
+  [353] = 314,
+  [354] = 315,
+  [355] = 316,
+  [356] = 319,
+  [357] = 320,
+  [358] = 311,
+  [359] = 312,
+  [360] = 313,
+  [361] = 314,
+  [362] = 315,
+  [363] = 316,
+  [364] = 319,
+  [365] = 320,
+  [366] = 309,
+  [367] = 309,
+  [368] = 309,
+  [369] = 309,
+  [370] = 309,
+};
+
+static const TSCharacterRange lex_character_set_1[] = {
+  {'#', '&'}, {'(', '+'}, {'-', '-'}, {'/', '/'}, {'>', '>'}, {'@', '@'}, {'[', '['}, {']', '_'},
+  {'{', '{'}, {'}', '~'},
+};
+
+static const TSCharacterRange lex_character_set_2[] = {
+  {'#', '&'}, {'(', '+'}, {'-', '-'}, {'/', '/'}, {'=', '>'}, {'@', '@'}, {'[', '['}, {']', '_'},
+  {'{', '{'}, {'}', '~'},
+};
+
+static const TSCharacterRange lex_character_set_3[] = {
+  {' ', ' '}, {'#', '&'}, {'(', '+'}, {'-', '-'}, {'/', '/'}, {'<', '>'}, {'@', '@'}, {'\\', '\\'},
+  {'^', '_'}, {'~', '~'},
+};
+
+static bool ts_lex(TSLexer *lexer, TSStateId state) {
+  START_LEXER();
+  eof = lexer->eof(lexer);
+  switch (state) {
+    case 0:
+      if (eof) ADVANCE(17);
+      if (lookahead == ';') ADVANCE(22);
+      if (lookahead == '<') ADVANCE(24);
+      if (lookahead == '=') ADVANCE(27);
+      if (lookahead == '\\') ADVANCE(20);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(14);
+      if (set_contains(lex_character_set_1, 10, lookahead)) ADVANCE(23);
+      END_STATE();
+    case 1:
+      if (lookahead == ' ') ADVANCE(21);
+      if (lookahead == '<') ADVANCE(24);
+      if (lookahead == '\\') ADVANCE(25);
+      if (('\t' <= lookahead && lookahead <= '\r')) SKIP(10);
+      if (set_contains(lex_character_set_2, 10, lookahead)) ADVANCE(23);
+      END_STATE();
+    case 2:
+      if (lookahead == ' ') ADVANCE(21);
+      if (lookahead == '<') ADVANCE(3);
+      if (('\t' <= lookahead && lookahead <= '\r')) SKIP(11);
+      END_STATE();
+    case 3:
+      if (lookahead == '!') ADVANCE(4);
+      END_STATE();
+    case 4:
+      if (lookahead == '-') ADVANCE(5);
+      END_STATE();
+    case 5:
+      if (lookahead == '-') ADVANCE(7);
+      END_STATE();
+    case 6:
+      if (lookahead == '-') ADVANCE(6);
+      if (lookahead == '>') ADVANCE(18);
+      if (lookahead != 0 &&
+          lookahead != '\n' &&
+          lookahead != '-' &&
+          lookahead != '>') ADVANCE(7);
+      END_STATE();
+    case 7:
+      if (lookahead == '-') ADVANCE(8);
+      if (lookahead != 0 &&
+          lookahead != '\n' &&
+          lookahead != '-') ADVANCE(7);
+      END_STATE();
+    case 8:
+      if (lookahead == '-') ADVANCE(6);
+      if (lookahead != 0 &&
+          lookahead != '\n' &&
+          lookahead != '-') ADVANCE(7);
+      END_STATE();
+    case 9:
+      if (lookahead == '<') ADVANCE(3);
+      if (lookahead == '=') ADVANCE(27);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(9);
+      END_STATE();
+    case 10:
+      if (lookahead == '<') ADVANCE(24);
+      if (lookahead == '\\') ADVANCE(25);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(10);
+      if (set_contains(lex_character_set_2, 10, lookahead)) ADVANCE(23);
+      END_STATE();
+    case 11:
+      if (lookahead == '<') ADVANCE(3);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(11);
+      END_STATE();
+    case 12:
+      if (eof) ADVANCE(17);
+      if (lookahead == ' ') ADVANCE(2);
+      if (lookahead == '<') ADVANCE(3);
+      if (lookahead == '\\') ADVANCE(19);
+      if (('\t' <= lookahead && lookahead <= '\r')) SKIP(16);
+      END_STATE();
+    case 13:
+      if (eof) ADVANCE(17);
+      if (lookahead == ' ') ADVANCE(1);
+      if (lookahead == '<') ADVANCE(24);
+      if (lookahead == '\\') ADVANCE(20);
+      if (('\t' <= lookahead && lookahead <= '\r')) SKIP(15);
+      if (set_contains(lex_character_set_2, 10, lookahead)) ADVANCE(23);
+      END_STATE();
+    case 14:
+      if (eof) ADVANCE(17);
+      if (lookahead == ';') ADVANCE(22);
+      if (lookahead == '<') ADVANCE(24);
+      if (lookahead == '=') ADVANCE(27);
+      if (lookahead == '\\') ADVANCE(25);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(14);
+      if (set_contains(lex_character_set_1, 10, lookahead)) ADVANCE(23);
+      END_STATE();
+    case 15:
+      if (eof) ADVANCE(17);
+      if (lookahead == '<') ADVANCE(24);
+      if (lookahead == '\\') ADVANCE(25);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(15);
+      if (set_contains(lex_character_set_2, 10, lookahead)) ADVANCE(23);
+      END_STATE();
+    case 16:
+      if (eof) ADVANCE(17);
+      if (lookahead == '<') ADVANCE(3);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(16);
+      END_STATE();
+    case 17:
+      ACCEPT_TOKEN(ts_builtin_sym_end);
+      END_STATE();
+    case 18:
+      ACCEPT_TOKEN(sym_comment);
+      if (lookahead == '-') ADVANCE(8);
+      if (lookahead != 0 &&
+          lookahead != '\n' &&
+          lookahead != '-') ADVANCE(7);
+      END_STATE();
+    case 19:
+      ACCEPT_TOKEN(anon_sym_BSLASH);
+      END_STATE();
+    case 20:
+      ACCEPT_TOKEN(anon_sym_BSLASH);
+      if (set_contains(lex_character_set_3, 10, lookahead)) ADVANCE(26);
+      END_STATE();
+    case 21:
+      ACCEPT_TOKEN(anon_sym_);
+      END_STATE();
+    case 22:
+      ACCEPT_TOKEN(sym_semi_colon);
+      END_STATE();
+    case 23:
+      ACCEPT_TOKEN(sym_symbols);
+      END_STATE();
+    case 24:
+      ACCEPT_TOKEN(sym_symbols);
+      if (lookahead == '!') ADVANCE(4);
+      END_STATE();
+    case 25:
+      ACCEPT_TOKEN(sym_symbols);
+      if (set_contains(lex_character_set_3, 10, lookahead)) ADVANCE(26);
+      END_STATE();
+    case 26:
+      ACCEPT_TOKEN(aux_sym_literal_token1);
+      END_STATE();
+    case 27:
+      ACCEPT_TOKEN(anon_sym_EQ);
+      END_STATE();
+    default:
+      return false;
+  }
+}
+
+static const TSLexerMode ts_lex_modes[STATE_COUNT] = {
+  [0] = {.lex_state = 0, .external_lex_state = 1},
+  [1] = {.lex_state = 0, .external_lex_state = 2},
+  [2] = {.lex_state = 13, .external_lex_state = 3},
+  [3] = {.lex_state = 13, .external_lex_state = 4},
+  [4] = {.lex_state = 13, .external_lex_state = 5},
+  [5] = {.lex_state = 13, .external_lex_state = 6},
+  [6] = {.lex_state = 13, .external_lex_state = 7},
+  [7] = {.lex_state = 13, .external_lex_state = 7},
+  [8] = {.lex_state = 13, .external_lex_state = 3},
+  [9] = {.lex_state = 13, .external_lex_state = 3},
+  [10] = {.lex_state = 13, .external_lex_state = 4},
+  [11] = {.lex_state = 13, .external_lex_state = 4},
+  [12] = {.lex_state = 13, .external_lex_state = 5},
+  [13] = {.lex_state = 13, .external_lex_state = 5},
+  [14] = {.lex_state = 13, .external_lex_state = 6},
+  [15] = {.lex_state = 13, .external_lex_state = 6},
+  [16] = {.lex_state = 10, .external_lex_state = 8},
+  [17] = {.lex_state = 10, .external_lex_state = 8},
+  [18] = {.lex_state = 10, .external_lex_state = 8},
+  [19] = {.lex_state = 10, .external_lex_state = 8},
+  [20] = {.lex_state = 10, .external_lex_state = 9},
+  [21] = {.lex_state = 10, .external_lex_state = 9},
+  [22] = {.lex_state = 10, .external_lex_state = 9},
+  [23] = {.lex_state = 10, .external_lex_state = 9},
+  [24] = {.lex_state = 10, .external_lex_state = 9},
+  [25] = {.lex_state = 10, .external_lex_state = 9},
+  [26] = {.lex_state = 10, .external_lex_state = 9},
+  [27] = {.lex_state = 10, .external_lex_state = 8},
+  [28] = {.lex_state = 10, .external_lex_state = 8},
+  [29] = {.lex_state = 10, .external_lex_state = 8},
+  [30] = {.lex_state = 10, .external_lex_state = 8},
+  [31] = {.lex_state = 10, .external_lex_state = 9},
+  [32] = {.lex_state = 10, .external_lex_state = 9},
+  [33] = {.lex_state = 10, .external_lex_state = 9},
+  [34] = {.lex_state = 10, .external_lex_state = 9},
+  [35] = {.lex_state = 10, .external_lex_state = 9},
+  [36] = {.lex_state = 10, .external_lex_state = 9},
+  [37] = {.lex_state = 10, .external_lex_state = 8},
+  [38] = {.lex_state = 10, .external_lex_state = 8},
+  [39] = {.lex_state = 10, .external_lex_state = 8},
+  [40] = {.lex_state = 10, .external_lex_state = 8},
+  [41] = {.lex_state = 10, .external_lex_state = 9},
+  [42] = {.lex_state = 10, .external_lex_state = 9},
+  [43] = {.lex_state = 10, .external_lex_state = 9},
+  [44] = {.lex_state = 10, .external_lex_state = 9},
+  [45] = {.lex_state = 10, .external_lex_state = 9},
+  [46] = {.lex_state = 10, .external_lex_state = 9},
+  [47] = {.lex_state = 10, .external_lex_state = 8},
+  [48] = {.lex_state = 10, .external_lex_state = 8},
+  [49] = {.lex_state = 10, .external_lex_state = 8},
+  [50] = {.lex_state = 10, .external_lex_state = 8},
+  [51] = {.lex_state = 10, .external_lex_state = 9},
+  [52] = {.lex_state = 10, .external_lex_state = 9},
+  [53] = {.lex_state = 10, .external_lex_state = 9},
+  [54] = {.lex_state = 10, .external_lex_state = 9},
+  [55] = {.lex_state = 10, .external_lex_state = 9},
+  [56] = {.lex_state = 10, .external_lex_state = 9},
+  [57] = {.lex_state = 10, .external_lex_state = 8},
+  [58] = {.lex_state = 10, .external_lex_state = 8},
+  [59] = {.lex_state = 10, .external_lex_state = 8},
+  [60] = {.lex_state = 10, .external_lex_state = 8},
+  [61] = {.lex_state = 10, .external_lex_state = 9},
+  [62] = {.lex_state = 10, .external_lex_state = 9},
+  [63] = {.lex_state = 10, .external_lex_state = 9},
+  [64] = {.lex_state = 10, .external_lex_state = 9},
+  [65] = {.lex_state = 10, .external_lex_state = 9},
+  [66] = {.lex_state = 10, .external_lex_state = 9},
+  [67] = {.lex_state = 10, .external_lex_state = 8},
+  [68] = {.lex_state = 10, .external_lex_state = 8},
+  [69] = {.lex_state = 10, .external_lex_state = 8},
+  [70] = {.lex_state = 10, .external_lex_state = 8},
+  [71] = {.lex_state = 10, .external_lex_state = 9},
+  [72] = {.lex_state = 10, .external_lex_state = 9},
+  [73] = {.lex_state = 10, .external_lex_state = 9},
+  [74] = {.lex_state = 10, .external_lex_state = 9},
+  [75] = {.lex_state = 10, .external_lex_state = 9},
+  [76] = {.lex_state = 10, .external_lex_state = 9},
+  [77] = {.lex_state = 10, .external_lex_state = 8},
+  [78] = {.lex_state = 10, .external_lex_state = 8},
+  [79] = {.lex_state = 10, .external_lex_state = 8},
+  [80] = {.lex_state = 10, .external_lex_state = 8},
+  [81] = {.lex_state = 10, .external_lex_state = 8},
+  [82] = {.lex_state = 13, .external_lex_state = 10},
+  [83] = {.lex_state = 13, .external_lex_state = 10},
+  [84] = {.lex_state = 13, .external_lex_state = 10},
+  [85] = {.lex_state = 13, .external_lex_state = 10},
+  [86] = {.lex_state = 13, .external_lex_state = 11},
+  [87] = {.lex_state = 13, .external_lex_state = 11},
+  [88] = {.lex_state = 13, .external_lex_state = 11},
+  [89] = {.lex_state = 13, .external_lex_state = 11},
+  [90] = {.lex_state = 13, .external_lex_state = 12},
+  [91] = {.lex_state = 13, .external_lex_state = 12},
+  [92] = {.lex_state = 13, .external_lex_state = 12},
+  [93] = {.lex_state = 13, .external_lex_state = 12},
+  [94] = {.lex_state = 13, .external_lex_state = 13},
+  [95] = {.lex_state = 13, .external_lex_state = 13},
+  [96] = {.lex_state = 13, .external_lex_state = 13},
+  [97] = {.lex_state = 13, .external_lex_state = 13},
+  [98] = {.lex_state = 13, .external_lex_state = 14},
+  [99] = {.lex_state = 13, .external_lex_state = 14},
+  [100] = {.lex_state = 13, .external_lex_state = 14},
+  [101] = {.lex_state = 13, .external_lex_state = 14},
+  [102] = {.lex_state = 13, .external_lex_state = 7},
+  [103] = {.lex_state = 13, .external_lex_state = 7},
+  [104] = {.lex_state = 13, .external_lex_state = 7},
+  [105] = {.lex_state = 13, .external_lex_state = 7},
+  [106] = {.lex_state = 13, .external_lex_state = 7},
+  [107] = {.lex_state = 13, .external_lex_state = 7},
+  [108] = {.lex_state = 13, .external_lex_state = 7},
+  [109] = {.lex_state = 13, .external_lex_state = 7},
+  [110] = {.lex_state = 13, .external_lex_state = 7},
+  [111] = {.lex_state = 13, .external_lex_state = 7},
+  [112] = {.lex_state = 13, .external_lex_state = 7},
+  [113] = {.lex_state = 13, .external_lex_state = 7},
+  [114] = {.lex_state = 13, .external_lex_state = 7},
+  [115] = {.lex_state = 13, .external_lex_state = 7},
+  [116] = {.lex_state = 13, .external_lex_state = 7},
+  [117] = {.lex_state = 13, .external_lex_state = 7},
+  [118] = {.lex_state = 13, .external_lex_state = 7},
+  [119] = {.lex_state = 13, .external_lex_state = 7},
+  [120] = {.lex_state = 13, .external_lex_state = 7},
+  [121] = {.lex_state = 13, .external_lex_state = 3},
+  [122] = {.lex_state = 13, .external_lex_state = 3},
+  [123] = {.lex_state = 13, .external_lex_state = 3},
+  [124] = {.lex_state = 13, .external_lex_state = 3},
+  [125] = {.lex_state = 13, .external_lex_state = 3},
+  [126] = {.lex_state = 13, .external_lex_state = 3},
+  [127] = {.lex_state = 13, .external_lex_state = 3},
+  [128] = {.lex_state = 13, .external_lex_state = 3},
+  [129] = {.lex_state = 13, .external_lex_state = 3},
+  [130] = {.lex_state = 13, .external_lex_state = 3},
+  [131] = {.lex_state = 13, .external_lex_state = 3},
+  [132] = {.lex_state = 13, .external_lex_state = 3},
+  [133] = {.lex_state = 13, .external_lex_state = 3},
+  [134] = {.lex_state = 13, .external_lex_state = 3},
+  [135] = {.lex_state = 13, .external_lex_state = 3},
+  [136] = {.lex_state = 13, .external_lex_state = 3},
+  [137] = {.lex_state = 13, .external_lex_state = 3},
+  [138] = {.lex_state = 13, .external_lex_state = 3},
+  [139] = {.lex_state = 13, .external_lex_state = 3},
+  [140] = {.lex_state = 13, .external_lex_state = 4},
+  [141] = {.lex_state = 13, .external_lex_state = 4},
+  [142] = {.lex_state = 13, .external_lex_state = 4},
+  [143] = {.lex_state = 13, .external_lex_state = 4},
+  [144] = {.lex_state = 13, .external_lex_state = 4},
+  [145] = {.lex_state = 13, .external_lex_state = 4},
+  [146] = {.lex_state = 13, .external_lex_state = 4},
+  [147] = {.lex_state = 13, .external_lex_state = 4},
+  [148] = {.lex_state = 13, .external_lex_state = 4},
+  [149] = {.lex_state = 13, .external_lex_state = 4},
+  [150] = {.lex_state = 13, .external_lex_state = 4},
+  [151] = {.lex_state = 13, .external_lex_state = 4},
+  [152] = {.lex_state = 13, .external_lex_state = 4},
+  [153] = {.lex_state = 13, .external_lex_state = 4},
+  [154] = {.lex_state = 13, .external_lex_state = 4},
+  [155] = {.lex_state = 13, .external_lex_state = 4},
+  [156] = {.lex_state = 13, .external_lex_state = 4},
+  [157] = {.lex_state = 13, .external_lex_state = 4},
+  [158] = {.lex_state = 13, .external_lex_state = 4},
+  [159] = {.lex_state = 13, .external_lex_state = 5},
+  [160] = {.lex_state = 13, .external_lex_state = 5},
+  [161] = {.lex_state = 13, .external_lex_state = 5},
+  [162] = {.lex_state = 13, .external_lex_state = 5},
+  [163] = {.lex_state = 13, .external_lex_state = 5},
+  [164] = {.lex_state = 13, .external_lex_state = 5},
+  [165] = {.lex_state = 13, .external_lex_state = 5},
+  [166] = {.lex_state = 13, .external_lex_state = 5},
+  [167] = {.lex_state = 13, .external_lex_state = 5},
+  [168] = {.lex_state = 13, .external_lex_state = 5},
+  [169] = {.lex_state = 13, .external_lex_state = 5},
+  [170] = {.lex_state = 13, .external_lex_state = 5},
+  [171] = {.lex_state = 13, .external_lex_state = 5},
+  [172] = {.lex_state = 13, .external_lex_state = 5},
+  [173] = {.lex_state = 13, .external_lex_state = 5},
+  [174] = {.lex_state = 13, .external_lex_state = 5},
+  [175] = {.lex_state = 13, .external_lex_state = 5},
+  [176] = {.lex_state = 13, .external_lex_state = 5},
+  [177] = {.lex_state = 13, .external_lex_state = 5},
+  [178] = {.lex_state = 13, .external_lex_state = 6},
+  [179] = {.lex_state = 13, .external_lex_state = 6},
+  [180] = {.lex_state = 13, .external_lex_state = 6},
+  [181] = {.lex_state = 13, .external_lex_state = 6},
+  [182] = {.lex_state = 13, .external_lex_state = 6},
+  [183] = {.lex_state = 13, .external_lex_state = 6},
+  [184] = {.lex_state = 13, .external_lex_state = 6},
+  [185] = {.lex_state = 13, .external_lex_state = 6},
+  [186] = {.lex_state = 13, .external_lex_state = 6},
+  [187] = {.lex_state = 13, .external_lex_state = 6},
+  [188] = {.lex_state = 13, .external_lex_state = 6},
+  [189] = {.lex_state = 13, .external_lex_state = 6},
+  [190] = {.lex_state = 13, .external_lex_state = 6},
+  [191] = {.lex_state = 13, .external_lex_state = 6},
+  [192] = {.lex_state = 13, .external_lex_state = 6},
+  [193] = {.lex_state = 13, .external_lex_state = 6},
+  [194] = {.lex_state = 13, .external_lex_state = 6},
+  [195] = {.lex_state = 13, .external_lex_state = 6},
+  [196] = {.lex_state = 13, .external_lex_state = 6},
+  [197] = {.lex_state = 10, .external_lex_state = 15},
+  [198] = {.lex_state = 10, .external_lex_state = 15},
+  [199] = {.lex_state = 10, .external_lex_state = 15},
+  [200] = {.lex_state = 10, .external_lex_state = 15},
+  [201] = {.lex_state = 10, .external_lex_state = 9},
+  [202] = {.lex_state = 10, .external_lex_state = 9},
+  [203] = {.lex_state = 10, .external_lex_state = 9},
+  [204] = {.lex_state = 10, .external_lex_state = 9},
+  [205] = {.lex_state = 10, .external_lex_state = 9},
+  [206] = {.lex_state = 10, .external_lex_state = 9},
+  [207] = {.lex_state = 10, .external_lex_state = 9},
+  [208] = {.lex_state = 10, .external_lex_state = 9},
+  [209] = {.lex_state = 10, .external_lex_state = 9},
+  [210] = {.lex_state = 10, .external_lex_state = 9},
+  [211] = {.lex_state = 10, .external_lex_state = 9},
+  [212] = {.lex_state = 10, .external_lex_state = 9},
+  [213] = {.lex_state = 10, .external_lex_state = 9},
+  [214] = {.lex_state = 10, .external_lex_state = 9},
+  [215] = {.lex_state = 10, .external_lex_state = 9},
+  [216] = {.lex_state = 10, .external_lex_state = 9},
+  [217] = {.lex_state = 10, .external_lex_state = 9},
+  [218] = {.lex_state = 10, .external_lex_state = 9},
+  [219] = {.lex_state = 10, .external_lex_state = 9},
+  [220] = {.lex_state = 10, .external_lex_state = 8},
+  [221] = {.lex_state = 12, .external_lex_state = 16},
+  [222] = {.lex_state = 12, .external_lex_state = 16},
+  [223] = {.lex_state = 12, .external_lex_state = 16},
+  [224] = {.lex_state = 0, .external_lex_state = 17},
+  [225] = {.lex_state = 0, .external_lex_state = 17},
+  [226] = {.lex_state = 12, .external_lex_state = 18},
+  [227] = {.lex_state = 0, .external_lex_state = 17},
+  [228] = {.lex_state = 0, .external_lex_state = 17},
+  [229] = {.lex_state = 12, .external_lex_state = 18},
+  [230] = {.lex_state = 0, .external_lex_state = 17},
+  [231] = {.lex_state = 12, .external_lex_state = 19},
+  [232] = {.lex_state = 12, .external_lex_state = 19},
+  [233] = {.lex_state = 12, .external_lex_state = 20},
+  [234] = {.lex_state = 12, .external_lex_state = 20},
+  [235] = {.lex_state = 12, .external_lex_state = 21},
+  [236] = {.lex_state = 12, .external_lex_state = 21},
+  [237] = {.lex_state = 0, .external_lex_state = 17},
+  [238] = {.lex_state = 0, .external_lex_state = 17},
+  [239] = {.lex_state = 0, .external_lex_state = 17},
+  [240] = {.lex_state = 0, .external_lex_state = 17},
+  [241] = {.lex_state = 0, .external_lex_state = 17},
+  [242] = {.lex_state = 0, .external_lex_state = 17},
+  [243] = {.lex_state = 0, .external_lex_state = 17},
+  [244] = {.lex_state = 0, .external_lex_state = 17},
+  [245] = {.lex_state = 0, .external_lex_state = 17},
+  [246] = {.lex_state = 0, .external_lex_state = 17},
+  [247] = {.lex_state = 12, .external_lex_state = 22},
+  [248] = {.lex_state = 12, .external_lex_state = 16},
+  [249] = {.lex_state = 12, .external_lex_state = 22},
+  [250] = {.lex_state = 0, .external_lex_state = 23},
+  [251] = {.lex_state = 12, .external_lex_state = 22},
+  [252] = {.lex_state = 0, .external_lex_state = 23},
+  [253] = {.lex_state = 12, .external_lex_state = 22},
+  [254] = {.lex_state = 0, .external_lex_state = 17},
+  [255] = {.lex_state = 0, .external_lex_state = 23},
+  [256] = {.lex_state = 0, .external_lex_state = 23},
+  [257] = {.lex_state = 0, .external_lex_state = 23},
+  [258] = {.lex_state = 0, .external_lex_state = 23},
+  [259] = {.lex_state = 0, .external_lex_state = 23},
+  [260] = {.lex_state = 0, .external_lex_state = 2},
+  [261] = {.lex_state = 0, .external_lex_state = 24},
+  [262] = {.lex_state = 0, .external_lex_state = 25},
+  [263] = {.lex_state = 0, .external_lex_state = 26},
+  [264] = {.lex_state = 0, .external_lex_state = 2},
+  [265] = {.lex_state = 0, .external_lex_state = 24},
+  [266] = {.lex_state = 0, .external_lex_state = 25},
+  [267] = {.lex_state = 0, .external_lex_state = 26},
+  [268] = {.lex_state = 0, .external_lex_state = 25},
+  [269] = {.lex_state = 0, .external_lex_state = 26},
+  [270] = {.lex_state = 0, .external_lex_state = 25},
+  [271] = {.lex_state = 0, .external_lex_state = 26},
+  [272] = {.lex_state = 0, .external_lex_state = 25},
+  [273] = {.lex_state = 0, .external_lex_state = 26},
+  [274] = {.lex_state = 0, .external_lex_state = 25},
+  [275] = {.lex_state = 0, .external_lex_state = 26},
+  [276] = {.lex_state = 0, .external_lex_state = 25},
+  [277] = {.lex_state = 0, .external_lex_state = 26},
+  [278] = {.lex_state = 0, .external_lex_state = 25},
+  [279] = {.lex_state = 0, .external_lex_state = 26},
+  [280] = {.lex_state = 0, .external_lex_state = 25},
+  [281] = {.lex_state = 0, .external_lex_state = 26},
+  [282] = {.lex_state = 0, .external_lex_state = 25},
+  [283] = {.lex_state = 0, .external_lex_state = 26},
+  [284] = {.lex_state = 0, .external_lex_state = 25},
+  [285] = {.lex_state = 0, .external_lex_state = 26},
+  [286] = {.lex_state = 0, .external_lex_state = 25},
+  [287] = {.lex_state = 0, .external_lex_state = 26},
+  [288] = {.lex_state = 0, .external_lex_state = 25},
+  [289] = {.lex_state = 0, .external_lex_state = 26},
+  [290] = {.lex_state = 0, .external_lex_state = 27},
+  [291] = {.lex_state = 0, .external_lex_state = 28},
+  [292] = {.lex_state = 0, .external_lex_state = 2},
+  [293] = {.lex_state = 0, .external_lex_state = 27},
+  [294] = {.lex_state = 0, .external_lex_state = 25},
+  [295] = {.lex_state = 0, .external_lex_state = 2},
+  [296] = {.lex_state = 0, .external_lex_state = 25},
+  [297] = {.lex_state = 0, .external_lex_state = 25},
+  [298] = {.lex_state = 0, .external_lex_state = 27},
+  [299] = {.lex_state = 0, .external_lex_state = 27},
+  [300] = {.lex_state = 0, .external_lex_state = 27},
+  [301] = {.lex_state = 0, .external_lex_state = 27},
+  [302] = {.lex_state = 0, .external_lex_state = 27},
+  [303] = {.lex_state = 0, .external_lex_state = 27},
+  [304] = {.lex_state = 0, .external_lex_state = 27},
+  [305] = {.lex_state = 0, .external_lex_state = 27},
+  [306] = {.lex_state = 0, .external_lex_state = 27},
+  [307] = {.lex_state = 0, .external_lex_state = 27},
+  [308] = {.lex_state = 0},
+  [309] = {.lex_state = 0, .external_lex_state = 29},
+  [310] = {.lex_state = 0, .external_lex_state = 22},
+  [311] = {.lex_state = 0, .external_lex_state = 30},
+  [312] = {.lex_state = 0, .external_lex_state = 31},
+  [313] = {.lex_state = 0, .external_lex_state = 32},
+  [314] = {.lex_state = 0, .external_lex_state = 33},
+  [315] = {.lex_state = 0, .external_lex_state = 34},
+  [316] = {.lex_state = 0, .external_lex_state = 34},
+  [317] = {.lex_state = 9},
+  [318] = {.lex_state = 0},
+  [319] = {.lex_state = 0, .external_lex_state = 34},
+  [320] = {.lex_state = 0, .external_lex_state = 34},
+  [321] = {.lex_state = 0, .external_lex_state = 35},
+  [322] = {.lex_state = 0},
+  [323] = {.lex_state = 0},
+  [324] = {.lex_state = 0, .external_lex_state = 22},
+  [325] = {.lex_state = 0, .external_lex_state = 30},
+  [326] = {.lex_state = 0, .external_lex_state = 31},
+  [327] = {.lex_state = 0, .external_lex_state = 32},
+  [328] = {.lex_state = 0, .external_lex_state = 33},
+  [329] = {.lex_state = 0, .external_lex_state = 34},
+  [330] = {.lex_state = 0, .external_lex_state = 34},
+  [331] = {.lex_state = 0, .external_lex_state = 34},
+  [332] = {.lex_state = 0, .external_lex_state = 34},
+  [333] = {.lex_state = 0, .external_lex_state = 22},
+  [334] = {.lex_state = 0, .external_lex_state = 30},
+  [335] = {.lex_state = 0, .external_lex_state = 31},
+  [336] = {.lex_state = 0, .external_lex_state = 32},
+  [337] = {.lex_state = 0, .external_lex_state = 33},
+  [338] = {.lex_state = 0, .external_lex_state = 34},
+  [339] = {.lex_state = 0, .external_lex_state = 34},
+  [340] = {.lex_state = 0, .external_lex_state = 34},
+  [341] = {.lex_state = 0, .external_lex_state = 34},
+  [342] = {.lex_state = 0, .external_lex_state = 30},
+  [343] = {.lex_state = 0, .external_lex_state = 31},
+  [344] = {.lex_state = 0, .external_lex_state = 32},
+  [345] = {.lex_state = 0, .external_lex_state = 33},
+  [346] = {.lex_state = 0, .external_lex_state = 34},
+  [347] = {.lex_state = 0, .external_lex_state = 34},
+  [348] = {.lex_state = 0, .external_lex_state = 34},
+  [349] = {.lex_state = 0, .external_lex_state = 34},
+  [350] = {.lex_state = 0, .external_lex_state = 30},
+  [351] = {.lex_state = 0, .external_lex_state = 31},
+  [352] = {.lex_state = 0, .external_lex_state = 32},
+  [353] = {.lex_state = 0, .external_lex_state = 33},
+  [354] = {.lex_state = 0, .external_lex_state = 34},
+  [355] = {.lex_state = 0, .external_lex_state = 34},
+  [356] = {.lex_state = 0, .external_lex_state = 34},
+  [357] = {.lex_state = 0, .external_lex_state = 34},
+  [358] = {.lex_state = 0, .external_lex_state = 30},
+  [359] = {.lex_state = 0, .external_lex_state = 31},
+  [360] = {.lex_state = 0, .external_lex_state = 32},
+  [361] = {.lex_state = 0, .external_lex_state = 33},
+  [362] = {.lex_state = 0, .external_lex_state = 34},
+  [363] = {.lex_state = 0, .external_lex_state = 34},
+  [364] = {.lex_state = 0, .external_lex_state = 34},
+  [365] = {.lex_state = 0, .external_lex_state = 34},
+  [366] = {.lex_state = 0, .external_lex_state = 29},
+  [367] = {.lex_state = 0, .external_lex_state = 29},
+  [368] = {.lex_state = 0, .external_lex_state = 29},
+  [369] = {.lex_state = 0, .external_lex_state = 29},
+  [370] = {.lex_state = 0, .external_lex_state = 29},
+};
+
+static const uint16_t ts_parse_table[LARGE_STATE_COUNT][SYMBOL_COUNT] = {
+  [STATE(0)] = {
+    [ts_builtin_sym_end] = ACTIONS(1),
+    [sym_comment] = ACTIONS(3),
+    [anon_sym_BSLASH] = ACTIONS(1),
+    [sym_semi_colon] = ACTIONS(1),
+    [sym_symbols] = ACTIONS(1),
+    [aux_sym_literal_token1] = ACTIONS(1),
+    [anon_sym_EQ] = ACTIONS(1),
+    [sym__line_start] = ACTIONS(1),
+    [sym_line_end] = ACTIONS(1),
+    [sym__emph_star_start] = ACTIONS(1),
+    [sym__emph_star_end] = ACTIONS(1),
+    [sym__emph_under_start] = ACTIONS(1),
+    [sym__emph_under_end] = ACTIONS(1),
+    [sym__strong_star_start] = ACTIONS(1),
+    [sym__strong_star_end] = ACTIONS(1),
+    [sym__strong_under_start] = ACTIONS(1),
+    [sym__strong_under_end] = ACTIONS(1),
+    [sym__no_parse] = ACTIONS(1),
+    [sym__link_start] = ACTIONS(1),
+    [sym__image_start] = ACTIONS(1),
+    [sym__link_end] = ACTIONS(1),
+    [sym_link_destination] = ACTIONS(1),
+    [sym__span_start] = ACTIONS(1),
+    [sym__attribute_start] = ACTIONS(1),
+    [sym_attribute_id] = ACTIONS(1),
+    [sym_attribute_class] = ACTIONS(1),
+    [sym_attribute_key] = ACTIONS(1),
+    [sym_attribute_value] = ACTIONS(1),
+    [sym__attribute_end] = ACTIONS(1),
+    [sym_inline_math] = ACTIONS(1),
+    [sym_display_math] = ACTIONS(1),
+    [sym_citation] = ACTIONS(1),
+    [sym_cross_reference] = ACTIONS(1),
+    [sym__citation_group_start] = ACTIONS(1),
+    [sym_citation_prefix] = ACTIONS(1),
+    [sym_citation_locator] = ACTIONS(1),
+    [sym__shortcode_start] = ACTIONS(1),
+    [sym_shortcode_name] = ACTIONS(1),
+    [sym_shortcode_argument] = ACTIONS(1),
+    [sym__shortcode_end] = ACTIONS(1),
+    [sym_shortcode_escaped] = ACTIONS(1),
+    [sym_text] = ACTIONS(1),
+    [sym__trailing_attribute_start] = ACTIONS(1),
+    [sym__unused_error] = ACTIONS(1),
+  },
+  [STATE(1)] = {
+    [sym_inline] = STATE(308),
+    [sym__line] = STATE(221),
+    [sym_comment] = ACTIONS(3),
+    [sym__line_start] = ACTIONS(5),
+  },
+  [STATE(2)] = {
+    [sym_line_break] = STATE(78),
+    [aux_sym__line_content] = STATE(9),
+    [sym_literal] = STATE(9),
+    [sym_emph] = STATE(9),
+    [sym__emph_star] = STATE(122),
+    [sym__emph_under] = STATE(122),
+    [sym_link] = STATE(9),
+    [sym_image] = STATE(9),
+    [sym_span] = STATE(9),
+    [sym_citation_group] = STATE(9),
+    [sym_shortcode] = STATE(9),
+    [sym_strong] = STATE(9),
+    [sym__strong_star] = STATE(123),
+    [sym__strong_under] = STATE(123),
+    [aux_sym__inline_content_repeat1] = STATE(226),
+    [sym_comment] = ACTIONS(7),
+    [anon_sym_BSLASH] = ACTIONS(9),
+    [anon_sym_] = ACTIONS(11),
+    [sym_symbols] = ACTIONS(13),
+    [aux_sym_literal_token1] = ACTIONS(15),
+    [sym_line_end] = ACTIONS(17),
+    [sym__emph_star_start] = ACTIONS(19),
+    [sym__emph_star_end] = ACTIONS(21),
+    [sym__emph_under_start] = ACTIONS(23),
+    [sym__strong_star_start] = ACTIONS(25),
+    [sym__strong_under_start] = ACTIONS(27),
+    [sym__no_parse] = ACTIONS(29),
+    [sym__link_start] = ACTIONS(31),
+    [sym__image_start] = ACTIONS(33),
+    [sym__span_start] = ACTIONS(35),
+    [sym_inline_math] = ACTIONS(29),
+    [sym_display_math] = ACTIONS(29),
+    [sym_citation] = ACTIONS(29),
+    [sym_cross_reference] = ACTIONS(29),
+    [sym__citation_group_start] = ACTIONS(37),
+    [sym__shortcode_start] = ACTIONS(39),
+    [sym_shortcode_escaped] = ACTIONS(29),
+    [sym_text] = ACTIONS(29),
+  },
+  [STATE(3)] = {
+    [sym_line_break] = STATE(79),
+    [aux_sym__line_content] = STATE(11),
+    [sym_literal] = STATE(11),
+    [sym_emph] = STATE(11),
+    [sym__emph_star] = STATE(141),
+    [sym__emph_under] = STATE(141),
+    [sym_link] = STATE(11),
+    [sym_image] = STATE(11),
+    [sym_span] = STATE(11),
+    [sym_citation_group] = STATE(11),
+    [sym_shortcode] = STATE(11),
+    [sym_strong] = STATE(11),
+    [sym__strong_star] = STATE(142),
+    [sym__strong_under] = STATE(142),
+    [aux_sym__inline_content_repeat1] = STATE(231),
+    [sym_comment] = ACTIONS(7),
+    [anon_sym_BSLASH] = ACTIONS(9),
+    [anon_sym_] = ACTIONS(11),
+    [sym_symbols] = ACTIONS(41),
+    [aux_sym_literal_token1] = ACTIONS(43),
+    [sym_line_end] = ACTIONS(45),
+    [sym__emph_star_start] = ACTIONS(47),
+    [sym__emph_under_start] = ACTIONS(49),
+    [sym__emph_under_end] = ACTIONS(21),
+    [sym__strong_star_start] = ACTIONS(51),
+    [sym__strong_under_start] = ACTIONS(53),
+    [sym__no_parse] = ACTIONS(55),
+    [sym__link_start] = ACTIONS(57),
+    [sym__image_start] = ACTIONS(59),
+    [sym__span_start] = ACTIONS(61),
+    [sym_inline_math] = ACTIONS(55),
+    [sym_display_math] = ACTIONS(55),
+    [sym_citation] = ACTIONS(55),
+    [sym_cross_reference] = ACTIONS(55),
+    [sym__citation_group_start] = ACTIONS(63),
+    [sym__shortcode_start] = ACTIONS(65),
+    [sym_shortcode_escaped] = ACTIONS(55),
+    [sym_text] = ACTIONS(55),
+  },
+  [STATE(4)] = {
+    [sym_line_break] = STATE(80),
+    [aux_sym__line_content] = STATE(13),
+    [sym_literal] = STATE(13),
+    [sym_emph] = STATE(13),
+    [sym__emph_star] = STATE(160),
+    [sym__emph_under] = STATE(160),
+    [sym_link] = STATE(13),
+    [sym_image] = STATE(13),
+    [sym_span] = STATE(13),
+    [sym_citation_group] = STATE(13),
+    [sym_shortcode] = STATE(13),
+    [sym_strong] = STATE(13),
+    [sym__strong_star] = STATE(161),
+    [sym__strong_under] = STATE(161),
+    [aux_sym__inline_content_repeat1] = STATE(233),
+    [sym_comment] = ACTIONS(7),
+    [anon_sym_BSLASH] = ACTIONS(9),
+    [anon_sym_] = ACTIONS(11),
+    [sym_symbols] = ACTIONS(67),
+    [aux_sym_literal_token1] = ACTIONS(69),
+    [sym_line_end] = ACTIONS(71),
+    [sym__emph_star_start] = ACTIONS(73),
+    [sym__emph_under_start] = ACTIONS(75),
+    [sym__strong_star_start] = ACTIONS(77),
+    [sym__strong_star_end] = ACTIONS(21),
+    [sym__strong_under_start] = ACTIONS(79),
+    [sym__no_parse] = ACTIONS(81),
+    [sym__link_start] = ACTIONS(83),
+    [sym__image_start] = ACTIONS(85),
+    [sym__span_start] = ACTIONS(87),
+    [sym_inline_math] = ACTIONS(81),
+    [sym_display_math] = ACTIONS(81),
+    [sym_citation] = ACTIONS(81),
+    [sym_cross_reference] = ACTIONS(81),
+    [sym__citation_group_start] = ACTIONS(89),
+    [sym__shortcode_start] = ACTIONS(91),
+    [sym_shortcode_escaped] = ACTIONS(81),
+    [sym_text] = ACTIONS(81),
+  },
+  [STATE(5)] = {
+    [sym_line_break] = STATE(81),
+    [aux_sym__line_content] = STATE(15),
+    [sym_literal] = STATE(15),
+    [sym_emph] = STATE(15),
+    [sym__emph_star] = STATE(179),
+    [sym__emph_under] = STATE(179),
+    [sym_link] = STATE(15),
+    [sym_image] = STATE(15),
+    [sym_span] = STATE(15),
+    [sym_citation_group] = STATE(15),
+    [sym_shortcode] = STATE(15),
+    [sym_strong] = STATE(15),
+    [sym__strong_star] = STATE(180),
+    [sym__strong_under] = STATE(180),
+    [aux_sym__inline_content_repeat1] = STATE(235),
+    [sym_comment] = ACTIONS(7),
+    [anon_sym_BSLASH] = ACTIONS(9),
+    [anon_sym_] = ACTIONS(11),
+    [sym_symbols] = ACTIONS(93),
+    [aux_sym_literal_token1] = ACTIONS(95),
+    [sym_line_end] = ACTIONS(97),
+    [sym__emph_star_start] = ACTIONS(99),
+    [sym__emph_under_start] = ACTIONS(101),
+    [sym__strong_star_start] = ACTIONS(103),
+    [sym__strong_under_start] = ACTIONS(105),
+    [sym__strong_under_end] = ACTIONS(21),
+    [sym__no_parse] = ACTIONS(107),
+    [sym__link_start] = ACTIONS(109),
+    [sym__image_start] = ACTIONS(111),
+    [sym__span_start] = ACTIONS(113),
+    [sym_inline_math] = ACTIONS(107),
+    [sym_display_math] = ACTIONS(107),
+    [sym_citation] = ACTIONS(107),
+    [sym_cross_reference] = ACTIONS(107),
+    [sym__citation_group_start] = ACTIONS(115),
+    [sym__shortcode_start] = ACTIONS(117),
+    [sym_shortcode_escaped] = ACTIONS(107),
+    [sym_text] = ACTIONS(107),
+  },
+  [STATE(6)] = {
+    [aux_sym__line_content] = STATE(7),
+    [sym_literal] = STATE(7),
+    [sym_emph] = STATE(7),
+    [sym__emph_star] = STATE(103),
+    [sym__emph_under] = STATE(103),
+    [sym_link] = STATE(7),
+    [sym_image] = STATE(7),
+    [sym_span] = STATE(7),
+    [sym_citation_group] = STATE(7),
+    [sym_shortcode] = STATE(7),
+    [sym_strong] = STATE(7),
+    [sym__strong_star] = STATE(104),
+    [sym__strong_under] = STATE(104),
+    [ts_builtin_sym_end] = ACTIONS(119),
+    [sym_comment] = ACTIONS(7),
+    [anon_sym_BSLASH] = ACTIONS(121),
+    [anon_sym_] = ACTIONS(119),
+    [sym_symbols] = ACTIONS(123),
+    [aux_sym_literal_token1] = ACTIONS(125),
+    [sym_line_end] = ACTIONS(119),
+    [sym__emph_star_start] = ACTIONS(127),
+    [sym__emph_under_start] = ACTIONS(129),
+    [sym__strong_star_start] = ACTIONS(131),
+    [sym__strong_under_start] = ACTIONS(133),
+    [sym__no_parse] = ACTIONS(135),
+    [sym__link_start] = ACTIONS(137),
+    [sym__image_start] = ACTIONS(139),
+    [sym__span_start] = ACTIONS(141),
+    [sym_inline_math] = ACTIONS(135),
+    [sym_display_math] = ACTIONS(135),
+    [sym_citation] = ACTIONS(135),
+    [sym_cross_reference] = ACTIONS(135),
+    [sym__citation_group_start] = ACTIONS(143),
+    [sym__shortcode_start] = ACTIONS(145),
+    [sym_shortcode_escaped] = ACTIONS(135),
+    [sym_text] = ACTIONS(135),
+    [sym__trailing_attribute_start] = ACTIONS(119),
+  },
+  [STATE(7)] = {
+    [aux_sym__line_content] = STATE(7),
+    [sym_literal] = STATE(7),
+    [sym_emph] = STATE(7),
+    [sym__emph_star] = STATE(103),
+    [sym__emph_under] = STATE(103),
+    [sym_link] = STATE(7),
+    [sym_image] = STATE(7),
+    [sym_span] = STATE(7),
+    [sym_citation_group] = STATE(7),
+    [sym_shortcode] = STATE(7),
+    [sym_strong] = STATE(7),
+    [sym__strong_star] = STATE(104),
+    [sym__strong_under] = STATE(104),
+    [ts_builtin_sym_end] = ACTIONS(147),
+    [sym_comment] = ACTIONS(7),
+    [anon_sym_BSLASH] = ACTIONS(149),
+    [anon_sym_] = ACTIONS(147),
+    [sym_symbols] = ACTIONS(151),
+    [aux_sym_literal_token1] = ACTIONS(154),
+    [sym_line_end] = ACTIONS(147),
+    [sym__emph_star_start] = ACTIONS(157),
+    [sym__emph_under_start] = ACTIONS(160),
+    [sym__strong_star_start] = ACTIONS(163),
+    [sym__strong_under_start] = ACTIONS(166),
+    [sym__no_parse] = ACTIONS(169),
+    [sym__link_start] = ACTIONS(172),
+    [sym__image_start] = ACTIONS(175),
+    [sym__span_start] = ACTIONS(178),
+    [sym_inline_math] = ACTIONS(169),
+    [sym_display_math] = ACTIONS(169),
+    [sym_citation] = ACTIONS(169),
+    [sym_cross_reference] = ACTIONS(169),
+    [sym__citation_group_start] = ACTIONS(181),
+    [sym__shortcode_start] = ACTIONS(184),
+    [sym_shortcode_escaped] = ACTIONS(169),
+    [sym_text] = ACTIONS(169),
+    [sym__trailing_attribute_start] = ACTIONS(147),
+  },
+  [STATE(8)] = {
+    [aux_sym__line_content] = STATE(9),
+    [sym_literal] = STATE(9),
+    [sym_emph] = STATE(9),
+    [sym__emph_star] = STATE(122),
+    [sym__emph_under] = STATE(122),
+    [sym_link] = STATE(9),
+    [sym_image] = STATE(9),
+    [sym_span] = STATE(9),
+    [sym_citation_group] = STATE(9),
+    [sym_shortcode] = STATE(9),
+    [sym_strong] = STATE(9),
+    [sym__strong_star] = STATE(123),
+    [sym__strong_under] = STATE(123),
+    [sym_comment] = ACTIONS(7),
+    [anon_sym_BSLASH] = ACTIONS(187),
+    [anon_sym_] = ACTIONS(189),
+    [sym_symbols] = ACTIONS(13),
+    [aux_sym_literal_token1] = ACTIONS(15),
+    [sym_line_end] = ACTIONS(189),
+    [sym__emph_star_start] = ACTIONS(19),
+    [sym__emph_star_end] = ACTIONS(189),
+    [sym__emph_under_start] = ACTIONS(23),
+    [sym__strong_star_start] = ACTIONS(25),
+    [sym__strong_under_start] = ACTIONS(27),
+    [sym__no_parse] = ACTIONS(29),
+    [sym__link_start] = ACTIONS(31),
+    [sym__image_start] = ACTIONS(33),
+    [sym__span_start] = ACTIONS(35),
+    [sym_inline_math] = ACTIONS(29),
+    [sym_display_math] = ACTIONS(29),
+    [sym_citation] = ACTIONS(29),
+    [sym_cross_reference] = ACTIONS(29),
+    [sym__citation_group_start] = ACTIONS(37),
+    [sym__shortcode_start] = ACTIONS(39),
+    [sym_shortcode_escaped] = ACTIONS(29),
+    [sym_text] = ACTIONS(29),
+  },
+  [STATE(9)] = {
+    [aux_sym__line_content] = STATE(9),
+    [sym_literal] = STATE(9),
+    [sym_emph] = STATE(9),
+    [sym__emph_star] = STATE(122),
+    [sym__emph_under] = STATE(122),
+    [sym_link] = STATE(9),
+    [sym_image] = STATE(9),
+    [sym_span] = STATE(9),
+    [sym_citation_group] = STATE(9),
+    [sym_shortcode] = STATE(9),
+    [sym_strong] = STATE(9),
+    [sym__strong_star] = STATE(123),
+    [sym__strong_under] = STATE(123),
+    [sym_comment] = ACTIONS(7),
+    [anon_sym_BSLASH] = ACTIONS(149),
+    [anon_sym_] = ACTIONS(147),
+    [sym_symbols] = ACTIONS(191),
+    [aux_sym_literal_token1] = ACTIONS(194),
+    [sym_line_end] = ACTIONS(147),
+    [sym__emph_star_start] = ACTIONS(197),
+    [sym__emph_star_end] = ACTIONS(147),
+    [sym__emph_under_start] = ACTIONS(200),
+    [sym__strong_star_start] = ACTIONS(203),
+    [sym__strong_under_start] = ACTIONS(206),
+    [sym__no_parse] = ACTIONS(209),
+    [sym__link_start] = ACTIONS(212),
+    [sym__image_start] = ACTIONS(215),
+    [sym__span_start] = ACTIONS(218),
+    [sym_inline_math] = ACTIONS(209),
+    [sym_display_math] = ACTIONS(209),
+    [sym_citation] = ACTIONS(209),
+    [sym_cross_reference] = ACTIONS(209),
+    [sym__citation_group_start] = ACTIONS(221),
+    [sym__shortcode_start] = ACTIONS(224),
+    [sym_shortcode_escaped] = ACTIONS(209),
+    [sym_text] = ACTIONS(209),
+  },
+  [STATE(10)] = {
+    [aux_sym__line_content] = STATE(11),
+    [sym_literal] = STATE(11),
+    [sym_emph] = STATE(11),
+    [sym__emph_star] = STATE(141),
+    [sym__emph_under] = STATE(141),
+    [sym_link] = STATE(11),
+    [sym_image] = STATE(11),
+    [sym_span] = STATE(11),
+    [sym_citation_group] = STATE(11),
+    [sym_shortcode] = STATE(11),
+    [sym_strong] = STATE(11),
+    [sym__strong_star] = STATE(142),
+    [sym__strong_under] = STATE(142),
+    [sym_comment] = ACTIONS(7),
+    [anon_sym_BSLASH] = ACTIONS(187),
+    [anon_sym_] = ACTIONS(189),
+    [sym_symbols] = ACTIONS(41),
+    [aux_sym_literal_token1] = ACTIONS(43),
+    [sym_line_end] = ACTIONS(189),
+    [sym__emph_star_start] = ACTIONS(47),
+    [sym__emph_under_start] = ACTIONS(49),
+    [sym__emph_under_end] = ACTIONS(189),
+    [sym__strong_star_start] = ACTIONS(51),
+    [sym__strong_under_start] = ACTIONS(53),
+    [sym__no_parse] = ACTIONS(55),
+    [sym__link_start] = ACTIONS(57),
+    [sym__image_start] = ACTIONS(59),
+    [sym__span_start] = ACTIONS(61),
+    [sym_inline_math] = ACTIONS(55),
+    [sym_display_math] = ACTIONS(55),
+    [sym_citation] = ACTIONS(55),
+    [sym_cross_reference] = ACTIONS(55),
+    [sym__citation_group_start] = ACTIONS(63),
+    [sym__shortcode_start] = ACTIONS(65),
+    [sym_shortcode_escaped] = ACTIONS(55),
+    [sym_text] = ACTIONS(55),
+  },
+  [STATE(11)] = {
+    [aux_sym__line_content] = STATE(11),
+    [sym_literal] = STATE(11),
+    [sym_emph] = STATE(11),
+    [sym__emph_star] = STATE(141),
+    [sym__emph_under] = STATE(141),
+    [sym_link] = STATE(11),
+    [sym_image] = STATE(11),
+    [sym_span] = STATE(11),
+    [sym_citation_group] = STATE(11),
+    [sym_shortcode] = STATE(11),
+    [sym_strong] = STATE(11),
+    [sym__strong_star] = STATE(142),
+    [sym__strong_under] = STATE(142),
+    [sym_comment] = ACTIONS(7),
+    [anon_sym_BSLASH] = ACTIONS(149),
+    [anon_sym_] = ACTIONS(147),
+    [sym_symbols] = ACTIONS(227),
+    [aux_sym_literal_token1] = ACTIONS(230),
+    [sym_line_end] = ACTIONS(147),
+    [sym__emph_star_start] = ACTIONS(233),
+    [sym__emph_under_start] = ACTIONS(236),
+    [sym__emph_under_end] = ACTIONS(147),
+    [sym__strong_star_start] = ACTIONS(239),
+    [sym__strong_under_start] = ACTIONS(242),
+    [sym__no_parse] = ACTIONS(245),
+    [sym__link_start] = ACTIONS(248),
+    [sym__image_start] = ACTIONS(251),
+    [sym__span_start] = ACTIONS(254),
+    [sym_inline_math] = ACTIONS(245),
+    [sym_display_math] = ACTIONS(245),
+    [sym_citation] = ACTIONS(245),
+    [sym_cross_reference] = ACTIONS(245),
+    [sym__citation_group_start] = ACTIONS(257),
+    [sym__shortcode_start] = ACTIONS(260),
+    [sym_shortcode_escaped] = ACTIONS(245),
+    [sym_text] = ACTIONS(245),
+  },
+  [STATE(12)] = {
+    [aux_sym__line_content] = STATE(13),
+    [sym_literal] = STATE(13),
+    [sym_emph] = STATE(13),
+    [sym__emph_star] = STATE(160),
+    [sym__emph_under] = STATE(160),
+    [sym_link] = STATE(13),
+    [sym_image] = STATE(13),
+    [sym_span] = STATE(13),
+    [sym_citation_group] = STATE(13),
+    [sym_shortcode] = STATE(13),
+    [sym_strong] = STATE(13),
+    [sym__strong_star] = STATE(161),
+    [sym__strong_under] = STATE(161),
+    [sym_comment] = ACTIONS(7),
+    [anon_sym_BSLASH] = ACTIONS(187),
+    [anon_sym_] = ACTIONS(189),
+    [sym_symbols] = ACTIONS(67),
+    [aux_sym_literal_token1] = ACTIONS(69),
+    [sym_line_end] = ACTIONS(189),
+    [sym__emph_star_start] = ACTIONS(73),
+    [sym__emph_under_start] = ACTIONS(75),
+    [sym__strong_star_start] = ACTIONS(77),
+    [sym__strong_star_end] = ACTIONS(189),
+    [sym__strong_under_start] = ACTIONS(79),
+    [sym__no_parse] = ACTIONS(81),
+    [sym__link_start] = ACTIONS(83),
+    [sym__image_start] = ACTIONS(85),
+    [sym__span_start] = ACTIONS(87),
+    [sym_inline_math] = ACTIONS(81),
+    [sym_display_math] = ACTIONS(81),
+    [sym_citation] = ACTIONS(81),
+    [sym_cross_reference] = ACTIONS(81),
+    [sym__citation_group_start] = ACTIONS(89),
+    [sym__shortcode_start] = ACTIONS(91),
+    [sym_shortcode_escaped] = ACTIONS(81),
+    [sym_text] = ACTIONS(81),
+  },
+  [STATE(13)] = {
+    [aux_sym__line_content] = STATE(13),
+    [sym_literal] = STATE(13),
+    [sym_emph] = STATE(13),
+    [sym__emph_star] = STATE(160),
+    [sym__emph_under] = STATE(160),
+    [sym_link] = STATE(13),
+    [sym_image] = STATE(13),
+    [sym_span] = STATE(13),
+    [sym_citation_group] = STATE(13),
+    [sym_shortcode] = STATE(13),
+    [sym_strong] = STATE(13),
+    [sym__strong_star] = STATE(161),
+    [sym__strong_under] = STATE(161),
+    [sym_comment] = ACTIONS(7),
+    [anon_sym_BSLASH] = ACTIONS(149),
+    [anon_sym_] = ACTIONS(147),
+    [sym_symbols] = ACTIONS(263),
+    [aux_sym_literal_token1] = ACTIONS(266),
+    [sym_line_end] = ACTIONS(147),
+    [sym__emph_star_start] = ACTIONS(269),
+    [sym__emph_under_start] = ACTIONS(272),
+    [sym__strong_star_start] = ACTIONS(275),
+    [sym__strong_star_end] = ACTIONS(147),
+    [sym__strong_under_start] = ACTIONS(278),
+    [sym__no_parse] = ACTIONS(281),
+    [sym__link_start] = ACTIONS(284),
+    [sym__image_start] = ACTIONS(287),
+    [sym__span_start] = ACTIONS(290),
+    [sym_inline_math] = ACTIONS(281),
+    [sym_display_math] = ACTIONS(281),
+    [sym_citation] = ACTIONS(281),
+    [sym_cross_reference] = ACTIONS(281),
+    [sym__citation_group_start] = ACTIONS(293),
+    [sym__shortcode_start] = ACTIONS(296),
+    [sym_shortcode_escaped] = ACTIONS(281),
+    [sym_text] = ACTIONS(281),
+  },
+  [STATE(14)] = {
+    [aux_sym__line_content] = STATE(15),
+    [sym_literal] = STATE(15),
+    [sym_emph] = STATE(15),
+    [sym__emph_star] = STATE(179),
+    [sym__emph_under] = STATE(179),
+    [sym_link] = STATE(15),
+    [sym_image] = STATE(15),
+    [sym_span] = STATE(15),
+    [sym_citation_group] = STATE(15),
+    [sym_shortcode] = STATE(15),
+    [sym_strong] = STATE(15),
+    [sym__strong_star] = STATE(180),
+    [sym__strong_under] = STATE(180),
+    [sym_comment] = ACTIONS(7),
+    [anon_sym_BSLASH] = ACTIONS(187),
+    [anon_sym_] = ACTIONS(189),
+    [sym_symbols] = ACTIONS(93),
+    [aux_sym_literal_token1] = ACTIONS(95),
+    [sym_line_end] = ACTIONS(189),
+    [sym__emph_star_start] = ACTIONS(99),
+    [sym__emph_under_start] = ACTIONS(101),
+    [sym__strong_star_start] = ACTIONS(103),
+    [sym__strong_under_start] = ACTIONS(105),
+    [sym__strong_under_end] = ACTIONS(189),
+    [sym__no_parse] = ACTIONS(107),
+    [sym__link_start] = ACTIONS(109),
+    [sym__image_start] = ACTIONS(111),
+    [sym__span_start] = ACTIONS(113),
+    [sym_inline_math] = ACTIONS(107),
+    [sym_display_math] = ACTIONS(107),
+    [sym_citation] = ACTIONS(107),
+    [sym_cross_reference] = ACTIONS(107),
+    [sym__citation_group_start] = ACTIONS(115),
+    [sym__shortcode_start] = ACTIONS(117),
+    [sym_shortcode_escaped] = ACTIONS(107),
+    [sym_text] = ACTIONS(107),
+  },
+  [STATE(15)] = {
+    [aux_sym__line_content] = STATE(15),
+    [sym_literal] = STATE(15),
+    [sym_emph] = STATE(15),
+    [sym__emph_star] = STATE(179),
+    [sym__emph_under] = STATE(179),
+    [sym_link] = STATE(15),
+    [sym_image] = STATE(15),
+    [sym_span] = STATE(15),
+    [sym_citation_group] = STATE(15),
+    [sym_shortcode] = STATE(15),
+    [sym_strong] = STATE(15),
+    [sym__strong_star] = STATE(180),
+    [sym__strong_under] = STATE(180),
+    [sym_comment] = ACTIONS(7),
+    [anon_sym_BSLASH] = ACTIONS(149),
+    [anon_sym_] = ACTIONS(147),
+    [sym_symbols] = ACTIONS(299),
+    [aux_sym_literal_token1] = ACTIONS(302),
+    [sym_line_end] = ACTIONS(147),
+    [sym__emph_star_start] = ACTIONS(305),
+    [sym__emph_under_start] = ACTIONS(308),
+    [sym__strong_star_start] = ACTIONS(311),
+    [sym__strong_under_start] = ACTIONS(314),
+    [sym__strong_under_end] = ACTIONS(147),
+    [sym__no_parse] = ACTIONS(317),
+    [sym__link_start] = ACTIONS(320),
+    [sym__image_start] = ACTIONS(323),
+    [sym__span_start] = ACTIONS(326),
+    [sym_inline_math] = ACTIONS(317),
+    [sym_display_math] = ACTIONS(317),
+    [sym_citation] = ACTIONS(317),
+    [sym_cross_reference] = ACTIONS(317),
+    [sym__citation_group_start] = ACTIONS(329),
+    [sym__shortcode_start] = ACTIONS(332),
+    [sym_shortcode_escaped] = ACTIONS(317),
+    [sym_text] = ACTIONS(317),
+  },
+};
+
+static const uint16_t ts_small_parse_table[] = {
+  [0] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(19), 1,
+      sym__emph_star_start,
+    ACTIONS(23), 1,
+      sym__emph_under_start,
+    ACTIONS(25), 1,
+      sym__strong_star_start,
+    ACTIONS(27), 1,
+      sym__strong_under_start,
+    ACTIONS(31), 1,
+      sym__link_start,
+    ACTIONS(33), 1,
+      sym__image_start,
+    ACTIONS(35), 1,
+      sym__span_start,
+    ACTIONS(37), 1,
+      sym__citation_group_start,
+    ACTIONS(39), 1,
+      sym__shortcode_start,
+    ACTIONS(337), 1,
+      sym_symbols,
+    ACTIONS(339), 1,
+      aux_sym_literal_token1,
+    STATE(311), 1,
+      sym__inline_content,
+    STATE(122), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(123), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(335), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(2), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [68] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(47), 1,
+      sym__emph_star_start,
+    ACTIONS(49), 1,
+      sym__emph_under_start,
+    ACTIONS(51), 1,
+      sym__strong_star_start,
+    ACTIONS(53), 1,
+      sym__strong_under_start,
+    ACTIONS(57), 1,
+      sym__link_start,
+    ACTIONS(59), 1,
+      sym__image_start,
+    ACTIONS(61), 1,
+      sym__span_start,
+    ACTIONS(63), 1,
+      sym__citation_group_start,
+    ACTIONS(65), 1,
+      sym__shortcode_start,
+    ACTIONS(343), 1,
+      sym_symbols,
+    ACTIONS(345), 1,
+      aux_sym_literal_token1,
+    STATE(312), 1,
+      sym__inline_content,
+    STATE(141), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(142), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(341), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(3), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [136] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(73), 1,
+      sym__emph_star_start,
+    ACTIONS(75), 1,
+      sym__emph_under_start,
+    ACTIONS(77), 1,
+      sym__strong_star_start,
+    ACTIONS(79), 1,
+      sym__strong_under_start,
+    ACTIONS(83), 1,
+      sym__link_start,
+    ACTIONS(85), 1,
+      sym__image_start,
+    ACTIONS(87), 1,
+      sym__span_start,
+    ACTIONS(89), 1,
+      sym__citation_group_start,
+    ACTIONS(91), 1,
+      sym__shortcode_start,
+    ACTIONS(349), 1,
+      sym_symbols,
+    ACTIONS(351), 1,
+      aux_sym_literal_token1,
+    STATE(313), 1,
+      sym__inline_content,
+    STATE(160), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(161), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(347), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(4), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [204] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(99), 1,
+      sym__emph_star_start,
+    ACTIONS(101), 1,
+      sym__emph_under_start,
+    ACTIONS(103), 1,
+      sym__strong_star_start,
+    ACTIONS(105), 1,
+      sym__strong_under_start,
+    ACTIONS(109), 1,
+      sym__link_start,
+    ACTIONS(111), 1,
+      sym__image_start,
+    ACTIONS(113), 1,
+      sym__span_start,
+    ACTIONS(115), 1,
+      sym__citation_group_start,
+    ACTIONS(117), 1,
+      sym__shortcode_start,
+    ACTIONS(355), 1,
+      sym_symbols,
+    ACTIONS(357), 1,
+      aux_sym_literal_token1,
+    STATE(314), 1,
+      sym__inline_content,
+    STATE(179), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(180), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(353), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(5), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [272] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(373), 1,
+      sym__link_end,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(381), 1,
+      sym_symbols,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(367), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(23), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [340] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(387), 1,
+      sym__link_end,
+    ACTIONS(389), 1,
+      sym_symbols,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(385), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(24), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [408] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(393), 1,
+      sym__link_end,
+    ACTIONS(395), 1,
+      sym_symbols,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(391), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(25), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [476] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(399), 1,
+      sym__link_end,
+    ACTIONS(401), 1,
+      sym_symbols,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(397), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(26), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [544] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(401), 1,
+      sym_symbols,
+    ACTIONS(403), 1,
+      sym__link_end,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(397), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(26), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [612] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(401), 1,
+      sym_symbols,
+    ACTIONS(405), 1,
+      sym__link_end,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(397), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(26), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [680] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(147), 1,
+      sym__link_end,
+    ACTIONS(407), 1,
+      sym__emph_star_start,
+    ACTIONS(410), 1,
+      sym__emph_under_start,
+    ACTIONS(413), 1,
+      sym__strong_star_start,
+    ACTIONS(416), 1,
+      sym__strong_under_start,
+    ACTIONS(422), 1,
+      sym__link_start,
+    ACTIONS(425), 1,
+      sym__image_start,
+    ACTIONS(428), 1,
+      sym__span_start,
+    ACTIONS(431), 1,
+      sym__citation_group_start,
+    ACTIONS(434), 1,
+      sym__shortcode_start,
+    ACTIONS(437), 1,
+      sym_symbols,
+    ACTIONS(440), 1,
+      aux_sym_literal_token1,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(419), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(26), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [748] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(19), 1,
+      sym__emph_star_start,
+    ACTIONS(23), 1,
+      sym__emph_under_start,
+    ACTIONS(25), 1,
+      sym__strong_star_start,
+    ACTIONS(27), 1,
+      sym__strong_under_start,
+    ACTIONS(31), 1,
+      sym__link_start,
+    ACTIONS(33), 1,
+      sym__image_start,
+    ACTIONS(35), 1,
+      sym__span_start,
+    ACTIONS(37), 1,
+      sym__citation_group_start,
+    ACTIONS(39), 1,
+      sym__shortcode_start,
+    ACTIONS(337), 1,
+      sym_symbols,
+    ACTIONS(339), 1,
+      aux_sym_literal_token1,
+    STATE(325), 1,
+      sym__inline_content,
+    STATE(122), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(123), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(335), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(2), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [816] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(47), 1,
+      sym__emph_star_start,
+    ACTIONS(49), 1,
+      sym__emph_under_start,
+    ACTIONS(51), 1,
+      sym__strong_star_start,
+    ACTIONS(53), 1,
+      sym__strong_under_start,
+    ACTIONS(57), 1,
+      sym__link_start,
+    ACTIONS(59), 1,
+      sym__image_start,
+    ACTIONS(61), 1,
+      sym__span_start,
+    ACTIONS(63), 1,
+      sym__citation_group_start,
+    ACTIONS(65), 1,
+      sym__shortcode_start,
+    ACTIONS(343), 1,
+      sym_symbols,
+    ACTIONS(345), 1,
+      aux_sym_literal_token1,
+    STATE(326), 1,
+      sym__inline_content,
+    STATE(141), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(142), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(341), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(3), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [884] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(73), 1,
+      sym__emph_star_start,
+    ACTIONS(75), 1,
+      sym__emph_under_start,
+    ACTIONS(77), 1,
+      sym__strong_star_start,
+    ACTIONS(79), 1,
+      sym__strong_under_start,
+    ACTIONS(83), 1,
+      sym__link_start,
+    ACTIONS(85), 1,
+      sym__image_start,
+    ACTIONS(87), 1,
+      sym__span_start,
+    ACTIONS(89), 1,
+      sym__citation_group_start,
+    ACTIONS(91), 1,
+      sym__shortcode_start,
+    ACTIONS(349), 1,
+      sym_symbols,
+    ACTIONS(351), 1,
+      aux_sym_literal_token1,
+    STATE(327), 1,
+      sym__inline_content,
+    STATE(160), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(161), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(347), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(4), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [952] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(99), 1,
+      sym__emph_star_start,
+    ACTIONS(101), 1,
+      sym__emph_under_start,
+    ACTIONS(103), 1,
+      sym__strong_star_start,
+    ACTIONS(105), 1,
+      sym__strong_under_start,
+    ACTIONS(109), 1,
+      sym__link_start,
+    ACTIONS(111), 1,
+      sym__image_start,
+    ACTIONS(113), 1,
+      sym__span_start,
+    ACTIONS(115), 1,
+      sym__citation_group_start,
+    ACTIONS(117), 1,
+      sym__shortcode_start,
+    ACTIONS(355), 1,
+      sym_symbols,
+    ACTIONS(357), 1,
+      aux_sym_literal_token1,
+    STATE(328), 1,
+      sym__inline_content,
+    STATE(179), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(180), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(353), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(5), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [1020] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(445), 1,
+      sym__link_end,
+    ACTIONS(447), 1,
+      sym_symbols,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(443), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(34), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [1088] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(451), 1,
+      sym__link_end,
+    ACTIONS(453), 1,
+      sym_symbols,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(449), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(35), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [1156] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(457), 1,
+      sym__link_end,
+    ACTIONS(459), 1,
+      sym_symbols,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(455), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(36), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [1224] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(401), 1,
+      sym_symbols,
+    ACTIONS(461), 1,
+      sym__link_end,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(397), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(26), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [1292] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(401), 1,
+      sym_symbols,
+    ACTIONS(463), 1,
+      sym__link_end,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(397), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(26), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [1360] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(401), 1,
+      sym_symbols,
+    ACTIONS(465), 1,
+      sym__link_end,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(397), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(26), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [1428] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(19), 1,
+      sym__emph_star_start,
+    ACTIONS(23), 1,
+      sym__emph_under_start,
+    ACTIONS(25), 1,
+      sym__strong_star_start,
+    ACTIONS(27), 1,
+      sym__strong_under_start,
+    ACTIONS(31), 1,
+      sym__link_start,
+    ACTIONS(33), 1,
+      sym__image_start,
+    ACTIONS(35), 1,
+      sym__span_start,
+    ACTIONS(37), 1,
+      sym__citation_group_start,
+    ACTIONS(39), 1,
+      sym__shortcode_start,
+    ACTIONS(337), 1,
+      sym_symbols,
+    ACTIONS(339), 1,
+      aux_sym_literal_token1,
+    STATE(334), 1,
+      sym__inline_content,
+    STATE(122), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(123), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(335), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(2), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [1496] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(47), 1,
+      sym__emph_star_start,
+    ACTIONS(49), 1,
+      sym__emph_under_start,
+    ACTIONS(51), 1,
+      sym__strong_star_start,
+    ACTIONS(53), 1,
+      sym__strong_under_start,
+    ACTIONS(57), 1,
+      sym__link_start,
+    ACTIONS(59), 1,
+      sym__image_start,
+    ACTIONS(61), 1,
+      sym__span_start,
+    ACTIONS(63), 1,
+      sym__citation_group_start,
+    ACTIONS(65), 1,
+      sym__shortcode_start,
+    ACTIONS(343), 1,
+      sym_symbols,
+    ACTIONS(345), 1,
+      aux_sym_literal_token1,
+    STATE(335), 1,
+      sym__inline_content,
+    STATE(141), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(142), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(341), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(3), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [1564] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(73), 1,
+      sym__emph_star_start,
+    ACTIONS(75), 1,
+      sym__emph_under_start,
+    ACTIONS(77), 1,
+      sym__strong_star_start,
+    ACTIONS(79), 1,
+      sym__strong_under_start,
+    ACTIONS(83), 1,
+      sym__link_start,
+    ACTIONS(85), 1,
+      sym__image_start,
+    ACTIONS(87), 1,
+      sym__span_start,
+    ACTIONS(89), 1,
+      sym__citation_group_start,
+    ACTIONS(91), 1,
+      sym__shortcode_start,
+    ACTIONS(349), 1,
+      sym_symbols,
+    ACTIONS(351), 1,
+      aux_sym_literal_token1,
+    STATE(336), 1,
+      sym__inline_content,
+    STATE(160), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(161), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(347), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(4), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [1632] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(99), 1,
+      sym__emph_star_start,
+    ACTIONS(101), 1,
+      sym__emph_under_start,
+    ACTIONS(103), 1,
+      sym__strong_star_start,
+    ACTIONS(105), 1,
+      sym__strong_under_start,
+    ACTIONS(109), 1,
+      sym__link_start,
+    ACTIONS(111), 1,
+      sym__image_start,
+    ACTIONS(113), 1,
+      sym__span_start,
+    ACTIONS(115), 1,
+      sym__citation_group_start,
+    ACTIONS(117), 1,
+      sym__shortcode_start,
+    ACTIONS(355), 1,
+      sym_symbols,
+    ACTIONS(357), 1,
+      aux_sym_literal_token1,
+    STATE(337), 1,
+      sym__inline_content,
+    STATE(179), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(180), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(353), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(5), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [1700] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(469), 1,
+      sym__link_end,
+    ACTIONS(471), 1,
+      sym_symbols,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(467), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(44), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [1768] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(475), 1,
+      sym__link_end,
+    ACTIONS(477), 1,
+      sym_symbols,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(473), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(45), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [1836] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(481), 1,
+      sym__link_end,
+    ACTIONS(483), 1,
+      sym_symbols,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(479), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(46), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [1904] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(401), 1,
+      sym_symbols,
+    ACTIONS(485), 1,
+      sym__link_end,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(397), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(26), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [1972] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(401), 1,
+      sym_symbols,
+    ACTIONS(487), 1,
+      sym__link_end,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(397), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(26), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [2040] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(401), 1,
+      sym_symbols,
+    ACTIONS(489), 1,
+      sym__link_end,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(397), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(26), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [2108] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(19), 1,
+      sym__emph_star_start,
+    ACTIONS(23), 1,
+      sym__emph_under_start,
+    ACTIONS(25), 1,
+      sym__strong_star_start,
+    ACTIONS(27), 1,
+      sym__strong_under_start,
+    ACTIONS(31), 1,
+      sym__link_start,
+    ACTIONS(33), 1,
+      sym__image_start,
+    ACTIONS(35), 1,
+      sym__span_start,
+    ACTIONS(37), 1,
+      sym__citation_group_start,
+    ACTIONS(39), 1,
+      sym__shortcode_start,
+    ACTIONS(337), 1,
+      sym_symbols,
+    ACTIONS(339), 1,
+      aux_sym_literal_token1,
+    STATE(342), 1,
+      sym__inline_content,
+    STATE(122), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(123), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(335), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(2), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [2176] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(47), 1,
+      sym__emph_star_start,
+    ACTIONS(49), 1,
+      sym__emph_under_start,
+    ACTIONS(51), 1,
+      sym__strong_star_start,
+    ACTIONS(53), 1,
+      sym__strong_under_start,
+    ACTIONS(57), 1,
+      sym__link_start,
+    ACTIONS(59), 1,
+      sym__image_start,
+    ACTIONS(61), 1,
+      sym__span_start,
+    ACTIONS(63), 1,
+      sym__citation_group_start,
+    ACTIONS(65), 1,
+      sym__shortcode_start,
+    ACTIONS(343), 1,
+      sym_symbols,
+    ACTIONS(345), 1,
+      aux_sym_literal_token1,
+    STATE(343), 1,
+      sym__inline_content,
+    STATE(141), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(142), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(341), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(3), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [2244] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(73), 1,
+      sym__emph_star_start,
+    ACTIONS(75), 1,
+      sym__emph_under_start,
+    ACTIONS(77), 1,
+      sym__strong_star_start,
+    ACTIONS(79), 1,
+      sym__strong_under_start,
+    ACTIONS(83), 1,
+      sym__link_start,
+    ACTIONS(85), 1,
+      sym__image_start,
+    ACTIONS(87), 1,
+      sym__span_start,
+    ACTIONS(89), 1,
+      sym__citation_group_start,
+    ACTIONS(91), 1,
+      sym__shortcode_start,
+    ACTIONS(349), 1,
+      sym_symbols,
+    ACTIONS(351), 1,
+      aux_sym_literal_token1,
+    STATE(344), 1,
+      sym__inline_content,
+    STATE(160), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(161), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(347), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(4), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [2312] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(99), 1,
+      sym__emph_star_start,
+    ACTIONS(101), 1,
+      sym__emph_under_start,
+    ACTIONS(103), 1,
+      sym__strong_star_start,
+    ACTIONS(105), 1,
+      sym__strong_under_start,
+    ACTIONS(109), 1,
+      sym__link_start,
+    ACTIONS(111), 1,
+      sym__image_start,
+    ACTIONS(113), 1,
+      sym__span_start,
+    ACTIONS(115), 1,
+      sym__citation_group_start,
+    ACTIONS(117), 1,
+      sym__shortcode_start,
+    ACTIONS(355), 1,
+      sym_symbols,
+    ACTIONS(357), 1,
+      aux_sym_literal_token1,
+    STATE(345), 1,
+      sym__inline_content,
+    STATE(179), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(180), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(353), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(5), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [2380] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(493), 1,
+      sym__link_end,
+    ACTIONS(495), 1,
+      sym_symbols,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(491), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(54), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [2448] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(499), 1,
+      sym__link_end,
+    ACTIONS(501), 1,
+      sym_symbols,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(497), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(55), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [2516] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(505), 1,
+      sym__link_end,
+    ACTIONS(507), 1,
+      sym_symbols,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(503), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(56), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [2584] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(401), 1,
+      sym_symbols,
+    ACTIONS(509), 1,
+      sym__link_end,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(397), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(26), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [2652] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(401), 1,
+      sym_symbols,
+    ACTIONS(511), 1,
+      sym__link_end,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(397), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(26), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [2720] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(401), 1,
+      sym_symbols,
+    ACTIONS(513), 1,
+      sym__link_end,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(397), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(26), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [2788] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(19), 1,
+      sym__emph_star_start,
+    ACTIONS(23), 1,
+      sym__emph_under_start,
+    ACTIONS(25), 1,
+      sym__strong_star_start,
+    ACTIONS(27), 1,
+      sym__strong_under_start,
+    ACTIONS(31), 1,
+      sym__link_start,
+    ACTIONS(33), 1,
+      sym__image_start,
+    ACTIONS(35), 1,
+      sym__span_start,
+    ACTIONS(37), 1,
+      sym__citation_group_start,
+    ACTIONS(39), 1,
+      sym__shortcode_start,
+    ACTIONS(337), 1,
+      sym_symbols,
+    ACTIONS(339), 1,
+      aux_sym_literal_token1,
+    STATE(350), 1,
+      sym__inline_content,
+    STATE(122), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(123), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(335), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(2), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [2856] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(47), 1,
+      sym__emph_star_start,
+    ACTIONS(49), 1,
+      sym__emph_under_start,
+    ACTIONS(51), 1,
+      sym__strong_star_start,
+    ACTIONS(53), 1,
+      sym__strong_under_start,
+    ACTIONS(57), 1,
+      sym__link_start,
+    ACTIONS(59), 1,
+      sym__image_start,
+    ACTIONS(61), 1,
+      sym__span_start,
+    ACTIONS(63), 1,
+      sym__citation_group_start,
+    ACTIONS(65), 1,
+      sym__shortcode_start,
+    ACTIONS(343), 1,
+      sym_symbols,
+    ACTIONS(345), 1,
+      aux_sym_literal_token1,
+    STATE(351), 1,
+      sym__inline_content,
+    STATE(141), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(142), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(341), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(3), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [2924] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(73), 1,
+      sym__emph_star_start,
+    ACTIONS(75), 1,
+      sym__emph_under_start,
+    ACTIONS(77), 1,
+      sym__strong_star_start,
+    ACTIONS(79), 1,
+      sym__strong_under_start,
+    ACTIONS(83), 1,
+      sym__link_start,
+    ACTIONS(85), 1,
+      sym__image_start,
+    ACTIONS(87), 1,
+      sym__span_start,
+    ACTIONS(89), 1,
+      sym__citation_group_start,
+    ACTIONS(91), 1,
+      sym__shortcode_start,
+    ACTIONS(349), 1,
+      sym_symbols,
+    ACTIONS(351), 1,
+      aux_sym_literal_token1,
+    STATE(352), 1,
+      sym__inline_content,
+    STATE(160), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(161), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(347), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(4), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [2992] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(99), 1,
+      sym__emph_star_start,
+    ACTIONS(101), 1,
+      sym__emph_under_start,
+    ACTIONS(103), 1,
+      sym__strong_star_start,
+    ACTIONS(105), 1,
+      sym__strong_under_start,
+    ACTIONS(109), 1,
+      sym__link_start,
+    ACTIONS(111), 1,
+      sym__image_start,
+    ACTIONS(113), 1,
+      sym__span_start,
+    ACTIONS(115), 1,
+      sym__citation_group_start,
+    ACTIONS(117), 1,
+      sym__shortcode_start,
+    ACTIONS(355), 1,
+      sym_symbols,
+    ACTIONS(357), 1,
+      aux_sym_literal_token1,
+    STATE(353), 1,
+      sym__inline_content,
+    STATE(179), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(180), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(353), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(5), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [3060] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(517), 1,
+      sym__link_end,
+    ACTIONS(519), 1,
+      sym_symbols,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(515), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(64), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [3128] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(523), 1,
+      sym__link_end,
+    ACTIONS(525), 1,
+      sym_symbols,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(521), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(65), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [3196] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(529), 1,
+      sym__link_end,
+    ACTIONS(531), 1,
+      sym_symbols,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(527), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(66), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [3264] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(401), 1,
+      sym_symbols,
+    ACTIONS(533), 1,
+      sym__link_end,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(397), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(26), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [3332] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(401), 1,
+      sym_symbols,
+    ACTIONS(535), 1,
+      sym__link_end,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(397), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(26), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [3400] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(401), 1,
+      sym_symbols,
+    ACTIONS(537), 1,
+      sym__link_end,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(397), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(26), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [3468] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(19), 1,
+      sym__emph_star_start,
+    ACTIONS(23), 1,
+      sym__emph_under_start,
+    ACTIONS(25), 1,
+      sym__strong_star_start,
+    ACTIONS(27), 1,
+      sym__strong_under_start,
+    ACTIONS(31), 1,
+      sym__link_start,
+    ACTIONS(33), 1,
+      sym__image_start,
+    ACTIONS(35), 1,
+      sym__span_start,
+    ACTIONS(37), 1,
+      sym__citation_group_start,
+    ACTIONS(39), 1,
+      sym__shortcode_start,
+    ACTIONS(337), 1,
+      sym_symbols,
+    ACTIONS(339), 1,
+      aux_sym_literal_token1,
+    STATE(358), 1,
+      sym__inline_content,
+    STATE(122), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(123), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(335), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(2), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [3536] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(47), 1,
+      sym__emph_star_start,
+    ACTIONS(49), 1,
+      sym__emph_under_start,
+    ACTIONS(51), 1,
+      sym__strong_star_start,
+    ACTIONS(53), 1,
+      sym__strong_under_start,
+    ACTIONS(57), 1,
+      sym__link_start,
+    ACTIONS(59), 1,
+      sym__image_start,
+    ACTIONS(61), 1,
+      sym__span_start,
+    ACTIONS(63), 1,
+      sym__citation_group_start,
+    ACTIONS(65), 1,
+      sym__shortcode_start,
+    ACTIONS(343), 1,
+      sym_symbols,
+    ACTIONS(345), 1,
+      aux_sym_literal_token1,
+    STATE(359), 1,
+      sym__inline_content,
+    STATE(141), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(142), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(341), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(3), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [3604] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(73), 1,
+      sym__emph_star_start,
+    ACTIONS(75), 1,
+      sym__emph_under_start,
+    ACTIONS(77), 1,
+      sym__strong_star_start,
+    ACTIONS(79), 1,
+      sym__strong_under_start,
+    ACTIONS(83), 1,
+      sym__link_start,
+    ACTIONS(85), 1,
+      sym__image_start,
+    ACTIONS(87), 1,
+      sym__span_start,
+    ACTIONS(89), 1,
+      sym__citation_group_start,
+    ACTIONS(91), 1,
+      sym__shortcode_start,
+    ACTIONS(349), 1,
+      sym_symbols,
+    ACTIONS(351), 1,
+      aux_sym_literal_token1,
+    STATE(360), 1,
+      sym__inline_content,
+    STATE(160), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(161), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(347), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(4), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [3672] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(99), 1,
+      sym__emph_star_start,
+    ACTIONS(101), 1,
+      sym__emph_under_start,
+    ACTIONS(103), 1,
+      sym__strong_star_start,
+    ACTIONS(105), 1,
+      sym__strong_under_start,
+    ACTIONS(109), 1,
+      sym__link_start,
+    ACTIONS(111), 1,
+      sym__image_start,
+    ACTIONS(113), 1,
+      sym__span_start,
+    ACTIONS(115), 1,
+      sym__citation_group_start,
+    ACTIONS(117), 1,
+      sym__shortcode_start,
+    ACTIONS(355), 1,
+      sym_symbols,
+    ACTIONS(357), 1,
+      aux_sym_literal_token1,
+    STATE(361), 1,
+      sym__inline_content,
+    STATE(179), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(180), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(353), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(5), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [3740] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(541), 1,
+      sym__link_end,
+    ACTIONS(543), 1,
+      sym_symbols,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(539), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(74), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [3808] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(547), 1,
+      sym__link_end,
+    ACTIONS(549), 1,
+      sym_symbols,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(545), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(75), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [3876] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(553), 1,
+      sym__link_end,
+    ACTIONS(555), 1,
+      sym_symbols,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(551), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(76), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [3944] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(401), 1,
+      sym_symbols,
+    ACTIONS(557), 1,
+      sym__link_end,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(397), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(26), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [4012] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(401), 1,
+      sym_symbols,
+    ACTIONS(559), 1,
+      sym__link_end,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(397), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(26), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [4080] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(359), 1,
+      sym__emph_star_start,
+    ACTIONS(361), 1,
+      sym__emph_under_start,
+    ACTIONS(363), 1,
+      sym__strong_star_start,
+    ACTIONS(365), 1,
+      sym__strong_under_start,
+    ACTIONS(369), 1,
+      sym__link_start,
+    ACTIONS(371), 1,
+      sym__image_start,
+    ACTIONS(375), 1,
+      sym__span_start,
+    ACTIONS(377), 1,
+      sym__citation_group_start,
+    ACTIONS(379), 1,
+      sym__shortcode_start,
+    ACTIONS(383), 1,
+      aux_sym_literal_token1,
+    ACTIONS(401), 1,
+      sym_symbols,
+    ACTIONS(561), 1,
+      sym__link_end,
+    STATE(202), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(203), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(397), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(26), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [4148] = 16,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(127), 1,
+      sym__emph_star_start,
+    ACTIONS(129), 1,
+      sym__emph_under_start,
+    ACTIONS(131), 1,
+      sym__strong_star_start,
+    ACTIONS(133), 1,
+      sym__strong_under_start,
+    ACTIONS(137), 1,
+      sym__link_start,
+    ACTIONS(139), 1,
+      sym__image_start,
+    ACTIONS(141), 1,
+      sym__span_start,
+    ACTIONS(143), 1,
+      sym__citation_group_start,
+    ACTIONS(145), 1,
+      sym__shortcode_start,
+    ACTIONS(565), 1,
+      sym_symbols,
+    ACTIONS(567), 1,
+      aux_sym_literal_token1,
+    STATE(103), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(104), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(563), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(6), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [4213] = 16,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(19), 1,
+      sym__emph_star_start,
+    ACTIONS(23), 1,
+      sym__emph_under_start,
+    ACTIONS(25), 1,
+      sym__strong_star_start,
+    ACTIONS(27), 1,
+      sym__strong_under_start,
+    ACTIONS(31), 1,
+      sym__link_start,
+    ACTIONS(33), 1,
+      sym__image_start,
+    ACTIONS(35), 1,
+      sym__span_start,
+    ACTIONS(37), 1,
+      sym__citation_group_start,
+    ACTIONS(39), 1,
+      sym__shortcode_start,
+    ACTIONS(339), 1,
+      aux_sym_literal_token1,
+    ACTIONS(571), 1,
+      sym_symbols,
+    STATE(122), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(123), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(569), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(8), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [4278] = 16,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(47), 1,
+      sym__emph_star_start,
+    ACTIONS(49), 1,
+      sym__emph_under_start,
+    ACTIONS(51), 1,
+      sym__strong_star_start,
+    ACTIONS(53), 1,
+      sym__strong_under_start,
+    ACTIONS(57), 1,
+      sym__link_start,
+    ACTIONS(59), 1,
+      sym__image_start,
+    ACTIONS(61), 1,
+      sym__span_start,
+    ACTIONS(63), 1,
+      sym__citation_group_start,
+    ACTIONS(65), 1,
+      sym__shortcode_start,
+    ACTIONS(345), 1,
+      aux_sym_literal_token1,
+    ACTIONS(575), 1,
+      sym_symbols,
+    STATE(141), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(142), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(573), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(10), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [4343] = 16,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(73), 1,
+      sym__emph_star_start,
+    ACTIONS(75), 1,
+      sym__emph_under_start,
+    ACTIONS(77), 1,
+      sym__strong_star_start,
+    ACTIONS(79), 1,
+      sym__strong_under_start,
+    ACTIONS(83), 1,
+      sym__link_start,
+    ACTIONS(85), 1,
+      sym__image_start,
+    ACTIONS(87), 1,
+      sym__span_start,
+    ACTIONS(89), 1,
+      sym__citation_group_start,
+    ACTIONS(91), 1,
+      sym__shortcode_start,
+    ACTIONS(351), 1,
+      aux_sym_literal_token1,
+    ACTIONS(579), 1,
+      sym_symbols,
+    STATE(160), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(161), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(577), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(12), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [4408] = 16,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(99), 1,
+      sym__emph_star_start,
+    ACTIONS(101), 1,
+      sym__emph_under_start,
+    ACTIONS(103), 1,
+      sym__strong_star_start,
+    ACTIONS(105), 1,
+      sym__strong_under_start,
+    ACTIONS(109), 1,
+      sym__link_start,
+    ACTIONS(111), 1,
+      sym__image_start,
+    ACTIONS(113), 1,
+      sym__span_start,
+    ACTIONS(115), 1,
+      sym__citation_group_start,
+    ACTIONS(117), 1,
+      sym__shortcode_start,
+    ACTIONS(357), 1,
+      aux_sym_literal_token1,
+    ACTIONS(583), 1,
+      sym_symbols,
+    STATE(179), 2,
+      sym__emph_star,
+      sym__emph_under,
+    STATE(180), 2,
+      sym__strong_star,
+      sym__strong_under,
+    ACTIONS(581), 7,
+      sym__no_parse,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym_shortcode_escaped,
+      sym_text,
+    STATE(14), 9,
+      aux_sym__line_content,
+      sym_literal,
+      sym_emph,
+      sym_link,
+      sym_image,
+      sym_span,
+      sym_citation_group,
+      sym_shortcode,
+      sym_strong,
+  [4473] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(589), 1,
+      sym__attribute_start,
+    STATE(112), 1,
+      sym_attribute_block,
+    ACTIONS(587), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(585), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [4510] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(589), 1,
+      sym__attribute_start,
+    STATE(113), 1,
+      sym_attribute_block,
+    ACTIONS(593), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(591), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [4547] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(589), 1,
+      sym__attribute_start,
+    STATE(118), 1,
+      sym_attribute_block,
+    ACTIONS(597), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(595), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [4584] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(589), 1,
+      sym__attribute_start,
+    STATE(119), 1,
+      sym_attribute_block,
+    ACTIONS(601), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(599), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [4621] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(603), 1,
+      sym__attribute_start,
+    STATE(131), 1,
+      sym_attribute_block,
+    ACTIONS(587), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(585), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [4657] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(603), 1,
+      sym__attribute_start,
+    STATE(132), 1,
+      sym_attribute_block,
+    ACTIONS(593), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(591), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [4693] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(603), 1,
+      sym__attribute_start,
+    STATE(137), 1,
+      sym_attribute_block,
+    ACTIONS(597), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(595), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [4729] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(603), 1,
+      sym__attribute_start,
+    STATE(138), 1,
+      sym_attribute_block,
+    ACTIONS(601), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(599), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [4765] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(605), 1,
+      sym__attribute_start,
+    STATE(150), 1,
+      sym_attribute_block,
+    ACTIONS(587), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(585), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [4801] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(605), 1,
+      sym__attribute_start,
+    STATE(151), 1,
+      sym_attribute_block,
+    ACTIONS(593), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(591), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [4837] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(605), 1,
+      sym__attribute_start,
+    STATE(156), 1,
+      sym_attribute_block,
+    ACTIONS(597), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(595), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [4873] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(605), 1,
+      sym__attribute_start,
+    STATE(157), 1,
+      sym_attribute_block,
+    ACTIONS(601), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(599), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [4909] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(607), 1,
+      sym__attribute_start,
+    STATE(169), 1,
+      sym_attribute_block,
+    ACTIONS(587), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(585), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [4945] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(607), 1,
+      sym__attribute_start,
+    STATE(170), 1,
+      sym_attribute_block,
+    ACTIONS(593), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(591), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [4981] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(607), 1,
+      sym__attribute_start,
+    STATE(175), 1,
+      sym_attribute_block,
+    ACTIONS(597), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(595), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [5017] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(607), 1,
+      sym__attribute_start,
+    STATE(176), 1,
+      sym_attribute_block,
+    ACTIONS(601), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(599), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [5053] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(609), 1,
+      sym__attribute_start,
+    STATE(188), 1,
+      sym_attribute_block,
+    ACTIONS(587), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(585), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [5089] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(609), 1,
+      sym__attribute_start,
+    STATE(189), 1,
+      sym_attribute_block,
+    ACTIONS(593), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(591), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [5125] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(609), 1,
+      sym__attribute_start,
+    STATE(194), 1,
+      sym_attribute_block,
+    ACTIONS(597), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(595), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [5161] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(609), 1,
+      sym__attribute_start,
+    STATE(195), 1,
+      sym_attribute_block,
+    ACTIONS(601), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(599), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [5197] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(613), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(611), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [5228] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(617), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(615), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [5259] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(621), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(619), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [5290] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(625), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(623), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [5321] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(629), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(627), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [5352] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(633), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(631), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [5383] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(637), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(635), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [5414] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(641), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(639), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [5445] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(645), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(643), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [5476] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(649), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(647), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [5507] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(597), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(595), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [5538] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(601), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(599), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [5569] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(653), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(651), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [5600] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(657), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(655), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [5631] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(661), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(659), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [5662] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(665), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(663), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [5693] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(669), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(667), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [5724] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(673), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(671), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [5755] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(677), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(675), 20,
+      ts_builtin_sym_end,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+      sym__trailing_attribute_start,
+  [5786] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(613), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(611), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [5816] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(617), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(615), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [5846] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(621), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(619), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [5876] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(625), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(623), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [5906] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(629), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(627), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [5936] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(633), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(631), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [5966] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(637), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(635), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [5996] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(641), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(639), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6026] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(645), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(643), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6056] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(649), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(647), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6086] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(597), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(595), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6116] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(601), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(599), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6146] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(653), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(651), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6176] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(657), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(655), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6206] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(661), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(659), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6236] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(665), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(663), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6266] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(669), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(667), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6296] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(673), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(671), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6326] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(677), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(675), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_star_end,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6356] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(613), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(611), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6386] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(617), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(615), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6416] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(621), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(619), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6446] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(625), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(623), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6476] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(629), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(627), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6506] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(633), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(631), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6536] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(637), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(635), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6566] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(641), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(639), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6596] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(645), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(643), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6626] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(649), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(647), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6656] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(597), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(595), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6686] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(601), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(599), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6716] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(653), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(651), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6746] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(657), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(655), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6776] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(661), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(659), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6806] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(665), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(663), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6836] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(669), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(667), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6866] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(673), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(671), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6896] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(677), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(675), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__emph_under_end,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6926] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(613), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(611), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6956] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(617), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(615), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [6986] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(621), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(619), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7016] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(625), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(623), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7046] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(629), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(627), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7076] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(633), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(631), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7106] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(637), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(635), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7136] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(641), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(639), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7166] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(645), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(643), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7196] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(649), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(647), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7226] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(597), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(595), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7256] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(601), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(599), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7286] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(653), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(651), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7316] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(657), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(655), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7346] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(661), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(659), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7376] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(665), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(663), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7406] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(669), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(667), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7436] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(673), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(671), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7466] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(677), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(675), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_star_end,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7496] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(613), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(611), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7526] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(617), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(615), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7556] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(621), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(619), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7586] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(625), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(623), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7616] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(629), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(627), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7646] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(633), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(631), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7676] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(637), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(635), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7706] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(641), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(639), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7736] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(645), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(643), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7766] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(649), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(647), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7796] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(597), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(595), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7826] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(601), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(599), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7856] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(653), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(651), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7886] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(657), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(655), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7916] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(661), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(659), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7946] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(665), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(663), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [7976] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(669), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(667), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8006] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(673), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(671), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8036] = 3,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(677), 3,
+      anon_sym_BSLASH,
+      sym_symbols,
+      aux_sym_literal_token1,
+    ACTIONS(675), 19,
+      anon_sym_,
+      sym_line_end,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__strong_under_end,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8066] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(587), 1,
+      sym_symbols,
+    ACTIONS(679), 1,
+      sym__attribute_start,
+    STATE(211), 1,
+      sym_attribute_block,
+    ACTIONS(585), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8099] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(593), 1,
+      sym_symbols,
+    ACTIONS(679), 1,
+      sym__attribute_start,
+    STATE(212), 1,
+      sym_attribute_block,
+    ACTIONS(591), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8132] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(597), 1,
+      sym_symbols,
+    ACTIONS(679), 1,
+      sym__attribute_start,
+    STATE(217), 1,
+      sym_attribute_block,
+    ACTIONS(595), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8165] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(601), 1,
+      sym_symbols,
+    ACTIONS(679), 1,
+      sym__attribute_start,
+    STATE(218), 1,
+      sym_attribute_block,
+    ACTIONS(599), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8198] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(613), 1,
+      sym_symbols,
+    ACTIONS(611), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8225] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(617), 1,
+      sym_symbols,
+    ACTIONS(615), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8252] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(621), 1,
+      sym_symbols,
+    ACTIONS(619), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8279] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(625), 1,
+      sym_symbols,
+    ACTIONS(623), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8306] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(629), 1,
+      sym_symbols,
+    ACTIONS(627), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8333] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(633), 1,
+      sym_symbols,
+    ACTIONS(631), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8360] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(637), 1,
+      sym_symbols,
+    ACTIONS(635), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8387] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(641), 1,
+      sym_symbols,
+    ACTIONS(639), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8414] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(645), 1,
+      sym_symbols,
+    ACTIONS(643), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8441] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(649), 1,
+      sym_symbols,
+    ACTIONS(647), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8468] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(597), 1,
+      sym_symbols,
+    ACTIONS(595), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8495] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(601), 1,
+      sym_symbols,
+    ACTIONS(599), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8522] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(653), 1,
+      sym_symbols,
+    ACTIONS(651), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8549] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(657), 1,
+      sym_symbols,
+    ACTIONS(655), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8576] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(661), 1,
+      sym_symbols,
+    ACTIONS(659), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8603] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(665), 1,
+      sym_symbols,
+    ACTIONS(663), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8630] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(669), 1,
+      sym_symbols,
+    ACTIONS(667), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8657] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(673), 1,
+      sym_symbols,
+    ACTIONS(671), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8684] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(677), 1,
+      sym_symbols,
+    ACTIONS(675), 18,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__link_end,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8711] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(683), 1,
+      sym_symbols,
+    ACTIONS(681), 17,
+      aux_sym_literal_token1,
+      sym__emph_star_start,
+      sym__emph_under_start,
+      sym__strong_star_start,
+      sym__strong_under_start,
+      sym__no_parse,
+      sym__link_start,
+      sym__image_start,
+      sym__span_start,
+      sym_inline_math,
+      sym_display_math,
+      sym_citation,
+      sym_cross_reference,
+      sym__citation_group_start,
+      sym__shortcode_start,
+      sym_shortcode_escaped,
+      sym_text,
+  [8737] = 8,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(685), 1,
+      ts_builtin_sym_end,
+    ACTIONS(687), 1,
+      sym_line_end,
+    ACTIONS(689), 1,
+      sym__trailing_attribute_start,
+    STATE(222), 1,
+      aux_sym_inline_repeat1,
+    STATE(247), 1,
+      sym__trailing_attribute_block,
+    STATE(260), 1,
+      sym_line_break,
+    ACTIONS(691), 2,
+      anon_sym_BSLASH,
+      anon_sym_,
+  [8763] = 8,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(689), 1,
+      sym__trailing_attribute_start,
+    ACTIONS(693), 1,
+      ts_builtin_sym_end,
+    ACTIONS(695), 1,
+      sym_line_end,
+    STATE(223), 1,
+      aux_sym_inline_repeat1,
+    STATE(249), 1,
+      sym__trailing_attribute_block,
+    STATE(264), 1,
+      sym_line_break,
+    ACTIONS(691), 2,
+      anon_sym_BSLASH,
+      anon_sym_,
+  [8789] = 6,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(697), 1,
+      sym_line_end,
+    STATE(223), 1,
+      aux_sym_inline_repeat1,
+    STATE(295), 1,
+      sym_line_break,
+    ACTIONS(700), 2,
+      ts_builtin_sym_end,
+      sym__trailing_attribute_start,
+    ACTIONS(702), 2,
+      anon_sym_BSLASH,
+      anon_sym_,
+  [8810] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(707), 1,
+      sym_attribute_key,
+    ACTIONS(709), 1,
+      sym__attribute_end,
+    ACTIONS(705), 2,
+      sym_attribute_id,
+      sym_attribute_class,
+    STATE(225), 2,
+      sym_attribute,
+      aux_sym_attribute_block_repeat1,
+  [8828] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(707), 1,
+      sym_attribute_key,
+    ACTIONS(713), 1,
+      sym__attribute_end,
+    ACTIONS(711), 2,
+      sym_attribute_id,
+      sym_attribute_class,
+    STATE(228), 2,
+      sym_attribute,
+      aux_sym_attribute_block_repeat1,
+  [8846] = 6,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(17), 1,
+      sym_line_end,
+    ACTIONS(715), 1,
+      sym__emph_star_end,
+    STATE(78), 1,
+      sym_line_break,
+    STATE(229), 1,
+      aux_sym__inline_content_repeat1,
+    ACTIONS(11), 2,
+      anon_sym_BSLASH,
+      anon_sym_,
+  [8866] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(707), 1,
+      sym_attribute_key,
+    ACTIONS(719), 1,
+      sym__attribute_end,
+    ACTIONS(717), 2,
+      sym_attribute_id,
+      sym_attribute_class,
+    STATE(230), 2,
+      sym_attribute,
+      aux_sym_attribute_block_repeat1,
+  [8884] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(724), 1,
+      sym_attribute_key,
+    ACTIONS(727), 1,
+      sym__attribute_end,
+    ACTIONS(721), 2,
+      sym_attribute_id,
+      sym_attribute_class,
+    STATE(228), 2,
+      sym_attribute,
+      aux_sym_attribute_block_repeat1,
+  [8902] = 6,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(189), 1,
+      sym__emph_star_end,
+    ACTIONS(729), 1,
+      sym_line_end,
+    STATE(78), 1,
+      sym_line_break,
+    STATE(229), 1,
+      aux_sym__inline_content_repeat1,
+    ACTIONS(732), 2,
+      anon_sym_BSLASH,
+      anon_sym_,
+  [8922] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(707), 1,
+      sym_attribute_key,
+    ACTIONS(735), 1,
+      sym__attribute_end,
+    ACTIONS(711), 2,
+      sym_attribute_id,
+      sym_attribute_class,
+    STATE(228), 2,
+      sym_attribute,
+      aux_sym_attribute_block_repeat1,
+  [8940] = 6,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(45), 1,
+      sym_line_end,
+    ACTIONS(715), 1,
+      sym__emph_under_end,
+    STATE(79), 1,
+      sym_line_break,
+    STATE(232), 1,
+      aux_sym__inline_content_repeat1,
+    ACTIONS(11), 2,
+      anon_sym_BSLASH,
+      anon_sym_,
+  [8960] = 6,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(189), 1,
+      sym__emph_under_end,
+    ACTIONS(737), 1,
+      sym_line_end,
+    STATE(79), 1,
+      sym_line_break,
+    STATE(232), 1,
+      aux_sym__inline_content_repeat1,
+    ACTIONS(732), 2,
+      anon_sym_BSLASH,
+      anon_sym_,
+  [8980] = 6,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(71), 1,
+      sym_line_end,
+    ACTIONS(715), 1,
+      sym__strong_star_end,
+    STATE(80), 1,
+      sym_line_break,
+    STATE(234), 1,
+      aux_sym__inline_content_repeat1,
+    ACTIONS(11), 2,
+      anon_sym_BSLASH,
+      anon_sym_,
+  [9000] = 6,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(189), 1,
+      sym__strong_star_end,
+    ACTIONS(740), 1,
+      sym_line_end,
+    STATE(80), 1,
+      sym_line_break,
+    STATE(234), 1,
+      aux_sym__inline_content_repeat1,
+    ACTIONS(732), 2,
+      anon_sym_BSLASH,
+      anon_sym_,
+  [9020] = 6,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(97), 1,
+      sym_line_end,
+    ACTIONS(715), 1,
+      sym__strong_under_end,
+    STATE(81), 1,
+      sym_line_break,
+    STATE(236), 1,
+      aux_sym__inline_content_repeat1,
+    ACTIONS(11), 2,
+      anon_sym_BSLASH,
+      anon_sym_,
+  [9040] = 6,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(189), 1,
+      sym__strong_under_end,
+    ACTIONS(743), 1,
+      sym_line_end,
+    STATE(81), 1,
+      sym_line_break,
+    STATE(236), 1,
+      aux_sym__inline_content_repeat1,
+    ACTIONS(732), 2,
+      anon_sym_BSLASH,
+      anon_sym_,
+  [9060] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(707), 1,
+      sym_attribute_key,
+    ACTIONS(748), 1,
+      sym__attribute_end,
+    ACTIONS(746), 2,
+      sym_attribute_id,
+      sym_attribute_class,
+    STATE(238), 2,
+      sym_attribute,
+      aux_sym_attribute_block_repeat1,
+  [9078] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(707), 1,
+      sym_attribute_key,
+    ACTIONS(750), 1,
+      sym__attribute_end,
+    ACTIONS(711), 2,
+      sym_attribute_id,
+      sym_attribute_class,
+    STATE(228), 2,
+      sym_attribute,
+      aux_sym_attribute_block_repeat1,
+  [9096] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(707), 1,
+      sym_attribute_key,
+    ACTIONS(754), 1,
+      sym__attribute_end,
+    ACTIONS(752), 2,
+      sym_attribute_id,
+      sym_attribute_class,
+    STATE(240), 2,
+      sym_attribute,
+      aux_sym_attribute_block_repeat1,
+  [9114] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(707), 1,
+      sym_attribute_key,
+    ACTIONS(756), 1,
+      sym__attribute_end,
+    ACTIONS(711), 2,
+      sym_attribute_id,
+      sym_attribute_class,
+    STATE(228), 2,
+      sym_attribute,
+      aux_sym_attribute_block_repeat1,
+  [9132] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(707), 1,
+      sym_attribute_key,
+    ACTIONS(760), 1,
+      sym__attribute_end,
+    ACTIONS(758), 2,
+      sym_attribute_id,
+      sym_attribute_class,
+    STATE(242), 2,
+      sym_attribute,
+      aux_sym_attribute_block_repeat1,
+  [9150] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(707), 1,
+      sym_attribute_key,
+    ACTIONS(762), 1,
+      sym__attribute_end,
+    ACTIONS(711), 2,
+      sym_attribute_id,
+      sym_attribute_class,
+    STATE(228), 2,
+      sym_attribute,
+      aux_sym_attribute_block_repeat1,
+  [9168] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(707), 1,
+      sym_attribute_key,
+    ACTIONS(766), 1,
+      sym__attribute_end,
+    ACTIONS(764), 2,
+      sym_attribute_id,
+      sym_attribute_class,
+    STATE(244), 2,
+      sym_attribute,
+      aux_sym_attribute_block_repeat1,
+  [9186] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(707), 1,
+      sym_attribute_key,
+    ACTIONS(768), 1,
+      sym__attribute_end,
+    ACTIONS(711), 2,
+      sym_attribute_id,
+      sym_attribute_class,
+    STATE(228), 2,
+      sym_attribute,
+      aux_sym_attribute_block_repeat1,
+  [9204] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(707), 1,
+      sym_attribute_key,
+    ACTIONS(772), 1,
+      sym__attribute_end,
+    ACTIONS(770), 2,
+      sym_attribute_id,
+      sym_attribute_class,
+    STATE(246), 2,
+      sym_attribute,
+      aux_sym_attribute_block_repeat1,
+  [9222] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(707), 1,
+      sym_attribute_key,
+    ACTIONS(774), 1,
+      sym__attribute_end,
+    ACTIONS(711), 2,
+      sym_attribute_id,
+      sym_attribute_class,
+    STATE(228), 2,
+      sym_attribute,
+      aux_sym_attribute_block_repeat1,
+  [9240] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(693), 1,
+      ts_builtin_sym_end,
+    ACTIONS(776), 1,
+      sym_line_end,
+    STATE(318), 1,
+      sym_line_break,
+    ACTIONS(778), 2,
+      anon_sym_BSLASH,
+      anon_sym_,
+  [9257] = 2,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(700), 5,
+      ts_builtin_sym_end,
+      anon_sym_BSLASH,
+      anon_sym_,
+      sym_line_end,
+      sym__trailing_attribute_start,
+  [9268] = 5,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(780), 1,
+      ts_builtin_sym_end,
+    ACTIONS(782), 1,
+      sym_line_end,
+    STATE(322), 1,
+      sym_line_break,
+    ACTIONS(778), 2,
+      anon_sym_BSLASH,
+      anon_sym_,
+  [9285] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(786), 1,
+      sym_citation_prefix,
+    STATE(262), 1,
+      sym_citation_item,
+    ACTIONS(784), 2,
+      sym_citation,
+      sym_cross_reference,
+  [9299] = 2,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(788), 4,
+      ts_builtin_sym_end,
+      anon_sym_BSLASH,
+      anon_sym_,
+      sym_line_end,
+  [9309] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(786), 1,
+      sym_citation_prefix,
+    STATE(297), 1,
+      sym_citation_item,
+    ACTIONS(784), 2,
+      sym_citation,
+      sym_cross_reference,
+  [9323] = 2,
+    ACTIONS(7), 1,
+      sym_comment,
+    ACTIONS(790), 4,
+      ts_builtin_sym_end,
+      anon_sym_BSLASH,
+      anon_sym_,
+      sym_line_end,
+  [9333] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(792), 4,
+      sym_attribute_id,
+      sym_attribute_class,
+      sym_attribute_key,
+      sym__attribute_end,
+  [9343] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(786), 1,
+      sym_citation_prefix,
+    STATE(270), 1,
+      sym_citation_item,
+    ACTIONS(784), 2,
+      sym_citation,
+      sym_cross_reference,
+  [9357] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(786), 1,
+      sym_citation_prefix,
+    STATE(274), 1,
+      sym_citation_item,
+    ACTIONS(784), 2,
+      sym_citation,
+      sym_cross_reference,
+  [9371] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(786), 1,
+      sym_citation_prefix,
+    STATE(278), 1,
+      sym_citation_item,
+    ACTIONS(784), 2,
+      sym_citation,
+      sym_cross_reference,
+  [9385] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(786), 1,
+      sym_citation_prefix,
+    STATE(282), 1,
+      sym_citation_item,
+    ACTIONS(784), 2,
+      sym_citation,
+      sym_cross_reference,
+  [9399] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(786), 1,
+      sym_citation_prefix,
+    STATE(286), 1,
+      sym_citation_item,
+    ACTIONS(784), 2,
+      sym_citation,
+      sym_cross_reference,
+  [9413] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(5), 1,
+      sym__line_start,
+    ACTIONS(693), 1,
+      ts_builtin_sym_end,
+    STATE(248), 1,
+      sym__line,
+  [9426] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(796), 1,
+      sym_citation_locator,
+    ACTIONS(794), 2,
+      sym_semi_colon,
+      sym__link_end,
+  [9437] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(798), 1,
+      sym__link_end,
+    ACTIONS(800), 1,
+      sym_semi_colon,
+    STATE(266), 1,
+      aux_sym_citation_group_repeat1,
+  [9450] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(802), 1,
+      sym_shortcode_argument,
+    ACTIONS(804), 1,
+      sym__shortcode_end,
+    STATE(267), 1,
+      aux_sym_shortcode_repeat1,
+  [9463] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(5), 1,
+      sym__line_start,
+    ACTIONS(780), 1,
+      ts_builtin_sym_end,
+    STATE(248), 1,
+      sym__line,
+  [9476] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(808), 1,
+      sym_citation_locator,
+    ACTIONS(806), 2,
+      sym_semi_colon,
+      sym__link_end,
+  [9487] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(800), 1,
+      sym_semi_colon,
+    ACTIONS(810), 1,
+      sym__link_end,
+    STATE(268), 1,
+      aux_sym_citation_group_repeat1,
+  [9500] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(812), 1,
+      sym_shortcode_argument,
+    ACTIONS(814), 1,
+      sym__shortcode_end,
+    STATE(269), 1,
+      aux_sym_shortcode_repeat1,
+  [9513] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(816), 1,
+      sym__link_end,
+    ACTIONS(818), 1,
+      sym_semi_colon,
+    STATE(268), 1,
+      aux_sym_citation_group_repeat1,
+  [9526] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(821), 1,
+      sym_shortcode_argument,
+    ACTIONS(824), 1,
+      sym__shortcode_end,
+    STATE(269), 1,
+      aux_sym_shortcode_repeat1,
+  [9539] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(800), 1,
+      sym_semi_colon,
+    ACTIONS(826), 1,
+      sym__link_end,
+    STATE(272), 1,
+      aux_sym_citation_group_repeat1,
+  [9552] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(828), 1,
+      sym_shortcode_argument,
+    ACTIONS(830), 1,
+      sym__shortcode_end,
+    STATE(273), 1,
+      aux_sym_shortcode_repeat1,
+  [9565] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(800), 1,
+      sym_semi_colon,
+    ACTIONS(832), 1,
+      sym__link_end,
+    STATE(268), 1,
+      aux_sym_citation_group_repeat1,
+  [9578] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(812), 1,
+      sym_shortcode_argument,
+    ACTIONS(834), 1,
+      sym__shortcode_end,
+    STATE(269), 1,
+      aux_sym_shortcode_repeat1,
+  [9591] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(800), 1,
+      sym_semi_colon,
+    ACTIONS(836), 1,
+      sym__link_end,
+    STATE(276), 1,
+      aux_sym_citation_group_repeat1,
+  [9604] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(838), 1,
+      sym_shortcode_argument,
+    ACTIONS(840), 1,
+      sym__shortcode_end,
+    STATE(277), 1,
+      aux_sym_shortcode_repeat1,
+  [9617] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(800), 1,
+      sym_semi_colon,
+    ACTIONS(842), 1,
+      sym__link_end,
+    STATE(268), 1,
+      aux_sym_citation_group_repeat1,
+  [9630] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(812), 1,
+      sym_shortcode_argument,
+    ACTIONS(844), 1,
+      sym__shortcode_end,
+    STATE(269), 1,
+      aux_sym_shortcode_repeat1,
+  [9643] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(800), 1,
+      sym_semi_colon,
+    ACTIONS(846), 1,
+      sym__link_end,
+    STATE(280), 1,
+      aux_sym_citation_group_repeat1,
+  [9656] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(848), 1,
+      sym_shortcode_argument,
+    ACTIONS(850), 1,
+      sym__shortcode_end,
+    STATE(281), 1,
+      aux_sym_shortcode_repeat1,
+  [9669] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(800), 1,
+      sym_semi_colon,
+    ACTIONS(852), 1,
+      sym__link_end,
+    STATE(268), 1,
+      aux_sym_citation_group_repeat1,
+  [9682] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(812), 1,
+      sym_shortcode_argument,
+    ACTIONS(854), 1,
+      sym__shortcode_end,
+    STATE(269), 1,
+      aux_sym_shortcode_repeat1,
+  [9695] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(800), 1,
+      sym_semi_colon,
+    ACTIONS(856), 1,
+      sym__link_end,
+    STATE(284), 1,
+      aux_sym_citation_group_repeat1,
+  [9708] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(858), 1,
+      sym_shortcode_argument,
+    ACTIONS(860), 1,
+      sym__shortcode_end,
+    STATE(285), 1,
+      aux_sym_shortcode_repeat1,
+  [9721] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(800), 1,
+      sym_semi_colon,
+    ACTIONS(862), 1,
+      sym__link_end,
+    STATE(268), 1,
+      aux_sym_citation_group_repeat1,
+  [9734] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(812), 1,
+      sym_shortcode_argument,
+    ACTIONS(864), 1,
+      sym__shortcode_end,
+    STATE(269), 1,
+      aux_sym_shortcode_repeat1,
+  [9747] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(800), 1,
+      sym_semi_colon,
+    ACTIONS(866), 1,
+      sym__link_end,
+    STATE(288), 1,
+      aux_sym_citation_group_repeat1,
+  [9760] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(868), 1,
+      sym_shortcode_argument,
+    ACTIONS(870), 1,
+      sym__shortcode_end,
+    STATE(289), 1,
+      aux_sym_shortcode_repeat1,
+  [9773] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(800), 1,
+      sym_semi_colon,
+    ACTIONS(872), 1,
+      sym__link_end,
+    STATE(268), 1,
+      aux_sym_citation_group_repeat1,
+  [9786] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(812), 1,
+      sym_shortcode_argument,
+    ACTIONS(874), 1,
+      sym__shortcode_end,
+    STATE(269), 1,
+      aux_sym_shortcode_repeat1,
+  [9799] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(589), 1,
+      sym__attribute_start,
+    STATE(109), 1,
+      sym_attribute_block,
+  [9809] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(876), 2,
+      sym_citation,
+      sym_cross_reference,
+  [9817] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(681), 2,
+      ts_builtin_sym_end,
+      sym__line_start,
+  [9825] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(589), 1,
+      sym__attribute_start,
+    STATE(115), 1,
+      sym_attribute_block,
+  [9835] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(806), 2,
+      sym_semi_colon,
+      sym__link_end,
+  [9843] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(5), 1,
+      sym__line_start,
+    STATE(248), 1,
+      sym__line,
+  [9853] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(878), 2,
+      sym_semi_colon,
+      sym__link_end,
+  [9861] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(816), 2,
+      sym_semi_colon,
+      sym__link_end,
+  [9869] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(603), 1,
+      sym__attribute_start,
+    STATE(128), 1,
+      sym_attribute_block,
+  [9879] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(603), 1,
+      sym__attribute_start,
+    STATE(134), 1,
+      sym_attribute_block,
+  [9889] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(605), 1,
+      sym__attribute_start,
+    STATE(147), 1,
+      sym_attribute_block,
+  [9899] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(605), 1,
+      sym__attribute_start,
+    STATE(153), 1,
+      sym_attribute_block,
+  [9909] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(607), 1,
+      sym__attribute_start,
+    STATE(166), 1,
+      sym_attribute_block,
+  [9919] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(607), 1,
+      sym__attribute_start,
+    STATE(172), 1,
+      sym_attribute_block,
+  [9929] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(609), 1,
+      sym__attribute_start,
+    STATE(185), 1,
+      sym_attribute_block,
+  [9939] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(609), 1,
+      sym__attribute_start,
+    STATE(191), 1,
+      sym_attribute_block,
+  [9949] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(679), 1,
+      sym__attribute_start,
+    STATE(208), 1,
+      sym_attribute_block,
+  [9959] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(679), 1,
+      sym__attribute_start,
+    STATE(214), 1,
+      sym_attribute_block,
+  [9969] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(880), 1,
+      ts_builtin_sym_end,
+  [9976] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(882), 1,
+      sym_shortcode_name,
+  [9983] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(884), 1,
+      sym_line_end,
+  [9990] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(886), 1,
+      sym__emph_star_end,
+  [9997] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(888), 1,
+      sym__emph_under_end,
+  [10004] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(890), 1,
+      sym__strong_star_end,
+  [10011] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(892), 1,
+      sym__strong_under_end,
+  [10018] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(894), 1,
+      sym_link_destination,
+  [10025] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(896), 1,
+      sym_link_destination,
+  [10032] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(898), 1,
+      anon_sym_EQ,
+  [10039] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(780), 1,
+      ts_builtin_sym_end,
+  [10046] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(900), 1,
+      sym_link_destination,
+  [10053] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(902), 1,
+      sym_link_destination,
+  [10060] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(904), 1,
+      sym_attribute_value,
+  [10067] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(906), 1,
+      ts_builtin_sym_end,
+  [10074] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(681), 1,
+      ts_builtin_sym_end,
+  [10081] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(908), 1,
+      sym_line_end,
+  [10088] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(910), 1,
+      sym__emph_star_end,
+  [10095] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(912), 1,
+      sym__emph_under_end,
+  [10102] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(914), 1,
+      sym__strong_star_end,
+  [10109] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(916), 1,
+      sym__strong_under_end,
+  [10116] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(918), 1,
+      sym_link_destination,
+  [10123] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(920), 1,
+      sym_link_destination,
+  [10130] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(922), 1,
+      sym_link_destination,
+  [10137] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(924), 1,
+      sym_link_destination,
+  [10144] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(926), 1,
+      sym_line_end,
+  [10151] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(928), 1,
+      sym__emph_star_end,
+  [10158] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(930), 1,
+      sym__emph_under_end,
+  [10165] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(932), 1,
+      sym__strong_star_end,
+  [10172] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(934), 1,
+      sym__strong_under_end,
+  [10179] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(936), 1,
+      sym_link_destination,
+  [10186] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(938), 1,
+      sym_link_destination,
+  [10193] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(940), 1,
+      sym_link_destination,
+  [10200] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(942), 1,
+      sym_link_destination,
+  [10207] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(944), 1,
+      sym__emph_star_end,
+  [10214] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(946), 1,
+      sym__emph_under_end,
+  [10221] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(948), 1,
+      sym__strong_star_end,
+  [10228] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(950), 1,
+      sym__strong_under_end,
+  [10235] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(952), 1,
+      sym_link_destination,
+  [10242] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(954), 1,
+      sym_link_destination,
+  [10249] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(956), 1,
+      sym_link_destination,
+  [10256] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(958), 1,
+      sym_link_destination,
+  [10263] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(960), 1,
+      sym__emph_star_end,
+  [10270] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(962), 1,
+      sym__emph_under_end,
+  [10277] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(964), 1,
+      sym__strong_star_end,
+  [10284] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(966), 1,
+      sym__strong_under_end,
+  [10291] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(968), 1,
+      sym_link_destination,
+  [10298] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(970), 1,
+      sym_link_destination,
+  [10305] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(972), 1,
+      sym_link_destination,
+  [10312] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(974), 1,
+      sym_link_destination,
+  [10319] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(976), 1,
+      sym__emph_star_end,
+  [10326] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(978), 1,
+      sym__emph_under_end,
+  [10333] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(980), 1,
+      sym__strong_star_end,
+  [10340] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(982), 1,
+      sym__strong_under_end,
+  [10347] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(984), 1,
+      sym_link_destination,
+  [10354] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(986), 1,
+      sym_link_destination,
+  [10361] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(988), 1,
+      sym_link_destination,
+  [10368] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(990), 1,
+      sym_link_destination,
+  [10375] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(992), 1,
+      sym_shortcode_name,
+  [10382] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(994), 1,
+      sym_shortcode_name,
+  [10389] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(996), 1,
+      sym_shortcode_name,
+  [10396] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(998), 1,
+      sym_shortcode_name,
+  [10403] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(1000), 1,
+      sym_shortcode_name,
+};
+
+static const uint32_t ts_small_parse_table_map[] = {
+  [SMALL_STATE(16)] = 0,
+  [SMALL_STATE(17)] = 68,
+  [SMALL_STATE(18)] = 136,
+  [SMALL_STATE(19)] = 204,
+  [SMALL_STATE(20)] = 272,
+  [SMALL_STATE(21)] = 340,
+  [SMALL_STATE(22)] = 408,
+  [SMALL_STATE(23)] = 476,
+  [SMALL_STATE(24)] = 544,
+  [SMALL_STATE(25)] = 612,
+  [SMALL_STATE(26)] = 680,
+  [SMALL_STATE(27)] = 748,
+  [SMALL_STATE(28)] = 816,
+  [SMALL_STATE(29)] = 884,
+  [SMALL_STATE(30)] = 952,
+  [SMALL_STATE(31)] = 1020,
+  [SMALL_STATE(32)] = 1088,
+  [SMALL_STATE(33)] = 1156,
+  [SMALL_STATE(34)] = 1224,
+  [SMALL_STATE(35)] = 1292,
+  [SMALL_STATE(36)] = 1360,
+  [SMALL_STATE(37)] = 1428,
+  [SMALL_STATE(38)] = 1496,
+  [SMALL_STATE(39)] = 1564,
+  [SMALL_STATE(40)] = 1632,
+  [SMALL_STATE(41)] = 1700,
+  [SMALL_STATE(42)] = 1768,
+  [SMALL_STATE(43)] = 1836,
+  [SMALL_STATE(44)] = 1904,
+  [SMALL_STATE(45)] = 1972,
+  [SMALL_STATE(46)] = 2040,
+  [SMALL_STATE(47)] = 2108,
+  [SMALL_STATE(48)] = 2176,
+  [SMALL_STATE(49)] = 2244,
+  [SMALL_STATE(50)] = 2312,
+  [SMALL_STATE(51)] = 2380,
+  [SMALL_STATE(52)] = 2448,
+  [SMALL_STATE(53)] = 2516,
+  [SMALL_STATE(54)] = 2584,
+  [SMALL_STATE(55)] = 2652,
+  [SMALL_STATE(56)] = 2720,
+  [SMALL_STATE(57)] = 2788,
+  [SMALL_STATE(58)] = 2856,
+  [SMALL_STATE(59)] = 2924,
+  [SMALL_STATE(60)] = 2992,
+  [SMALL_STATE(61)] = 3060,
+  [SMALL_STATE(62)] = 3128,
+  [SMALL_STATE(63)] = 3196,
+  [SMALL_STATE(64)] = 3264,
+  [SMALL_STATE(65)] = 3332,
+  [SMALL_STATE(66)] = 3400,
+  [SMALL_STATE(67)] = 3468,
+  [SMALL_STATE(68)] = 3536,
+  [SMALL_STATE(69)] = 3604,
+  [SMALL_STATE(70)] = 3672,
+  [SMALL_STATE(71)] = 3740,
+  [SMALL_STATE(72)] = 3808,
+  [SMALL_STATE(73)] = 3876,
+  [SMALL_STATE(74)] = 3944,
+  [SMALL_STATE(75)] = 4012,
+  [SMALL_STATE(76)] = 4080,
+  [SMALL_STATE(77)] = 4148,
+  [SMALL_STATE(78)] = 4213,
+  [SMALL_STATE(79)] = 4278,
+  [SMALL_STATE(80)] = 4343,
+  [SMALL_STATE(81)] = 4408,
+  [SMALL_STATE(82)] = 4473,
+  [SMALL_STATE(83)] = 4510,
+  [SMALL_STATE(84)] = 4547,
+  [SMALL_STATE(85)] = 4584,
+  [SMALL_STATE(86)] = 4621,
+  [SMALL_STATE(87)] = 4657,
+  [SMALL_STATE(88)] = 4693,
+  [SMALL_STATE(89)] = 4729,
+  [SMALL_STATE(90)] = 4765,
+  [SMALL_STATE(91)] = 4801,
+  [SMALL_STATE(92)] = 4837,
+  [SMALL_STATE(93)] = 4873,
+  [SMALL_STATE(94)] = 4909,
+  [SMALL_STATE(95)] = 4945,
+  [SMALL_STATE(96)] = 4981,
+  [SMALL_STATE(97)] = 5017,
+  [SMALL_STATE(98)] = 5053,
+  [SMALL_STATE(99)] = 5089,
+  [SMALL_STATE(100)] = 5125,
+  [SMALL_STATE(101)] = 5161,
+  [SMALL_STATE(102)] = 5197,
+  [SMALL_STATE(103)] = 5228,
+  [SMALL_STATE(104)] = 5259,
+  [SMALL_STATE(105)] = 5290,
+  [SMALL_STATE(106)] = 5321,
+  [SMALL_STATE(107)] = 5352,
+  [SMALL_STATE(108)] = 5383,
+  [SMALL_STATE(109)] = 5414,
+  [SMALL_STATE(110)] = 5445,
+  [SMALL_STATE(111)] = 5476,
+  [SMALL_STATE(112)] = 5507,
+  [SMALL_STATE(113)] = 5538,
+  [SMALL_STATE(114)] = 5569,
+  [SMALL_STATE(115)] = 5600,
+  [SMALL_STATE(116)] = 5631,
+  [SMALL_STATE(117)] = 5662,
+  [SMALL_STATE(118)] = 5693,
+  [SMALL_STATE(119)] = 5724,
+  [SMALL_STATE(120)] = 5755,
+  [SMALL_STATE(121)] = 5786,
+  [SMALL_STATE(122)] = 5816,
+  [SMALL_STATE(123)] = 5846,
+  [SMALL_STATE(124)] = 5876,
+  [SMALL_STATE(125)] = 5906,
+  [SMALL_STATE(126)] = 5936,
+  [SMALL_STATE(127)] = 5966,
+  [SMALL_STATE(128)] = 5996,
+  [SMALL_STATE(129)] = 6026,
+  [SMALL_STATE(130)] = 6056,
+  [SMALL_STATE(131)] = 6086,
+  [SMALL_STATE(132)] = 6116,
+  [SMALL_STATE(133)] = 6146,
+  [SMALL_STATE(134)] = 6176,
+  [SMALL_STATE(135)] = 6206,
+  [SMALL_STATE(136)] = 6236,
+  [SMALL_STATE(137)] = 6266,
+  [SMALL_STATE(138)] = 6296,
+  [SMALL_STATE(139)] = 6326,
+  [SMALL_STATE(140)] = 6356,
+  [SMALL_STATE(141)] = 6386,
+  [SMALL_STATE(142)] = 6416,
+  [SMALL_STATE(143)] = 6446,
+  [SMALL_STATE(144)] = 6476,
+  [SMALL_STATE(145)] = 6506,
+  [SMALL_STATE(146)] = 6536,
+  [SMALL_STATE(147)] = 6566,
+  [SMALL_STATE(148)] = 6596,
+  [SMALL_STATE(149)] = 6626,
+  [SMALL_STATE(150)] = 6656,
+  [SMALL_STATE(151)] = 6686,
+  [SMALL_STATE(152)] = 6716,
+  [SMALL_STATE(153)] = 6746,
+  [SMALL_STATE(154)] = 6776,
+  [SMALL_STATE(155)] = 6806,
+  [SMALL_STATE(156)] = 6836,
+  [SMALL_STATE(157)] = 6866,
+  [SMALL_STATE(158)] = 6896,
+  [SMALL_STATE(159)] = 6926,
+  [SMALL_STATE(160)] = 6956,
+  [SMALL_STATE(161)] = 6986,
+  [SMALL_STATE(162)] = 7016,
+  [SMALL_STATE(163)] = 7046,
+  [SMALL_STATE(164)] = 7076,
+  [SMALL_STATE(165)] = 7106,
+  [SMALL_STATE(166)] = 7136,
+  [SMALL_STATE(167)] = 7166,
+  [SMALL_STATE(168)] = 7196,
+  [SMALL_STATE(169)] = 7226,
+  [SMALL_STATE(170)] = 7256,
+  [SMALL_STATE(171)] = 7286,
+  [SMALL_STATE(172)] = 7316,
+  [SMALL_STATE(173)] = 7346,
+  [SMALL_STATE(174)] = 7376,
+  [SMALL_STATE(175)] = 7406,
+  [SMALL_STATE(176)] = 7436,
+  [SMALL_STATE(177)] = 7466,
+  [SMALL_STATE(178)] = 7496,
+  [SMALL_STATE(179)] = 7526,
+  [SMALL_STATE(180)] = 7556,
+  [SMALL_STATE(181)] = 7586,
+  [SMALL_STATE(182)] = 7616,
+  [SMALL_STATE(183)] = 7646,
+  [SMALL_STATE(184)] = 7676,
+  [SMALL_STATE(185)] = 7706,
+  [SMALL_STATE(186)] = 7736,
+  [SMALL_STATE(187)] = 7766,
+  [SMALL_STATE(188)] = 7796,
+  [SMALL_STATE(189)] = 7826,
+  [SMALL_STATE(190)] = 7856,
+  [SMALL_STATE(191)] = 7886,
+  [SMALL_STATE(192)] = 7916,
+  [SMALL_STATE(193)] = 7946,
+  [SMALL_STATE(194)] = 7976,
+  [SMALL_STATE(195)] = 8006,
+  [SMALL_STATE(196)] = 8036,
+  [SMALL_STATE(197)] = 8066,
+  [SMALL_STATE(198)] = 8099,
+  [SMALL_STATE(199)] = 8132,
+  [SMALL_STATE(200)] = 8165,
+  [SMALL_STATE(201)] = 8198,
+  [SMALL_STATE(202)] = 8225,
+  [SMALL_STATE(203)] = 8252,
+  [SMALL_STATE(204)] = 8279,
+  [SMALL_STATE(205)] = 8306,
+  [SMALL_STATE(206)] = 8333,
+  [SMALL_STATE(207)] = 8360,
+  [SMALL_STATE(208)] = 8387,
+  [SMALL_STATE(209)] = 8414,
+  [SMALL_STATE(210)] = 8441,
+  [SMALL_STATE(211)] = 8468,
+  [SMALL_STATE(212)] = 8495,
+  [SMALL_STATE(213)] = 8522,
+  [SMALL_STATE(214)] = 8549,
+  [SMALL_STATE(215)] = 8576,
+  [SMALL_STATE(216)] = 8603,
+  [SMALL_STATE(217)] = 8630,
+  [SMALL_STATE(218)] = 8657,
+  [SMALL_STATE(219)] = 8684,
+  [SMALL_STATE(220)] = 8711,
+  [SMALL_STATE(221)] = 8737,
+  [SMALL_STATE(222)] = 8763,
+  [SMALL_STATE(223)] = 8789,
+  [SMALL_STATE(224)] = 8810,
+  [SMALL_STATE(225)] = 8828,
+  [SMALL_STATE(226)] = 8846,
+  [SMALL_STATE(227)] = 8866,
+  [SMALL_STATE(228)] = 8884,
+  [SMALL_STATE(229)] = 8902,
+  [SMALL_STATE(230)] = 8922,
+  [SMALL_STATE(231)] = 8940,
+  [SMALL_STATE(232)] = 8960,
+  [SMALL_STATE(233)] = 8980,
+  [SMALL_STATE(234)] = 9000,
+  [SMALL_STATE(235)] = 9020,
+  [SMALL_STATE(236)] = 9040,
+  [SMALL_STATE(237)] = 9060,
+  [SMALL_STATE(238)] = 9078,
+  [SMALL_STATE(239)] = 9096,
+  [SMALL_STATE(240)] = 9114,
+  [SMALL_STATE(241)] = 9132,
+  [SMALL_STATE(242)] = 9150,
+  [SMALL_STATE(243)] = 9168,
+  [SMALL_STATE(244)] = 9186,
+  [SMALL_STATE(245)] = 9204,
+  [SMALL_STATE(246)] = 9222,
+  [SMALL_STATE(247)] = 9240,
+  [SMALL_STATE(248)] = 9257,
+  [SMALL_STATE(249)] = 9268,
+  [SMALL_STATE(250)] = 9285,
+  [SMALL_STATE(251)] = 9299,
+  [SMALL_STATE(252)] = 9309,
+  [SMALL_STATE(253)] = 9323,
+  [SMALL_STATE(254)] = 9333,
+  [SMALL_STATE(255)] = 9343,
+  [SMALL_STATE(256)] = 9357,
+  [SMALL_STATE(257)] = 9371,
+  [SMALL_STATE(258)] = 9385,
+  [SMALL_STATE(259)] = 9399,
+  [SMALL_STATE(260)] = 9413,
+  [SMALL_STATE(261)] = 9426,
+  [SMALL_STATE(262)] = 9437,
+  [SMALL_STATE(263)] = 9450,
+  [SMALL_STATE(264)] = 9463,
+  [SMALL_STATE(265)] = 9476,
+  [SMALL_STATE(266)] = 9487,
+  [SMALL_STATE(267)] = 9500,
+  [SMALL_STATE(268)] = 9513,
+  [SMALL_STATE(269)] = 9526,
+  [SMALL_STATE(270)] = 9539,
+  [SMALL_STATE(271)] = 9552,
+  [SMALL_STATE(272)] = 9565,
+  [SMALL_STATE(273)] = 9578,
+  [SMALL_STATE(274)] = 9591,
+  [SMALL_STATE(275)] = 9604,
+  [SMALL_STATE(276)] = 9617,
+  [SMALL_STATE(277)] = 9630,
+  [SMALL_STATE(278)] = 9643,
+  [SMALL_STATE(279)] = 9656,
+  [SMALL_STATE(280)] = 9669,
+  [SMALL_STATE(281)] = 9682,
+  [SMALL_STATE(282)] = 9695,
+  [SMALL_STATE(283)] = 9708,
+  [SMALL_STATE(284)] = 9721,
+  [SMALL_STATE(285)] = 9734,
+  [SMALL_STATE(286)] = 9747,
+  [SMALL_STATE(287)] = 9760,
+  [SMALL_STATE(288)] = 9773,
+  [SMALL_STATE(289)] = 9786,
+  [SMALL_STATE(290)] = 9799,
+  [SMALL_STATE(291)] = 9809,
+  [SMALL_STATE(292)] = 9817,
+  [SMALL_STATE(293)] = 9825,
+  [SMALL_STATE(294)] = 9835,
+  [SMALL_STATE(295)] = 9843,
+  [SMALL_STATE(296)] = 9853,
+  [SMALL_STATE(297)] = 9861,
+  [SMALL_STATE(298)] = 9869,
+  [SMALL_STATE(299)] = 9879,
+  [SMALL_STATE(300)] = 9889,
+  [SMALL_STATE(301)] = 9899,
+  [SMALL_STATE(302)] = 9909,
+  [SMALL_STATE(303)] = 9919,
+  [SMALL_STATE(304)] = 9929,
+  [SMALL_STATE(305)] = 9939,
+  [SMALL_STATE(306)] = 9949,
+  [SMALL_STATE(307)] = 9959,
+  [SMALL_STATE(308)] = 9969,
+  [SMALL_STATE(309)] = 9976,
+  [SMALL_STATE(310)] = 9983,
+  [SMALL_STATE(311)] = 9990,
+  [SMALL_STATE(312)] = 9997,
+  [SMALL_STATE(313)] = 10004,
+  [SMALL_STATE(314)] = 10011,
+  [SMALL_STATE(315)] = 10018,
+  [SMALL_STATE(316)] = 10025,
+  [SMALL_STATE(317)] = 10032,
+  [SMALL_STATE(318)] = 10039,
+  [SMALL_STATE(319)] = 10046,
+  [SMALL_STATE(320)] = 10053,
+  [SMALL_STATE(321)] = 10060,
+  [SMALL_STATE(322)] = 10067,
+  [SMALL_STATE(323)] = 10074,
+  [SMALL_STATE(324)] = 10081,
+  [SMALL_STATE(325)] = 10088,
+  [SMALL_STATE(326)] = 10095,
+  [SMALL_STATE(327)] = 10102,
+  [SMALL_STATE(328)] = 10109,
+  [SMALL_STATE(329)] = 10116,
+  [SMALL_STATE(330)] = 10123,
+  [SMALL_STATE(331)] = 10130,
+  [SMALL_STATE(332)] = 10137,
+  [SMALL_STATE(333)] = 10144,
+  [SMALL_STATE(334)] = 10151,
+  [SMALL_STATE(335)] = 10158,
+  [SMALL_STATE(336)] = 10165,
+  [SMALL_STATE(337)] = 10172,
+  [SMALL_STATE(338)] = 10179,
+  [SMALL_STATE(339)] = 10186,
+  [SMALL_STATE(340)] = 10193,
+  [SMALL_STATE(341)] = 10200,
+  [SMALL_STATE(342)] = 10207,
+  [SMALL_STATE(343)] = 10214,
+  [SMALL_STATE(344)] = 10221,
+  [SMALL_STATE(345)] = 10228,
+  [SMALL_STATE(346)] = 10235,
+  [SMALL_STATE(347)] = 10242,
+  [SMALL_STATE(348)] = 10249,
+  [SMALL_STATE(349)] = 10256,
+  [SMALL_STATE(350)] = 10263,
+  [SMALL_STATE(351)] = 10270,
+  [SMALL_STATE(352)] = 10277,
+  [SMALL_STATE(353)] = 10284,
+  [SMALL_STATE(354)] = 10291,
+  [SMALL_STATE(355)] = 10298,
+  [SMALL_STATE(356)] = 10305,
+  [SMALL_STATE(357)] = 10312,
+  [SMALL_STATE(358)] = 10319,
+  [SMALL_STATE(359)] = 10326,
+  [SMALL_STATE(360)] = 10333,
+  [SMALL_STATE(361)] = 10340,
+  [SMALL_STATE(362)] = 10347,
+  [SMALL_STATE(363)] = 10354,
+  [SMALL_STATE(364)] = 10361,
+  [SMALL_STATE(365)] = 10368,
+  [SMALL_STATE(366)] = 10375,
+  [SMALL_STATE(367)] = 10382,
+  [SMALL_STATE(368)] = 10389,
+  [SMALL_STATE(369)] = 10396,
+  [SMALL_STATE(370)] = 10403,
+};
+
+static const TSParseActionEntry ts_parse_actions[] = {
+  [0] = {.entry = {.count = 0, .reusable = false}},
+  [1] = {.entry = {.count = 1, .reusable = false}}, RECOVER(),
+  [3] = {.entry = {.count = 1, .reusable = true}}, SHIFT_EXTRA(),
+  [5] = {.entry = {.count = 1, .reusable = true}}, SHIFT(77),
+  [7] = {.entry = {.count = 1, .reusable = false}}, SHIFT_EXTRA(),
+  [9] = {.entry = {.count = 1, .reusable = false}}, SHIFT(333),
+  [11] = {.entry = {.count = 1, .reusable = true}}, SHIFT(333),
+  [13] = {.entry = {.count = 1, .reusable = false}}, SHIFT(9),
+  [15] = {.entry = {.count = 1, .reusable = false}}, SHIFT(121),
+  [17] = {.entry = {.count = 1, .reusable = true}}, SHIFT(78),
+  [19] = {.entry = {.count = 1, .reusable = true}}, SHIFT(27),
+  [21] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__inline_content, 1, 0, 0),
+  [23] = {.entry = {.count = 1, .reusable = true}}, SHIFT(28),
+  [25] = {.entry = {.count = 1, .reusable = true}}, SHIFT(29),
+  [27] = {.entry = {.count = 1, .reusable = true}}, SHIFT(30),
+  [29] = {.entry = {.count = 1, .reusable = true}}, SHIFT(9),
+  [31] = {.entry = {.count = 1, .reusable = true}}, SHIFT(31),
+  [33] = {.entry = {.count = 1, .reusable = true}}, SHIFT(32),
+  [35] = {.entry = {.count = 1, .reusable = true}}, SHIFT(33),
+  [37] = {.entry = {.count = 1, .reusable = true}}, SHIFT(255),
+  [39] = {.entry = {.count = 1, .reusable = true}}, SHIFT(366),
+  [41] = {.entry = {.count = 1, .reusable = false}}, SHIFT(11),
+  [43] = {.entry = {.count = 1, .reusable = false}}, SHIFT(140),
+  [45] = {.entry = {.count = 1, .reusable = true}}, SHIFT(79),
+  [47] = {.entry = {.count = 1, .reusable = true}}, SHIFT(37),
+  [49] = {.entry = {.count = 1, .reusable = true}}, SHIFT(38),
+  [51] = {.entry = {.count = 1, .reusable = true}}, SHIFT(39),
+  [53] = {.entry = {.count = 1, .reusable = true}}, SHIFT(40),
+  [55] = {.entry = {.count = 1, .reusable = true}}, SHIFT(11),
+  [57] = {.entry = {.count = 1, .reusable = true}}, SHIFT(41),
+  [59] = {.entry = {.count = 1, .reusable = true}}, SHIFT(42),
+  [61] = {.entry = {.count = 1, .reusable = true}}, SHIFT(43),
+  [63] = {.entry = {.count = 1, .reusable = true}}, SHIFT(256),
+  [65] = {.entry = {.count = 1, .reusable = true}}, SHIFT(367),
+  [67] = {.entry = {.count = 1, .reusable = false}}, SHIFT(13),
+  [69] = {.entry = {.count = 1, .reusable = false}}, SHIFT(159),
+  [71] = {.entry = {.count = 1, .reusable = true}}, SHIFT(80),
+  [73] = {.entry = {.count = 1, .reusable = true}}, SHIFT(47),
+  [75] = {.entry = {.count = 1, .reusable = true}}, SHIFT(48),
+  [77] = {.entry = {.count = 1, .reusable = true}}, SHIFT(49),
+  [79] = {.entry = {.count = 1, .reusable = true}}, SHIFT(50),
+  [81] = {.entry = {.count = 1, .reusable = true}}, SHIFT(13),
+  [83] = {.entry = {.count = 1, .reusable = true}}, SHIFT(51),
+  [85] = {.entry = {.count = 1, .reusable = true}}, SHIFT(52),
+  [87] = {.entry = {.count = 1, .reusable = true}}, SHIFT(53),
+  [89] = {.entry = {.count = 1, .reusable = true}}, SHIFT(257),
+  [91] = {.entry = {.count = 1, .reusable = true}}, SHIFT(368),
+  [93] = {.entry = {.count = 1, .reusable = false}}, SHIFT(15),
+  [95] = {.entry = {.count = 1, .reusable = false}}, SHIFT(178),
+  [97] = {.entry = {.count = 1, .reusable = true}}, SHIFT(81),
+  [99] = {.entry = {.count = 1, .reusable = true}}, SHIFT(57),
+  [101] = {.entry = {.count = 1, .reusable = true}}, SHIFT(58),
+  [103] = {.entry = {.count = 1, .reusable = true}}, SHIFT(59),
+  [105] = {.entry = {.count = 1, .reusable = true}}, SHIFT(60),
+  [107] = {.entry = {.count = 1, .reusable = true}}, SHIFT(15),
+  [109] = {.entry = {.count = 1, .reusable = true}}, SHIFT(61),
+  [111] = {.entry = {.count = 1, .reusable = true}}, SHIFT(62),
+  [113] = {.entry = {.count = 1, .reusable = true}}, SHIFT(63),
+  [115] = {.entry = {.count = 1, .reusable = true}}, SHIFT(258),
+  [117] = {.entry = {.count = 1, .reusable = true}}, SHIFT(369),
+  [119] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__line, 2, 0, 0),
+  [121] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym__line, 2, 0, 0),
+  [123] = {.entry = {.count = 1, .reusable = false}}, SHIFT(7),
+  [125] = {.entry = {.count = 1, .reusable = false}}, SHIFT(102),
+  [127] = {.entry = {.count = 1, .reusable = true}}, SHIFT(16),
+  [129] = {.entry = {.count = 1, .reusable = true}}, SHIFT(17),
+  [131] = {.entry = {.count = 1, .reusable = true}}, SHIFT(18),
+  [133] = {.entry = {.count = 1, .reusable = true}}, SHIFT(19),
+  [135] = {.entry = {.count = 1, .reusable = true}}, SHIFT(7),
+  [137] = {.entry = {.count = 1, .reusable = true}}, SHIFT(20),
+  [139] = {.entry = {.count = 1, .reusable = true}}, SHIFT(21),
+  [141] = {.entry = {.count = 1, .reusable = true}}, SHIFT(22),
+  [143] = {.entry = {.count = 1, .reusable = true}}, SHIFT(250),
+  [145] = {.entry = {.count = 1, .reusable = true}}, SHIFT(309),
+  [147] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0),
+  [149] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym__line_content, 2, 0, 0),
+  [151] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(7),
+  [154] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(102),
+  [157] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(16),
+  [160] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(17),
+  [163] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(18),
+  [166] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(19),
+  [169] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(7),
+  [172] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(20),
+  [175] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(21),
+  [178] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(22),
+  [181] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(250),
+  [184] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(309),
+  [187] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym__inline_content_repeat1, 2, 0, 0),
+  [189] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym__inline_content_repeat1, 2, 0, 0),
+  [191] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(9),
+  [194] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(121),
+  [197] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(27),
+  [200] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(28),
+  [203] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(29),
+  [206] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(30),
+  [209] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(9),
+  [212] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(31),
+  [215] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(32),
+  [218] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(33),
+  [221] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(255),
+  [224] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(366),
+  [227] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(11),
+  [230] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(140),
+  [233] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(37),
+  [236] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(38),
+  [239] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(39),
+  [242] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(40),
+  [245] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(11),
+  [248] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(41),
+  [251] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(42),
+  [254] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(43),
+  [257] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(256),
+  [260] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(367),
+  [263] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(13),
+  [266] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(159),
+  [269] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(47),
+  [272] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(48),
+  [275] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(49),
+  [278] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(50),
+  [281] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(13),
+  [284] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(51),
+  [287] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(52),
+  [290] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(53),
+  [293] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(257),
+  [296] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(368),
+  [299] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(15),
+  [302] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(178),
+  [305] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(57),
+  [308] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(58),
+  [311] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(59),
+  [314] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(60),
+  [317] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(15),
+  [320] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(61),
+  [323] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(62),
+  [326] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(63),
+  [329] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(258),
+  [332] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(369),
+  [335] = {.entry = {.count = 1, .reusable = true}}, SHIFT(2),
+  [337] = {.entry = {.count = 1, .reusable = false}}, SHIFT(2),
+  [339] = {.entry = {.count = 1, .reusable = true}}, SHIFT(121),
+  [341] = {.entry = {.count = 1, .reusable = true}}, SHIFT(3),
+  [343] = {.entry = {.count = 1, .reusable = false}}, SHIFT(3),
+  [345] = {.entry = {.count = 1, .reusable = true}}, SHIFT(140),
+  [347] = {.entry = {.count = 1, .reusable = true}}, SHIFT(4),
+  [349] = {.entry = {.count = 1, .reusable = false}}, SHIFT(4),
+  [351] = {.entry = {.count = 1, .reusable = true}}, SHIFT(159),
+  [353] = {.entry = {.count = 1, .reusable = true}}, SHIFT(5),
+  [355] = {.entry = {.count = 1, .reusable = false}}, SHIFT(5),
+  [357] = {.entry = {.count = 1, .reusable = true}}, SHIFT(178),
+  [359] = {.entry = {.count = 1, .reusable = true}}, SHIFT(67),
+  [361] = {.entry = {.count = 1, .reusable = true}}, SHIFT(68),
+  [363] = {.entry = {.count = 1, .reusable = true}}, SHIFT(69),
+  [365] = {.entry = {.count = 1, .reusable = true}}, SHIFT(70),
+  [367] = {.entry = {.count = 1, .reusable = true}}, SHIFT(23),
+  [369] = {.entry = {.count = 1, .reusable = true}}, SHIFT(71),
+  [371] = {.entry = {.count = 1, .reusable = true}}, SHIFT(72),
+  [373] = {.entry = {.count = 1, .reusable = true}}, SHIFT(315),
+  [375] = {.entry = {.count = 1, .reusable = true}}, SHIFT(73),
+  [377] = {.entry = {.count = 1, .reusable = true}}, SHIFT(259),
+  [379] = {.entry = {.count = 1, .reusable = true}}, SHIFT(370),
+  [381] = {.entry = {.count = 1, .reusable = false}}, SHIFT(23),
+  [383] = {.entry = {.count = 1, .reusable = true}}, SHIFT(201),
+  [385] = {.entry = {.count = 1, .reusable = true}}, SHIFT(24),
+  [387] = {.entry = {.count = 1, .reusable = true}}, SHIFT(316),
+  [389] = {.entry = {.count = 1, .reusable = false}}, SHIFT(24),
+  [391] = {.entry = {.count = 1, .reusable = true}}, SHIFT(25),
+  [393] = {.entry = {.count = 1, .reusable = true}}, SHIFT(290),
+  [395] = {.entry = {.count = 1, .reusable = false}}, SHIFT(25),
+  [397] = {.entry = {.count = 1, .reusable = true}}, SHIFT(26),
+  [399] = {.entry = {.count = 1, .reusable = true}}, SHIFT(319),
+  [401] = {.entry = {.count = 1, .reusable = false}}, SHIFT(26),
+  [403] = {.entry = {.count = 1, .reusable = true}}, SHIFT(320),
+  [405] = {.entry = {.count = 1, .reusable = true}}, SHIFT(293),
+  [407] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(67),
+  [410] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(68),
+  [413] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(69),
+  [416] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(70),
+  [419] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(26),
+  [422] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(71),
+  [425] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(72),
+  [428] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(73),
+  [431] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(259),
+  [434] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(370),
+  [437] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(26),
+  [440] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(201),
+  [443] = {.entry = {.count = 1, .reusable = true}}, SHIFT(34),
+  [445] = {.entry = {.count = 1, .reusable = true}}, SHIFT(329),
+  [447] = {.entry = {.count = 1, .reusable = false}}, SHIFT(34),
+  [449] = {.entry = {.count = 1, .reusable = true}}, SHIFT(35),
+  [451] = {.entry = {.count = 1, .reusable = true}}, SHIFT(330),
+  [453] = {.entry = {.count = 1, .reusable = false}}, SHIFT(35),
+  [455] = {.entry = {.count = 1, .reusable = true}}, SHIFT(36),
+  [457] = {.entry = {.count = 1, .reusable = true}}, SHIFT(298),
+  [459] = {.entry = {.count = 1, .reusable = false}}, SHIFT(36),
+  [461] = {.entry = {.count = 1, .reusable = true}}, SHIFT(331),
+  [463] = {.entry = {.count = 1, .reusable = true}}, SHIFT(332),
+  [465] = {.entry = {.count = 1, .reusable = true}}, SHIFT(299),
+  [467] = {.entry = {.count = 1, .reusable = true}}, SHIFT(44),
+  [469] = {.entry = {.count = 1, .reusable = true}}, SHIFT(338),
+  [471] = {.entry = {.count = 1, .reusable = false}}, SHIFT(44),
+  [473] = {.entry = {.count = 1, .reusable = true}}, SHIFT(45),
+  [475] = {.entry = {.count = 1, .reusable = true}}, SHIFT(339),
+  [477] = {.entry = {.count = 1, .reusable = false}}, SHIFT(45),
+  [479] = {.entry = {.count = 1, .reusable = true}}, SHIFT(46),
+  [481] = {.entry = {.count = 1, .reusable = true}}, SHIFT(300),
+  [483] = {.entry = {.count = 1, .reusable = false}}, SHIFT(46),
+  [485] = {.entry = {.count = 1, .reusable = true}}, SHIFT(340),
+  [487] = {.entry = {.count = 1, .reusable = true}}, SHIFT(341),
+  [489] = {.entry = {.count = 1, .reusable = true}}, SHIFT(301),
+  [491] = {.entry = {.count = 1, .reusable = true}}, SHIFT(54),
+  [493] = {.entry = {.count = 1, .reusable = true}}, SHIFT(346),
+  [495] = {.entry = {.count = 1, .reusable = false}}, SHIFT(54),
+  [497] = {.entry = {.count = 1, .reusable = true}}, SHIFT(55),
+  [499] = {.entry = {.count = 1, .reusable = true}}, SHIFT(347),
+  [501] = {.entry = {.count = 1, .reusable = false}}, SHIFT(55),
+  [503] = {.entry = {.count = 1, .reusable = true}}, SHIFT(56),
+  [505] = {.entry = {.count = 1, .reusable = true}}, SHIFT(302),
+  [507] = {.entry = {.count = 1, .reusable = false}}, SHIFT(56),
+  [509] = {.entry = {.count = 1, .reusable = true}}, SHIFT(348),
+  [511] = {.entry = {.count = 1, .reusable = true}}, SHIFT(349),
+  [513] = {.entry = {.count = 1, .reusable = true}}, SHIFT(303),
+  [515] = {.entry = {.count = 1, .reusable = true}}, SHIFT(64),
+  [517] = {.entry = {.count = 1, .reusable = true}}, SHIFT(354),
+  [519] = {.entry = {.count = 1, .reusable = false}}, SHIFT(64),
+  [521] = {.entry = {.count = 1, .reusable = true}}, SHIFT(65),
+  [523] = {.entry = {.count = 1, .reusable = true}}, SHIFT(355),
+  [525] = {.entry = {.count = 1, .reusable = false}}, SHIFT(65),
+  [527] = {.entry = {.count = 1, .reusable = true}}, SHIFT(66),
+  [529] = {.entry = {.count = 1, .reusable = true}}, SHIFT(304),
+  [531] = {.entry = {.count = 1, .reusable = false}}, SHIFT(66),
+  [533] = {.entry = {.count = 1, .reusable = true}}, SHIFT(356),
+  [535] = {.entry = {.count = 1, .reusable = true}}, SHIFT(357),
+  [537] = {.entry = {.count = 1, .reusable = true}}, SHIFT(305),
+  [539] = {.entry = {.count = 1, .reusable = true}}, SHIFT(74),
+  [541] = {.entry = {.count = 1, .reusable = true}}, SHIFT(362),
+  [543] = {.entry = {.count = 1, .reusable = false}}, SHIFT(74),
+  [545] = {.entry = {.count = 1, .reusable = true}}, SHIFT(75),
+  [547] = {.entry = {.count = 1, .reusable = true}}, SHIFT(363),
+  [549] = {.entry = {.count = 1, .reusable = false}}, SHIFT(75),
+  [551] = {.entry = {.count = 1, .reusable = true}}, SHIFT(76),
+  [553] = {.entry = {.count = 1, .reusable = true}}, SHIFT(306),
+  [555] = {.entry = {.count = 1, .reusable = false}}, SHIFT(76),
+  [557] = {.entry = {.count = 1, .reusable = true}}, SHIFT(364),
+  [559] = {.entry = {.count = 1, .reusable = true}}, SHIFT(365),
+  [561] = {.entry = {.count = 1, .reusable = true}}, SHIFT(307),
+  [563] = {.entry = {.count = 1, .reusable = true}}, SHIFT(6),
+  [565] = {.entry = {.count = 1, .reusable = false}}, SHIFT(6),
+  [567] = {.entry = {.count = 1, .reusable = true}}, SHIFT(102),
+  [569] = {.entry = {.count = 1, .reusable = true}}, SHIFT(8),
+  [571] = {.entry = {.count = 1, .reusable = false}}, SHIFT(8),
+  [573] = {.entry = {.count = 1, .reusable = true}}, SHIFT(10),
+  [575] = {.entry = {.count = 1, .reusable = false}}, SHIFT(10),
+  [577] = {.entry = {.count = 1, .reusable = true}}, SHIFT(12),
+  [579] = {.entry = {.count = 1, .reusable = false}}, SHIFT(12),
+  [581] = {.entry = {.count = 1, .reusable = true}}, SHIFT(14),
+  [583] = {.entry = {.count = 1, .reusable = false}}, SHIFT(14),
+  [585] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_link, 3, 0, 0),
+  [587] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_link, 3, 0, 0),
+  [589] = {.entry = {.count = 1, .reusable = true}}, SHIFT(227),
+  [591] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_image, 3, 0, 0),
+  [593] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_image, 3, 0, 0),
+  [595] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_link, 4, 0, 0),
+  [597] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_link, 4, 0, 0),
+  [599] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_image, 4, 0, 0),
+  [601] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_image, 4, 0, 0),
+  [603] = {.entry = {.count = 1, .reusable = true}}, SHIFT(237),
+  [605] = {.entry = {.count = 1, .reusable = true}}, SHIFT(239),
+  [607] = {.entry = {.count = 1, .reusable = true}}, SHIFT(241),
+  [609] = {.entry = {.count = 1, .reusable = true}}, SHIFT(243),
+  [611] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_literal, 1, 0, 0),
+  [613] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_literal, 1, 0, 0),
+  [615] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_emph, 1, 0, 0),
+  [617] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_emph, 1, 0, 0),
+  [619] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_strong, 1, 0, 0),
+  [621] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_strong, 1, 0, 0),
+  [623] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__emph_star, 3, 0, 0),
+  [625] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym__emph_star, 3, 0, 0),
+  [627] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__emph_under, 3, 0, 0),
+  [629] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym__emph_under, 3, 0, 0),
+  [631] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__strong_star, 3, 0, 0),
+  [633] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym__strong_star, 3, 0, 0),
+  [635] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__strong_under, 3, 0, 0),
+  [637] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym__strong_under, 3, 0, 0),
+  [639] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_span, 3, 0, 1),
+  [641] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_span, 3, 0, 1),
+  [643] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_citation_group, 3, 0, 2),
+  [645] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_citation_group, 3, 0, 2),
+  [647] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_shortcode, 3, 0, 0),
+  [649] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_shortcode, 3, 0, 0),
+  [651] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_attribute_block, 2, 0, 0),
+  [653] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_attribute_block, 2, 0, 0),
+  [655] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_span, 4, 0, 3),
+  [657] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_span, 4, 0, 3),
+  [659] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_citation_group, 4, 0, 4),
+  [661] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_citation_group, 4, 0, 4),
+  [663] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_shortcode, 4, 0, 0),
+  [665] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_shortcode, 4, 0, 0),
+  [667] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_link, 5, 0, 0),
+  [669] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_link, 5, 0, 0),
+  [671] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_image, 5, 0, 0),
+  [673] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_image, 5, 0, 0),
+  [675] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_attribute_block, 3, 0, 0),
+  [677] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_attribute_block, 3, 0, 0),
+  [679] = {.entry = {.count = 1, .reusable = true}}, SHIFT(245),
+  [681] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_line_break, 2, 0, 0),
+  [683] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_line_break, 2, 0, 0),
+  [685] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_inline, 1, 0, 0),
+  [687] = {.entry = {.count = 1, .reusable = true}}, SHIFT(260),
+  [689] = {.entry = {.count = 1, .reusable = true}}, SHIFT(224),
+  [691] = {.entry = {.count = 1, .reusable = true}}, SHIFT(310),
+  [693] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_inline, 2, 0, 0),
+  [695] = {.entry = {.count = 1, .reusable = true}}, SHIFT(264),
+  [697] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_inline_repeat1, 2, 0, 0), SHIFT_REPEAT(295),
+  [700] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_inline_repeat1, 2, 0, 0),
+  [702] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_inline_repeat1, 2, 0, 0), SHIFT_REPEAT(310),
+  [705] = {.entry = {.count = 1, .reusable = true}}, SHIFT(225),
+  [707] = {.entry = {.count = 1, .reusable = true}}, SHIFT(317),
+  [709] = {.entry = {.count = 1, .reusable = true}}, SHIFT(251),
+  [711] = {.entry = {.count = 1, .reusable = true}}, SHIFT(228),
+  [713] = {.entry = {.count = 1, .reusable = true}}, SHIFT(253),
+  [715] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__inline_content, 2, 0, 0),
+  [717] = {.entry = {.count = 1, .reusable = true}}, SHIFT(230),
+  [719] = {.entry = {.count = 1, .reusable = true}}, SHIFT(114),
+  [721] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_attribute_block_repeat1, 2, 0, 0), SHIFT_REPEAT(228),
+  [724] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_attribute_block_repeat1, 2, 0, 0), SHIFT_REPEAT(317),
+  [727] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_attribute_block_repeat1, 2, 0, 0),
+  [729] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__inline_content_repeat1, 2, 0, 0), SHIFT_REPEAT(78),
+  [732] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__inline_content_repeat1, 2, 0, 0), SHIFT_REPEAT(333),
+  [735] = {.entry = {.count = 1, .reusable = true}}, SHIFT(120),
+  [737] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__inline_content_repeat1, 2, 0, 0), SHIFT_REPEAT(79),
+  [740] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__inline_content_repeat1, 2, 0, 0), SHIFT_REPEAT(80),
+  [743] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__inline_content_repeat1, 2, 0, 0), SHIFT_REPEAT(81),
+  [746] = {.entry = {.count = 1, .reusable = true}}, SHIFT(238),
+  [748] = {.entry = {.count = 1, .reusable = true}}, SHIFT(133),
+  [750] = {.entry = {.count = 1, .reusable = true}}, SHIFT(139),
+  [752] = {.entry = {.count = 1, .reusable = true}}, SHIFT(240),
+  [754] = {.entry = {.count = 1, .reusable = true}}, SHIFT(152),
+  [756] = {.entry = {.count = 1, .reusable = true}}, SHIFT(158),
+  [758] = {.entry = {.count = 1, .reusable = true}}, SHIFT(242),
+  [760] = {.entry = {.count = 1, .reusable = true}}, SHIFT(171),
+  [762] = {.entry = {.count = 1, .reusable = true}}, SHIFT(177),
+  [764] = {.entry = {.count = 1, .reusable = true}}, SHIFT(244),
+  [766] = {.entry = {.count = 1, .reusable = true}}, SHIFT(190),
+  [768] = {.entry = {.count = 1, .reusable = true}}, SHIFT(196),
+  [770] = {.entry = {.count = 1, .reusable = true}}, SHIFT(246),
+  [772] = {.entry = {.count = 1, .reusable = true}}, SHIFT(213),
+  [774] = {.entry = {.count = 1, .reusable = true}}, SHIFT(219),
+  [776] = {.entry = {.count = 1, .reusable = true}}, SHIFT(318),
+  [778] = {.entry = {.count = 1, .reusable = true}}, SHIFT(324),
+  [780] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_inline, 3, 0, 0),
+  [782] = {.entry = {.count = 1, .reusable = true}}, SHIFT(322),
+  [784] = {.entry = {.count = 1, .reusable = true}}, SHIFT(261),
+  [786] = {.entry = {.count = 1, .reusable = true}}, SHIFT(291),
+  [788] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__trailing_attribute_block, 2, 0, 0),
+  [790] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__trailing_attribute_block, 3, 0, 0),
+  [792] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_attribute, 3, 0, 0),
+  [794] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_citation_item, 1, 0, 0),
+  [796] = {.entry = {.count = 1, .reusable = true}}, SHIFT(294),
+  [798] = {.entry = {.count = 1, .reusable = true}}, SHIFT(110),
+  [800] = {.entry = {.count = 1, .reusable = true}}, SHIFT(252),
+  [802] = {.entry = {.count = 1, .reusable = true}}, SHIFT(267),
+  [804] = {.entry = {.count = 1, .reusable = true}}, SHIFT(111),
+  [806] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_citation_item, 2, 0, 0),
+  [808] = {.entry = {.count = 1, .reusable = true}}, SHIFT(296),
+  [810] = {.entry = {.count = 1, .reusable = true}}, SHIFT(116),
+  [812] = {.entry = {.count = 1, .reusable = true}}, SHIFT(269),
+  [814] = {.entry = {.count = 1, .reusable = true}}, SHIFT(117),
+  [816] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_citation_group_repeat1, 2, 0, 0),
+  [818] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_citation_group_repeat1, 2, 0, 0), SHIFT_REPEAT(252),
+  [821] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_shortcode_repeat1, 2, 0, 0), SHIFT_REPEAT(269),
+  [824] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_shortcode_repeat1, 2, 0, 0),
+  [826] = {.entry = {.count = 1, .reusable = true}}, SHIFT(129),
+  [828] = {.entry = {.count = 1, .reusable = true}}, SHIFT(273),
+  [830] = {.entry = {.count = 1, .reusable = true}}, SHIFT(130),
+  [832] = {.entry = {.count = 1, .reusable = true}}, SHIFT(135),
+  [834] = {.entry = {.count = 1, .reusable = true}}, SHIFT(136),
+  [836] = {.entry = {.count = 1, .reusable = true}}, SHIFT(148),
+  [838] = {.entry = {.count = 1, .reusable = true}}, SHIFT(277),
+  [840] = {.entry = {.count = 1, .reusable = true}}, SHIFT(149),
+  [842] = {.entry = {.count = 1, .reusable = true}}, SHIFT(154),
+  [844] = {.entry = {.count = 1, .reusable = true}}, SHIFT(155),
+  [846] = {.entry = {.count = 1, .reusable = true}}, SHIFT(167),
+  [848] = {.entry = {.count = 1, .reusable = true}}, SHIFT(281),
+  [850] = {.entry = {.count = 1, .reusable = true}}, SHIFT(168),
+  [852] = {.entry = {.count = 1, .reusable = true}}, SHIFT(173),
+  [854] = {.entry = {.count = 1, .reusable = true}}, SHIFT(174),
+  [856] = {.entry = {.count = 1, .reusable = true}}, SHIFT(186),
+  [858] = {.entry = {.count = 1, .reusable = true}}, SHIFT(285),
+  [860] = {.entry = {.count = 1, .reusable = true}}, SHIFT(187),
+  [862] = {.entry = {.count = 1, .reusable = true}}, SHIFT(192),
+  [864] = {.entry = {.count = 1, .reusable = true}}, SHIFT(193),
+  [866] = {.entry = {.count = 1, .reusable = true}}, SHIFT(209),
+  [868] = {.entry = {.count = 1, .reusable = true}}, SHIFT(289),
+  [870] = {.entry = {.count = 1, .reusable = true}}, SHIFT(210),
+  [872] = {.entry = {.count = 1, .reusable = true}}, SHIFT(215),
+  [874] = {.entry = {.count = 1, .reusable = true}}, SHIFT(216),
+  [876] = {.entry = {.count = 1, .reusable = true}}, SHIFT(265),
+  [878] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_citation_item, 3, 0, 0),
+  [880] = {.entry = {.count = 1, .reusable = true}},  ACCEPT_INPUT(),
+  [882] = {.entry = {.count = 1, .reusable = true}}, SHIFT(263),
+  [884] = {.entry = {.count = 1, .reusable = true}}, SHIFT(292),
+  [886] = {.entry = {.count = 1, .reusable = true}}, SHIFT(105),
+  [888] = {.entry = {.count = 1, .reusable = true}}, SHIFT(106),
+  [890] = {.entry = {.count = 1, .reusable = true}}, SHIFT(107),
+  [892] = {.entry = {.count = 1, .reusable = true}}, SHIFT(108),
+  [894] = {.entry = {.count = 1, .reusable = true}}, SHIFT(82),
+  [896] = {.entry = {.count = 1, .reusable = true}}, SHIFT(83),
+  [898] = {.entry = {.count = 1, .reusable = true}}, SHIFT(321),
+  [900] = {.entry = {.count = 1, .reusable = true}}, SHIFT(84),
+  [902] = {.entry = {.count = 1, .reusable = true}}, SHIFT(85),
+  [904] = {.entry = {.count = 1, .reusable = true}}, SHIFT(254),
+  [906] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_inline, 4, 0, 0),
+  [908] = {.entry = {.count = 1, .reusable = true}}, SHIFT(323),
+  [910] = {.entry = {.count = 1, .reusable = true}}, SHIFT(124),
+  [912] = {.entry = {.count = 1, .reusable = true}}, SHIFT(125),
+  [914] = {.entry = {.count = 1, .reusable = true}}, SHIFT(126),
+  [916] = {.entry = {.count = 1, .reusable = true}}, SHIFT(127),
+  [918] = {.entry = {.count = 1, .reusable = true}}, SHIFT(86),
+  [920] = {.entry = {.count = 1, .reusable = true}}, SHIFT(87),
+  [922] = {.entry = {.count = 1, .reusable = true}}, SHIFT(88),
+  [924] = {.entry = {.count = 1, .reusable = true}}, SHIFT(89),
+  [926] = {.entry = {.count = 1, .reusable = true}}, SHIFT(220),
+  [928] = {.entry = {.count = 1, .reusable = true}}, SHIFT(143),
+  [930] = {.entry = {.count = 1, .reusable = true}}, SHIFT(144),
+  [932] = {.entry = {.count = 1, .reusable = true}}, SHIFT(145),
+  [934] = {.entry = {.count = 1, .reusable = true}}, SHIFT(146),
+  [936] = {.entry = {.count = 1, .reusable = true}}, SHIFT(90),
+  [938] = {.entry = {.count = 1, .reusable = true}}, SHIFT(91),
+  [940] = {.entry = {.count = 1, .reusable = true}}, SHIFT(92),
+  [942] = {.entry = {.count = 1, .reusable = true}}, SHIFT(93),
+  [944] = {.entry = {.count = 1, .reusable = true}}, SHIFT(162),
+  [946] = {.entry = {.count = 1, .reusable = true}}, SHIFT(163),
+  [948] = {.entry = {.count = 1, .reusable = true}}, SHIFT(164),
+  [950] = {.entry = {.count = 1, .reusable = true}}, SHIFT(165),
+  [952] = {.entry = {.count = 1, .reusable = true}}, SHIFT(94),
+  [954] = {.entry = {.count = 1, .reusable = true}}, SHIFT(95),
+  [956] = {.entry = {.count = 1, .reusable = true}}, SHIFT(96),
+  [958] = {.entry = {.count = 1, .reusable = true}}, SHIFT(97),
+  [960] = {.entry = {.count = 1, .reusable = true}}, SHIFT(181),
+  [962] = {.entry = {.count = 1, .reusable = true}}, SHIFT(182),
+  [964] = {.entry = {.count = 1, .reusable = true}}, SHIFT(183),
+  [966] = {.entry = {.count = 1, .reusable = true}}, SHIFT(184),
+  [968] = {.entry = {.count = 1, .reusable = true}}, SHIFT(98),
+  [970] = {.entry = {.count = 1, .reusable = true}}, SHIFT(99),
+  [972] = {.entry = {.count = 1, .reusable = true}}, SHIFT(100),
+  [974] = {.entry = {.count = 1, .reusable = true}}, SHIFT(101),
+  [976] = {.entry = {.count = 1, .reusable = true}}, SHIFT(204),
+  [978] = {.entry = {.count = 1, .reusable = true}}, SHIFT(205),
+  [980] = {.entry = {.count = 1, .reusable = true}}, SHIFT(206),
+  [982] = {.entry = {.count = 1, .reusable = true}}, SHIFT(207),
+  [984] = {.entry = {.count = 1, .reusable = true}}, SHIFT(197),
+  [986] = {.entry = {.count = 1, .reusable = true}}, SHIFT(198),
+  [988] = {.entry = {.count = 1, .reusable = true}}, SHIFT(199),
+  [990] = {.entry = {.count = 1, .reusable = true}}, SHIFT(200),
+  [992] = {.entry = {.count = 1, .reusable = true}}, SHIFT(271),
+  [994] = {.entry = {.count = 1, .reusable = true}}, SHIFT(275),
+  [996] = {.entry = {.count = 1, .reusable = true}}, SHIFT(279),
+  [998] = {.entry = {.count = 1, .reusable = true}}, SHIFT(283),
+  [1000] = {.entry = {.count = 1, .reusable = true}}, SHIFT(287),
+};
+
+enum ts_external_scanner_symbol_identifiers {
+  ts_external_token__line_start = 0,
+  ts_external_token_line_end = 1,
+  ts_external_token__emph_star_start = 2,
+  ts_external_token__emph_star_end = 3,
+  ts_external_token__emph_under_start = 4,
+  ts_external_token__emph_under_end = 5,
+  ts_external_token__strong_star_start = 6,
+  ts_external_token__strong_star_end = 7,
+  ts_external_token__strong_under_start = 8,
+  ts_external_token__strong_under_end = 9,
+  ts_external_token__no_parse = 10,
+  ts_external_token__link_start = 11,
+  ts_external_token__image_start = 12,
+  ts_external_token__link_end = 13,
+  ts_external_token_link_destination = 14,
+  ts_external_token__span_start = 15,
+  ts_external_token__attribute_start = 16,
+  ts_external_token_attribute_id = 17,
+  ts_external_token_attribute_class = 18,
+  ts_external_token_attribute_key = 19,
+  ts_external_token_attribute_value = 20,
+  ts_external_token__attribute_end = 21,
+  ts_external_token_inline_math = 22,
+  ts_external_token_display_math = 23,
+  ts_external_token_citation = 24,
+  ts_external_token_cross_reference = 25,
+  ts_external_token__citation_group_start = 26,
+  ts_external_token_citation_prefix = 27,
+  ts_external_token_citation_locator = 28,
+  ts_external_token__shortcode_start = 29,
+  ts_external_token_shortcode_name = 30,
+  ts_external_token_shortcode_argument = 31,
+  ts_external_token__shortcode_end = 32,
+  ts_external_token_shortcode_escaped = 33,
+  ts_external_token_text = 34,
+  ts_external_token__trailing_attribute_start = 35,
+  ts_external_token__unused_error = 36,
+};
+
+static const TSSymbol ts_external_scanner_symbol_map[EXTERNAL_TOKEN_COUNT] = {
+  [ts_external_token__line_start] = sym__line_start,
+  [ts_external_token_line_end] = sym_line_end,
+  [ts_external_token__emph_star_start] = sym__emph_star_start,
+  [ts_external_token__emph_star_end] = sym__emph_star_end,
+  [ts_external_token__emph_under_start] = sym__emph_under_start,
+  [ts_external_token__emph_under_end] = sym__emph_under_end,
+  [ts_external_token__strong_star_start] = sym__strong_star_start,
+  [ts_external_token__strong_star_end] = sym__strong_star_end,
+  [ts_external_token__strong_under_start] = sym__strong_under_start,
+  [ts_external_token__strong_under_end] = sym__strong_under_end,
+  [ts_external_token__no_parse] = sym__no_parse,
+  [ts_external_token__link_start] = sym__link_start,
+  [ts_external_token__image_start] = sym__image_start,
+  [ts_external_token__link_end] = sym__link_end,
+  [ts_external_token_link_destination] = sym_link_destination,
+  [ts_external_token__span_start] = sym__span_start,
+  [ts_external_token__attribute_start] = sym__attribute_start,
+  [ts_external_token_attribute_id] = sym_attribute_id,
+  [ts_external_token_attribute_class] = sym_attribute_class,
+  [ts_external_token_attribute_key] = sym_attribute_key,
+  [ts_external_token_attribute_value] = sym_attribute_value,
+  [ts_external_token__attribute_end] = sym__attribute_end,
+  [ts_external_token_inline_math] = sym_inline_math,
+  [ts_external_token_display_math] = sym_display_math,
+  [ts_external_token_citation] = sym_citation,
+  [ts_external_token_cross_reference] = sym_cross_reference,
+  [ts_external_token__citation_group_start] = sym__citation_group_start,
+  [ts_external_token_citation_prefix] = sym_citation_prefix,
+  [ts_external_token_citation_locator] = sym_citation_locator,
+  [ts_external_token__shortcode_start] = sym__shortcode_start,
+  [ts_external_token_shortcode_name] = sym_shortcode_name,
+  [ts_external_token_shortcode_argument] = sym_shortcode_argument,
+  [ts_external_token__shortcode_end] = sym__shortcode_end,
+  [ts_external_token_shortcode_escaped] = sym_shortcode_escaped,
+  [ts_external_token_text] = sym_text,
+  [ts_external_token__trailing_attribute_start] = sym__trailing_attribute_start,
+  [ts_external_token__unused_error] = sym__unused_error,
+};
+
+static const bool ts_external_scanner_states[36][EXTERNAL_TOKEN_COUNT] = {
+  [1] = {
+    [ts_external_token__line_start] = true,
+    [ts_external_token_line_end] = true,
+    [ts_external_token__emph_star_start] = true,
+    [ts_external_token__emph_star_end] = true,
+    [ts_external_token__emph_under_start] = true,
+    [ts_external_token__emph_under_end] = true,
+    [ts_external_token__strong_star_start] = true,
+    [ts_external_token__strong_star_end] = true,
+    [ts_external_token__strong_under_start] = true,
+    [ts_external_token__strong_under_end] = true,
+    [ts_external_token__no_parse] = true,
+    [ts_external_token__link_start] = true,
+    [ts_external_token__image_start] = true,
+    [ts_external_token__link_end] = true,
+    [ts_external_token_link_destination] = true,
+    [ts_external_token__span_start] = true,
+    [ts_external_token__attribute_start] = true,
+    [ts_external_token_attribute_id] = true,
+    [ts_external_token_attribute_class] = true,
+    [ts_external_token_attribute_key] = true,
+    [ts_external_token_attribute_value] = true,
+    [ts_external_token__attribute_end] = true,
+    [ts_external_token_inline_math] = true,
+    [ts_external_token_display_math] = true,
+    [ts_external_token_citation] = true,
+    [ts_external_token_cross_reference] = true,
+    [ts_external_token__citation_group_start] = true,
+    [ts_external_token_citation_prefix] = true,
+    [ts_external_token_citation_locator] = true,
+    [ts_external_token__shortcode_start] = true,
+    [ts_external_token_shortcode_name] = true,
+    [ts_external_token_shortcode_argument] = true,
+    [ts_external_token__shortcode_end] = true,
+    [ts_external_token_shortcode_escaped] = true,
+    [ts_external_token_text] = true,
+    [ts_external_token__trailing_attribute_start] = true,
+    [ts_external_token__unused_error] = true,
+  },
+  [2] = {
+    [ts_external_token__line_start] = true,
+  },
+  [3] = {
+    [ts_external_token_line_end] = true,
+    [ts_external_token__emph_star_start] = true,
+    [ts_external_token__emph_star_end] = true,
+    [ts_external_token__emph_under_start] = true,
+    [ts_external_token__strong_star_start] = true,
+    [ts_external_token__strong_under_start] = true,
+    [ts_external_token__no_parse] = true,
+    [ts_external_token__link_start] = true,
+    [ts_external_token__image_start] = true,
+    [ts_external_token__span_start] = true,
+    [ts_external_token_inline_math] = true,
+    [ts_external_token_display_math] = true,
+    [ts_external_token_citation] = true,
+    [ts_external_token_cross_reference] = true,
+    [ts_external_token__citation_group_start] = true,
+    [ts_external_token__shortcode_start] = true,
+    [ts_external_token_shortcode_escaped] = true,
+    [ts_external_token_text] = true,
+  },
+  [4] = {
+    [ts_external_token_line_end] = true,
+    [ts_external_token__emph_star_start] = true,
+    [ts_external_token__emph_under_start] = true,
+    [ts_external_token__emph_under_end] = true,
+    [ts_external_token__strong_star_start] = true,
+    [ts_external_token__strong_under_start] = true,
+    [ts_external_token__no_parse] = true,
+    [ts_external_token__link_start] = true,
+    [ts_external_token__image_start] = true,
+    [ts_external_token__span_start] = true,
+    [ts_external_token_inline_math] = true,
+    [ts_external_token_display_math] = true,
+    [ts_external_token_citation] = true,
+    [ts_external_token_cross_reference] = true,
+    [ts_external_token__citation_group_start] = true,
+    [ts_external_token__shortcode_start] = true,
+    [ts_external_token_shortcode_escaped] = true,
+    [ts_external_token_text] = true,
+  },
+  [5] = {
+    [ts_external_token_line_end] = true,
+    [ts_external_token__emph_star_start] = true,
+    [ts_external_token__emph_under_start] = true,
+    [ts_external_token__strong_star_start] = true,
+    [ts_external_token__strong_star_end] = true,
+    [ts_external_token__strong_under_start] = true,
+    [ts_external_token__no_parse] = true,
+    [ts_external_token__link_start] = true,
+    [ts_external_token__image_start] = true,
+    [ts_external_token__span_start] = true,
+    [ts_external_token_inline_math] = true,
+    [ts_external_token_display_math] = true,
+    [ts_external_token_citation] = true,
+    [ts_external_token_cross_reference] = true,
+    [ts_external_token__citation_group_start] = true,
+    [ts_external_token__shortcode_start] = true,
+    [ts_external_token_shortcode_escaped] = true,
+    [ts_external_token_text] = true,
+  },
+  [6] = {
+    [ts_external_token_line_end] = true,
+    [ts_external_token__emph_star_start] = true,
+    [ts_external_token__emph_under_start] = true,
+    [ts_external_token__strong_star_start] = true,
+    [ts_external_token__strong_under_start] = true,
+    [ts_external_token__strong_under_end] = true,
+    [ts_external_token__no_parse] = true,
+    [ts_external_token__link_start] = true,
+    [ts_external_token__image_start] = true,
+    [ts_external_token__span_start] = true,
+    [ts_external_token_inline_math] = true,
+    [ts_external_token_display_math] = true,
+    [ts_external_token_citation] = true,
+    [ts_external_token_cross_reference] = true,
+    [ts_external_token__citation_group_start] = true,
+    [ts_external_token__shortcode_start] = true,
+    [ts_external_token_shortcode_escaped] = true,
+    [ts_external_token_text] = true,
+  },
+  [7] = {
+    [ts_external_token_line_end] = true,
+    [ts_external_token__emph_star_start] = true,
+    [ts_external_token__emph_under_start] = true,
+    [ts_external_token__strong_star_start] = true,
+    [ts_external_token__strong_under_start] = true,
+    [ts_external_token__no_parse] = true,
+    [ts_external_token__link_start] = true,
+    [ts_external_token__image_start] = true,
+    [ts_external_token__span_start] = true,
+    [ts_external_token_inline_math] = true,
+    [ts_external_token_display_math] = true,
+    [ts_external_token_citation] = true,
+    [ts_external_token_cross_reference] = true,
+    [ts_external_token__citation_group_start] = true,
+    [ts_external_token__shortcode_start] = true,
+    [ts_external_token_shortcode_escaped] = true,
+    [ts_external_token_text] = true,
+    [ts_external_token__trailing_attribute_start] = true,
+  },
+  [8] = {
+    [ts_external_token__emph_star_start] = true,
+    [ts_external_token__emph_under_start] = true,
+    [ts_external_token__strong_star_start] = true,
+    [ts_external_token__strong_under_start] = true,
+    [ts_external_token__no_parse] = true,
+    [ts_external_token__link_start] = true,
+    [ts_external_token__image_start] = true,
+    [ts_external_token__span_start] = true,
+    [ts_external_token_inline_math] = true,
+    [ts_external_token_display_math] = true,
+    [ts_external_token_citation] = true,
+    [ts_external_token_cross_reference] = true,
+    [ts_external_token__citation_group_start] = true,
+    [ts_external_token__shortcode_start] = true,
+    [ts_external_token_shortcode_escaped] = true,
+    [ts_external_token_text] = true,
+  },
+  [9] = {
+    [ts_external_token__emph_star_start] = true,
+    [ts_external_token__emph_under_start] = true,
+    [ts_external_token__strong_star_start] = true,
+    [ts_external_token__strong_under_start] = true,
+    [ts_external_token__no_parse] = true,
+    [ts_external_token__link_start] = true,
+    [ts_external_token__image_start] = true,
+    [ts_external_token__link_end] = true,
+    [ts_external_token__span_start] = true,
+    [ts_external_token_inline_math] = true,
+    [ts_external_token_display_math] = true,
+    [ts_external_token_citation] = true,
+    [ts_external_token_cross_reference] = true,
+    [ts_external_token__citation_group_start] = true,
+    [ts_external_token__shortcode_start] = true,
+    [ts_external_token_shortcode_escaped] = true,
+    [ts_external_token_text] = true,
+  },
+  [10] = {
+    [ts_external_token_line_end] = true,
+    [ts_external_token__emph_star_start] = true,
+    [ts_external_token__emph_under_start] = true,
+    [ts_external_token__strong_star_start] = true,
+    [ts_external_token__strong_under_start] = true,
+    [ts_external_token__no_parse] = true,
+    [ts_external_token__link_start] = true,
+    [ts_external_token__image_start] = true,
+    [ts_external_token__span_start] = true,
+    [ts_external_token__attribute_start] = true,
+    [ts_external_token_inline_math] = true,
+    [ts_external_token_display_math] = true,
+    [ts_external_token_citation] = true,
+    [ts_external_token_cross_reference] = true,
+    [ts_external_token__citation_group_start] = true,
+    [ts_external_token__shortcode_start] = true,
+    [ts_external_token_shortcode_escaped] = true,
+    [ts_external_token_text] = true,
+    [ts_external_token__trailing_attribute_start] = true,
+  },
+  [11] = {
+    [ts_external_token_line_end] = true,
+    [ts_external_token__emph_star_start] = true,
+    [ts_external_token__emph_star_end] = true,
+    [ts_external_token__emph_under_start] = true,
+    [ts_external_token__strong_star_start] = true,
+    [ts_external_token__strong_under_start] = true,
+    [ts_external_token__no_parse] = true,
+    [ts_external_token__link_start] = true,
+    [ts_external_token__image_start] = true,
+    [ts_external_token__span_start] = true,
+    [ts_external_token__attribute_start] = true,
+    [ts_external_token_inline_math] = true,
+    [ts_external_token_display_math] = true,
+    [ts_external_token_citation] = true,
+    [ts_external_token_cross_reference] = true,
+    [ts_external_token__citation_group_start] = true,
+    [ts_external_token__shortcode_start] = true,
+    [ts_external_token_shortcode_escaped] = true,
+    [ts_external_token_text] = true,
+  },
+  [12] = {
+    [ts_external_token_line_end] = true,
+    [ts_external_token__emph_star_start] = true,
+    [ts_external_token__emph_under_start] = true,
+    [ts_external_token__emph_under_end] = true,
+    [ts_external_token__strong_star_start] = true,
+    [ts_external_token__strong_under_start] = true,
+    [ts_external_token__no_parse] = true,
+    [ts_external_token__link_start] = true,
+    [ts_external_token__image_start] = true,
+    [ts_external_token__span_start] = true,
+    [ts_external_token__attribute_start] = true,
+    [ts_external_token_inline_math] = true,
+    [ts_external_token_display_math] = true,
+    [ts_external_token_citation] = true,
+    [ts_external_token_cross_reference] = true,
+    [ts_external_token__citation_group_start] = true,
+    [ts_external_token__shortcode_start] = true,
+    [ts_external_token_shortcode_escaped] = true,
+    [ts_external_token_text] = true,
+  },
+  [13] = {
+    [ts_external_token_line_end] = true,
+    [ts_external_token__emph_star_start] = true,
+    [ts_external_token__emph_under_start] = true,
+    [ts_external_token__strong_star_start] = true,
+    [ts_external_token__strong_star_end] = true,
+    [ts_external_token__strong_under_start] = true,
+    [ts_external_token__no_parse] = true,
+    [ts_external_token__link_start] = true,
+    [ts_external_token__image_start] = true,
+    [ts_external_token__span_start] = true,
+    [ts_external_token__attribute_start] = true,
+    [ts_external_token_inline_math] = true,
+    [ts_external_token_display_math] = true,
+    [ts_external_token_citation] = true,
+    [ts_external_token_cross_reference] = true,
+    [ts_external_token__citation_group_start] = true,
+    [ts_external_token__shortcode_start] = true,
+    [ts_external_token_shortcode_escaped] = true,
+    [ts_external_token_text] = true,
+  },
+  [14] = {
+    [ts_external_token_line_end] = true,
+    [ts_external_token__emph_star_start] = true,
+    [ts_external_token__emph_under_start] = true,
+    [ts_external_token__strong_star_start] = true,
+    [ts_external_token__strong_under_start] = true,
+    [ts_external_token__strong_under_end] = true,
+    [ts_external_token__no_parse] = true,
+    [ts_external_token__link_start] = true,
+    [ts_external_token__image_start] = true,
+    [ts_external_token__span_start] = true,
+    [ts_external_token__attribute_start] = true,
+    [ts_external_token_inline_math] = true,
+    [ts_external_token_display_math] = true,
+    [ts_external_token_citation] = true,
+    [ts_external_token_cross_reference] = true,
+    [ts_external_token__citation_group_start] = true,
+    [ts_external_token__shortcode_start] = true,
+    [ts_external_token_shortcode_escaped] = true,
+    [ts_external_token_text] = true,
+  },
+  [15] = {
+    [ts_external_token__emph_star_start] = true,
+    [ts_external_token__emph_under_start] = true,
+    [ts_external_token__strong_star_start] = true,
+    [ts_external_token__strong_under_start] = true,
+    [ts_external_token__no_parse] = true,
+    [ts_external_token__link_start] = true,
+    [ts_external_token__image_start] = true,
+    [ts_external_token__link_end] = true,
+    [ts_external_token__span_start] = true,
+    [ts_external_token__attribute_start] = true,
+    [ts_external_token_inline_math] = true,
+    [ts_external_token_display_math] = true,
+    [ts_external_token_citation] = true,
+    [ts_external_token_cross_reference] = true,
+    [ts_external_token__citation_group_start] = true,
+    [ts_external_token__shortcode_start] = true,
+    [ts_external_token_shortcode_escaped] = true,
+    [ts_external_token_text] = true,
+  },
+  [16] = {
+    [ts_external_token_line_end] = true,
+    [ts_external_token__trailing_attribute_start] = true,
+  },
+  [17] = {
+    [ts_external_token_attribute_id] = true,
+    [ts_external_token_attribute_class] = true,
+    [ts_external_token_attribute_key] = true,
+    [ts_external_token__attribute_end] = true,
+  },
+  [18] = {
+    [ts_external_token_line_end] = true,
+    [ts_external_token__emph_star_end] = true,
+  },
+  [19] = {
+    [ts_external_token_line_end] = true,
+    [ts_external_token__emph_under_end] = true,
+  },
+  [20] = {
+    [ts_external_token_line_end] = true,
+    [ts_external_token__strong_star_end] = true,
+  },
+  [21] = {
+    [ts_external_token_line_end] = true,
+    [ts_external_token__strong_under_end] = true,
+  },
+  [22] = {
+    [ts_external_token_line_end] = true,
+  },
+  [23] = {
+    [ts_external_token_citation] = true,
+    [ts_external_token_cross_reference] = true,
+    [ts_external_token_citation_prefix] = true,
+  },
+  [24] = {
+    [ts_external_token__link_end] = true,
+    [ts_external_token_citation_locator] = true,
+  },
+  [25] = {
+    [ts_external_token__link_end] = true,
+  },
+  [26] = {
+    [ts_external_token_shortcode_argument] = true,
+    [ts_external_token__shortcode_end] = true,
+  },
+  [27] = {
+    [ts_external_token__attribute_start] = true,
+  },
+  [28] = {
+    [ts_external_token_citation] = true,
+    [ts_external_token_cross_reference] = true,
+  },
+  [29] = {
+    [ts_external_token_shortcode_name] = true,
+  },
+  [30] = {
+    [ts_external_token__emph_star_end] = true,
+  },
+  [31] = {
+    [ts_external_token__emph_under_end] = true,
+  },
+  [32] = {
+    [ts_external_token__strong_star_end] = true,
+  },
+  [33] = {
+    [ts_external_token__strong_under_end] = true,
+  },
+  [34] = {
+    [ts_external_token_link_destination] = true,
+  },
+  [35] = {
+    [ts_external_token_attribute_value] = true,
+  },
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void *tree_sitter_quarto_inline_external_scanner_create(void);
+void tree_sitter_quarto_inline_external_scanner_destroy(void *);
+bool tree_sitter_quarto_inline_external_scanner_scan(void *, TSLexer *, const bool *);
+unsigned tree_sitter_quarto_inline_external_scanner_serialize(void *, char *);
+void tree_sitter_quarto_inline_external_scanner_deserialize(void *, const char *, unsigned);
+
+#ifdef TREE_SITTER_HIDE_SYMBOLS
+#define TS_PUBLIC
+#elif defined(_WIN32)
+#define TS_PUBLIC __declspec(dllexport)
+#else
+#define TS_PUBLIC __attribute__((visibility("default")))
+#endif
+
+TS_PUBLIC const TSLanguage *tree_sitter_quarto_inline(void) {
+  static const TSLanguage language = {
+    .abi_version = LANGUAGE_VERSION,
+    .symbol_count = SYMBOL_COUNT,
+    .alias_count = ALIAS_COUNT,
+    .token_count = TOKEN_COUNT,
+    .external_token_count = EXTERNAL_TOKEN_COUNT,
+    .state_count = STATE_COUNT,
+    .large_state_count = LARGE_STATE_COUNT,
+    .production_id_count = PRODUCTION_ID_COUNT,
+    .supertype_count = SUPERTYPE_COUNT,
+    .field_count = FIELD_COUNT,
+    .max_alias_sequence_length = MAX_ALIAS_SEQUENCE_LENGTH,
+    .parse_table = &ts_parse_table[0][0],
+    .small_parse_table = ts_small_parse_table,
+    .small_parse_table_map = ts_small_parse_table_map,
+    .parse_actions = ts_parse_actions,
+    .symbol_names = ts_symbol_names,
+    .symbol_metadata = ts_symbol_metadata,
+    .public_symbol_map = ts_symbol_map,
+    .alias_map = ts_non_terminal_alias_map,
+    .alias_sequences = &ts_alias_sequences[0][0],
+    .lex_modes = (const void*)ts_lex_modes,
+    .lex_fn = ts_lex,
+    .external_scanner = {
+      &ts_external_scanner_states[0][0],
+      ts_external_scanner_symbol_map,
+      tree_sitter_quarto_inline_external_scanner_create,
+      tree_sitter_quarto_inline_external_scanner_destroy,
+      tree_sitter_quarto_inline_external_scanner_scan,
+      tree_sitter_quarto_inline_external_scanner_serialize,
+      tree_sitter_quarto_inline_external_scanner_deserialize,
+    },
+    .primary_state_ids = ts_primary_state_ids,
+    .name = "quarto_inline",
+    .max_reserved_word_set_size = 0,
+    .metadata = {
+      .major_version = 0,
+      .minor_version = 1,
+      .patch_version = 0,
+    },
+  };
+  return &language;
+}
+#ifdef __cplusplus
+}
+#endif
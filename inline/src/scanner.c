@@ -0,0 +1,3250 @@
+#include <stdint.h>
+#include "tree_sitter/parser.h"
+#include "tree_sitter/array.h"
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+#include <stddef.h>
+// the public header, for TSQuartoScannerCounters
+#include "../../bindings/c/tree_sitter/tree-sitter-quarto.h"
+
+// the scanner keeps all of its mutable state in ScannerState, so parsers
+// on different threads never share anything
+static const size_t not_found = SIZE_MAX;
+static const uint32_t max_unsized = -1;
+static const uint32_t max_destination_depth = 32;
+
+enum TokenType {
+  LINE_START,
+  LINE_END,        // Token type for line_end
+  EMPHASIS_STAR_START,  // Token type for emphasis_start
+  EMPHASIS_STAR_END,     // Token type for emphasis_end
+  EMPHASIS_UNDER_START,
+  EMPHASIS_UNDER_END,
+  STRONG_STAR_START,
+  STRONG_STAR_END,
+  STRONG_UNDER_START,
+  STRONG_UNDER_END,
+  NO_PARSE,
+  LINK_START,
+  IMAGE_START,
+  LINK_END,
+  LINK_DESTINATION,
+  SPAN_START,
+  ATTRIBUTE_START,
+  ATTRIBUTE_ID,
+  ATTRIBUTE_CLASS,
+  ATTRIBUTE_KEY,
+  ATTRIBUTE_VALUE,
+  ATTRIBUTE_END,
+  INLINE_MATH,
+  DISPLAY_MATH,
+  CITATION,
+  CROSS_REFERENCE,
+  CITATION_GROUP_START,
+  CITATION_PREFIX,
+  CITATION_LOCATOR,
+  SHORTCODE_START,
+  SHORTCODE_NAME,
+  SHORTCODE_ARGUMENT,
+  SHORTCODE_END,
+  SHORTCODE_ESCAPED,
+  TEXT,
+  TRAILING_ATTRIBUTE_START,
+  ERROR, //General Emphasis
+};
+
+enum ParseToken {
+    NONE,
+    DO_NOT_PARSE,
+    EMPHASIS_STAR,
+    EMPHASIS_UNDER,
+    STRONG_STAR,
+    STRONG_UNDER,
+    LINK,
+    IMAGE,
+    SPAN,
+    CITATION_GROUP,
+    SHORTCODE,
+    SHORTCODE_LITERAL,
+};
+
+// keys starting with one of these and a '-' are quarto cross references
+static const char *const cross_reference_prefixes[] = {
+    "fig", "tbl", "lst", "tip", "nte", "wrn", "imp", "cau", "thm", "lem",
+    "cor", "prp", "cnj", "def", "exm", "exr", "sol", "rem", "alg", "eq",
+    "sec", NULL
+};
+
+
+
+// this struct is for emphasis
+// strong, and strong_emphasis
+// sections. I dont predict that
+// they will need the full size
+// of a uint32, but i suppose it
+// isn't imposible?
+typedef struct {
+  bool within;
+  uint32_t row;
+  uint32_t col;
+} WithinRange;
+
+typedef struct Pos {
+    uint32_t row;
+    uint32_t col;
+} Pos;
+
+typedef struct Range {
+    Pos start;
+    Pos end;
+} Range;
+
+enum RangeType {
+    DISJOINT_LESS,
+    OVERLAP,
+    CHILD,
+    PARENT,
+    DISJOINT_GREATER
+};
+
+/// COUNT and COUNT_PEAK record what the scanners of the calling thread
+/// did in a TSQuartoScannerCounters when the scanner is compiled with
+/// TREE_SITTER_QUARTO_COUNTERS, see
+/// `tree_sitter_quarto_inline_scanner_counters()`. Being thread-local,
+/// the counters are shared by no two threads, like ScannerState.
+
+#ifdef TREE_SITTER_QUARTO_COUNTERS
+static _Thread_local TSQuartoScannerCounters thread_counters;
+#define COUNT(counter, n) (thread_counters.counter += (n))
+#define COUNT_PEAK(counter, n) \
+    (thread_counters.counter = (n) > thread_counters.counter ? (n) : thread_counters.counter)
+#else
+#define COUNT(counter, n) ((void)0)
+#define COUNT_PEAK(counter, n) ((void)0)
+#endif
+
+/// a '[' and the buffer position of its matching ']'.
+/// `close` is `max_unsized` when the bracket is never closed.
+typedef struct BracketMatch {
+    uint32_t open;
+    uint32_t close;
+} BracketMatch;
+
+/// where the pre-parse found citation keys at the start of a word,
+/// ordered. They are kept apart from the other results so that a line of
+/// citations is neither scanned nor shifted for each key.
+typedef Array(Pos) KeyArray;
+
+typedef struct LexWrap {
+    TSLexer *lexer;
+    Pos init_pos;
+    Pos curr_pos;
+    uint32_t pos;
+    uint32_t line;
+    Array(int32_t) buffer;
+    Array(uint32_t) line_width;
+    Array(uint32_t) new_line_loc;
+    // every bracket in [bracket_start, bracket_end) of the buffer
+    // has been paired, ordered by `open`.
+    Array(BracketMatch) brackets;
+    uint32_t bracket_start;
+    uint32_t bracket_end;
+    // region of the document known to hold no ']'. Lives in the
+    // ScannerState so it survives across lines of a paragraph.
+    Range *no_closer;
+    // region of the document where no '(' opens a link destination,
+    // also from the ScannerState.
+    Range *no_destination;
+    // and where no '$' opens inline math, then display math
+    Range *no_math;
+    uint32_t no_shortcode_start;
+    uint32_t no_shortcode_end;
+    // those of the ScannerState, set once when it is created
+    KeyArray *keys;
+} LexWrap;
+
+
+static void print_letter(int32_t letter) {
+    if (letter == '\n') {
+        // fprintf(stderr, "'\\n'");
+    } else {
+        // fprintf(stderr, "'%c'", letter);
+    }
+}
+
+static LexWrap new_lexer(TSLexer *lexer, Pos init_pos) {
+    LexWrap obj;
+    obj.lexer = lexer;
+    obj.init_pos = init_pos;
+    obj.curr_pos = init_pos;
+    obj.pos = 0;
+    obj.line = max_unsized;
+    array_init(&obj.buffer);
+    array_init(&obj.line_width);
+    array_init(&obj.new_line_loc);
+    array_init(&obj.brackets);
+    obj.bracket_start = 0;
+    obj.bracket_end = 0;
+    obj.no_closer = NULL;
+    obj.no_destination = NULL;
+    obj.no_math = NULL;
+    obj.no_shortcode_start = 0;
+    obj.no_shortcode_end = 0;
+    obj.keys = NULL;
+    return obj;
+}
+
+/// points `wrapper` at `lexer` again, keeping the memory of its arrays.
+/// The scanner reuses one LexWrap for every call.
+static void lex_reset(LexWrap *wrapper, TSLexer *lexer, Pos init_pos) {
+    wrapper->lexer = lexer;
+    wrapper->init_pos = init_pos;
+    wrapper->curr_pos = init_pos;
+    wrapper->pos = 0;
+    wrapper->line = max_unsized;
+    array_clear(&wrapper->buffer);
+    array_clear(&wrapper->line_width);
+    array_clear(&wrapper->new_line_loc);
+    array_clear(&wrapper->brackets);
+    wrapper->bracket_start = 0;
+    wrapper->bracket_end = 0;
+    wrapper->no_closer = NULL;
+    wrapper->no_destination = NULL;
+    wrapper->no_math = NULL;
+    wrapper->no_shortcode_start = 0;
+    wrapper->no_shortcode_end = 0;
+}
+
+static void lex_delete(LexWrap *wrapper) {
+    array_delete(&wrapper->buffer);
+    array_delete(&wrapper->line_width);
+    array_delete(&wrapper->new_line_loc);
+    array_delete(&wrapper->brackets);
+}
+
+static int32_t lex_lookahead(LexWrap* wrapper) {
+
+    if (wrapper->pos == wrapper->buffer.size) {
+        return wrapper->lexer->lookahead;
+    } else {
+        return *array_get(&wrapper->buffer, wrapper->pos);
+    }
+}
+
+static void lex_advance(LexWrap* wrapper, bool skip) {
+    int32_t lookahead = lex_lookahead(wrapper);
+    if (wrapper->pos == wrapper->buffer.size) {
+        if (lookahead == '\n') {
+            // fprintf(stderr, "found new line, documenting position at %i\n", wrapper->pos + 1);
+            array_push(&wrapper->new_line_loc, wrapper->pos + 1);
+        }
+        array_push(&wrapper->buffer, lookahead);
+        wrapper->lexer->advance(wrapper->lexer, skip);
+    }
+    COUNT(advanced, 1);
+    if (lookahead != '\n') {
+        wrapper->curr_pos.col++;
+    } else {
+        wrapper->curr_pos.row++;
+        wrapper->line++;
+        if (wrapper->line == wrapper->line_width.size) {
+            array_push(&wrapper->line_width, wrapper->curr_pos.col);
+        }
+        wrapper->curr_pos.col = 0;
+    }
+    wrapper->pos++;
+
+    // fprintf(stderr, " * consuming: ");
+    print_letter(lookahead);
+    // fprintf(stderr, "\n");
+}
+
+static void lex_backtrack_n(LexWrap* wrapper, uint32_t n) {
+    // fprintf(stderr, "n: %i -- wrapper->pos: %i\n", n, wrapper->pos);
+    assert(n <= wrapper->pos);
+    COUNT(backtracked, n);
+    int32_t *letter;
+    for(uint32_t i = 0; i < n; i++) {
+        wrapper->pos--;
+        letter = &wrapper->buffer.contents[wrapper->pos];
+        if (*letter != '\n') {
+            wrapper->curr_pos.col--;
+        } else {
+            wrapper->curr_pos.row--;
+            assert(wrapper->line < wrapper->line_width.size);
+            wrapper->curr_pos.col = wrapper->line_width.contents[wrapper->line];
+            wrapper->line--;
+        }
+    }
+}
+
+static void lex_set_position(LexWrap *wrapper, uint32_t pos) {
+    if (pos >= wrapper->pos) {
+        uint32_t diff = pos - wrapper->pos;
+        for (uint32_t i = 0; i < diff; i++) {
+            lex_advance(wrapper, false);
+        }
+    } else {
+        uint32_t diff = wrapper->pos - pos;
+        lex_backtrack_n(wrapper, diff);
+    }
+}
+
+
+static Pos new_position(uint32_t row, uint32_t col) {
+    Pos obj;
+    obj.row = row;
+    obj.col = col;
+    return obj;
+}
+
+static bool pos_eq(Pos *x, Pos *y) {
+    return (x->row == y->row) && (x->col == y->col);
+}
+
+static bool pos_ne(Pos *x, Pos *y) {
+    return (x->row != y->row) || (x->col != y->col);
+}
+
+/// x < y
+static bool pos_lt(Pos *x, Pos *y) {
+    return (x->row < y->row ) || (x->row == y->row && x->col < y->col);
+}
+
+/// x <= y
+static bool pos_le(Pos *x, Pos *y) {
+    return x->row <= y->row && x->col <= y->col;
+}
+
+static bool pos_gt(Pos *x, Pos *y) {
+    return (x->row > y->row) || (x->row == y->row && x->col > y ->col);
+}
+
+static bool pos_ge(Pos *x, Pos *y) {
+    return x->row >= y->row && x->col >= y->col;
+}
+
+static void print_pos(const Pos *pos) {
+    // fprintf(stderr, "Pos { row: %u, col: %u }", pos->row, pos->col);
+}
+
+static void debug_pos(const Pos *pos) {
+    // fprintf(stderr, "[%u, %u]", pos->row, pos->col);
+}
+
+static Pos lex_current_position(LexWrap *wrapper) {
+    Pos range = new_position(wrapper->init_pos.row, wrapper->init_pos.col + wrapper->pos);
+    // fprintf(stderr, "current position: ");
+    debug_pos(&range);
+    if (wrapper->new_line_loc.size > 0) {
+        uint32_t diff;
+        uint32_t last_index = 0;
+        uint32_t line_index = 0;
+        // *array_get(&wrapper->new_line_loc, i);
+        for (uint32_t i = 0; i < wrapper->new_line_loc.size; i++) {
+            line_index = wrapper->new_line_loc.contents[i];
+            if (line_index > wrapper->pos) {
+                break;
+            }
+            range.row++;
+            diff = line_index - last_index;
+            last_index = line_index;
+            range.col -= diff;
+            // fprintf(stderr, " ");
+            debug_pos(&range);
+        }
+        // fprintf(stderr, "\n");
+    }
+    return range;
+}
+
+typedef struct ParseResult {
+    bool success;
+    uint32_t length;
+    Range range;
+    enum ParseToken token;
+} ParseResult;
+
+static Range new_range(Pos start, Pos end) {
+    Range obj;
+    obj.start = start;
+    obj.end = end;
+    return obj;
+}
+
+static ParseResult new_parse_result() {
+    ParseResult obj;
+    obj.success = false;
+    obj.length = 0;
+    obj.range = new_range(new_position(0, 0), new_position(0, 0));
+    obj.token = NONE;
+    return obj;
+}
+
+typedef Array(ParseResult) ParseResultArray;
+typedef Array(uint32_t) IndexArray;
+
+static bool pos_within_range(Pos *x, Range *y) {
+    return pos_le(x, &y->end) && pos_ge(x, &y->start);
+}
+
+/// x:   |----|
+/// y:  |-------|
+static bool range_within(Range *x, Range *y) {
+    return pos_gt(&x->end, &y->start) && pos_lt(&x->start, &y->end);
+}
+
+/// x: |---|
+/// y:       |----|
+static bool range_disjoint(Range *x, Range *y) {
+    return pos_ge(&y->start, &x->end) ||  pos_ge(&x->start, &y->end);
+}
+
+static enum RangeType classify_range(Range *x, Range *y) {
+    // |----|
+    //        |----|
+
+    if (pos_le(&x->end, &y->start)) {
+        return DISJOINT_LESS;
+    }
+    if (pos_le(&x->end, &y->end)) {
+        if (pos_ge(&x->start, &y->start)) {
+            return CHILD;
+        } else {
+            return OVERLAP;
+        }
+    } else {
+        if (pos_lt(&x->start, &y->start)) {
+            return PARENT;
+        }
+
+        if (pos_lt(&x->start, &y->end)) {
+            return OVERLAP;
+        } else {
+            return DISJOINT_GREATER;
+        }
+    }
+
+}
+
+static void print_parse_result(const ParseResult *res) {
+    // fprintf(stderr, "ParseResult { success: %d, length: %u, range: ", res->success, res->length);
+    // fprintf(stderr, "[%i, %i] - ", res->range.start.row, res->range.start.col);
+    // fprintf(stderr, "[%i, %i]", res->range.end.row, res->range.end.col);
+    // fprintf(stderr, ", token: %d }\n", res->token);
+}
+
+static void print_stack(ParseResultArray *stack) {
+    for (uint32_t i = 0; i < stack->size; i++) {
+        // fprintf(stderr, "\t");
+        print_parse_result(&stack->contents[i]);
+    }
+}
+
+static size_t stack_insert(ParseResultArray* array, ParseResult element) {
+    size_t out = not_found;
+    if (array->size == 0) {
+        array_push(array, element);
+        out = 0;
+        goto func_end;
+    } else {
+        for (size_t i = 0; i < array->size; i++) {
+            ParseResult *result = &array->contents[i];
+            switch (classify_range(&element.range, &result->range)) {
+                case OVERLAP: {
+                    // fprintf(stderr, "OVERLAP found [%i, %i] - [%i, %i] ... [%i, %i] - [%i, %i] ",
+                        // element.range.start.row,
+                        // element.range.start.col,
+                        // element.range.end.row,
+                        // element.range.end.col,
+                        // result->range.start.row, result->range.start.col,
+                        // result->range.end.row, result->range.end.col);
+                    out = not_found;
+                    goto func_end;
+                }
+                case PARENT: {
+                    array_insert(array, i, element);
+                    out = i;
+                    goto func_end;
+                }
+                case DISJOINT_LESS: {
+                    array_insert(array, i, element);
+                    out = i;
+                    goto func_end;
+                }
+                case DISJOINT_GREATER: {
+                    array_insert(array, i + 1, element);
+                    out = i + 1;
+                    goto func_end;
+                }
+                case CHILD: {
+                    continue;
+                }
+            }
+        }
+        // nested in everything on the stack, as emphasis inside a link
+        array_push(array, element);
+        out = array->size - 1;
+    }
+
+    func_end: {
+        if (out == not_found) {
+            // fprintf(stderr, "attempting to insert: ");
+            print_parse_result(&element);
+        }
+        // fprintf(stderr, "insert was %ssuccessful: \n", out==not_found ? "un" : "");
+        print_stack(array);
+        return out;
+    }
+
+
+}
+
+
+
+static size_t stack_find(ParseResultArray *array, Pos *pos, enum ParseToken token, bool end) {
+    ParseResult *element;
+    if (end) {
+        for (size_t i = 0; i < array->size; i++) {
+            element = &array->contents[i];
+            if (element->token == token && pos_eq(&element->range.end, pos)) {
+                return i;
+            }
+        }
+    } else {
+        for (size_t i = 0; i < array->size; i++) {
+            element = &array->contents[i];
+            if (element->token == token && pos_eq(&element->range.start, pos)) {
+                return i;
+            }
+        }
+    }
+    return not_found;
+}
+
+static size_t stack_find_within(ParseResultArray *array, Pos *pos, enum ParseToken token) {
+     ParseResult *element;
+    for (size_t i = 0; i < array->size; i++) {
+        element = &array->contents[i];
+        if (element->token == token && pos_within_range(pos, &element->range)) {
+            return i;
+        }
+    }
+    return not_found;
+}
+
+static size_t stack_find_exact(ParseResultArray *array,  ParseResult *res) {
+    ParseResult *element;
+   for (size_t i = 0; i < array->size; i++) {
+       element = &array->contents[i];
+       if (element->token == res->token &&
+           pos_eq(&element->range.start, &res->range.start) &&
+           pos_eq(&element->range.end, &res->range.end)) {
+           return i;
+       }
+   }
+   return not_found;
+}
+
+/// the index of the first key not before `pos`
+static size_t keys_lower_bound(KeyArray *keys, Pos *pos) {
+    size_t low = 0, high = keys->size;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (pos_lt(&keys->contents[mid], pos)) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+/// keys are mostly found left to right, so this is an append. A key
+/// found again when a line is pre-parsed twice is kept once.
+static void keys_insert(KeyArray *keys, Pos key) {
+    if (keys->size == 0 || pos_lt(&keys->contents[keys->size - 1], &key)) {
+        array_push(keys, key);
+        return;
+    }
+    size_t index = keys_lower_bound(keys, &key);
+    if (!pos_eq(&keys->contents[index], &key)) {
+        array_insert(keys, index, key);
+    }
+}
+
+static size_t keys_find(KeyArray *keys, Pos *pos) {
+    size_t index = keys_lower_bound(keys, pos);
+    if (index < keys->size && pos_eq(&keys->contents[index], pos)) {
+        return index;
+    }
+    return not_found;
+}
+
+
+static bool is_whitespace(int32_t char_) {
+    return char_ == ' ' || char_ == '\t' || char_ == '\n';
+}
+static bool is_whitespace_next(TSLexer *lexer) {
+    return is_whitespace(lexer->lookahead);
+}
+
+static bool is_inline_synatx(int32_t char_) {
+    return char_ == '*' || char_ == '_' ||
+     char_ == '^' || char_ == '~' ||
+     char_ == '`' || char_ == '@' ||
+     char_ == '[' || char_ == ']' ||
+     char_ == '!' || char_ == '{' ||
+     char_ == '$';
+}
+
+/// characters that never start inline syntax and may be part of a run
+/// of plain text. '!' and '@' are handled by the caller as they only
+/// matter before a '[' or at the start of a word.
+static bool is_text_char(int32_t char_) {
+    return char_ != '\0' && char_ != '\n' && char_ != '\r' &&
+     char_ != '*' && char_ != '_' &&
+     char_ != '[' && char_ != ']' &&
+     char_ != '{' && char_ != '$' &&
+     char_ != '@' && char_ != '\\' &&
+     char_ != '<';
+}
+
+/// characters allowed in ids, classes and keys of an attribute block
+static bool is_attribute_char(int32_t char_) {
+    return (char_ < 128 && isalnum(char_)) || char_ >= 128 ||
+     char_ == '-' || char_ == '_' || char_ == ':' || char_ == '.';
+}
+
+/// pairs every bracket from the '[' under the lexer up to the end of the
+/// paragraph, or up to the end of the line once no bracket is left open.
+/// The pairs are stored on the wrapper so that any later '[' inside the
+/// indexed region is answered without scanning again - a line of n '['
+/// is walked once instead of n times.
+///
+/// if brackets are still open when the paragraph ends, everything after
+/// the last ']' seen cannot be closed either. That region is recorded in
+/// `no_closer` so the '[' of the following lines can bail out immediately.
+static void lex_index_brackets(LexWrap *wrapper) {
+    uint32_t start = wrapper->pos;
+    IndexArray open;
+    array_init(&open);
+    array_clear(&wrapper->brackets);
+    wrapper->bracket_start = start;
+    Pos last_close = wrapper->curr_pos;
+    uint8_t new_line_count = 0;
+    int32_t lookahead = lex_lookahead(wrapper);
+    while (lookahead != '\0') {
+        switch (lookahead) {
+            case '[': {
+                BracketMatch match = { wrapper->pos, max_unsized };
+                array_push(&open, wrapper->brackets.size);
+                array_push(&wrapper->brackets, match);
+                new_line_count = 0;
+                break;
+            }
+            case ']': {
+                if (open.size > 0) {
+                    wrapper->brackets.contents[*array_back(&open)].close = wrapper->pos;
+                    (void)array_pop(&open);
+                }
+                last_close = wrapper->curr_pos;
+                new_line_count = 0;
+                break;
+            }
+            case '\\': {
+                // escaped brackets never pair
+                lex_advance(wrapper, false);
+                new_line_count = 0;
+                lookahead = lex_lookahead(wrapper);
+                if (lookahead == '\n') {
+                    continue;
+                }
+                break;
+            }
+            case '\n': {
+                new_line_count++;
+                if (new_line_count > 1 || open.size == 0) {
+                    goto index_end;
+                }
+                break;
+            }
+            case ' ':
+            case '\t': {
+                break;
+            }
+            default: {
+                new_line_count = 0;
+            }
+        }
+        lex_advance(wrapper, false);
+        lookahead = lex_lookahead(wrapper);
+    }
+
+    index_end: {
+        wrapper->bracket_end = wrapper->pos;
+        if (open.size > 0 && wrapper->no_closer) {
+            wrapper->no_closer->start = last_close;
+            wrapper->no_closer->end = wrapper->curr_pos;
+        }
+        array_delete(&open);
+        lex_set_position(wrapper, start);
+    }
+}
+
+/// returns the buffer position of the ']' closing the '[' under the
+/// lexer, or `max_unsized` if there is none.
+static uint32_t lex_find_bracket_close(LexWrap *wrapper) {
+    Range *no_closer = wrapper->no_closer;
+    if (no_closer &&
+        pos_gt(&wrapper->curr_pos, &no_closer->start) &&
+        pos_lt(&wrapper->curr_pos, &no_closer->end)) {
+        return max_unsized;
+    }
+    if (wrapper->pos < wrapper->bracket_start || wrapper->pos >= wrapper->bracket_end) {
+        lex_index_brackets(wrapper);
+    }
+    uint32_t lo = 0;
+    uint32_t hi = wrapper->brackets.size;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        BracketMatch *match = &wrapper->brackets.contents[mid];
+        if (match->open == wrapper->pos) {
+            return match->close;
+        } else if (match->open < wrapper->pos) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return max_unsized;
+}
+
+/// consumes a link destination `(url "title")` if one is under the lexer.
+/// Parentheses may nest up to `max_destination_depth` levels, as in cmark,
+/// and nothing inside a quoted title or after a '\\' counts towards the
+/// nesting. A blank line ends the attempt.
+///
+/// when the attempt fails, no '(' after the last ')' it passed can be
+/// closed either. That region is recorded in `no_destination`, so a
+/// paragraph full of unclosed `[a](` is walked once.
+static bool lex_link_destination(LexWrap *wrapper) {
+    if (lex_lookahead(wrapper) != '(') {
+        return false;
+    }
+    Range *no_destination = wrapper->no_destination;
+    if (no_destination &&
+        pos_gt(&wrapper->curr_pos, &no_destination->start) &&
+        pos_lt(&wrapper->curr_pos, &no_destination->end)) {
+        return false;
+    }
+    Pos last_close = wrapper->curr_pos;
+    lex_advance(wrapper, false);
+    uint32_t depth = 1;
+    uint8_t new_line_count = 0;
+    bool quoted = false;
+    int32_t last_char = '(';
+    int32_t lookahead = lex_lookahead(wrapper);
+    while (lookahead != '\0') {
+        switch (lookahead) {
+            case '\\': {
+                lex_advance(wrapper, false);
+                new_line_count = 0;
+                lookahead = lex_lookahead(wrapper);
+                if (lookahead == '\n' || lookahead == '\0') {
+                    continue;
+                }
+                break;
+            }
+            case '\n': {
+                new_line_count++;
+                if (new_line_count > 1) {
+                    goto no_destination;
+                }
+                break;
+            }
+            case '"': {
+                // a title only opens after whitespace, so quotes
+                // inside the url itself are left alone
+                new_line_count = 0;
+                if (quoted || is_whitespace(last_char)) {
+                    quoted = !quoted;
+                }
+                break;
+            }
+            case '(': {
+                new_line_count = 0;
+                if (!quoted && ++depth > max_destination_depth) {
+                    return false;
+                }
+                break;
+            }
+            case ')': {
+                // quotes and nesting depend on where the attempt started,
+                // so any ')' may close a later '('
+                new_line_count = 0;
+                last_close = wrapper->curr_pos;
+                if (!quoted && --depth == 0) {
+                    lex_advance(wrapper, false);
+                    return true;
+                }
+                break;
+            }
+            case ' ':
+            case '\t': {
+                break;
+            }
+            default: {
+                new_line_count = 0;
+            }
+        }
+        last_char = lookahead;
+        lex_advance(wrapper, false);
+        lookahead = lex_lookahead(wrapper);
+    }
+
+    no_destination: {
+        if (no_destination) {
+            no_destination->start = last_close;
+            no_destination->end = wrapper->curr_pos;
+        }
+        return false;
+    }
+}
+
+static bool lex_attribute_name(LexWrap *wrapper) {
+    uint32_t start = wrapper->pos;
+    while (is_attribute_char(lex_lookahead(wrapper))) {
+        lex_advance(wrapper, false);
+    }
+    return wrapper->pos > start;
+}
+
+/// consumes one piece of an attribute block and reports which token it
+/// is: `#id`, `.class`, a `key` (the '=' is left behind), or the closing
+/// '}'. With `value` set it instead consumes the value after a '=',
+/// either bare or quoted. Returns ERROR when nothing valid is found.
+/// With `skip` set leading whitespace is skipped, so that it is left out
+/// of the token.
+///
+/// this is the only place attribute syntax is defined - the pre-parse
+/// uses it to validate and skip whole blocks, and the scanner uses it
+/// to hand the pieces to the grammar one at a time.
+static enum TokenType lex_attribute_component(LexWrap *wrapper, bool value, bool skip) {
+    int32_t lookahead = lex_lookahead(wrapper);
+    while (lookahead == ' ' || lookahead == '\t') {
+        lex_advance(wrapper, skip);
+        lookahead = lex_lookahead(wrapper);
+    }
+    if (value) {
+        if (lookahead == '"' || lookahead == '\'') {
+            int32_t quote = lookahead;
+            lex_advance(wrapper, false);
+            lookahead = lex_lookahead(wrapper);
+            while (lookahead != quote) {
+                if (lookahead == '\0' || lookahead == '\n') {
+                    return ERROR;
+                }
+                if (lookahead == '\\') {
+                    lex_advance(wrapper, false);
+                    if (lex_lookahead(wrapper) == '\0') {
+                        return ERROR;
+                    }
+                }
+                lex_advance(wrapper, false);
+                lookahead = lex_lookahead(wrapper);
+            }
+            lex_advance(wrapper, false);
+            return ATTRIBUTE_VALUE;
+        }
+        uint32_t start = wrapper->pos;
+        while (lookahead != '\0' && lookahead != '}' && !is_whitespace(lookahead)) {
+            lex_advance(wrapper, false);
+            lookahead = lex_lookahead(wrapper);
+        }
+        return wrapper->pos > start ? ATTRIBUTE_VALUE : ERROR;
+    }
+    switch (lookahead) {
+        case '}': {
+            lex_advance(wrapper, false);
+            return ATTRIBUTE_END;
+        }
+        case '#': {
+            lex_advance(wrapper, false);
+            return lex_attribute_name(wrapper) ? ATTRIBUTE_ID : ERROR;
+        }
+        case '.': {
+            lex_advance(wrapper, false);
+            return lex_attribute_name(wrapper) ? ATTRIBUTE_CLASS : ERROR;
+        }
+        default: {
+            if (lex_attribute_name(wrapper) && lex_lookahead(wrapper) == '=') {
+                return ATTRIBUTE_KEY;
+            }
+            return ERROR;
+        }
+    }
+}
+
+/// consumes a whole attribute block `{#id .class key=val}` in a single
+/// forward pass. Returns false if the '{' does not open a valid block.
+static bool lex_attribute_block(LexWrap *wrapper) {
+    if (lex_lookahead(wrapper) != '{') {
+        return false;
+    }
+    lex_advance(wrapper, false);
+    while (true) {
+        switch (lex_attribute_component(wrapper, false, false)) {
+            case ATTRIBUTE_END: {
+                return true;
+            }
+            case ATTRIBUTE_ID:
+            case ATTRIBUTE_CLASS: {
+                break;
+            }
+            case ATTRIBUTE_KEY: {
+                lex_advance(wrapper, false);
+                if (lex_attribute_component(wrapper, true, false) != ATTRIBUTE_VALUE) {
+                    return false;
+                }
+                break;
+            }
+            default: {
+                return false;
+            }
+        }
+    }
+}
+
+/// consumes `$...$` or `$$...$$` following pandoc's tex_math_dollars
+/// rules: an opening '$' must be followed by a non-space character, and
+/// a closing '$' must follow a non-space character and must not be
+/// followed by a digit, so "$20 and $30" stays text. Display math may
+/// contain anything but a blank line. Returns INLINE_MATH, DISPLAY_MATH,
+/// or ERROR when the '$' does not open math.
+///
+/// when the attempt fails, math opening after the last '$' that could
+/// have closed it cannot be closed either. Those regions are recorded
+/// in `no_math`, one for inline and one for display math, so a
+/// paragraph of "$1 $2 $3" is walked once.
+static enum TokenType lex_math(LexWrap *wrapper) {
+    Pos start = wrapper->curr_pos;
+    lex_advance(wrapper, false);
+    bool display = false;
+    if (lex_lookahead(wrapper) == '$') {
+        lex_advance(wrapper, false);
+        display = true;
+    }
+    int32_t lookahead = lex_lookahead(wrapper);
+    if (!display && is_whitespace(lookahead)) {
+        return ERROR;
+    }
+    Range *no_math = wrapper->no_math;
+    if (no_math &&
+        pos_gt(&start, &no_math[display].start) &&
+        pos_lt(&start, &no_math[display].end)) {
+        return ERROR;
+    }
+    // the last '$' that would close inline math and the last "$$", as
+    // seen from any '$' before them
+    Pos last_close[2] = { start, start };
+    int32_t last_char = '$';
+    uint8_t new_line_count = 0;
+    while (lookahead != '\0') {
+        switch (lookahead) {
+            case '\\': {
+                lex_advance(wrapper, false);
+                new_line_count = 0;
+                lookahead = lex_lookahead(wrapper);
+                if (lookahead == '\n' || lookahead == '\0') {
+                    continue;
+                }
+                break;
+            }
+            case '\n': {
+                new_line_count++;
+                if (new_line_count > 1) {
+                    goto no_math;
+                }
+                break;
+            }
+            case '$': {
+                new_line_count = 0;
+                Pos dollar = wrapper->curr_pos;
+                if (last_char == '$') {
+                    last_close[true] = dollar;
+                }
+                lex_advance(wrapper, false);
+                lookahead = lex_lookahead(wrapper);
+                if (display && lookahead == '$') {
+                    lex_advance(wrapper, false);
+                    return DISPLAY_MATH;
+                }
+                if (!is_whitespace(last_char) && (lookahead < '0' || lookahead > '9')) {
+                    if (!display) {
+                        return INLINE_MATH;
+                    }
+                    last_close[false] = dollar;
+                }
+                last_char = '$';
+                continue;
+            }
+            case ' ':
+            case '\t': {
+                break;
+            }
+            default: {
+                new_line_count = 0;
+            }
+        }
+        last_char = lookahead;
+        lex_advance(wrapper, false);
+        lookahead = lex_lookahead(wrapper);
+    }
+
+    no_math: {
+        if (no_math) {
+            for (uint8_t i = 0; i < 2; i++) {
+                no_math[i].start = last_close[i];
+                no_math[i].end = wrapper->curr_pos;
+            }
+        }
+        return ERROR;
+    }
+}
+
+static bool is_citation_char(int32_t char_) {
+    return (char_ < 128 && isalnum(char_)) || char_ >= 128 || char_ == '_';
+}
+
+/// punctuation allowed inside a citation key, as long as a key
+/// character follows it
+static bool is_citation_punctuation(int32_t char_) {
+    return char_ > 0 && char_ < 128 && strchr(":.#$%&-+?<>~/", char_) != NULL;
+}
+
+/// the key occupies [start, wrapper->pos) of the buffer
+static bool is_cross_reference(LexWrap *wrapper, uint32_t start) {
+    for (const char *const *prefix = cross_reference_prefixes; *prefix; prefix++) {
+        uint32_t length = strlen(*prefix);
+        if (start + length >= wrapper->pos ||
+            wrapper->buffer.contents[start + length] != '-') {
+            continue;
+        }
+        uint32_t i = 0;
+        while (i < length && wrapper->buffer.contents[start + i] == (*prefix)[i]) {
+            i++;
+        }
+        if (i == length) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// consumes a citation key following pandoc's rules, the lexer being
+/// just past the '@'. A key starts with a letter, digit or '_', and may
+/// contain `:.#$%&-+?<>~/` only between key characters, so the period
+/// ending a sentence is left alone. `@{...}` takes anything but braces.
+/// Returns CITATION, CROSS_REFERENCE, or ERROR when no key follows.
+///
+/// with `mark` set the token end is marked after every key character,
+/// since a trailing punctuation character has to be given back.
+static enum TokenType lex_citation_key(LexWrap *wrapper, bool mark) {
+    int32_t lookahead = lex_lookahead(wrapper);
+    if (lookahead == '{') {
+        lex_advance(wrapper, false);
+        lookahead = lex_lookahead(wrapper);
+        while (lookahead != '}') {
+            if (lookahead == '\0' || lookahead == '\n' || lookahead == '{') {
+                return ERROR;
+            }
+            lex_advance(wrapper, false);
+            lookahead = lex_lookahead(wrapper);
+        }
+        lex_advance(wrapper, false);
+        if (mark) {
+            wrapper->lexer->mark_end(wrapper->lexer);
+        }
+        return CITATION;
+    }
+    if (!is_citation_char(lookahead)) {
+        return ERROR;
+    }
+    uint32_t start = wrapper->pos;
+    while (true) {
+        lookahead = lex_lookahead(wrapper);
+        if (is_citation_punctuation(lookahead)) {
+            lex_advance(wrapper, false);
+            if (!is_citation_char(lex_lookahead(wrapper))) {
+                lex_backtrack_n(wrapper, 1);
+                break;
+            }
+        } else if (!is_citation_char(lookahead)) {
+            break;
+        }
+        lex_advance(wrapper, false);
+        if (mark) {
+            wrapper->lexer->mark_end(wrapper->lexer);
+        }
+    }
+    return is_cross_reference(wrapper, start) ? CROSS_REFERENCE : CITATION;
+}
+
+/// checks the text of a bracket, from just past the '[' up to the
+/// buffer position `close` of its ']', for a citation key at the start
+/// of a word. Nested brackets and line breaks are not allowed, which
+/// also keeps this check linear across a paragraph.
+static bool lex_citation_group(LexWrap *wrapper, uint32_t close) {
+    int32_t last_char = '[';
+    bool found = false;
+    while (wrapper->pos < close) {
+        int32_t lookahead = lex_lookahead(wrapper);
+        switch (lookahead) {
+            case '[':
+            case '\n': {
+                return false;
+            }
+            case '\\': {
+                lex_advance(wrapper, false);
+                break;
+            }
+            case '@': {
+                lex_advance(wrapper, false);
+                if (!is_citation_char(last_char) && lex_citation_key(wrapper, false) != ERROR) {
+                    found = true;
+                }
+                last_char = '@';
+                continue;
+            }
+            default: {}
+        }
+        last_char = lookahead;
+        lex_advance(wrapper, false);
+    }
+    return found;
+}
+
+/// consumes the text in a citation group before a key - the "see" of
+/// `[see @doe99]`. The token ends in front of the '@', or in front of
+/// the '-' of a `-@key` that suppresses the author.
+static bool scan_citation_prefix(TSLexer *lexer) {
+    int32_t last_char = ' ';
+    bool has_text = false;
+    while (true) {
+        int32_t lookahead = lexer->lookahead;
+        switch (lookahead) {
+            case '\0':
+            case '\n':
+            case ';':
+            case '[':
+            case ']': {
+                return false;
+            }
+            case '@': {
+                if (!is_citation_char(last_char)) {
+                    if (last_char != '-') {
+                        lexer->mark_end(lexer);
+                    }
+                    return has_text;
+                }
+                break;
+            }
+            case '-': {
+                lexer->mark_end(lexer);
+                break;
+            }
+            case '\\': {
+                lexer->advance(lexer, false);
+                has_text = true;
+                break;
+            }
+            default: {
+                if (!is_whitespace(lookahead)) {
+                    has_text = true;
+                }
+            }
+        }
+        last_char = lookahead;
+        lexer->advance(lexer, false);
+    }
+}
+
+/// consumes the text after a key in a citation group, up to the next
+/// ';' or the closing ']' - the ", pp. 33-35" of `[@doe99, pp. 33-35]`.
+static bool scan_citation_locator(TSLexer *lexer) {
+    bool has_text = false;
+    while (lexer->lookahead != ';' && lexer->lookahead != ']') {
+        if (lexer->lookahead == '\0' || lexer->lookahead == '\n') {
+            return false;
+        }
+        if (lexer->lookahead == '\\') {
+            lexer->advance(lexer, false);
+        }
+        lexer->advance(lexer, false);
+        has_text = true;
+    }
+    lexer->mark_end(lexer);
+    return has_text;
+}
+
+/// consumes the `>}}` closing a shortcode, or `>}}}` when `braces` is 3.
+/// The lexer is left where it was if they are not there.
+static bool lex_shortcode_close(LexWrap *wrapper, uint8_t braces) {
+    if (lex_lookahead(wrapper) != '>') {
+        return false;
+    }
+    lex_advance(wrapper, false);
+    for (uint8_t i = 0; i < braces; i++) {
+        if (lex_lookahead(wrapper) != '}') {
+            lex_backtrack_n(wrapper, i + 1);
+            return false;
+        }
+        lex_advance(wrapper, false);
+    }
+    return true;
+}
+
+/// consumes the next piece of a shortcode: an argument, bare or with
+/// quoted parts such as `key="a value"`, or the closing braces. The
+/// first argument is the shortcode's name. Returns SHORTCODE_ARGUMENT,
+/// SHORTCODE_END, or ERROR. With `mark` set the token end is marked
+/// after every argument character, since a '>' may turn out to start
+/// the closing braces, and leading whitespace is left out of the token.
+static enum TokenType lex_shortcode_component(LexWrap *wrapper, uint8_t braces, bool mark) {
+    int32_t lookahead = lex_lookahead(wrapper);
+    while (lookahead == ' ' || lookahead == '\t') {
+        lex_advance(wrapper, mark);
+        lookahead = lex_lookahead(wrapper);
+    }
+    if (lex_shortcode_close(wrapper, braces)) {
+        return SHORTCODE_END;
+    }
+    uint32_t start = wrapper->pos;
+    while (lookahead != '\0' && !is_whitespace(lookahead)) {
+        if (lookahead == '>' && lex_shortcode_close(wrapper, braces)) {
+            lex_backtrack_n(wrapper, braces + 1);
+            break;
+        }
+        if (lookahead == '"' || lookahead == '\'') {
+            int32_t quote = lookahead;
+            lex_advance(wrapper, false);
+            lookahead = lex_lookahead(wrapper);
+            while (lookahead != quote) {
+                if (lookahead == '\0' || lookahead == '\n') {
+                    return ERROR;
+                }
+                if (lookahead == '\\') {
+                    lex_advance(wrapper, false);
+                }
+                lex_advance(wrapper, false);
+                lookahead = lex_lookahead(wrapper);
+            }
+        }
+        lex_advance(wrapper, false);
+        if (mark) {
+            wrapper->lexer->mark_end(wrapper->lexer);
+        }
+        lookahead = lex_lookahead(wrapper);
+    }
+    return wrapper->pos > start ? SHORTCODE_ARGUMENT : ERROR;
+}
+
+/// consumes a whole shortcode `{{< name args >}}` in one pass, returning
+/// SHORTCODE_START, or SHORTCODE_ESCAPED for the literal `{{{< ... >}}}`
+/// form. Returns ERROR when the braces do not open a shortcode.
+///
+/// when an attempt runs into the end of the line, no shortcode opening
+/// after the last `>}}` it passed can be closed. That region is recorded
+/// on the wrapper so a line full of unclosed `{{<` is walked once.
+static enum TokenType lex_shortcode(LexWrap *wrapper) {
+    uint32_t start = wrapper->pos;
+    if (start >= wrapper->no_shortcode_start && start < wrapper->no_shortcode_end) {
+        return ERROR;
+    }
+    uint8_t braces = 0;
+    while (lex_lookahead(wrapper) == '{' && braces < 4) {
+        lex_advance(wrapper, false);
+        braces++;
+    }
+    if ((braces != 2 && braces != 3) || lex_lookahead(wrapper) != '<') {
+        return ERROR;
+    }
+    lex_advance(wrapper, false);
+    enum TokenType token = lex_shortcode_component(wrapper, braces, false);
+    while (token == SHORTCODE_ARGUMENT) {
+        token = lex_shortcode_component(wrapper, braces, false);
+        if (token == SHORTCODE_END) {
+            return braces == 3 ? SHORTCODE_ESCAPED : SHORTCODE_START;
+        }
+    }
+    int32_t lookahead = lex_lookahead(wrapper);
+    if (lookahead == '\n' || lookahead == '\0') {
+        uint32_t from = wrapper->pos;
+        while (from > start + 2) {
+            int32_t *close = &wrapper->buffer.contents[from - 3];
+            if (close[0] == '>' && close[1] == '}' && close[2] == '}') {
+                break;
+            }
+            from--;
+        }
+        wrapper->no_shortcode_start = from > start + 2 ? from - 2 : start;
+        wrapper->no_shortcode_end = wrapper->pos;
+    }
+    return ERROR;
+}
+
+// prototypes:
+
+static ParseResult parse_inline(LexWrap *wrapper, ParseResultArray* stack);
+static ParseResult parse_star(LexWrap *wrapper, ParseResultArray* stack);
+static ParseResult parse_under(LexWrap *wrapper, ParseResultArray* stack);
+static ParseResult parse_bracket(LexWrap *wrapper, ParseResultArray* stack, Pos start, enum ParseToken token);
+static ParseResult parse_bracket_close(LexWrap *wrapper, ParseResultArray* stack);
+
+static ParseResult parse_inline(LexWrap *wrapper, ParseResultArray* stack) {
+    // fprintf(stderr, "calling parse_inline()\n");
+    // uint32_t stack_start_size = stack->size;
+    uint32_t buffer_start_pos = wrapper->pos;
+    ParseResult res = new_parse_result();
+    res.range.start = wrapper->curr_pos;
+    int32_t lookahead = lex_lookahead(wrapper);
+    switch (lookahead) {
+        case '*': {
+            res = parse_star(wrapper, stack);
+            break;
+        }
+
+        case '_': {
+            res = parse_under(wrapper, stack);
+            break;
+        }
+
+        case '[': {
+            res = parse_bracket(wrapper, stack, res.range.start, LINK);
+            break;
+        }
+
+        case '!': {
+            lex_advance(wrapper, false);
+            if (lex_lookahead(wrapper) == '[') {
+                res = parse_bracket(wrapper, stack, res.range.start, IMAGE);
+            } else {
+                res.success = true;
+            }
+            break;
+        }
+
+        case ']': {
+            res = parse_bracket_close(wrapper, stack);
+            break;
+        }
+
+        case '@': {
+            // only a key at the start of a word is a citation, so
+            // email addresses stay text
+            Pos key = wrapper->curr_pos;
+            int32_t last_char = wrapper->pos > 0 ? wrapper->buffer.contents[wrapper->pos - 1] : ' ';
+            lex_advance(wrapper, false);
+            enum TokenType token = is_citation_char(last_char) ? ERROR : lex_citation_key(wrapper, false);
+            if (token != ERROR) {
+                keys_insert(wrapper->keys, key);
+            } else {
+                lex_set_position(wrapper, buffer_start_pos + 1);
+            }
+            res.success = true;
+            break;
+        }
+
+        case '$': {
+            // math is opaque, its '_' and '*' are never emphasis
+            if (lex_math(wrapper) == ERROR) {
+                lex_set_position(wrapper, buffer_start_pos);
+                lex_advance(wrapper, false);
+            }
+            res.success = true;
+            break;
+        }
+
+        case '{': {
+            // shortcodes and attribute values are opaque, skip the
+            // whole block
+            enum TokenType token = lex_shortcode(wrapper);
+            if (token != ERROR) {
+                ParseResult shortcode = new_parse_result();
+                shortcode.success = true;
+                shortcode.token = token == SHORTCODE_START ? SHORTCODE : SHORTCODE_LITERAL;
+                shortcode.range = new_range(res.range.start, wrapper->curr_pos);
+                shortcode.length = wrapper->pos - buffer_start_pos;
+                stack_insert(stack, shortcode);
+            } else {
+                lex_set_position(wrapper, buffer_start_pos);
+                if (!lex_attribute_block(wrapper)) {
+                    lex_set_position(wrapper, buffer_start_pos);
+                    lex_advance(wrapper, false);
+                }
+            }
+            res.success = true;
+            break;
+        }
+
+        default: {
+            // syntax without a parser yet is plain text. It must still be
+            // consumed, otherwise the calling loops never move forward.
+            lex_advance(wrapper, false);
+            res.success = true;
+        }
+
+    }
+    if (res.success && res.token == NONE) {
+        res.range.end = wrapper->curr_pos;
+        res.token = DO_NOT_PARSE;
+        res.length = wrapper->pos - buffer_start_pos;
+    }
+    if (!res.success) {
+
+        res.range.end = wrapper->curr_pos;
+        res.token = DO_NOT_PARSE;
+        res.length = wrapper->pos - buffer_start_pos;
+    }
+    // fprintf(stderr, "inline parse results: ");
+    print_parse_result(&res);
+    return res;
+}
+
+/// takes a result object, and inserts appropriate DO_NOT_PARSE
+/// tokens into the stack. optionally, it will delete the result
+/// if the element exists in the stack
+static size_t dont_parse_result(ParseResult *result, ParseResultArray *array, bool remove) {
+    switch (result->token) {
+        case EMPHASIS_STAR:
+        case EMPHASIS_UNDER: {
+            ParseResult emph_start = new_parse_result();
+            emph_start.token = DO_NOT_PARSE;
+            emph_start.range.start = result->range.start;
+            ParseResult emph_end = new_parse_result();
+            emph_end.token = DO_NOT_PARSE;
+            emph_end.range.end = result->range.end;
+            emph_start.range.end = emph_start.range.start;
+            emph_start.length = 1;
+            emph_start.range.end.col += 1;
+            emph_end.range.start = emph_end.range.end;
+            emph_end.range.start.col -= 1;
+            emph_end.length = 1;
+            stack_insert(array, emph_start);
+            stack_insert(array, emph_end);
+            break;
+        }
+        case STRONG_STAR:
+        case STRONG_UNDER: {
+            ParseResult strong_start = new_parse_result();
+            strong_start.token = DO_NOT_PARSE;
+            strong_start.range.start = result->range.start;
+            ParseResult strong_end = new_parse_result();
+            strong_end.token = DO_NOT_PARSE;
+            strong_end.range.end = result->range.end;
+            strong_start.range.end = strong_start.range.start;
+            strong_start.length = 2;
+            strong_start.range.end.col += 2;
+            strong_end.range.start = strong_end.range.end;
+            strong_end.range.start.col -= 2;
+            strong_end.length = 2;
+            stack_insert(array, strong_start);
+            stack_insert(array, strong_end);
+        }
+
+        default: {
+
+        }
+    }
+
+    if (remove) {
+        size_t index = stack_find_exact(array, result);
+        if (index < not_found) {
+            array_erase(array, index);
+            return index;
+        }
+    }
+
+
+    return not_found;
+}
+
+static void dont_parse_next_n(LexWrap *wrapper, ParseResultArray *stack, uint32_t n) {
+    if (n > 0) {
+        ParseResult result = new_parse_result();
+        result.range.start = wrapper->curr_pos;
+        for (uint32_t i = 0; i < n; i++) {
+            lex_advance(wrapper, false);
+        }
+        result.range.end = wrapper->curr_pos;
+        result.length = n;
+        result.success = true;
+        result.token = DO_NOT_PARSE;
+        stack_insert(stack, result);
+    }
+
+}
+
+/// called with the lexer on a '['. If the bracket closes and is followed
+/// by a link destination, a LINK (or IMAGE) result spanning the brackets
+/// is pushed to the stack, and a closed '[' followed by an attribute
+/// block makes a SPAN. Either way only the '[' is consumed, so the
+/// caller goes on to pre-parse the link text like any other text.
+///
+/// a closed '[' followed by neither, holding a citation key, is a
+/// CITATION_GROUP. Its prefixes and locators are opaque tokens, so the
+/// whole group is consumed.
+static ParseResult parse_bracket(LexWrap *wrapper, ParseResultArray* stack, Pos start, enum ParseToken token) {
+    ParseResult res = new_parse_result();
+    res.range.start = start;
+    uint32_t open = wrapper->pos;
+    uint32_t close = lex_find_bracket_close(wrapper);
+    if (close != max_unsized) {
+        lex_set_position(wrapper, close);
+        lex_advance(wrapper, false);
+        res.range.end = wrapper->curr_pos;
+        bool matched = false;
+        switch (lex_lookahead(wrapper)) {
+            case '(': {
+                matched = lex_link_destination(wrapper);
+                break;
+            }
+            case '{': {
+                if (token == LINK) {
+                    token = SPAN;
+                    matched = lex_attribute_block(wrapper);
+                }
+                break;
+            }
+            default: {
+                if (token == LINK) {
+                    token = CITATION_GROUP;
+                    lex_set_position(wrapper, open + 1);
+                    matched = lex_citation_group(wrapper, close);
+                }
+            }
+        }
+        if (matched) {
+            res.success = true;
+            res.token = token;
+            res.length = close + 1 - open;
+            if (stack_insert(stack, res) == not_found) {
+                res.success = false;
+            }
+        }
+        if (res.success && token == CITATION_GROUP) {
+            lex_set_position(wrapper, close + 1);
+            return res;
+        }
+        lex_set_position(wrapper, open);
+    }
+    lex_advance(wrapper, false);
+    if (!res.success) {
+        // a lone '[' is just text
+        res.success = true;
+        res.token = DO_NOT_PARSE;
+        res.range.end = wrapper->curr_pos;
+        res.length = 1;
+    }
+    return res;
+}
+
+/// called with the lexer on a ']'. When it closes a link, image or span
+/// found by `parse_bracket()` the destination and attributes are consumed
+/// as well, so that the '_' and '*' common in urls are never mistaken
+/// for emphasis.
+static ParseResult parse_bracket_close(LexWrap *wrapper, ParseResultArray* stack) {
+    ParseResult res = new_parse_result();
+    res.range.start = wrapper->curr_pos;
+    lex_advance(wrapper, false);
+    Pos end = wrapper->curr_pos;
+    if (stack_find(stack, &end, LINK, true) < not_found ||
+        stack_find(stack, &end, IMAGE, true) < not_found) {
+        lex_link_destination(wrapper);
+        lex_attribute_block(wrapper);
+    } else if (stack_find(stack, &end, SPAN, true) < not_found) {
+        lex_attribute_block(wrapper);
+    }
+    res.success = true;
+    res.token = DO_NOT_PARSE;
+    res.range.end = wrapper->curr_pos;
+    res.length = 1;
+    return res;
+}
+
+static ParseResult parse_star(LexWrap *wrapper, ParseResultArray* stack) {
+    // fprintf(stderr, "calling - parse_star()\n");
+    COUNT(star_calls, 1);
+    // uint32_t stack_start_size = stack->size;
+    uint32_t buffer_start_pos = wrapper->pos;
+    ParseResult res = new_parse_result();
+    res.range.start = wrapper->curr_pos;
+
+    /// for this parse to be valid one of
+    /// if we detect 1 --> expecting emphasis
+    /// if we detect 2 --> expecting strong
+    /// if we detect 3 --> expecting combo of emphasis or strong
+    ///                    with the possibility of either ending
+    ///                    early.
+    /// > 3 --> return false
+    uint8_t char_count = 0;
+    while (lex_lookahead(wrapper) == '*') {
+        lex_advance(wrapper, false);
+        char_count++;
+    }
+    switch (char_count) {
+        case 1: {
+            res.token = EMPHASIS_STAR;
+            break;
+        }
+        case 2: {
+            res.token = STRONG_STAR;
+            break;
+        }
+        default: {}
+    }
+    if (char_count > 3) {
+        // as a special feature, we insert this into
+        // the stack to signal that it should not match
+        // any symbols
+
+        res.success = true;
+        res.range.end = wrapper->curr_pos;
+        res.length = char_count;
+        res.token = DO_NOT_PARSE;
+        // wrapper->lexer->mark_end(wrapper->lexer);
+        // fprintf(stderr, "returning a NO_PARSE result:");
+        print_parse_result(&res);
+        // fprintf(stderr, "\n");
+        stack_insert(stack, res);
+        return res;
+    }
+    int32_t lookahead = lex_lookahead(wrapper);
+    if (is_whitespace(lookahead)) {
+        // cannot parse star as any type of valid
+        // emphasis or strong.
+        return res;
+    }
+    uint32_t last_lex_pos = 0;
+    uint8_t end_char_count = 0;
+    uint8_t new_line_count = 0;
+    while(lookahead != '\0' && char_count > 0) {
+        switch (lookahead) {
+            case '*': {
+                // see how many we can consume
+                end_char_count = 0;
+                while (lex_lookahead(wrapper) == '*') {
+                    lex_advance(wrapper, false);
+                    end_char_count++;
+                }
+                switch (char_count) {
+                    case 1: {
+                        // we only have one left to match...
+                        // no matter the size of end_char_count
+                        lex_backtrack_n(wrapper, end_char_count - 1);
+                        last_lex_pos = wrapper->pos;
+                        res.range.end = wrapper->curr_pos;
+                        res.token = EMPHASIS_STAR;
+
+                        switch (end_char_count) {
+                            case 2: {
+                                lex_backtrack_n(wrapper, 1);
+                                ParseResult attempt = parse_star(wrapper, stack);
+                                if (attempt.success) {
+                                    lookahead = lex_lookahead(wrapper);
+                                    continue;
+                                } else {
+                                    lex_set_position(wrapper, last_lex_pos - 1);
+                                    dont_parse_next_n(wrapper, stack, 2);
+                                }
+                                break;
+                            }
+                            default: {
+                                res.length = last_lex_pos - buffer_start_pos;
+                                res.success = true;
+                                break;
+                            }
+                        }
+
+                        goto return_res;
+                        break;
+                    }
+                    case 2: {
+                        last_lex_pos = wrapper->pos;
+                        res.token = STRONG_STAR;
+                        switch (end_char_count) {
+                            case 1: {
+                                lex_backtrack_n(wrapper, 1);
+                                ParseResult attempt = parse_star(wrapper, stack);
+                                if (attempt.success) {
+                                    lookahead = lex_lookahead(wrapper);
+                                    continue;
+                                } else {
+                                    lex_set_position(wrapper, last_lex_pos - 1);
+                                    dont_parse_next_n(wrapper, stack, 1);
+                                }
+                                break;
+                            }
+                            default: {
+                                // no matter how many match here. we have
+                                // reached our target.
+                                lex_backtrack_n(wrapper, end_char_count - 2);
+                                res.range.end = wrapper->curr_pos;
+                                res.success = true;
+                                res.length = wrapper->pos - buffer_start_pos;
+                                break;
+                            }
+                        }
+                        goto return_res;
+                        break;
+                    }
+                    case 3: {
+                        switch (end_char_count){
+                            case 1: {
+                                // inner syntax is an emph and outer is
+                                // likely a strong.
+                                // create new result to insert
+                                ParseResult inner = new_parse_result();
+                                inner.range.end = wrapper->curr_pos;
+                                inner.range.start = res.range.start;
+                                inner.range.start.col += 2;
+                                inner.success = true;
+                                inner.token = EMPHASIS_STAR;
+                                inner.length = wrapper->pos - buffer_start_pos - 2;
+                                if (stack_insert(stack, inner) < not_found) {
+                                    char_count--;
+                                }
+                                lookahead = lex_lookahead(wrapper);
+                                continue;
+                            }
+                            case 2: {
+                                // inner syntax is an strong and outer is
+                                // likely a emph.
+                                // create new result to insert
+                                ParseResult inner = new_parse_result();
+                                inner.range.end = wrapper->curr_pos;
+                                inner.range.start = res.range.start;
+                                inner.range.start.col += 1;
+                                inner.success = true;
+                                inner.token = STRONG_STAR;
+                                inner.length = wrapper->pos - buffer_start_pos - 1;
+                                if (stack_insert(stack, inner) < not_found) {
+                                    char_count -= 2;
+                                }
+                                lookahead = lex_lookahead(wrapper);
+                                continue;
+                            }
+                            default: {
+                                // no matter how many times we detected
+                                // a '*'
+                                // we have matched our stack!
+                                lex_backtrack_n(wrapper, end_char_count - 3);
+                                res.range.end = wrapper->curr_pos;
+                                res.success = true;
+                                res.token = STRONG_STAR;
+                                res.length = wrapper->pos - buffer_start_pos;
+                                // inner will be an emphasis
+                                ParseResult inner = new_parse_result();
+                                inner.range.end = wrapper->curr_pos;
+                                inner.range.end.col -= 2;
+                                inner.range.start = res.range.start;
+                                inner.range.start.col += 2;
+                                inner.success = true;
+                                inner.token = EMPHASIS_STAR;
+                                inner.length = wrapper->pos - buffer_start_pos - 2;
+                                size_t index = stack_insert(stack, inner);
+                                if (index == not_found) {
+                                    res.success = false;
+                                }
+                                break;
+                            }
+                        }
+                        goto return_res;
+                        break;
+                    }
+                }
+                break;
+            }
+            case '\n': {
+                new_line_count++;
+                if (new_line_count > 1) {
+                    return res;
+                }
+                break;
+            }
+            case '\\': {
+                // treat next character as literal - do not
+                // parse it
+                lex_advance(wrapper, false);
+                break;
+            }
+            default: {
+                // check if inline symbol
+                new_line_count = 0;
+                if (is_inline_synatx(lookahead)) {
+                    ParseResult attempt = parse_inline(wrapper, stack);
+                    if (!attempt.success) {
+                        return res;
+                    }
+                    lookahead = lex_lookahead(wrapper);
+                    continue;
+                }
+            }
+                break;
+        }
+        lex_advance(wrapper, false);
+        lookahead = lex_lookahead(wrapper);
+    }
+
+    goto return_res;
+    return_res: {
+
+        if (res.success) {
+            stack_insert(stack, res);
+        } else {
+            // fprintf(stderr, "failed parsing: ");
+            print_parse_result(&res);
+            // we do not know if result ranges are correct...
+            ParseResult start = new_parse_result();
+            start.token = DO_NOT_PARSE;
+            start.range.start = res.range.start;
+            start.range.end = res.range.start;
+            start.success = true;
+            switch (res.token) {
+                case EMPHASIS_STAR: {
+                    start.range.end.col++;
+                    start.length = 1;
+                    break;
+                }
+                case STRONG_STAR: {
+                    start.range.end.col += 2;
+                    start.length = 2;
+                    break;
+                }
+                default: {}
+            }
+            if (start.length > 0) {
+                stack_insert(stack, start);
+            }
+        }
+        // fprintf(stderr, "parser is at position: ");
+        debug_pos(&wrapper->curr_pos);
+        // fprintf(stderr, "\n");
+        return res;
+    }
+
+}
+
+static ParseResult parse_under(LexWrap *wrapper, ParseResultArray* stack) {
+    // fprintf(stderr, "calling - parse_under()\n");
+    COUNT(under_calls, 1);
+    // uint32_t stack_start_size = stack->size;
+    uint32_t buffer_start_pos = wrapper->pos;
+    uint32_t last_lex_pos = wrapper->pos;
+    ParseResult res = new_parse_result();
+    res.range.start = wrapper->curr_pos;
+
+    /// for this parse to be valid one of
+    /// if we detect 1 --> expecting emphasis
+    /// if we detect 2 --> expecting strong
+    /// if we detect 3 --> expecting combo of emphasis or strong
+    ///                    with the possibility of either ending
+    ///                    early.
+    /// > 3 --> return false
+    uint8_t char_count = 0;
+    while (lex_lookahead(wrapper) == '_') {
+        lex_advance(wrapper, false);
+        char_count++;
+    }
+    switch (char_count) {
+        case 1: {
+            res.token = EMPHASIS_UNDER;
+            break;
+        }
+        case 2: {
+            res.token = STRONG_UNDER;
+            break;
+        }
+        default: {}
+    }
+    if (char_count > 3) {
+        // as a special feature, we insert this into
+        // the stack to signal that it should not match
+        // any symbols
+
+        res.success = true;
+        res.range.end = wrapper->curr_pos;
+        res.length = char_count;
+        // wrapper->lexer->mark_end(wrapper->lexer);
+        // fprintf(stderr, "returning a NONE result:");
+        print_parse_result(&res);
+        // fprintf(stderr, "\n");
+        stack_insert(stack, res);
+        return res;
+    }
+    int32_t lookahead = lex_lookahead(wrapper);
+    if (is_whitespace(lookahead)) {
+        // cannot parse star as any type of valid
+        // emphasis or strong.
+        return res;
+    }
+    uint32_t last_char = ' ';
+    uint8_t end_char_count = 0;
+    uint8_t new_line_count = 0;
+    while(lookahead != '\0' && char_count > 0) {
+        // fprintf(stderr, "lookahead - %c\n", lookahead);
+        switch (lookahead) {
+            case '_': {
+                // see how many we can consume
+                end_char_count = 0;
+                while (lex_lookahead(wrapper) == '_') {
+                    lex_advance(wrapper, false);
+                    end_char_count++;
+                }
+                int32_t next_char = lex_lookahead(wrapper);
+                switch (char_count) {
+                    case 1: {
+                        // we only have one left to match...
+                        // no matter the size of end_char_count
+                        lex_backtrack_n(wrapper, end_char_count - 1);
+                        last_lex_pos = wrapper->pos;
+                        res.range.end = wrapper->curr_pos;
+                        res.token = EMPHASIS_UNDER;
+                        res.length = wrapper->pos - buffer_start_pos;
+                        // we do not know if it is valid yet...
+
+                        switch (end_char_count) {
+                            case 1: {
+                                // do we need to check that the next character
+                                // is syntax???
+                                if (!isalpha(next_char)) {
+                                    // if the next character is NOT alphabet
+                                    // then we can complete this case
+                                    res.success = true;
+                                } else if (!isalpha(last_char)) {
+                                    // we know the next character IS alphabet,
+                                    // which automatically invalidates the current
+                                    // scope
+                                    // do not modify beginning, leave that for the return_res section
+                                    // however if the last character is NOT alphabet
+                                    // then it is possible to parse the next _.
+                                    lex_backtrack_n(wrapper, 1);
+                                    ParseResult attempt = parse_under(wrapper, stack);
+                                    if (!attempt.success) {
+                                        lex_set_position(wrapper, last_lex_pos);
+                                    }
+                                } else {
+                                    // special case where we treat it as literal
+                                    lex_backtrack_n(wrapper, 1);
+                                    dont_parse_next_n(wrapper, stack, 1);
+                                    last_char = '_';
+                                    lookahead = next_char;
+                                    continue;
+                                }
+
+                                break;
+
+                            }
+                            case 2: {
+                                // interestingly, if we can parse this
+                                // token, it takes precendence
+                                lex_backtrack_n(wrapper, 1);
+                                Pos pos = wrapper->curr_pos;
+                                // fprintf(stderr, "about to call parse_under: ");
+                                debug_pos(&pos);
+                                // fprintf(stderr, "\n");
+                                ParseResult attempt = parse_under(wrapper, stack);
+                                // fprintf(stderr, "returned with: ");
+                                print_parse_result(&attempt);
+                                // fprintf(stderr, " and at position: ");
+                                pos = wrapper->curr_pos;
+                                debug_pos(&pos);
+                                // fprintf(stderr, "\n");
+                                if (!attempt.success) {
+                                    lex_set_position(wrapper, last_lex_pos + 1);
+                                    break;
+                                }
+
+                                // if it was successful, our lexer should be at the end
+                                // of the lexed token.
+                                Pos last_pos = wrapper->curr_pos;
+                                print_pos(&last_pos);
+                                size_t index = stack_find(stack, &last_pos, DO_NOT_PARSE, true);
+                                print_stack(stack);
+                                if (index < not_found) {
+                                    // fprintf(stderr, "index at %zu\n", index);
+                                    array_erase(stack, index);
+                                    last_pos = wrapper->curr_pos;
+                                    print_pos(&last_pos);
+                                    lex_backtrack_n(wrapper, 1);
+                                }
+                                // if it was successful, there is a chance to
+                                // finish this parse.
+                                last_char = '_';
+                                lookahead = lex_lookahead(wrapper);
+                                continue;
+                            }
+                            case 3: {
+                                if (!isalpha(next_char)) {
+                                    res.success = true;
+                                    dont_parse_next_n(wrapper, stack, 1);
+                                } else {
+                                    lex_backtrack_n(wrapper, 1);
+                                    // dont_parse_result(&res, stack, false);
+                                    dont_parse_next_n(wrapper, stack, 2);
+                                }
+                                break;
+                            }
+                            default: {
+                                res.success = true;
+                                Pos pos = wrapper->curr_pos;
+                                print_pos(&pos);
+                                dont_parse_next_n(wrapper, stack, 1);
+                                print_stack(stack);
+                                break;
+                            }
+                        }
+                        // fprintf(stderr, "returning from case 1: ");
+                        goto return_res;
+                        break;
+                    }
+                    case 2: {
+                        // we do not know if it is valid yet...
+                        res.token = STRONG_UNDER;
+                        switch (end_char_count) {
+                            case 1: {
+                                // a single token cannot satisfy this condition
+                                // this is either parsible
+                                // or ignore this token
+                                // or invalidates the entire thing
+                                lex_backtrack_n(wrapper, 1);
+                                last_lex_pos = wrapper->pos;
+                                res.range.end = wrapper->curr_pos;
+                                res.length = last_lex_pos - buffer_start_pos;
+
+                                if (!isalpha(last_char) && isalpha(next_char)) {
+
+                                    ParseResult attempt = parse_under(wrapper, stack);
+                                    if (!attempt.success) {
+                                        lex_set_position(wrapper, last_lex_pos + 1);
+                                        break;
+                                    }
+                                    // check if last position was ignored
+                                    Pos last_pos = wrapper->curr_pos;
+                                    print_pos(&last_pos);
+                                    size_t index = stack_find(stack, &last_pos, DO_NOT_PARSE, true);
+                                    print_stack(stack);
+                                    if (index < not_found) {
+                                        // fprintf(stderr, "index at %zu\n", index);
+                                        array_erase(stack, index);
+                                        last_pos = wrapper->curr_pos;
+                                        print_pos(&last_pos);
+                                        lex_backtrack_n(wrapper, 1);
+                                    }
+                                    lookahead = lex_lookahead(wrapper);
+
+                                } else {
+                                    // if we cannot parse it, we skip it
+                                    dont_parse_next_n(wrapper, stack, 1);
+                                    lookahead = next_char;
+                                }
+                                continue;
+                            }
+                            case 2:  {
+                                last_lex_pos = wrapper->pos;
+                                res.length = last_lex_pos - buffer_start_pos;
+                                res.range.end = wrapper->curr_pos;
+                                // do we need to check that the next character
+                                // is syntax???
+                                if (!isalpha(next_char)) {
+                                    // if the next character is NOT alphabet
+                                    // then we can complete this case
+                                    res.success = true;
+                                    break;
+                                } else if (!isalpha(last_char)) {
+                                    // we know the next character IS alphabet,
+                                    // which automatically invalidates the current
+                                    // scope
+                                    // however if the last character is NOT alphabet
+                                    // then it is possible to parse the next _.
+                                    lex_backtrack_n(wrapper, 2);
+                                    ParseResult attempt = parse_under(wrapper, stack);
+                                    if (!attempt.success) {
+                                        lex_set_position(wrapper, last_lex_pos);
+                                        // dont_parse_next_n(wrapper, stack, 2);
+                                    }
+                                }
+
+                                break;
+                            }
+                            default: {
+                                lex_backtrack_n(wrapper, end_char_count - 2);
+                                last_lex_pos = wrapper->pos;
+                                res.success = true;
+                                res.range.end = wrapper->curr_pos;
+                                res.length = last_lex_pos - buffer_start_pos;
+                                print_pos(&res.range.end);
+                                dont_parse_next_n(wrapper, stack, 1);
+                            }
+                        }
+                        // fprintf(stderr, "returning from case 2: ");
+                        goto return_res;
+                        break;
+                    }
+                    case 3: {
+                        switch (end_char_count){
+                            case 1: {
+                                last_lex_pos = wrapper->pos;
+                                // if the next character is not an alphabet
+                                // then we know that the inner set is an
+                                // emphasis.
+                                if (!isalpha(next_char)) {
+                                    ParseResult inner = new_parse_result();
+                                    inner.range.end = wrapper->curr_pos;
+                                    inner.range.start = res.range.start;
+                                    inner.range.start.col += 2;
+                                    inner.success = true;
+                                    inner.token = EMPHASIS_UNDER;
+                                    inner.length = last_lex_pos - buffer_start_pos - 2;
+                                    if (stack_insert(stack, inner) < not_found) {
+                                        res.token = STRONG_UNDER;
+                                        char_count--;
+                                    }
+                                    lookahead = next_char;
+                                } else if (!isalpha(last_char)) {
+                                    // we know the next character IS alphabet,
+                                    // unlike where we have 1 leading _,
+                                    // this may not be invalidated immediately
+                                    // however if the last character is NOT alphabet
+                                    // then it is possible to parse the next _.
+                                    lex_backtrack_n(wrapper, 1);
+                                    ParseResult res = parse_under(wrapper, stack);
+                                    if (!res.success) {
+                                        lex_set_position(wrapper, last_lex_pos);
+                                        // dont_parse_next_n(wrapper, stack, 1);
+                                    }
+                                    lookahead = lex_lookahead(wrapper);
+                                } else {
+                                    lookahead = next_char;
+                                }
+                                // at the end of this case the lexer should
+                                // be ready to continue
+                                last_char = '_';
+                                continue;
+                            }
+                            case 2: {
+                                // inner syntax is an strong and outer is
+                                // likely a emph.
+                                // create new result to insert
+                                if (!isalpha(next_char)) {
+                                    ParseResult inner = new_parse_result();
+                                    inner.range.end = wrapper->curr_pos;
+                                    inner.range.start = res.range.start;
+                                    inner.range.start.col += 1;
+                                    inner.success = true;
+                                    inner.token = STRONG_UNDER;
+                                    inner.length = wrapper->pos - buffer_start_pos - 1;
+                                    if (stack_insert(stack, inner) < not_found) {
+                                        res.token = EMPHASIS_UNDER;
+                                        char_count -= 2;
+                                    }
+                                } else {
+                                    // if the next character IS an alphabet,
+                                    // an odd thing occurs...
+                                    // the inner becomes an emphasis and the second
+                                    // _ is a literal.
+                                    lex_backtrack_n(wrapper, 1);
+                                    ParseResult inner = new_parse_result();
+                                    inner.range.end = wrapper->curr_pos;
+                                    inner.range.start = res.range.start;
+                                    inner.range.start.col += 2;
+                                    inner.success = true;
+                                    inner.token = EMPHASIS_UNDER;
+                                    inner.length = wrapper->pos - buffer_start_pos - 2;
+                                    if (stack_insert(stack, inner) < not_found) {
+                                        res.token = STRONG_UNDER;
+                                        char_count--;
+                                    }
+                                    dont_parse_next_n(wrapper, stack, 1);
+                                }
+                                lookahead = next_char;
+                                continue;
+                            }
+                            case 3: {
+                                if (!isalpha(next_char)) {
+                                    // complete match
+                                    lex_backtrack_n(wrapper, end_char_count - 3);
+                                    res.token = STRONG_UNDER;
+                                    res.success = true;
+                                    res.range.end = wrapper->curr_pos;
+                                    res.length = wrapper->pos - buffer_start_pos;
+                                    ParseResult inner = new_parse_result();
+                                    inner.range.end = wrapper->curr_pos;
+                                    inner.range.end.col -= 2;
+                                    inner.range.start = res.range.start;
+                                    inner.range.start.col += 2;
+                                    inner.success = true;
+                                    inner.token = EMPHASIS_UNDER;
+                                    inner.length = wrapper->pos - buffer_start_pos - 4;
+                                    size_t index = stack_insert(stack, inner);
+                                    if (index == not_found) {
+                                        res.success = false;
+                                    }
+                                } else {
+                                    ParseResult inner = new_parse_result();
+                                    lex_backtrack_n(wrapper, 1);
+                                    inner.range.end = wrapper->curr_pos;
+                                    inner.range.start = res.range.start;
+                                    inner.range.start.col++;
+                                    inner.success = true;
+                                    inner.token = STRONG_UNDER;
+                                    inner.length = wrapper->pos - buffer_start_pos - 1;
+                                    size_t index = stack_insert(stack, inner);
+                                    if (index == not_found) {
+                                        res.success = false;
+                                        return res;
+                                    }
+                                    dont_parse_next_n(wrapper, stack, 1);
+                                    lookahead = next_char;
+                                    char_count -= 2;
+                                    continue;
+                                }
+                                break;
+                            }
+                            default: {
+                                // no matter how many times we detected
+                                // a '_'
+
+                                lex_backtrack_n(wrapper, end_char_count - 3);
+                                last_lex_pos = wrapper->pos;
+                                res.token = STRONG_UNDER;
+                                res.success = true;
+                                res.range.end = wrapper->curr_pos;
+                                res.length = last_lex_pos - buffer_start_pos;
+                                ParseResult inner = new_parse_result();
+                                inner.range.end = wrapper->curr_pos;
+                                inner.range.end.col -= 2;
+                                inner.range.start = res.range.start;
+                                inner.range.start.col += 2;
+                                inner.success = true;
+                                inner.token = EMPHASIS_UNDER;
+                                inner.length = res.length - 4;
+                                size_t index = stack_insert(stack, inner);
+                                if (index == not_found) {
+                                    res.success = false;
+                                }
+                                dont_parse_next_n(wrapper, stack, 1);
+                                break;
+                            }
+                        }
+                        // fprintf(stderr, "returning from case 3:");
+                        goto return_res;
+                        break;
+                    }
+                }
+                break;
+            }
+            case '\n': {
+                new_line_count++;
+                if (new_line_count > 1) {
+                    // fprintf(stderr, "found too many '\\n' characters. returning...\n");
+                    goto return_res;
+                }
+                break;
+            }
+            case '\\': {
+                // treat next character as literal - do not
+                // parse it
+                lex_advance(wrapper, false);
+                break;
+            }
+            default: {
+                // check if inline symbol
+                new_line_count = 0;
+                if (is_inline_synatx(lookahead)) {
+                    ParseResult attempt = parse_inline(wrapper, stack);
+                    // should probabbly decide how to handle inline parse failures
+                    // maybe they should just be considered literal for this purpose
+                    // or maybe just ignored for later?
+                    if(!attempt.success) {
+                        // do something here?
+                    }
+                    lookahead = lex_lookahead(wrapper);
+                    continue;
+                }
+                break;
+            }
+        }
+        // fprintf(stderr, "made it to the end of the loop - last_char %c, lookahead %c \n", last_char, lookahead);
+        last_char = lookahead;
+        lex_advance(wrapper, false);
+        lookahead = lex_lookahead(wrapper);
+    }
+    // fprintf(stderr, "reached end of file\n");
+    goto return_res;
+    return_res: {
+
+        if (res.success) {
+            stack_insert(stack, res);
+        } else {
+            // fprintf(stderr, "failed parsing: ");
+            print_parse_result(&res);
+            // we do not know if result ranges are correct...
+            ParseResult start = new_parse_result();
+            start.token = DO_NOT_PARSE;
+            start.range.start = res.range.start;
+            start.range.end = res.range.start;
+            start.success = true;
+            switch (res.token) {
+                case EMPHASIS_UNDER: {
+                    start.range.end.col++;
+                    start.length = 1;
+                    break;
+                }
+                case STRONG_UNDER: {
+                    start.range.end.col += 2;
+                    start.length = 2;
+                    break;
+                }
+                default: {}
+            }
+            if (start.length > 0) {
+                stack_insert(stack, start);
+            }
+        }
+        // fprintf(stderr, "parser is at position: ");
+        debug_pos(&wrapper->curr_pos);
+        // fprintf(stderr, "\n");
+        return res;
+    }
+
+
+}
+
+
+
+typedef struct {
+  Pos pos;
+  Range no_closer; // region of the current paragraph without any ']'
+  Range no_destination; // and where no '(' opens a link destination
+  Range no_math[2]; // and where no '$' opens inline, then display math
+  ParseResultArray results; // State to track if we're inside an emphasis block
+  KeyArray keys; // citation keys ahead of `pos`
+  LexWrap lex; // scratch lexer, not serialized
+} ScannerState;
+
+static void print_scanner_state(const ScannerState *state) {
+    // fprintf(stderr, "ScannerState {\n  pos: ");
+    print_pos(&state->pos);
+    // fprintf(stderr, "\n  results (size: %u):\n", state->results.size);
+    for (uint32_t i = 0; i < state->results.size; i++) {
+        // fprintf(stderr, "\t");
+        print_parse_result(&state->results.contents[i]);
+    }
+    // fprintf(stderr, "}\n");
+}
+
+static void print_lexwrap(const LexWrap *wrap) {
+    // fprintf(stderr, "LexWrap {\n  init_pos: [%u, %u]\n  pos: %u\n", wrap->init_pos.row,
+        // wrap->init_pos.col, wrap->pos);
+    // fprintf(stderr, "  buffer (size: %u)\n", wrap->buffer.size);
+    // fprintf(stderr, " new_line_loc (size: %u): [", wrap->new_line_loc.size);
+    // for (uint32_t i = 0; i < wrap->new_line_loc.size; i++) {
+        // fprintf(stderr, "%u", wrap->new_line_loc.contents[i]);
+        // if (i + 1 < wrap->new_line_loc.size) fprintf(stderr, ", ");
+    // }
+    // fprintf(stderr, "]\n}\n");
+}
+
+
+void *tree_sitter_quarto_inline_external_scanner_create() {
+  ScannerState *state = (ScannerState *)malloc(sizeof(ScannerState));
+  state->pos = new_position(0, 0);
+  state->no_closer = new_range(new_position(0, 0), new_position(0, 0));
+  state->no_destination = state->no_closer;
+  state->no_math[0] = state->no_math[1] = state->no_closer;
+  array_init(&state->results); // Initialize the state
+  array_init(&state->keys);
+  state->lex = new_lexer(NULL, state->pos);
+  state->lex.keys = &state->keys;
+  return state;
+}
+
+void tree_sitter_quarto_inline_external_scanner_destroy(void *payload) {
+  ScannerState *state = (ScannerState *)payload;
+  array_delete(&state->results); // Free the heap memory used by the array
+  array_delete(&state->keys);
+  lex_delete(&state->lex);
+  free(payload); // Free the allocated state
+}
+
+// the largest serialized ParseResult: a token byte with the success bit,
+// then five varints
+#define MAX_RESULT_SIZE (1 + 5 * 5)
+// and citation key: two varints
+#define MAX_KEY_SIZE (2 * 5)
+
+static unsigned write_varint(char *buffer, unsigned offset, uint32_t value) {
+  while (value >= 0x80) {
+    buffer[offset++] = (char)(value | 0x80);
+    value >>= 7;
+  }
+  buffer[offset++] = (char)value;
+  return offset;
+}
+
+static bool read_varint(const char *buffer, unsigned length, unsigned *offset, uint32_t *value) {
+  *value = 0;
+  for (unsigned shift = 0; shift < 35 && *offset < length; shift += 7) {
+    uint8_t byte = (uint8_t)buffer[(*offset)++];
+    *value |= (uint32_t)(byte & 0x7f) << shift;
+    if (byte < 0x80) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/// a signed difference folded into an unsigned varint
+static uint32_t zigzag(uint32_t value, uint32_t base) {
+  int32_t delta = (int32_t)(value - base);
+  return ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31);
+}
+
+static uint32_t unzigzag(uint32_t value, uint32_t base) {
+  return base + ((value >> 1) ^ (0u - (value & 1)));
+}
+
+/// Each result is written relative to the one before it, so most take
+/// six bytes and a line with over a hundred of them still fits. Results
+/// that do not fit are dropped: '*' and '_' are pre-parsed again when
+/// the scanner reaches them, anything else is left as text. Citation
+/// keys come last, two bytes each, and are dropped the same way.
+unsigned tree_sitter_quarto_inline_external_scanner_serialize(void *payload, char *buffer) {
+  ScannerState *state = (ScannerState *)payload;
+  unsigned offset = 0;
+  // get the position
+  memcpy(buffer + offset, &state->pos.row, sizeof(uint32_t));
+  offset += sizeof(uint32_t);
+  memcpy(buffer + offset, &state->pos.col, sizeof(uint32_t));
+  offset += sizeof(uint32_t);
+  memcpy(buffer + offset, &state->no_closer, sizeof(Range));
+  offset += sizeof(Range);
+  memcpy(buffer + offset, &state->no_destination, sizeof(Range));
+  offset += sizeof(Range);
+  memcpy(buffer + offset, state->no_math, sizeof(state->no_math));
+  offset += sizeof(state->no_math);
+  // the results array size is filled in last
+  unsigned size_offset = offset;
+  offset += sizeof(uint32_t);
+
+  uint32_t count = 0;
+  Pos previous = state->pos;
+  for (; count < state->results.size; count++) {
+      if (offset + MAX_RESULT_SIZE + sizeof(uint32_t) > TREE_SITTER_SERIALIZATION_BUFFER_SIZE) {
+          break;
+      }
+      ParseResult *res = &state->results.contents[count];
+      Range *range = &res->range;
+      buffer[offset++] = (char)(res->token | (res->success ? 0x80 : 0));
+      offset = write_varint(buffer, offset, res->length);
+      offset = write_varint(buffer, offset, zigzag(range->start.row, previous.row));
+      offset = write_varint(buffer, offset, zigzag(range->start.col, previous.col));
+      offset = write_varint(buffer, offset, zigzag(range->end.row, range->start.row));
+      offset = write_varint(buffer, offset, zigzag(range->end.col, range->start.col));
+      previous = range->start;
+  }
+  memcpy(buffer + size_offset, &count, sizeof(uint32_t));
+
+  size_offset = offset;
+  offset += sizeof(uint32_t);
+  previous = state->pos;
+  for (count = 0; count < state->keys.size; count++) {
+      if (offset + MAX_KEY_SIZE > TREE_SITTER_SERIALIZATION_BUFFER_SIZE) {
+          break;
+      }
+      Pos *key = &state->keys.contents[count];
+      offset = write_varint(buffer, offset, zigzag(key->row, previous.row));
+      offset = write_varint(buffer, offset, zigzag(key->col, previous.col));
+      previous = *key;
+  }
+  memcpy(buffer + size_offset, &count, sizeof(uint32_t));
+  COUNT(serialized_bytes, offset);
+  COUNT_PEAK(peak_results, state->results.size);
+  return offset;
+}
+
+void tree_sitter_quarto_inline_external_scanner_deserialize(void *payload, const char *buffer, unsigned length) {
+    ScannerState *state = (ScannerState *)payload;
+    COUNT(deserialize_calls, 1);
+    state->pos = new_position(0, 0);
+    state->no_closer = new_range(new_position(0, 0), new_position(0, 0));
+    state->no_destination = state->no_closer;
+    state->no_math[0] = state->no_math[1] = state->no_closer;
+    array_clear(&state->results);
+    array_clear(&state->keys);
+    unsigned offset = 0;
+    if (length < 2 * sizeof(uint32_t) + 4 * sizeof(Range) + sizeof(uint32_t)) {
+        return;
+    }
+
+    memcpy(&state->pos.row, buffer + offset, sizeof(uint32_t));
+    offset += sizeof(uint32_t);
+    memcpy(&state->pos.col, buffer + offset, sizeof(uint32_t));
+    offset += sizeof(uint32_t);
+    memcpy(&state->no_closer, buffer + offset, sizeof(Range));
+    offset += sizeof(Range);
+    memcpy(&state->no_destination, buffer + offset, sizeof(Range));
+    offset += sizeof(Range);
+    memcpy(state->no_math, buffer + offset, sizeof(state->no_math));
+    offset += sizeof(state->no_math);
+
+    // Deserialize results array size
+    uint32_t arr_size = 0;
+    memcpy(&arr_size, buffer + offset, sizeof(uint32_t));
+    offset += sizeof(uint32_t);
+
+    Pos previous = state->pos;
+    for (uint32_t i = 0; i < arr_size && offset < length; i++) {
+      ParseResult res;
+      uint8_t token = (uint8_t)buffer[offset++];
+      res.token = (enum ParseToken)(token & 0x7f);
+      res.success = (token & 0x80) != 0;
+      Range *range = &res.range;
+      if (!read_varint(buffer, length, &offset, &res.length) ||
+          !read_varint(buffer, length, &offset, &range->start.row) ||
+          !read_varint(buffer, length, &offset, &range->start.col) ||
+          !read_varint(buffer, length, &offset, &range->end.row) ||
+          !read_varint(buffer, length, &offset, &range->end.col)) {
+        break;
+      }
+      range->start.row = unzigzag(range->start.row, previous.row);
+      range->start.col = unzigzag(range->start.col, previous.col);
+      range->end.row = unzigzag(range->end.row, range->start.row);
+      range->end.col = unzigzag(range->end.col, range->start.col);
+      previous = range->start;
+      array_push(&state->results, res);
+    }
+
+    if (offset + sizeof(uint32_t) > length) {
+        return;
+    }
+    memcpy(&arr_size, buffer + offset, sizeof(uint32_t));
+    offset += sizeof(uint32_t);
+    previous = state->pos;
+    for (uint32_t i = 0; i < arr_size && offset < length; i++) {
+      Pos key;
+      if (!read_varint(buffer, length, &offset, &key.row) ||
+          !read_varint(buffer, length, &offset, &key.col)) {
+        break;
+      }
+      key.row = unzigzag(key.row, previous.row);
+      key.col = unzigzag(key.col, previous.col);
+      previous = key;
+      array_push(&state->keys, key);
+    }
+}
+
+
+
+
+static int32_t other_emphasis(int32_t char_) {
+    if (char_=='*') {
+        return '_';
+    }
+    return '*';
+}
+
+static void print_valid_symbols(const bool *valid_symbols) {
+    // fprintf(stderr, "valid_symbols: [");
+    // fprintf(stderr, "LINE_START=%d, ", valid_symbols[LINE_START]);
+    // fprintf(stderr, "LINE_END=%d, ", valid_symbols[LINE_END]);
+    // fprintf(stderr, "EMPHASIS_STAR_START=%d, ", valid_symbols[EMPHASIS_STAR_START]);
+    // fprintf(stderr, "EMPHASIS_STAR_END=%d, ", valid_symbols[EMPHASIS_STAR_END]);
+    // fprintf(stderr, "EMPHASIS_UNDER_START=%d, ", valid_symbols[EMPHASIS_UNDER_START]);
+    // fprintf(stderr, "EMPHASIS_UNDER_END=%d, ", valid_symbols[EMPHASIS_UNDER_END]);
+    // fprintf(stderr, "STRONG_STAR_START=%d, ", valid_symbols[STRONG_STAR_START]);
+    // fprintf(stderr, "STRONG_STAR_END=%d, ", valid_symbols[STRONG_STAR_END]);
+    // fprintf(stderr, "STRONG_UNDER_START=%d, ", valid_symbols[STRONG_UNDER_START]);
+    // fprintf(stderr, "STRONG_UNDER_END=%d, ", valid_symbols[STRONG_UNDER_END]);
+    // fprintf(stderr, "NO_PARSE=%d, ", valid_symbols[NO_PARSE]);
+    // fprintf(stderr, "ERROR=%d", valid_symbols[ERROR]);
+    // fprintf(stderr, "]\n");
+}
+
+/// called after a new line is detected and the next symbol is not a new_line
+/// This will preparse the next line so that we can accurately identify end position
+/// marks when the lexer finially reaches that position.
+///
+/// This function should continue parsing  until it reaches a new line character.
+/// if some internal parse occurs in which we pass a new line, that is fine
+///
+static void parse_new_line(ScannerState *state, TSLexer *lexer) {
+    // fprintf(stderr, "- calling: parse_new_line()\n");
+    COUNT(new_line_calls, 1);
+    // the position of the state should ALWAYS be correct when this
+    // function is called.
+    LexWrap *wrapper = &state->lex;
+    lex_reset(wrapper, lexer, state->pos);
+    wrapper->no_closer = &state->no_closer;
+    wrapper->no_destination = &state->no_destination;
+    wrapper->no_math = state->no_math;
+    int32_t lookahead = lex_lookahead(wrapper);
+    // int8_t indent_size = 0;
+    Pos pos = new_position(0, 0);
+    while(lookahead == ' ' || lookahead == '\t') {
+        if (lookahead == ' ') {
+            // indent_size++;
+        } else {
+            // indent_size += 2;
+        }
+        lex_advance(wrapper, false);
+        lookahead = lex_lookahead(wrapper);
+    }
+    if (lookahead=='\n') {
+        return;
+    }
+    // decide what to do with the first symbol
+    // mostely for items that could expand into other syntatic elements
+    // i.e.
+    // - a list item could be a number of characters.
+    // - a block quote however is easy to identify
+    // - a table may require a bit more parsing
+    // - a div :::
+    // - some code block
+    // - a line block
+    switch (lookahead) {
+        case '*': {
+            // this could be a list item, or
+            // just inline syntax
+        }
+        default: {
+
+        }
+    }
+    while(lookahead != '\0') {
+        switch (lookahead) {
+            case '\n': {
+                // fprintf(stderr, "new-line is next... ending parse_new_line()\n");
+                return;
+            }
+            case '\\': {
+                lex_advance(wrapper, false);
+                if (lex_lookahead(wrapper) == '\n') {
+                    return;
+                }
+                break;
+            }
+            default: {
+
+                if (is_inline_synatx(lookahead)) {
+                    // fprintf(stderr, "about to parse inline: ");
+                    debug_pos(&wrapper->curr_pos);
+                    // fprintf(stderr, "\n");
+                    ParseResult attempt = parse_inline(wrapper, &state->results);
+                    if (attempt.success) {
+                        lex_backtrack_n(wrapper, 1);
+                    }
+                }
+            }
+        }
+        lex_advance(wrapper, false);
+        pos = wrapper->curr_pos;
+        size_t index = stack_find(&state->results, &pos, DO_NOT_PARSE, false);
+        if (index < not_found) {
+            ParseResult *no_parse = &state->results.contents[index];
+            for (uint32_t i = 0; i < no_parse->length; i++) {
+                lex_advance(wrapper, false);
+            }
+        }
+        lookahead = lex_lookahead(wrapper);
+
+
+    }
+
+
+}
+
+bool tree_sitter_quarto_inline_external_scanner_scan(void *payload, TSLexer *lexer, const bool *valid_symbols) {
+
+
+  ScannerState *state = (ScannerState *)payload;
+  COUNT(scan_calls, 1);
+  print_scanner_state(state);
+  // fprintf(stderr, "scanner invoked before: %c - is alpha: %i\n",
+      // lexer->lookahead, isalnum((int)lexer->lookahead));
+  print_valid_symbols(valid_symbols);
+  if (valid_symbols[ERROR]) {
+      // fprintf(stderr, "ERROR is a valid symbol. do not handle\n");
+      // lexer->mark_end(lexer);
+      // lexer->result_symbol = ERROR;
+      return false;
+  }
+
+
+  if (valid_symbols[LINE_START] && state->pos.col == 0 &&
+      lexer->lookahead != '\n' && lexer->lookahead != '\0') {
+      // fprintf(stderr, "possible line start\n");
+      // the range handed to this parser need not start a line of the
+      // document, so take the column from the lexer
+      state->pos.col = lexer->get_column(lexer);
+      lexer->mark_end(lexer);
+      lexer->result_symbol = LINE_START;
+      parse_new_line(state, lexer);
+      COUNT_PEAK(peak_results, state->results.size);
+      return true;
+  }
+
+  // Skip whitespace
+  bool skipped_whitespace = false;
+  while (lexer->lookahead == ' ' || lexer->lookahead == '\t') {
+    skipped_whitespace = true;
+    lexer->advance(lexer, true);
+  }
+
+  // fprintf(stderr, "scanner invoked... next char %c\n", lexer->lookahead);
+  // Detect a newline
+  if (lexer->lookahead == '\n' && valid_symbols[LINE_END]) {
+    state->pos.row++;
+    state->pos.col = 0;
+    lexer->advance(lexer, false); // Consume the newline
+    lexer->result_symbol = LINE_END; // Emit the LINE_END token
+    lexer->mark_end(lexer);
+    return true;
+  }
+
+  // handle NO_PARSE -
+  // this symbol can occur anywhere, and if it
+  // appears it means that this section was already
+  // pre-parsed and willl show up literally.
+  if (valid_symbols[NO_PARSE]) {
+      state->pos.col = lexer->get_column(lexer);
+      size_t index = stack_find(&state->results, &state->pos, DO_NOT_PARSE, false);
+      if (index < not_found) {
+          ParseResult *res = &state->results.contents[index];
+          for (uint32_t i = 0; i < res->length; i++) {
+              lexer->advance(lexer, false);
+          }
+          lexer->mark_end(lexer);
+          lexer->result_symbol = NO_PARSE;
+          array_erase(&state->results, index);
+          return true;
+      }
+
+  } else {
+      // just check if this is something we should skip
+      state->pos.col = lexer->get_column(lexer);
+      size_t index = stack_find(&state->results, &state->pos, DO_NOT_PARSE, false);
+      if (index < not_found) {
+          // ParseResult *res = &state->results.contents[index];
+          return false;
+      }
+  }
+
+  // detect links and images. The brackets were already matched
+  // during the pre-parse, so only the stack needs consulting.
+  if (lexer->lookahead == '[' && (valid_symbols[LINK_START] || valid_symbols[SPAN_START])) {
+      state->pos.col = lexer->get_column(lexer);
+      if (valid_symbols[LINK_START] &&
+          stack_find(&state->results, &state->pos, LINK, false) < not_found) {
+          lexer->advance(lexer, false);
+          lexer->mark_end(lexer);
+          lexer->result_symbol = LINK_START;
+          return true;
+      }
+      if (valid_symbols[SPAN_START] &&
+          stack_find(&state->results, &state->pos, SPAN, false) < not_found) {
+          lexer->advance(lexer, false);
+          lexer->mark_end(lexer);
+          lexer->result_symbol = SPAN_START;
+          return true;
+      }
+      if (valid_symbols[CITATION_GROUP_START] &&
+          stack_find(&state->results, &state->pos, CITATION_GROUP, false) < not_found) {
+          lexer->advance(lexer, false);
+          lexer->mark_end(lexer);
+          lexer->result_symbol = CITATION_GROUP_START;
+          return true;
+      }
+  }
+
+  if (lexer->lookahead == '!' && valid_symbols[IMAGE_START]) {
+      state->pos.col = lexer->get_column(lexer);
+      size_t index = stack_find(&state->results, &state->pos, IMAGE, false);
+      if (index < not_found) {
+          lexer->advance(lexer, false);
+          lexer->advance(lexer, false);
+          lexer->mark_end(lexer);
+          lexer->result_symbol = IMAGE_START;
+          return true;
+      }
+  }
+
+  if (lexer->lookahead == ']' && valid_symbols[LINK_END]) {
+      Pos possible_pos = new_position(state->pos.row, lexer->get_column(lexer) + 1);
+      size_t index = stack_find(&state->results, &possible_pos, LINK, true);
+      if (index == not_found) {
+          index = stack_find(&state->results, &possible_pos, IMAGE, true);
+      }
+      if (index == not_found) {
+          index = stack_find(&state->results, &possible_pos, SPAN, true);
+      }
+      if (index == not_found) {
+          index = stack_find(&state->results, &possible_pos, CITATION_GROUP, true);
+      }
+      if (index < not_found) {
+          lexer->advance(lexer, false);
+          lexer->mark_end(lexer);
+          lexer->result_symbol = LINK_END;
+          array_erase(&state->results, index);
+          return true;
+      }
+  }
+
+  if (lexer->lookahead == '(' && valid_symbols[LINK_DESTINATION]) {
+      state->pos.col = lexer->get_column(lexer);
+      LexWrap *wrapper = &state->lex;
+      lex_reset(wrapper, lexer, state->pos);
+      wrapper->no_destination = &state->no_destination;
+      if (lex_link_destination(wrapper)) {
+          state->pos.row = wrapper->curr_pos.row;
+          lexer->mark_end(lexer);
+          lexer->result_symbol = LINK_DESTINATION;
+          return true;
+      }
+      return false;
+  }
+
+  if (lexer->lookahead == '$' && (valid_symbols[INLINE_MATH] || valid_symbols[DISPLAY_MATH])) {
+      state->pos.col = lexer->get_column(lexer);
+      LexWrap *wrapper = &state->lex;
+      lex_reset(wrapper, lexer, state->pos);
+      wrapper->no_math = state->no_math;
+      enum TokenType token = lex_math(wrapper);
+      if (token != ERROR && valid_symbols[token]) {
+          // display math may span lines
+          state->pos.row = wrapper->curr_pos.row;
+          lexer->mark_end(lexer);
+          lexer->result_symbol = token;
+          return true;
+      }
+      return false;
+  }
+
+  // citations. Within a group, CITATION_PREFIX is valid at the start of
+  // every item and keys are lexed directly; past a prefix only a key may
+  // follow, so text is not valid there. In running text a key is only
+  // emitted where the pre-parse found one at the start of a word.
+  if (valid_symbols[CITATION] || valid_symbols[CROSS_REFERENCE]) {
+      bool in_group = valid_symbols[CITATION_PREFIX] || !valid_symbols[TEXT];
+      if (lexer->lookahead == '@' || (in_group && lexer->lookahead == '-')) {
+          state->pos.col = lexer->get_column(lexer);
+          size_t index = not_found;
+          if (!in_group) {
+              index = keys_find(&state->keys, &state->pos);
+              if (index == not_found) {
+                  return false;
+              }
+          }
+          LexWrap *wrapper = &state->lex;
+          lex_reset(wrapper, lexer, state->pos);
+          if (lex_lookahead(wrapper) == '-') {
+              lex_advance(wrapper, false);
+          }
+          if (lex_lookahead(wrapper) == '@') {
+              lex_advance(wrapper, false);
+              enum TokenType token = lex_citation_key(wrapper, true);
+              if (token != ERROR && valid_symbols[token]) {
+                  if (index < not_found) {
+                      // along with any key passed over
+                      array_splice(&state->keys, 0, index + 1, 0, NULL);
+                  }
+                  lexer->result_symbol = token;
+                  return true;
+              }
+          }
+          return false;
+      }
+      if (valid_symbols[CITATION_PREFIX]) {
+          if (scan_citation_prefix(lexer)) {
+              lexer->result_symbol = CITATION_PREFIX;
+              return true;
+          }
+          return false;
+      }
+  }
+
+  if (valid_symbols[CITATION_LOCATOR] && lexer->lookahead != ']' && lexer->lookahead != ';') {
+      if (scan_citation_locator(lexer)) {
+          lexer->result_symbol = CITATION_LOCATOR;
+          return true;
+      }
+      return false;
+  }
+
+  // shortcodes were validated during the pre-parse, only the stack
+  // needs consulting. The escaped form is a single opaque token.
+  if (lexer->lookahead == '{' &&
+      (valid_symbols[SHORTCODE_START] || valid_symbols[SHORTCODE_ESCAPED])) {
+      state->pos.col = lexer->get_column(lexer);
+      size_t index = stack_find(&state->results, &state->pos, SHORTCODE, false);
+      if (index < not_found && valid_symbols[SHORTCODE_START]) {
+          for (uint8_t i = 0; i < 3; i++) {
+              lexer->advance(lexer, false);
+          }
+          lexer->mark_end(lexer);
+          array_erase(&state->results, index);
+          lexer->result_symbol = SHORTCODE_START;
+          return true;
+      }
+      index = stack_find(&state->results, &state->pos, SHORTCODE_LITERAL, false);
+      if (index < not_found && valid_symbols[SHORTCODE_ESCAPED]) {
+          ParseResult *res = &state->results.contents[index];
+          for (uint32_t i = 0; i < res->length; i++) {
+              lexer->advance(lexer, false);
+          }
+          lexer->mark_end(lexer);
+          array_erase(&state->results, index);
+          lexer->result_symbol = SHORTCODE_ESCAPED;
+          return true;
+      }
+  }
+
+  if (valid_symbols[SHORTCODE_NAME] || valid_symbols[SHORTCODE_ARGUMENT] ||
+      valid_symbols[SHORTCODE_END]) {
+      state->pos.col = lexer->get_column(lexer);
+      LexWrap *wrapper = &state->lex;
+      lex_reset(wrapper, lexer, state->pos);
+      enum TokenType token = lex_shortcode_component(wrapper, 2, true);
+      if (token == SHORTCODE_ARGUMENT && valid_symbols[SHORTCODE_NAME]) {
+          token = SHORTCODE_NAME;
+      }
+      if (token != ERROR && valid_symbols[token]) {
+          if (token == SHORTCODE_END) {
+              lexer->mark_end(lexer);
+          }
+          lexer->result_symbol = token;
+          return true;
+      }
+      return false;
+  }
+
+  // attribute blocks. Only the '{' is emitted once the whole block is
+  // known to be valid, the pieces follow as separate tokens. A block
+  // closing the whole range, as a heading's does, is only taken when
+  // nothing but whitespace follows it.
+  if (lexer->lookahead == '{' &&
+      (valid_symbols[ATTRIBUTE_START] || valid_symbols[TRAILING_ATTRIBUTE_START])) {
+      state->pos.col = lexer->get_column(lexer);
+      LexWrap *wrapper = &state->lex;
+      lex_reset(wrapper, lexer, state->pos);
+      lex_advance(wrapper, false);
+      lexer->mark_end(lexer);
+      lex_backtrack_n(wrapper, 1);
+      if (!lex_attribute_block(wrapper)) {
+          return false;
+      }
+      if (valid_symbols[ATTRIBUTE_START]) {
+          lexer->result_symbol = ATTRIBUTE_START;
+          return true;
+      }
+      while (is_whitespace(lex_lookahead(wrapper)) || lex_lookahead(wrapper) == '\r') {
+          lex_advance(wrapper, false);
+      }
+      if (lex_lookahead(wrapper) == '\0' && lexer->eof(lexer)) {
+          lexer->result_symbol = TRAILING_ATTRIBUTE_START;
+          return true;
+      }
+      return false;
+  }
+
+  if (valid_symbols[ATTRIBUTE_ID] || valid_symbols[ATTRIBUTE_CLASS] ||
+      valid_symbols[ATTRIBUTE_KEY] || valid_symbols[ATTRIBUTE_VALUE] ||
+      valid_symbols[ATTRIBUTE_END]) {
+      state->pos.col = lexer->get_column(lexer);
+      LexWrap *wrapper = &state->lex;
+      lex_reset(wrapper, lexer, state->pos);
+      enum TokenType token = lex_attribute_component(wrapper, valid_symbols[ATTRIBUTE_VALUE], true);
+      if (token != ERROR && valid_symbols[token]) {
+          lexer->mark_end(lexer);
+          lexer->result_symbol = token;
+          return true;
+      }
+      return false;
+  }
+
+  // detect  star
+  if (lexer->lookahead == '*' && (
+      valid_symbols[EMPHASIS_STAR_START] ||
+      valid_symbols[STRONG_STAR_START] ||
+      valid_symbols[EMPHASIS_STAR_END] ||
+      valid_symbols[STRONG_STAR_END]
+  )) {
+      // fprintf(stderr, "looking for strong or emph star\n");
+      // get current start position
+      state->pos.col = lexer->get_column(lexer);
+      LexWrap *wrapper = &state->lex;
+      lex_reset(wrapper, lexer, state->pos);
+      wrapper->no_closer = &state->no_closer;
+      lex_advance(wrapper, false);
+      // possible end if just an emphasis
+      lexer->mark_end(lexer);
+      // before we move the lexer forward check
+      // if emphasis is valid... The grammar could
+      // enable STRONG_STAR_END and EMPH_STAR_END
+      // at the same time...
+      Pos possible_pos = wrapper->curr_pos;
+      // fprintf(stderr, "lex is at: ");
+      print_pos(&possible_pos);
+      // fprintf(stderr, "\n");
+      if (valid_symbols[EMPHASIS_STAR_END]) {
+          size_t index = stack_find(&state->results, &possible_pos, EMPHASIS_STAR, true);
+          if (index < not_found) {
+              lexer->result_symbol = EMPHASIS_STAR_END;
+              array_erase(&state->results, index);
+              return true;
+          }
+      }
+
+      if (valid_symbols[EMPHASIS_STAR_START]) {
+          // the start position should be one step prior
+          possible_pos.col--;
+          size_t index = stack_find(&state->results, &possible_pos, EMPHASIS_STAR, false);
+          if (index < not_found) {
+              lexer->result_symbol = EMPHASIS_STAR_START;
+              return true;
+          }
+          possible_pos.col++;
+      }
+
+      // without actually advancing the lexer, check the stack
+      if (valid_symbols[STRONG_STAR_START] || valid_symbols[STRONG_STAR_END]) {
+          possible_pos.col++;
+          if (valid_symbols[STRONG_STAR_END]) {
+              size_t index = stack_find(&state->results, &possible_pos, STRONG_STAR, true);
+              if (index < not_found) {
+                  lex_advance(wrapper, false);
+                  lexer->mark_end(lexer);
+                  lexer->result_symbol = STRONG_STAR_END;
+                  array_erase(&state->results, index);
+                  return true;
+              }
+          }
+          if (valid_symbols[STRONG_STAR_START]) {
+              //again, the start will be on the other side
+              possible_pos.col -= 2;
+              size_t index = stack_find(&state->results, &possible_pos, STRONG_STAR, false);
+              if (index < not_found) {
+                  lex_advance(wrapper, false);
+                  lexer->mark_end(lexer);
+                  lexer->result_symbol = STRONG_STAR_START;
+                  return true;
+              }
+              possible_pos.col += 2;
+          }
+      }
+
+      // failed to match any pre-parsed info on the stack.
+      // Its not the time to advance the lexer if STRONG match is possible.
+      if (valid_symbols[EMPHASIS_STAR_START] || valid_symbols[STRONG_STAR_START]) {
+
+          if (lexer->lookahead == '*' && valid_symbols[STRONG_STAR_START]) {
+              lex_advance(wrapper, false);
+              lexer->mark_end(lexer);
+          }
+          // reset wrapper to begining of this scan.
+          lex_backtrack_n(wrapper, wrapper->buffer.size);
+          // try and handle this parse...
+          ParseResult res = parse_star(wrapper, &state->results);
+          if (res.success) {
+              if (res.token == NONE) {
+                  lexer->result_symbol = ERROR;
+                  return true;
+              }
+              if (res.token == DO_NOT_PARSE) {
+                  size_t index = stack_find_exact(&state->results, &res);
+                  if (index < not_found) {
+                      array_erase(&state->results, index);
+                  }
+                  lexer->result_symbol = NO_PARSE;
+                  return true;
+              }
+              if (valid_symbols[EMPHASIS_STAR_START] && res.token == EMPHASIS_STAR) {
+                  lexer->result_symbol = EMPHASIS_STAR_START;
+                  return true;
+              } else if (valid_symbols[STRONG_STAR_START] && res.token == STRONG_STAR){
+                  lexer->result_symbol = STRONG_STAR_START;
+                  return true;
+              }
+          }
+      }
+      // the '*' was consumed above. It is left to the lexer as symbols
+      // instead of starting a text run.
+      return false;
+  }
+
+
+  // detect  underscore
+  if (lexer->lookahead == '_' && (
+      valid_symbols[EMPHASIS_UNDER_START] ||
+      valid_symbols[STRONG_UNDER_START] ||
+      valid_symbols[EMPHASIS_UNDER_END] ||
+      valid_symbols[STRONG_UNDER_END]
+  )) {
+      // fprintf(stderr, "looking for strong or emph under\n");
+      // get current start position
+      state->pos.col = lexer->get_column(lexer);
+      LexWrap *wrapper = &state->lex;
+      lex_reset(wrapper, lexer, state->pos);
+      wrapper->no_closer = &state->no_closer;
+      lex_advance(wrapper, false);
+      // possible end if just an emphasis
+      lexer->mark_end(lexer);
+      // before we move the lexer forward check
+      // if emphasis is valid... The grammar could
+      // enable STRONG_STAR_END and EMPH_STAR_END
+      // at the same time...
+      Pos possible_pos = wrapper->curr_pos;
+      // fprintf(stderr, "lex is at: ");
+      print_pos(&possible_pos);
+      // fprintf(stderr, "\n");
+      if (valid_symbols[EMPHASIS_UNDER_END]) {
+          size_t index = stack_find(&state->results, &possible_pos, EMPHASIS_UNDER, true);
+          if (index < not_found) {
+              lexer->result_symbol = EMPHASIS_UNDER_END;
+              array_erase(&state->results, index);
+              return true;
+          }
+      }
+
+      if (valid_symbols[EMPHASIS_UNDER_START]) {
+          // the start position should be one step prior
+          possible_pos.col--;
+          size_t index = stack_find(&state->results, &possible_pos, EMPHASIS_UNDER, false);
+          if (index < not_found) {
+              lexer->result_symbol = EMPHASIS_UNDER_START;
+              return true;
+          }
+          possible_pos.col++;
+      }
+
+      // without actually advancing the lexer, check the stack
+      if (valid_symbols[STRONG_UNDER_START] || valid_symbols[STRONG_UNDER_END]) {
+          possible_pos.col++;
+          if (valid_symbols[STRONG_UNDER_END]) {
+              size_t index = stack_find(&state->results, &possible_pos, STRONG_UNDER, true);
+              if (index < not_found) {
+                  lex_advance(wrapper, false);
+                  lexer->mark_end(lexer);
+                  lexer->result_symbol = STRONG_UNDER_END;
+                  array_erase(&state->results, index);
+                  return true;
+              }
+          }
+          if (valid_symbols[STRONG_UNDER_START]) {
+              //again, the start will be on the other side
+              possible_pos.col -= 2;
+              size_t index = stack_find(&state->results, &possible_pos, STRONG_UNDER, false);
+              if (index < not_found) {
+                  lex_advance(wrapper, false);
+                  lexer->mark_end(lexer);
+                  lexer->result_symbol = STRONG_UNDER_START;
+                  return true;
+              }
+              possible_pos.col += 2;
+          }
+      }
+
+      // failed to match any pre-parsed info on the stack.
+      // Its not the time to advance the lexer if STRONG match is possible.
+      if (valid_symbols[EMPHASIS_UNDER_START] || valid_symbols[STRONG_UNDER_START]) {
+
+          if (lexer->lookahead == '_' && valid_symbols[STRONG_UNDER_START]) {
+              lex_advance(wrapper, false);
+              // however, only mark end here if the next symbol is NOT
+              // an '_'. This is because a stream of ___ implies the first
+              // character is part of an emphasis
+              if (lexer->lookahead != '_') {
+                  lexer->mark_end(lexer);
+              }
+          }
+          // reset wrapper to begining of this scan.
+          lex_backtrack_n(wrapper, wrapper->buffer.size);
+          // try and handle this parse...
+          ParseResult res = parse_under(wrapper, &state->results);
+          if (res.success) {
+              if (res.token == NONE) {
+                  lexer->result_symbol = ERROR;
+                  return true;
+              }
+              if (res.token == DO_NOT_PARSE) {
+                  size_t index = stack_find_exact(&state->results, &res);
+                  if (index < not_found) {
+                      array_erase(&state->results, index);
+                  }
+                  lexer->result_symbol = NO_PARSE;
+                  return true;
+              }
+              if (valid_symbols[EMPHASIS_UNDER_START] && res.token == EMPHASIS_UNDER) {
+                  lexer->result_symbol = EMPHASIS_UNDER_START;
+                  return true;
+              } else if (valid_symbols[STRONG_UNDER_START] && res.token == STRONG_UNDER){
+                  lexer->result_symbol = STRONG_UNDER_START;
+                  return true;
+              }
+          }
+      }
+      // as for '*', the '_' is left to the lexer
+      return false;
+  }
+
+  // plain text. Everything up to the next character that may start
+  // inline syntax is one token, so prose costs a single node per run
+  // instead of one per word and punctuation mark. Trailing whitespace
+  // is left out of the token.
+  if (valid_symbols[TEXT] && lexer->lookahead != '#' &&
+      (is_text_char(lexer->lookahead) || lexer->lookahead == '!')) {
+      bool marked = false;
+      int32_t last_char = ' ';
+      while (!lexer->eof(lexer)) {
+          int32_t lookahead = lexer->lookahead;
+          if (lookahead == '!') {
+              lexer->advance(lexer, false);
+              if (lexer->lookahead == '[') {
+                  break;
+              }
+          } else if (is_text_char(lookahead) ||
+                     (lookahead == '@' && is_citation_char(last_char))) {
+              // an '@' inside a word is an email address, not a citation
+              lexer->advance(lexer, false);
+          } else {
+              break;
+          }
+          if (lookahead != ' ' && lookahead != '\t') {
+              lexer->mark_end(lexer);
+              marked = true;
+          }
+          last_char = lookahead;
+      }
+      if (marked) {
+          lexer->result_symbol = TEXT;
+      }
+      return marked;
+  }
+
+  return false; // No token recognized
+}
+
+/// Copies the counters of the calling thread's scanners. Returns false,
+/// leaving them zeroed, if they were not compiled in.
+bool tree_sitter_quarto_inline_scanner_counters(TSQuartoScannerCounters *counters) {
+#ifdef TREE_SITTER_QUARTO_COUNTERS
+  *counters = thread_counters;
+  return true;
+#else
+  memset(counters, 0, sizeof(TSQuartoScannerCounters));
+  return false;
+#endif
+}
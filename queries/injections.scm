@@ -0,0 +1,5 @@
+; The text of paragraphs and headings is parsed by the inline grammar.
+; Every inline node is its own injection, so an edit reparses only the
+; node it falls in.
+((inline) @injection.content
+  (#set! injection.language "quarto_inline"))
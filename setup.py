@@ -1,5 +1,6 @@
 from os import path
 from platform import system
+from subprocess import CalledProcessError, run
 from sysconfig import get_config_var
 
 from setuptools import Extension, find_packages, setup
@@ -9,10 +10,12 @@ from wheel.bdist_wheel import bdist_wheel
 
 sources = [
     "bindings/python/tree_sitter_quarto/binding.c",
+    "bindings/python/tree_sitter_quarto/batch.c",
     "src/parser.c",
 ]
 if path.exists("src/scanner.c"):
     sources.append("src/scanner.c")
+sources += ["inline/src/parser.c", "inline/src/scanner.c", "bindings/c/outline.c"]
 
 macros: list[tuple[str, str | None]] = [
     ("PY_SSIZE_T_CLEAN", None),
@@ -21,6 +24,25 @@ macros: list[tuple[str, str | None]] = [
 if limited_api := not get_config_var("Py_GIL_DISABLED"):
     macros.append(("Py_LIMITED_API", "0x030A0000"))
 
+
+def pkg_config(*args):
+    try:
+        result = run(["pkg-config", *args, "tree-sitter"],
+                     capture_output=True, check=True, text=True)
+    except (OSError, CalledProcessError):
+        return None
+    return result.stdout.split()
+
+
+# parse_many() only finds outlines without the tree-sitter runtime
+include_dirs = ["src", "bindings/c"]
+link_args = []
+if (runtime_libs := pkg_config("--libs")) is not None:
+    macros.append(("TREE_SITTER_QUARTO_RUNTIME", None))
+    sources.append("bindings/c/spans.c")
+    include_dirs += [flag[2:] for flag in pkg_config("--cflags-only-I") or []]
+    link_args = runtime_libs
+
 if system() != "Windows":
     cflags = ["-std=c11", "-fvisibility=hidden"]
 else:
@@ -47,7 +69,12 @@ class EggInfo(egg_info):
     def find_sources(self):
         super().find_sources()
         self.filelist.recursive_include("queries", "*.scm")
+        self.filelist.include("src/*.h")
         self.filelist.include("src/tree_sitter/*.h")
+        self.filelist.include("inline/src/tree_sitter/*.h")
+        self.filelist.include("bindings/c/outline.c")
+        self.filelist.include("bindings/c/spans.c")
+        self.filelist.include("bindings/c/tree_sitter/*.h")
 
 
 setup(
@@ -63,8 +90,9 @@ setup(
             name="_binding",
             sources=sources,
             extra_compile_args=cflags,
+            extra_link_args=link_args,
             define_macros=macros,
-            include_dirs=["src"],
+            include_dirs=include_dirs,
             py_limited_api=limited_api,
         )
     ],
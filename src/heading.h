@@ -0,0 +1,106 @@
+#ifndef TREE_SITTER_QUARTO_HEADING_H_
+#define TREE_SITTER_QUARTO_HEADING_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tree_sitter/parser.h"
+
+/// Heading recognition, shared by the block scanner and the outline
+/// parser in bindings/c/outline.c. Everything here works on a TSLexer,
+/// which the outline parser provides over a plain byte buffer.
+
+static inline bool is_blank(int32_t char_) {
+    return char_ == ' ' || char_ == '\t' || char_ == '\r';
+}
+
+/// consumes the rest of the line, marking the token end after every
+/// character that is not whitespace. Returns true if anything was marked.
+static inline bool scan_line(TSLexer *lexer) {
+    bool marked = false;
+    while (lexer->lookahead != '\n' && !lexer->eof(lexer)) {
+        int32_t char_ = lexer->lookahead;
+        lexer->advance(lexer, false);
+        if (!is_blank(char_)) {
+            lexer->mark_end(lexer);
+            marked = true;
+        }
+    }
+    return marked;
+}
+
+/// consumes the rest of an ATX heading line like scan_line(), but leaves
+/// out the closing sequence: the '#' runs and whitespace that end the
+/// line, if they start at the beginning or after whitespace. "H #" gives
+/// "H", while "a#" and "a # b" keep their '#'. Returns true if anything
+/// was marked.
+static inline bool scan_atx_heading_text(TSLexer *lexer) {
+    bool marked = false;
+    bool after_blank = true;
+    while (lexer->lookahead != '\n' && !lexer->eof(lexer)) {
+        int32_t char_ = lexer->lookahead;
+        lexer->advance(lexer, false);
+        if (char_ == '#' && after_blank) {
+            // may close the heading, so only marked along with whatever
+            // comes after it
+            continue;
+        }
+        after_blank = is_blank(char_);
+        if (!after_blank) {
+            lexer->mark_end(lexer);
+            marked = true;
+        }
+    }
+    return marked;
+}
+
+/// consumes '#' runs and whitespace, marking the token end after each
+/// '#'. Returns true if they reach the end of the line, making them the
+/// closing sequence of an ATX heading.
+static inline bool scan_atx_closing_sequence(TSLexer *lexer) {
+    while (lexer->lookahead == '#' || is_blank(lexer->lookahead)) {
+        int32_t char_ = lexer->lookahead;
+        lexer->advance(lexer, false);
+        if (char_ == '#') {
+            lexer->mark_end(lexer);
+        }
+    }
+    return lexer->lookahead == '\n' || lexer->eof(lexer);
+}
+
+/// consumes the '#' run opening an ATX heading. At most six are allowed
+/// and they must be followed by whitespace or the end of the line.
+/// Returns the number consumed, or 0 if this is not a heading.
+static inline uint8_t scan_atx_marker(TSLexer *lexer) {
+    uint8_t level = 0;
+    while (lexer->lookahead == '#' && level < 7) {
+        lexer->advance(lexer, false);
+        level++;
+    }
+    if (level > 6 || (!is_blank(lexer->lookahead) &&
+        lexer->lookahead != '\n' && !lexer->eof(lexer))) {
+        return 0;
+    }
+    return level;
+}
+
+/// consumes a setext underline, a run of '=' or '-' with nothing but
+/// whitespace after it on the line. Returns the heading level it gives,
+/// or 0 if the line is something else.
+static inline uint8_t scan_setext_underline(TSLexer *lexer) {
+    int32_t marker = lexer->lookahead;
+    if (marker != '=' && marker != '-') {
+        return 0;
+    }
+    while (lexer->lookahead == marker) {
+        lexer->advance(lexer, false);
+    }
+    while (is_blank(lexer->lookahead)) {
+        lexer->advance(lexer, false);
+    }
+    if (lexer->lookahead != '\n' && !lexer->eof(lexer)) {
+        return 0;
+    }
+    return marker == '=' ? 1 : 2;
+}
+
+#endif // TREE_SITTER_QUARTO_HEADING_H_
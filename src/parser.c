@@ -1,4 +1,4 @@
-/* Automatically @generated by tree-sitter v0.25.4 */
+/* Automatically @generated from src/grammar.json for tree-sitter v0.25.4 (ABI 15) */
 
 #include "tree_sitter/parser.h"
 
@@ -7,216 +7,99 @@
 #endif
 
 #define LANGUAGE_VERSION 15
-#define STATE_COUNT 129
-#define LARGE_STATE_COUNT 3
-#define SYMBOL_COUNT 64
+#define STATE_COUNT 26
+#define LARGE_STATE_COUNT 11
+#define SYMBOL_COUNT 25
 #define ALIAS_COUNT 0
-#define TOKEN_COUNT 33
-#define EXTERNAL_TOKEN_COUNT 12
+#define TOKEN_COUNT 16
+#define EXTERNAL_TOKEN_COUNT 14
 #define FIELD_COUNT 0
-#define MAX_ALIAS_SEQUENCE_LENGTH 3
+#define MAX_ALIAS_SEQUENCE_LENGTH 4
 #define MAX_RESERVED_WORD_SET_SIZE 0
 #define PRODUCTION_ID_COUNT 1
 #define SUPERTYPE_COUNT 0
 
 enum ts_symbol_identifiers {
   sym_comment = 1,
-  anon_sym_BSLASH = 2,
-  anon_sym_ = 3,
-  sym_word = 4,
-  sym_period = 5,
-  sym_comma = 6,
-  sym_exclamation = 7,
-  sym_question = 8,
-  sym_colon = 9,
-  sym_semi_colon = 10,
-  sym_single_quote = 11,
-  sym_double_quote = 12,
-  sym_symbols = 13,
-  aux_sym_literal_token1 = 14,
-  anon_sym_POUND = 15,
-  anon_sym_POUND_POUND = 16,
-  anon_sym_POUND_POUND_POUND = 17,
-  anon_sym_POUND_POUND_POUND_POUND = 18,
-  anon_sym_POUND_POUND_POUND_POUND_POUND = 19,
-  anon_sym_POUND_POUND_POUND_POUND_POUND_POUND = 20,
-  sym__line_start = 21,
-  sym_line_end = 22,
-  sym__emph_star_start = 23,
-  sym__emph_star_end = 24,
-  sym__emph_under_start = 25,
-  sym__emph_under_end = 26,
-  sym__strong_star_start = 27,
-  sym__strong_star_end = 28,
-  sym__strong_under_start = 29,
-  sym__strong_under_end = 30,
-  sym__no_parse = 31,
-  sym__unused_error = 32,
-  sym_source_file = 33,
-  sym_paragraph = 34,
-  sym_line_break = 35,
-  sym_paragraph_end = 36,
-  aux_sym__line_content = 37,
-  sym__line = 38,
-  sym_puncuation = 39,
-  sym_quotation = 40,
-  sym_literal = 41,
-  sym_content = 42,
-  sym__section = 43,
-  sym_heading = 44,
-  sym_heading_1 = 45,
-  sym_heading_2 = 46,
-  sym_heading_3 = 47,
-  sym_heading_4 = 48,
-  sym_heading_5 = 49,
-  sym_heading_6 = 50,
-  sym_emph = 51,
-  sym__emph_star = 52,
-  sym__emph_under = 53,
-  sym_strong = 54,
-  sym__strong_star = 55,
-  sym__strong_under = 56,
-  sym__strong_content = 57,
-  aux_sym_source_file_repeat1 = 58,
-  aux_sym_paragraph_repeat1 = 59,
-  aux_sym_paragraph_end_repeat1 = 60,
-  aux_sym_content_repeat1 = 61,
-  aux_sym__strong_content_repeat1 = 62,
-  aux_sym__strong_content_repeat2 = 63,
+  sym_line_end = 2,
+  sym_inline = 3,
+  sym__atx_heading_inline = 4,
+  sym__setext_heading_inline = 5,
+  sym_atx_h1_marker = 6,
+  sym_atx_h2_marker = 7,
+  sym_atx_h3_marker = 8,
+  sym_atx_h4_marker = 9,
+  sym_atx_h5_marker = 10,
+  sym_atx_h6_marker = 11,
+  sym_setext_h1_underline = 12,
+  sym_setext_h2_underline = 13,
+  sym__atx_closing_sequence = 14,
+  sym__unused_error = 15,
+  sym_source_file = 16,
+  sym_paragraph = 17,
+  sym_paragraph_end = 18,
+  sym_content = 19,
+  sym__section = 20,
+  sym_heading = 21,
+  aux_sym_source_file_repeat1 = 22,
+  aux_sym_paragraph_end_repeat1 = 23,
+  aux_sym_content_repeat1 = 24,
 };
 
 static const char * const ts_symbol_names[] = {
   [ts_builtin_sym_end] = "end",
   [sym_comment] = "comment",
-  [anon_sym_BSLASH] = "\\",
-  [anon_sym_] = "  ",
-  [sym_word] = "word",
-  [sym_period] = "period",
-  [sym_comma] = "comma",
-  [sym_exclamation] = "exclamation",
-  [sym_question] = "question",
-  [sym_colon] = "colon",
-  [sym_semi_colon] = "semi_colon",
-  [sym_single_quote] = "single_quote",
-  [sym_double_quote] = "double_quote",
-  [sym_symbols] = "symbols",
-  [aux_sym_literal_token1] = "literal_token1",
-  [anon_sym_POUND] = "#",
-  [anon_sym_POUND_POUND] = "##",
-  [anon_sym_POUND_POUND_POUND] = "###",
-  [anon_sym_POUND_POUND_POUND_POUND] = "####",
-  [anon_sym_POUND_POUND_POUND_POUND_POUND] = "#####",
-  [anon_sym_POUND_POUND_POUND_POUND_POUND_POUND] = "######",
-  [sym__line_start] = "_line_start",
   [sym_line_end] = "line_end",
-  [sym__emph_star_start] = "emph_start",
-  [sym__emph_star_end] = "emph_end",
-  [sym__emph_under_start] = "emph_start",
-  [sym__emph_under_end] = "emph_end",
-  [sym__strong_star_start] = "strong_start",
-  [sym__strong_star_end] = "strong_end",
-  [sym__strong_under_start] = "strong_start",
-  [sym__strong_under_end] = "strong_end",
-  [sym__no_parse] = "literal",
+  [sym_inline] = "inline",
+  [sym__atx_heading_inline] = "inline",
+  [sym__setext_heading_inline] = "inline",
+  [sym_atx_h1_marker] = "atx_h1_marker",
+  [sym_atx_h2_marker] = "atx_h2_marker",
+  [sym_atx_h3_marker] = "atx_h3_marker",
+  [sym_atx_h4_marker] = "atx_h4_marker",
+  [sym_atx_h5_marker] = "atx_h5_marker",
+  [sym_atx_h6_marker] = "atx_h6_marker",
+  [sym_setext_h1_underline] = "setext_h1_underline",
+  [sym_setext_h2_underline] = "setext_h2_underline",
+  [sym__atx_closing_sequence] = "_atx_closing_sequence",
   [sym__unused_error] = "_unused_error",
   [sym_source_file] = "source_file",
   [sym_paragraph] = "paragraph",
-  [sym_line_break] = "line_break",
   [sym_paragraph_end] = "paragraph_end",
-  [aux_sym__line_content] = "_line_content",
-  [sym__line] = "_line",
-  [sym_puncuation] = "puncuation",
-  [sym_quotation] = "quotation",
-  [sym_literal] = "literal",
   [sym_content] = "content",
   [sym__section] = "_section",
   [sym_heading] = "heading",
-  [sym_heading_1] = "heading_1",
-  [sym_heading_2] = "heading_2",
-  [sym_heading_3] = "heading_3",
-  [sym_heading_4] = "heading_4",
-  [sym_heading_5] = "heading_5",
-  [sym_heading_6] = "heading_6",
-  [sym_emph] = "emph",
-  [sym__emph_star] = "_emph_star",
-  [sym__emph_under] = "_emph_under",
-  [sym_strong] = "strong",
-  [sym__strong_star] = "_strong_star",
-  [sym__strong_under] = "_strong_under",
-  [sym__strong_content] = "_strong_content",
   [aux_sym_source_file_repeat1] = "source_file_repeat1",
-  [aux_sym_paragraph_repeat1] = "paragraph_repeat1",
   [aux_sym_paragraph_end_repeat1] = "paragraph_end_repeat1",
   [aux_sym_content_repeat1] = "content_repeat1",
-  [aux_sym__strong_content_repeat1] = "_strong_content_repeat1",
-  [aux_sym__strong_content_repeat2] = "_strong_content_repeat2",
 };
 
 static const TSSymbol ts_symbol_map[] = {
   [ts_builtin_sym_end] = ts_builtin_sym_end,
   [sym_comment] = sym_comment,
-  [anon_sym_BSLASH] = anon_sym_BSLASH,
-  [anon_sym_] = anon_sym_,
-  [sym_word] = sym_word,
-  [sym_period] = sym_period,
-  [sym_comma] = sym_comma,
-  [sym_exclamation] = sym_exclamation,
-  [sym_question] = sym_question,
-  [sym_colon] = sym_colon,
-  [sym_semi_colon] = sym_semi_colon,
-  [sym_single_quote] = sym_single_quote,
-  [sym_double_quote] = sym_double_quote,
-  [sym_symbols] = sym_symbols,
-  [aux_sym_literal_token1] = aux_sym_literal_token1,
-  [anon_sym_POUND] = anon_sym_POUND,
-  [anon_sym_POUND_POUND] = anon_sym_POUND_POUND,
-  [anon_sym_POUND_POUND_POUND] = anon_sym_POUND_POUND_POUND,
-  [anon_sym_POUND_POUND_POUND_POUND] = anon_sym_POUND_POUND_POUND_POUND,
-  [anon_sym_POUND_POUND_POUND_POUND_POUND] = anon_sym_POUND_POUND_POUND_POUND_POUND,
-  [anon_sym_POUND_POUND_POUND_POUND_POUND_POUND] = anon_sym_POUND_POUND_POUND_POUND_POUND_POUND,
-  [sym__line_start] = sym__line_start,
   [sym_line_end] = sym_line_end,
-  [sym__emph_star_start] = sym__emph_star_start,
-  [sym__emph_star_end] = sym__emph_star_end,
-  [sym__emph_under_start] = sym__emph_star_start,
-  [sym__emph_under_end] = sym__emph_star_end,
-  [sym__strong_star_start] = sym__strong_star_start,
-  [sym__strong_star_end] = sym__strong_star_end,
-  [sym__strong_under_start] = sym__strong_star_start,
-  [sym__strong_under_end] = sym__strong_star_end,
-  [sym__no_parse] = sym_literal,
+  [sym_inline] = sym_inline,
+  [sym__atx_heading_inline] = sym_inline,
+  [sym__setext_heading_inline] = sym_inline,
+  [sym_atx_h1_marker] = sym_atx_h1_marker,
+  [sym_atx_h2_marker] = sym_atx_h2_marker,
+  [sym_atx_h3_marker] = sym_atx_h3_marker,
+  [sym_atx_h4_marker] = sym_atx_h4_marker,
+  [sym_atx_h5_marker] = sym_atx_h5_marker,
+  [sym_atx_h6_marker] = sym_atx_h6_marker,
+  [sym_setext_h1_underline] = sym_setext_h1_underline,
+  [sym_setext_h2_underline] = sym_setext_h2_underline,
+  [sym__atx_closing_sequence] = sym__atx_closing_sequence,
   [sym__unused_error] = sym__unused_error,
   [sym_source_file] = sym_source_file,
   [sym_paragraph] = sym_paragraph,
-  [sym_line_break] = sym_line_break,
   [sym_paragraph_end] = sym_paragraph_end,
-  [aux_sym__line_content] = aux_sym__line_content,
-  [sym__line] = sym__line,
-  [sym_puncuation] = sym_puncuation,
-  [sym_quotation] = sym_quotation,
-  [sym_literal] = sym_literal,
   [sym_content] = sym_content,
   [sym__section] = sym__section,
   [sym_heading] = sym_heading,
-  [sym_heading_1] = sym_heading_1,
-  [sym_heading_2] = sym_heading_2,
-  [sym_heading_3] = sym_heading_3,
-  [sym_heading_4] = sym_heading_4,
-  [sym_heading_5] = sym_heading_5,
-  [sym_heading_6] = sym_heading_6,
-  [sym_emph] = sym_emph,
-  [sym__emph_star] = sym__emph_star,
-  [sym__emph_under] = sym__emph_under,
-  [sym_strong] = sym_strong,
-  [sym__strong_star] = sym__strong_star,
-  [sym__strong_under] = sym__strong_under,
-  [sym__strong_content] = sym__strong_content,
   [aux_sym_source_file_repeat1] = aux_sym_source_file_repeat1,
-  [aux_sym_paragraph_repeat1] = aux_sym_paragraph_repeat1,
   [aux_sym_paragraph_end_repeat1] = aux_sym_paragraph_end_repeat1,
   [aux_sym_content_repeat1] = aux_sym_content_repeat1,
-  [aux_sym__strong_content_repeat1] = aux_sym__strong_content_repeat1,
-  [aux_sym__strong_content_repeat2] = aux_sym__strong_content_repeat2,
 };
 
 static const TSSymbolMetadata ts_symbol_metadata[] = {
@@ -228,124 +111,56 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = true,
   },
-  [anon_sym_BSLASH] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_] = {
-    .visible = true,
-    .named = false,
-  },
-  [sym_word] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_period] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_comma] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_exclamation] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_question] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_colon] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_semi_colon] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_single_quote] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_double_quote] = {
+  [sym_line_end] = {
     .visible = true,
     .named = true,
   },
-  [sym_symbols] = {
+  [sym_inline] = {
     .visible = true,
     .named = true,
   },
-  [aux_sym_literal_token1] = {
-    .visible = false,
-    .named = false,
-  },
-  [anon_sym_POUND] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_POUND_POUND] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_POUND_POUND_POUND] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_POUND_POUND_POUND_POUND] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_POUND_POUND_POUND_POUND_POUND] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_POUND_POUND_POUND_POUND_POUND_POUND] = {
+  [sym__atx_heading_inline] = {
     .visible = true,
-    .named = false,
-  },
-  [sym__line_start] = {
-    .visible = false,
     .named = true,
   },
-  [sym_line_end] = {
+  [sym__setext_heading_inline] = {
     .visible = true,
     .named = true,
   },
-  [sym__emph_star_start] = {
+  [sym_atx_h1_marker] = {
     .visible = true,
     .named = true,
   },
-  [sym__emph_star_end] = {
+  [sym_atx_h2_marker] = {
     .visible = true,
     .named = true,
   },
-  [sym__emph_under_start] = {
+  [sym_atx_h3_marker] = {
     .visible = true,
     .named = true,
   },
-  [sym__emph_under_end] = {
+  [sym_atx_h4_marker] = {
     .visible = true,
     .named = true,
   },
-  [sym__strong_star_start] = {
+  [sym_atx_h5_marker] = {
     .visible = true,
     .named = true,
   },
-  [sym__strong_star_end] = {
+  [sym_atx_h6_marker] = {
     .visible = true,
     .named = true,
   },
-  [sym__strong_under_start] = {
+  [sym_setext_h1_underline] = {
     .visible = true,
     .named = true,
   },
-  [sym__strong_under_end] = {
+  [sym_setext_h2_underline] = {
     .visible = true,
     .named = true,
   },
-  [sym__no_parse] = {
-    .visible = true,
+  [sym__atx_closing_sequence] = {
+    .visible = false,
     .named = true,
   },
   [sym__unused_error] = {
@@ -360,34 +175,10 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = true,
   },
-  [sym_line_break] = {
-    .visible = true,
-    .named = true,
-  },
   [sym_paragraph_end] = {
     .visible = true,
     .named = true,
   },
-  [aux_sym__line_content] = {
-    .visible = false,
-    .named = false,
-  },
-  [sym__line] = {
-    .visible = false,
-    .named = true,
-  },
-  [sym_puncuation] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_quotation] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_literal] = {
-    .visible = true,
-    .named = true,
-  },
   [sym_content] = {
     .visible = true,
     .named = true,
@@ -400,66 +191,10 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = true,
   },
-  [sym_heading_1] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_heading_2] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_heading_3] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_heading_4] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_heading_5] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_heading_6] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_emph] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym__emph_star] = {
-    .visible = false,
-    .named = true,
-  },
-  [sym__emph_under] = {
-    .visible = false,
-    .named = true,
-  },
-  [sym_strong] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym__strong_star] = {
-    .visible = false,
-    .named = true,
-  },
-  [sym__strong_under] = {
-    .visible = false,
-    .named = true,
-  },
-  [sym__strong_content] = {
-    .visible = false,
-    .named = true,
-  },
   [aux_sym_source_file_repeat1] = {
     .visible = false,
     .named = false,
   },
-  [aux_sym_paragraph_repeat1] = {
-    .visible = false,
-    .named = false,
-  },
   [aux_sym_paragraph_end_repeat1] = {
     .visible = false,
     .named = false,
@@ -468,14 +203,6 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = false,
     .named = false,
   },
-  [aux_sym__strong_content_repeat1] = {
-    .visible = false,
-    .named = false,
-  },
-  [aux_sym__strong_content_repeat2] = {
-    .visible = false,
-    .named = false,
-  },
 };
 
 static const TSSymbol ts_alias_sequences[PRODUCTION_ID_COUNT][MAX_ALIAS_SEQUENCE_LENGTH] = {
@@ -494,233 +221,25 @@ static const TSStateId ts_primary_state_ids[STATE_COUNT] = {
   [4] = 4,
   [5] = 5,
   [6] = 6,
-  [7] = 4,
-  [8] = 4,
-  [9] = 5,
-  [10] = 6,
-  [11] = 5,
-  [12] = 6,
-  [13] = 5,
-  [14] = 6,
-  [15] = 5,
-  [16] = 6,
+  [7] = 7,
+  [8] = 8,
+  [9] = 9,
+  [10] = 10,
+  [11] = 11,
+  [12] = 12,
+  [13] = 13,
+  [14] = 14,
+  [15] = 15,
+  [16] = 16,
   [17] = 17,
-  [18] = 17,
+  [18] = 18,
   [19] = 19,
   [20] = 20,
-  [21] = 20,
+  [21] = 21,
   [22] = 17,
-  [23] = 20,
-  [24] = 20,
-  [25] = 17,
-  [26] = 20,
-  [27] = 17,
-  [28] = 28,
-  [29] = 28,
-  [30] = 30,
-  [31] = 30,
-  [32] = 32,
-  [33] = 33,
-  [34] = 34,
-  [35] = 35,
-  [36] = 32,
-  [37] = 35,
-  [38] = 34,
-  [39] = 35,
-  [40] = 33,
-  [41] = 33,
-  [42] = 42,
-  [43] = 43,
-  [44] = 44,
-  [45] = 45,
-  [46] = 46,
-  [47] = 47,
-  [48] = 48,
-  [49] = 49,
-  [50] = 50,
-  [51] = 48,
-  [52] = 47,
-  [53] = 49,
-  [54] = 43,
-  [55] = 44,
-  [56] = 45,
-  [57] = 46,
-  [58] = 48,
-  [59] = 50,
-  [60] = 42,
-  [61] = 47,
-  [62] = 49,
-  [63] = 43,
-  [64] = 44,
-  [65] = 45,
-  [66] = 46,
-  [67] = 42,
-  [68] = 50,
-  [69] = 42,
-  [70] = 47,
-  [71] = 49,
-  [72] = 44,
-  [73] = 45,
-  [74] = 50,
-  [75] = 42,
-  [76] = 47,
-  [77] = 49,
-  [78] = 44,
-  [79] = 45,
-  [80] = 50,
-  [81] = 81,
-  [82] = 82,
-  [83] = 82,
-  [84] = 81,
-  [85] = 85,
-  [86] = 86,
-  [87] = 87,
-  [88] = 88,
-  [89] = 89,
-  [90] = 90,
-  [91] = 91,
-  [92] = 92,
-  [93] = 93,
-  [94] = 94,
-  [95] = 95,
-  [96] = 96,
-  [97] = 97,
-  [98] = 98,
-  [99] = 99,
-  [100] = 100,
-  [101] = 101,
-  [102] = 102,
-  [103] = 103,
-  [104] = 104,
-  [105] = 105,
-  [106] = 106,
-  [107] = 107,
-  [108] = 108,
-  [109] = 109,
-  [110] = 81,
-  [111] = 111,
-  [112] = 112,
-  [113] = 113,
-  [114] = 114,
-  [115] = 115,
-  [116] = 116,
-  [117] = 117,
-  [118] = 118,
-  [119] = 119,
-  [120] = 120,
-  [121] = 121,
-  [122] = 122,
-  [123] = 122,
-  [124] = 120,
-  [125] = 120,
-  [126] = 119,
-  [127] = 119,
-  [128] = 122,
-};
-
-static const TSCharacterRange sym_word_character_set_1[] = {
-  {'0', '9'}, {'A', 'Z'}, {'a', 'z'}, {0xaa, 0xaa}, {0xb2, 0xb3}, {0xb5, 0xb5}, {0xb9, 0xba}, {0xbc, 0xbe},
-  {0xc0, 0xd6}, {0xd8, 0xf6}, {0xf8, 0x2c1}, {0x2c6, 0x2d1}, {0x2e0, 0x2e4}, {0x2ec, 0x2ec}, {0x2ee, 0x2ee}, {0x370, 0x374},
-  {0x376, 0x377}, {0x37a, 0x37d}, {0x37f, 0x37f}, {0x386, 0x386}, {0x388, 0x38a}, {0x38c, 0x38c}, {0x38e, 0x3a1}, {0x3a3, 0x3f5},
-  {0x3f7, 0x481}, {0x48a, 0x52f}, {0x531, 0x556}, {0x559, 0x559}, {0x560, 0x588}, {0x5d0, 0x5ea}, {0x5ef, 0x5f2}, {0x620, 0x64a},
-  {0x660, 0x669}, {0x66e, 0x66f}, {0x671, 0x6d3}, {0x6d5, 0x6d5}, {0x6e5, 0x6e6}, {0x6ee, 0x6fc}, {0x6ff, 0x6ff}, {0x710, 0x710},
-  {0x712, 0x72f}, {0x74d, 0x7a5}, {0x7b1, 0x7b1}, {0x7c0, 0x7ea}, {0x7f4, 0x7f5}, {0x7fa, 0x7fa}, {0x800, 0x815}, {0x81a, 0x81a},
-  {0x824, 0x824}, {0x828, 0x828}, {0x840, 0x858}, {0x860, 0x86a}, {0x870, 0x887}, {0x889, 0x88e}, {0x8a0, 0x8c9}, {0x904, 0x939},
-  {0x93d, 0x93d}, {0x950, 0x950}, {0x958, 0x961}, {0x966, 0x96f}, {0x971, 0x980}, {0x985, 0x98c}, {0x98f, 0x990}, {0x993, 0x9a8},
-  {0x9aa, 0x9b0}, {0x9b2, 0x9b2}, {0x9b6, 0x9b9}, {0x9bd, 0x9bd}, {0x9ce, 0x9ce}, {0x9dc, 0x9dd}, {0x9df, 0x9e1}, {0x9e6, 0x9f1},
-  {0x9f4, 0x9f9}, {0x9fc, 0x9fc}, {0xa05, 0xa0a}, {0xa0f, 0xa10}, {0xa13, 0xa28}, {0xa2a, 0xa30}, {0xa32, 0xa33}, {0xa35, 0xa36},
-  {0xa38, 0xa39}, {0xa59, 0xa5c}, {0xa5e, 0xa5e}, {0xa66, 0xa6f}, {0xa72, 0xa74}, {0xa85, 0xa8d}, {0xa8f, 0xa91}, {0xa93, 0xaa8},
-  {0xaaa, 0xab0}, {0xab2, 0xab3}, {0xab5, 0xab9}, {0xabd, 0xabd}, {0xad0, 0xad0}, {0xae0, 0xae1}, {0xae6, 0xaef}, {0xaf9, 0xaf9},
-  {0xb05, 0xb0c}, {0xb0f, 0xb10}, {0xb13, 0xb28}, {0xb2a, 0xb30}, {0xb32, 0xb33}, {0xb35, 0xb39}, {0xb3d, 0xb3d}, {0xb5c, 0xb5d},
-  {0xb5f, 0xb61}, {0xb66, 0xb6f}, {0xb71, 0xb77}, {0xb83, 0xb83}, {0xb85, 0xb8a}, {0xb8e, 0xb90}, {0xb92, 0xb95}, {0xb99, 0xb9a},
-  {0xb9c, 0xb9c}, {0xb9e, 0xb9f}, {0xba3, 0xba4}, {0xba8, 0xbaa}, {0xbae, 0xbb9}, {0xbd0, 0xbd0}, {0xbe6, 0xbf2}, {0xc05, 0xc0c},
-  {0xc0e, 0xc10}, {0xc12, 0xc28}, {0xc2a, 0xc39}, {0xc3d, 0xc3d}, {0xc58, 0xc5a}, {0xc5d, 0xc5d}, {0xc60, 0xc61}, {0xc66, 0xc6f},
-  {0xc78, 0xc7e}, {0xc80, 0xc80}, {0xc85, 0xc8c}, {0xc8e, 0xc90}, {0xc92, 0xca8}, {0xcaa, 0xcb3}, {0xcb5, 0xcb9}, {0xcbd, 0xcbd},
-  {0xcdd, 0xcde}, {0xce0, 0xce1}, {0xce6, 0xcef}, {0xcf1, 0xcf2}, {0xd04, 0xd0c}, {0xd0e, 0xd10}, {0xd12, 0xd3a}, {0xd3d, 0xd3d},
-  {0xd4e, 0xd4e}, {0xd54, 0xd56}, {0xd58, 0xd61}, {0xd66, 0xd78}, {0xd7a, 0xd7f}, {0xd85, 0xd96}, {0xd9a, 0xdb1}, {0xdb3, 0xdbb},
-  {0xdbd, 0xdbd}, {0xdc0, 0xdc6}, {0xde6, 0xdef}, {0xe01, 0xe30}, {0xe32, 0xe33}, {0xe40, 0xe46}, {0xe50, 0xe59}, {0xe81, 0xe82},
-  {0xe84, 0xe84}, {0xe86, 0xe8a}, {0xe8c, 0xea3}, {0xea5, 0xea5}, {0xea7, 0xeb0}, {0xeb2, 0xeb3}, {0xebd, 0xebd}, {0xec0, 0xec4},
-  {0xec6, 0xec6}, {0xed0, 0xed9}, {0xedc, 0xedf}, {0xf00, 0xf00}, {0xf20, 0xf33}, {0xf40, 0xf47}, {0xf49, 0xf6c}, {0xf88, 0xf8c},
-  {0x1000, 0x102a}, {0x103f, 0x1049}, {0x1050, 0x1055}, {0x105a, 0x105d}, {0x1061, 0x1061}, {0x1065, 0x1066}, {0x106e, 0x1070}, {0x1075, 0x1081},
-  {0x108e, 0x108e}, {0x1090, 0x1099}, {0x10a0, 0x10c5}, {0x10c7, 0x10c7}, {0x10cd, 0x10cd}, {0x10d0, 0x10fa}, {0x10fc, 0x1248}, {0x124a, 0x124d},
-  {0x1250, 0x1256}, {0x1258, 0x1258}, {0x125a, 0x125d}, {0x1260, 0x1288}, {0x128a, 0x128d}, {0x1290, 0x12b0}, {0x12b2, 0x12b5}, {0x12b8, 0x12be},
-  {0x12c0, 0x12c0}, {0x12c2, 0x12c5}, {0x12c8, 0x12d6}, {0x12d8, 0x1310}, {0x1312, 0x1315}, {0x1318, 0x135a}, {0x1369, 0x137c}, {0x1380, 0x138f},
-  {0x13a0, 0x13f5}, {0x13f8, 0x13fd}, {0x1401, 0x166c}, {0x166f, 0x167f}, {0x1681, 0x169a}, {0x16a0, 0x16ea}, {0x16ee, 0x16f8}, {0x1700, 0x1711},
-  {0x171f, 0x1731}, {0x1740, 0x1751}, {0x1760, 0x176c}, {0x176e, 0x1770}, {0x1780, 0x17b3}, {0x17d7, 0x17d7}, {0x17dc, 0x17dc}, {0x17e0, 0x17e9},
-  {0x17f0, 0x17f9}, {0x1810, 0x1819}, {0x1820, 0x1878}, {0x1880, 0x1884}, {0x1887, 0x18a8}, {0x18aa, 0x18aa}, {0x18b0, 0x18f5}, {0x1900, 0x191e},
-  {0x1946, 0x196d}, {0x1970, 0x1974}, {0x1980, 0x19ab}, {0x19b0, 0x19c9}, {0x19d0, 0x19da}, {0x1a00, 0x1a16}, {0x1a20, 0x1a54}, {0x1a80, 0x1a89},
-  {0x1a90, 0x1a99}, {0x1aa7, 0x1aa7}, {0x1b05, 0x1b33}, {0x1b45, 0x1b4c}, {0x1b50, 0x1b59}, {0x1b83, 0x1ba0}, {0x1bae, 0x1be5}, {0x1c00, 0x1c23},
-  {0x1c40, 0x1c49}, {0x1c4d, 0x1c7d}, {0x1c80, 0x1c8a}, {0x1c90, 0x1cba}, {0x1cbd, 0x1cbf}, {0x1ce9, 0x1cec}, {0x1cee, 0x1cf3}, {0x1cf5, 0x1cf6},
-  {0x1cfa, 0x1cfa}, {0x1d00, 0x1dbf}, {0x1e00, 0x1f15}, {0x1f18, 0x1f1d}, {0x1f20, 0x1f45}, {0x1f48, 0x1f4d}, {0x1f50, 0x1f57}, {0x1f59, 0x1f59},
-  {0x1f5b, 0x1f5b}, {0x1f5d, 0x1f5d}, {0x1f5f, 0x1f7d}, {0x1f80, 0x1fb4}, {0x1fb6, 0x1fbc}, {0x1fbe, 0x1fbe}, {0x1fc2, 0x1fc4}, {0x1fc6, 0x1fcc},
-  {0x1fd0, 0x1fd3}, {0x1fd6, 0x1fdb}, {0x1fe0, 0x1fec}, {0x1ff2, 0x1ff4}, {0x1ff6, 0x1ffc}, {0x2070, 0x2071}, {0x2074, 0x2079}, {0x207f, 0x2089},
-  {0x2090, 0x209c}, {0x2102, 0x2102}, {0x2107, 0x2107}, {0x210a, 0x2113}, {0x2115, 0x2115}, {0x2119, 0x211d}, {0x2124, 0x2124}, {0x2126, 0x2126},
-  {0x2128, 0x2128}, {0x212a, 0x212d}, {0x212f, 0x2139}, {0x213c, 0x213f}, {0x2145, 0x2149}, {0x214e, 0x214e}, {0x2150, 0x2189}, {0x2460, 0x249b},
-  {0x24ea, 0x24ff}, {0x2776, 0x2793}, {0x2c00, 0x2ce4}, {0x2ceb, 0x2cee}, {0x2cf2, 0x2cf3}, {0x2cfd, 0x2cfd}, {0x2d00, 0x2d25}, {0x2d27, 0x2d27},
-  {0x2d2d, 0x2d2d}, {0x2d30, 0x2d67}, {0x2d6f, 0x2d6f}, {0x2d80, 0x2d96}, {0x2da0, 0x2da6}, {0x2da8, 0x2dae}, {0x2db0, 0x2db6}, {0x2db8, 0x2dbe},
-  {0x2dc0, 0x2dc6}, {0x2dc8, 0x2dce}, {0x2dd0, 0x2dd6}, {0x2dd8, 0x2dde}, {0x2e2f, 0x2e2f}, {0x3005, 0x3007}, {0x3021, 0x3029}, {0x3031, 0x3035},
-  {0x3038, 0x303c}, {0x3041, 0x3096}, {0x309d, 0x309f}, {0x30a1, 0x30fa}, {0x30fc, 0x30ff}, {0x3105, 0x312f}, {0x3131, 0x318e}, {0x3192, 0x3195},
-  {0x31a0, 0x31bf}, {0x31f0, 0x31ff}, {0x3220, 0x3229}, {0x3248, 0x324f}, {0x3251, 0x325f}, {0x3280, 0x3289}, {0x32b1, 0x32bf}, {0x3400, 0x4dbf},
-  {0x4e00, 0xa48c}, {0xa4d0, 0xa4fd}, {0xa500, 0xa60c}, {0xa610, 0xa62b}, {0xa640, 0xa66e}, {0xa67f, 0xa69d}, {0xa6a0, 0xa6ef}, {0xa717, 0xa71f},
-  {0xa722, 0xa788}, {0xa78b, 0xa7cd}, {0xa7d0, 0xa7d1}, {0xa7d3, 0xa7d3}, {0xa7d5, 0xa7dc}, {0xa7f2, 0xa801}, {0xa803, 0xa805}, {0xa807, 0xa80a},
-  {0xa80c, 0xa822}, {0xa830, 0xa835}, {0xa840, 0xa873}, {0xa882, 0xa8b3}, {0xa8d0, 0xa8d9}, {0xa8f2, 0xa8f7}, {0xa8fb, 0xa8fb}, {0xa8fd, 0xa8fe},
-  {0xa900, 0xa925}, {0xa930, 0xa946}, {0xa960, 0xa97c}, {0xa984, 0xa9b2}, {0xa9cf, 0xa9d9}, {0xa9e0, 0xa9e4}, {0xa9e6, 0xa9fe}, {0xaa00, 0xaa28},
-  {0xaa40, 0xaa42}, {0xaa44, 0xaa4b}, {0xaa50, 0xaa59}, {0xaa60, 0xaa76}, {0xaa7a, 0xaa7a}, {0xaa7e, 0xaaaf}, {0xaab1, 0xaab1}, {0xaab5, 0xaab6},
-  {0xaab9, 0xaabd}, {0xaac0, 0xaac0}, {0xaac2, 0xaac2}, {0xaadb, 0xaadd}, {0xaae0, 0xaaea}, {0xaaf2, 0xaaf4}, {0xab01, 0xab06}, {0xab09, 0xab0e},
-  {0xab11, 0xab16}, {0xab20, 0xab26}, {0xab28, 0xab2e}, {0xab30, 0xab5a}, {0xab5c, 0xab69}, {0xab70, 0xabe2}, {0xabf0, 0xabf9}, {0xac00, 0xd7a3},
-  {0xd7b0, 0xd7c6}, {0xd7cb, 0xd7fb}, {0xf900, 0xfa6d}, {0xfa70, 0xfad9}, {0xfb00, 0xfb06}, {0xfb13, 0xfb17}, {0xfb1d, 0xfb1d}, {0xfb1f, 0xfb28},
-  {0xfb2a, 0xfb36}, {0xfb38, 0xfb3c}, {0xfb3e, 0xfb3e}, {0xfb40, 0xfb41}, {0xfb43, 0xfb44}, {0xfb46, 0xfbb1}, {0xfbd3, 0xfd3d}, {0xfd50, 0xfd8f},
-  {0xfd92, 0xfdc7}, {0xfdf0, 0xfdfb}, {0xfe70, 0xfe74}, {0xfe76, 0xfefc}, {0xff10, 0xff19}, {0xff21, 0xff3a}, {0xff41, 0xff5a}, {0xff66, 0xffbe},
-  {0xffc2, 0xffc7}, {0xffca, 0xffcf}, {0xffd2, 0xffd7}, {0xffda, 0xffdc}, {0x10000, 0x1000b}, {0x1000d, 0x10026}, {0x10028, 0x1003a}, {0x1003c, 0x1003d},
-  {0x1003f, 0x1004d}, {0x10050, 0x1005d}, {0x10080, 0x100fa}, {0x10107, 0x10133}, {0x10140, 0x10178}, {0x1018a, 0x1018b}, {0x10280, 0x1029c}, {0x102a0, 0x102d0},
-  {0x102e1, 0x102fb}, {0x10300, 0x10323}, {0x1032d, 0x1034a}, {0x10350, 0x10375}, {0x10380, 0x1039d}, {0x103a0, 0x103c3}, {0x103c8, 0x103cf}, {0x103d1, 0x103d5},
-  {0x10400, 0x1049d}, {0x104a0, 0x104a9}, {0x104b0, 0x104d3}, {0x104d8, 0x104fb}, {0x10500, 0x10527}, {0x10530, 0x10563}, {0x10570, 0x1057a}, {0x1057c, 0x1058a},
-  {0x1058c, 0x10592}, {0x10594, 0x10595}, {0x10597, 0x105a1}, {0x105a3, 0x105b1}, {0x105b3, 0x105b9}, {0x105bb, 0x105bc}, {0x105c0, 0x105f3}, {0x10600, 0x10736},
-  {0x10740, 0x10755}, {0x10760, 0x10767}, {0x10780, 0x10785}, {0x10787, 0x107b0}, {0x107b2, 0x107ba}, {0x10800, 0x10805}, {0x10808, 0x10808}, {0x1080a, 0x10835},
-  {0x10837, 0x10838}, {0x1083c, 0x1083c}, {0x1083f, 0x10855}, {0x10858, 0x10876}, {0x10879, 0x1089e}, {0x108a7, 0x108af}, {0x108e0, 0x108f2}, {0x108f4, 0x108f5},
-  {0x108fb, 0x1091b}, {0x10920, 0x10939}, {0x10980, 0x109b7}, {0x109bc, 0x109cf}, {0x109d2, 0x10a00}, {0x10a10, 0x10a13}, {0x10a15, 0x10a17}, {0x10a19, 0x10a35},
-  {0x10a40, 0x10a48}, {0x10a60, 0x10a7e}, {0x10a80, 0x10a9f}, {0x10ac0, 0x10ac7}, {0x10ac9, 0x10ae4}, {0x10aeb, 0x10aef}, {0x10b00, 0x10b35}, {0x10b40, 0x10b55},
-  {0x10b58, 0x10b72}, {0x10b78, 0x10b91}, {0x10ba9, 0x10baf}, {0x10c00, 0x10c48}, {0x10c80, 0x10cb2}, {0x10cc0, 0x10cf2}, {0x10cfa, 0x10d23}, {0x10d30, 0x10d39},
-  {0x10d40, 0x10d65}, {0x10d6f, 0x10d85}, {0x10e60, 0x10e7e}, {0x10e80, 0x10ea9}, {0x10eb0, 0x10eb1}, {0x10ec2, 0x10ec4}, {0x10f00, 0x10f27}, {0x10f30, 0x10f45},
-  {0x10f51, 0x10f54}, {0x10f70, 0x10f81}, {0x10fb0, 0x10fcb}, {0x10fe0, 0x10ff6}, {0x11003, 0x11037}, {0x11052, 0x1106f}, {0x11071, 0x11072}, {0x11075, 0x11075},
-  {0x11083, 0x110af}, {0x110d0, 0x110e8}, {0x110f0, 0x110f9}, {0x11103, 0x11126}, {0x11136, 0x1113f}, {0x11144, 0x11144}, {0x11147, 0x11147}, {0x11150, 0x11172},
-  {0x11176, 0x11176}, {0x11183, 0x111b2}, {0x111c1, 0x111c4}, {0x111d0, 0x111da}, {0x111dc, 0x111dc}, {0x111e1, 0x111f4}, {0x11200, 0x11211}, {0x11213, 0x1122b},
-  {0x1123f, 0x11240}, {0x11280, 0x11286}, {0x11288, 0x11288}, {0x1128a, 0x1128d}, {0x1128f, 0x1129d}, {0x1129f, 0x112a8}, {0x112b0, 0x112de}, {0x112f0, 0x112f9},
-  {0x11305, 0x1130c}, {0x1130f, 0x11310}, {0x11313, 0x11328}, {0x1132a, 0x11330}, {0x11332, 0x11333}, {0x11335, 0x11339}, {0x1133d, 0x1133d}, {0x11350, 0x11350},
-  {0x1135d, 0x11361}, {0x11380, 0x11389}, {0x1138b, 0x1138b}, {0x1138e, 0x1138e}, {0x11390, 0x113b5}, {0x113b7, 0x113b7}, {0x113d1, 0x113d1}, {0x113d3, 0x113d3},
-  {0x11400, 0x11434}, {0x11447, 0x1144a}, {0x11450, 0x11459}, {0x1145f, 0x11461}, {0x11480, 0x114af}, {0x114c4, 0x114c5}, {0x114c7, 0x114c7}, {0x114d0, 0x114d9},
-  {0x11580, 0x115ae}, {0x115d8, 0x115db}, {0x11600, 0x1162f}, {0x11644, 0x11644}, {0x11650, 0x11659}, {0x11680, 0x116aa}, {0x116b8, 0x116b8}, {0x116c0, 0x116c9},
-  {0x116d0, 0x116e3}, {0x11700, 0x1171a}, {0x11730, 0x1173b}, {0x11740, 0x11746}, {0x11800, 0x1182b}, {0x118a0, 0x118f2}, {0x118ff, 0x11906}, {0x11909, 0x11909},
-  {0x1190c, 0x11913}, {0x11915, 0x11916}, {0x11918, 0x1192f}, {0x1193f, 0x1193f}, {0x11941, 0x11941}, {0x11950, 0x11959}, {0x119a0, 0x119a7}, {0x119aa, 0x119d0},
-  {0x119e1, 0x119e1}, {0x119e3, 0x119e3}, {0x11a00, 0x11a00}, {0x11a0b, 0x11a32}, {0x11a3a, 0x11a3a}, {0x11a50, 0x11a50}, {0x11a5c, 0x11a89}, {0x11a9d, 0x11a9d},
-  {0x11ab0, 0x11af8}, {0x11bc0, 0x11be0}, {0x11bf0, 0x11bf9}, {0x11c00, 0x11c08}, {0x11c0a, 0x11c2e}, {0x11c40, 0x11c40}, {0x11c50, 0x11c6c}, {0x11c72, 0x11c8f},
-  {0x11d00, 0x11d06}, {0x11d08, 0x11d09}, {0x11d0b, 0x11d30}, {0x11d46, 0x11d46}, {0x11d50, 0x11d59}, {0x11d60, 0x11d65}, {0x11d67, 0x11d68}, {0x11d6a, 0x11d89},
-  {0x11d98, 0x11d98}, {0x11da0, 0x11da9}, {0x11ee0, 0x11ef2}, {0x11f02, 0x11f02}, {0x11f04, 0x11f10}, {0x11f12, 0x11f33}, {0x11f50, 0x11f59}, {0x11fb0, 0x11fb0},
-  {0x11fc0, 0x11fd4}, {0x12000, 0x12399}, {0x12400, 0x1246e}, {0x12480, 0x12543}, {0x12f90, 0x12ff0}, {0x13000, 0x1342f}, {0x13441, 0x13446}, {0x13460, 0x143fa},
-  {0x14400, 0x14646}, {0x16100, 0x1611d}, {0x16130, 0x16139}, {0x16800, 0x16a38}, {0x16a40, 0x16a5e}, {0x16a60, 0x16a69}, {0x16a70, 0x16abe}, {0x16ac0, 0x16ac9},
-  {0x16ad0, 0x16aed}, {0x16b00, 0x16b2f}, {0x16b40, 0x16b43}, {0x16b50, 0x16b59}, {0x16b5b, 0x16b61}, {0x16b63, 0x16b77}, {0x16b7d, 0x16b8f}, {0x16d40, 0x16d6c},
-  {0x16d70, 0x16d79}, {0x16e40, 0x16e96}, {0x16f00, 0x16f4a}, {0x16f50, 0x16f50}, {0x16f93, 0x16f9f}, {0x16fe0, 0x16fe1}, {0x16fe3, 0x16fe3}, {0x17000, 0x187f7},
-  {0x18800, 0x18cd5}, {0x18cff, 0x18d08}, {0x1aff0, 0x1aff3}, {0x1aff5, 0x1affb}, {0x1affd, 0x1affe}, {0x1b000, 0x1b122}, {0x1b132, 0x1b132}, {0x1b150, 0x1b152},
-  {0x1b155, 0x1b155}, {0x1b164, 0x1b167}, {0x1b170, 0x1b2fb}, {0x1bc00, 0x1bc6a}, {0x1bc70, 0x1bc7c}, {0x1bc80, 0x1bc88}, {0x1bc90, 0x1bc99}, {0x1ccf0, 0x1ccf9},
-  {0x1d2c0, 0x1d2d3}, {0x1d2e0, 0x1d2f3}, {0x1d360, 0x1d378}, {0x1d400, 0x1d454}, {0x1d456, 0x1d49c}, {0x1d49e, 0x1d49f}, {0x1d4a2, 0x1d4a2}, {0x1d4a5, 0x1d4a6},
-  {0x1d4a9, 0x1d4ac}, {0x1d4ae, 0x1d4b9}, {0x1d4bb, 0x1d4bb}, {0x1d4bd, 0x1d4c3}, {0x1d4c5, 0x1d505}, {0x1d507, 0x1d50a}, {0x1d50d, 0x1d514}, {0x1d516, 0x1d51c},
-  {0x1d51e, 0x1d539}, {0x1d53b, 0x1d53e}, {0x1d540, 0x1d544}, {0x1d546, 0x1d546}, {0x1d54a, 0x1d550}, {0x1d552, 0x1d6a5}, {0x1d6a8, 0x1d6c0}, {0x1d6c2, 0x1d6da},
-  {0x1d6dc, 0x1d6fa}, {0x1d6fc, 0x1d714}, {0x1d716, 0x1d734}, {0x1d736, 0x1d74e}, {0x1d750, 0x1d76e}, {0x1d770, 0x1d788}, {0x1d78a, 0x1d7a8}, {0x1d7aa, 0x1d7c2},
-  {0x1d7c4, 0x1d7cb}, {0x1d7ce, 0x1d7ff}, {0x1df00, 0x1df1e}, {0x1df25, 0x1df2a}, {0x1e030, 0x1e06d}, {0x1e100, 0x1e12c}, {0x1e137, 0x1e13d}, {0x1e140, 0x1e149},
-  {0x1e14e, 0x1e14e}, {0x1e290, 0x1e2ad}, {0x1e2c0, 0x1e2eb}, {0x1e2f0, 0x1e2f9}, {0x1e4d0, 0x1e4eb}, {0x1e4f0, 0x1e4f9}, {0x1e5d0, 0x1e5ed}, {0x1e5f0, 0x1e5fa},
-  {0x1e7e0, 0x1e7e6}, {0x1e7e8, 0x1e7eb}, {0x1e7ed, 0x1e7ee}, {0x1e7f0, 0x1e7fe}, {0x1e800, 0x1e8c4}, {0x1e8c7, 0x1e8cf}, {0x1e900, 0x1e943}, {0x1e94b, 0x1e94b},
-  {0x1e950, 0x1e959}, {0x1ec71, 0x1ecab}, {0x1ecad, 0x1ecaf}, {0x1ecb1, 0x1ecb4}, {0x1ed01, 0x1ed2d}, {0x1ed2f, 0x1ed3d}, {0x1ee00, 0x1ee03}, {0x1ee05, 0x1ee1f},
-  {0x1ee21, 0x1ee22}, {0x1ee24, 0x1ee24}, {0x1ee27, 0x1ee27}, {0x1ee29, 0x1ee32}, {0x1ee34, 0x1ee37}, {0x1ee39, 0x1ee39}, {0x1ee3b, 0x1ee3b}, {0x1ee42, 0x1ee42},
-  {0x1ee47, 0x1ee47}, {0x1ee49, 0x1ee49}, {0x1ee4b, 0x1ee4b}, {0x1ee4d, 0x1ee4f}, {0x1ee51, 0x1ee52}, {0x1ee54, 0x1ee54}, {0x1ee57, 0x1ee57}, {0x1ee59, 0x1ee59},
-  {0x1ee5b, 0x1ee5b}, {0x1ee5d, 0x1ee5d}, {0x1ee5f, 0x1ee5f}, {0x1ee61, 0x1ee62}, {0x1ee64, 0x1ee64}, {0x1ee67, 0x1ee6a}, {0x1ee6c, 0x1ee72}, {0x1ee74, 0x1ee77},
-  {0x1ee79, 0x1ee7c}, {0x1ee7e, 0x1ee7e}, {0x1ee80, 0x1ee89}, {0x1ee8b, 0x1ee9b}, {0x1eea1, 0x1eea3}, {0x1eea5, 0x1eea9}, {0x1eeab, 0x1eebb}, {0x1f100, 0x1f10c},
-  {0x1fbf0, 0x1fbf9}, {0x20000, 0x2a6df}, {0x2a700, 0x2b739}, {0x2b740, 0x2b81d}, {0x2b820, 0x2cea1}, {0x2ceb0, 0x2ebe0}, {0x2ebf0, 0x2ee5d}, {0x2f800, 0x2fa1d},
-  {0x30000, 0x3134a}, {0x31350, 0x323af},
-};
-
-static const TSCharacterRange aux_sym_literal_token1_character_set_1[] = {
-  {' ', ' '}, {'#', '&'}, {'(', '+'}, {'-', '-'}, {'/', '/'}, {'<', '>'}, {'@', '@'}, {'\\', '\\'},
-  {'^', '_'}, {'~', '~'},
+  [23] = 23,
+  [24] = 24,
+  [25] = 25,
 };
 
 static bool ts_lex(TSLexer *lexer, TSStateId state) {
@@ -728,244 +247,49 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
   eof = lexer->eof(lexer);
   switch (state) {
     case 0:
-      if (eof) ADVANCE(11);
-      ADVANCE_MAP(
-        '!', 18,
-        '"', 23,
-        '#', 28,
-        '\'', 22,
-        ',', 17,
-        '.', 16,
-        ':', 20,
-        ';', 21,
-        '<', 25,
-        '?', 19,
-        '\\', 13,
-      );
+      if (eof) ADVANCE(7);
+      if (lookahead == '<') ADVANCE(1);
       if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(10);
-      if (('$' <= lookahead && lookahead <= '/') ||
-          ('=' <= lookahead && lookahead <= '@') ||
-          lookahead == '^' ||
-          lookahead == '_' ||
-          lookahead == '~') ADVANCE(24);
-      if (set_contains(sym_word_character_set_1, 770, lookahead)) ADVANCE(15);
+          lookahead == ' ') SKIP(0);
       END_STATE();
     case 1:
-      ADVANCE_MAP(
-        ' ', 14,
-        '!', 18,
-        '"', 23,
-        '\'', 22,
-        ',', 17,
-        '.', 16,
-        ':', 20,
-        ';', 21,
-        '<', 25,
-        '?', 19,
-        '\\', 26,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r')) SKIP(4);
-      if (('#' <= lookahead && lookahead <= '/') ||
-          ('=' <= lookahead && lookahead <= '@') ||
-          lookahead == '^' ||
-          lookahead == '_' ||
-          lookahead == '~') ADVANCE(24);
-      if (set_contains(sym_word_character_set_1, 770, lookahead)) ADVANCE(15);
+      if (lookahead == '!') ADVANCE(2);
       END_STATE();
     case 2:
-      ADVANCE_MAP(
-        ' ', 1,
-        '!', 18,
-        '"', 23,
-        '\'', 22,
-        ',', 17,
-        '.', 16,
-        ':', 20,
-        ';', 21,
-        '<', 25,
-        '?', 19,
-        '\\', 13,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r')) SKIP(4);
-      if (('#' <= lookahead && lookahead <= '/') ||
-          ('=' <= lookahead && lookahead <= '@') ||
-          lookahead == '^' ||
-          lookahead == '_' ||
-          lookahead == '~') ADVANCE(24);
-      if (set_contains(sym_word_character_set_1, 770, lookahead)) ADVANCE(15);
+      if (lookahead == '-') ADVANCE(3);
       END_STATE();
     case 3:
-      ADVANCE_MAP(
-        '!', 18,
-        '"', 23,
-        '#', 28,
-        '\'', 22,
-        ',', 17,
-        '.', 16,
-        ':', 20,
-        ';', 21,
-        '<', 25,
-        '?', 19,
-        '\\', 26,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(3);
-      if (('$' <= lookahead && lookahead <= '/') ||
-          ('=' <= lookahead && lookahead <= '@') ||
-          lookahead == '^' ||
-          lookahead == '_' ||
-          lookahead == '~') ADVANCE(24);
-      if (set_contains(sym_word_character_set_1, 770, lookahead)) ADVANCE(15);
+      if (lookahead == '-') ADVANCE(5);
       END_STATE();
     case 4:
-      ADVANCE_MAP(
-        '!', 18,
-        '"', 23,
-        '\'', 22,
-        ',', 17,
-        '.', 16,
-        ':', 20,
-        ';', 21,
-        '<', 25,
-        '?', 19,
-        '\\', 26,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(4);
-      if (('#' <= lookahead && lookahead <= '/') ||
-          ('=' <= lookahead && lookahead <= '@') ||
-          lookahead == '^' ||
-          lookahead == '_' ||
-          lookahead == '~') ADVANCE(24);
-      if (set_contains(sym_word_character_set_1, 770, lookahead)) ADVANCE(15);
-      END_STATE();
-    case 5:
-      if (lookahead == '-') ADVANCE(9);
-      END_STATE();
-    case 6:
-      if (lookahead == '-') ADVANCE(6);
-      if (lookahead == '>') ADVANCE(12);
+      if (lookahead == '-') ADVANCE(4);
+      if (lookahead == '>') ADVANCE(8);
       if (lookahead != 0 &&
-          lookahead != '\n') ADVANCE(9);
+          lookahead != '\n' &&
+          lookahead != '-' &&
+          lookahead != '>') ADVANCE(5);
       END_STATE();
-    case 7:
+    case 5:
       if (lookahead == '-') ADVANCE(6);
       if (lookahead != 0 &&
-          lookahead != '\n') ADVANCE(9);
+          lookahead != '\n' &&
+          lookahead != '-') ADVANCE(5);
       END_STATE();
-    case 8:
-      if (lookahead == '-') ADVANCE(5);
-      END_STATE();
-    case 9:
-      if (lookahead == '-') ADVANCE(7);
+    case 6:
+      if (lookahead == '-') ADVANCE(4);
       if (lookahead != 0 &&
-          lookahead != '\n') ADVANCE(9);
+          lookahead != '\n' &&
+          lookahead != '-') ADVANCE(5);
       END_STATE();
-    case 10:
-      if (eof) ADVANCE(11);
-      ADVANCE_MAP(
-        '!', 18,
-        '"', 23,
-        '#', 28,
-        '\'', 22,
-        ',', 17,
-        '.', 16,
-        ':', 20,
-        ';', 21,
-        '<', 25,
-        '?', 19,
-        '\\', 26,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(10);
-      if (('$' <= lookahead && lookahead <= '/') ||
-          ('=' <= lookahead && lookahead <= '@') ||
-          lookahead == '^' ||
-          lookahead == '_' ||
-          lookahead == '~') ADVANCE(24);
-      if (set_contains(sym_word_character_set_1, 770, lookahead)) ADVANCE(15);
-      END_STATE();
-    case 11:
+    case 7:
       ACCEPT_TOKEN(ts_builtin_sym_end);
       END_STATE();
-    case 12:
+    case 8:
       ACCEPT_TOKEN(sym_comment);
-      if (lookahead == '-') ADVANCE(7);
+      if (lookahead == '-') ADVANCE(6);
       if (lookahead != 0 &&
-          lookahead != '\n') ADVANCE(9);
-      END_STATE();
-    case 13:
-      ACCEPT_TOKEN(anon_sym_BSLASH);
-      if (set_contains(aux_sym_literal_token1_character_set_1, 10, lookahead)) ADVANCE(27);
-      END_STATE();
-    case 14:
-      ACCEPT_TOKEN(anon_sym_);
-      END_STATE();
-    case 15:
-      ACCEPT_TOKEN(sym_word);
-      if (set_contains(sym_word_character_set_1, 770, lookahead)) ADVANCE(15);
-      END_STATE();
-    case 16:
-      ACCEPT_TOKEN(sym_period);
-      END_STATE();
-    case 17:
-      ACCEPT_TOKEN(sym_comma);
-      END_STATE();
-    case 18:
-      ACCEPT_TOKEN(sym_exclamation);
-      END_STATE();
-    case 19:
-      ACCEPT_TOKEN(sym_question);
-      END_STATE();
-    case 20:
-      ACCEPT_TOKEN(sym_colon);
-      END_STATE();
-    case 21:
-      ACCEPT_TOKEN(sym_semi_colon);
-      END_STATE();
-    case 22:
-      ACCEPT_TOKEN(sym_single_quote);
-      END_STATE();
-    case 23:
-      ACCEPT_TOKEN(sym_double_quote);
-      END_STATE();
-    case 24:
-      ACCEPT_TOKEN(sym_symbols);
-      END_STATE();
-    case 25:
-      ACCEPT_TOKEN(sym_symbols);
-      if (lookahead == '!') ADVANCE(8);
-      END_STATE();
-    case 26:
-      ACCEPT_TOKEN(sym_symbols);
-      if (set_contains(aux_sym_literal_token1_character_set_1, 10, lookahead)) ADVANCE(27);
-      END_STATE();
-    case 27:
-      ACCEPT_TOKEN(aux_sym_literal_token1);
-      END_STATE();
-    case 28:
-      ACCEPT_TOKEN(anon_sym_POUND);
-      if (lookahead == '#') ADVANCE(29);
-      END_STATE();
-    case 29:
-      ACCEPT_TOKEN(anon_sym_POUND_POUND);
-      if (lookahead == '#') ADVANCE(30);
-      END_STATE();
-    case 30:
-      ACCEPT_TOKEN(anon_sym_POUND_POUND_POUND);
-      if (lookahead == '#') ADVANCE(31);
-      END_STATE();
-    case 31:
-      ACCEPT_TOKEN(anon_sym_POUND_POUND_POUND_POUND);
-      if (lookahead == '#') ADVANCE(32);
-      END_STATE();
-    case 32:
-      ACCEPT_TOKEN(anon_sym_POUND_POUND_POUND_POUND_POUND);
-      if (lookahead == '#') ADVANCE(33);
-      END_STATE();
-    case 33:
-      ACCEPT_TOKEN(anon_sym_POUND_POUND_POUND_POUND_POUND_POUND);
+          lookahead != '\n' &&
+          lookahead != '-') ADVANCE(5);
       END_STATE();
     default:
       return false;
@@ -975,3340 +299,439 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
 static const TSLexerMode ts_lex_modes[STATE_COUNT] = {
   [0] = {.lex_state = 0, .external_lex_state = 1},
   [1] = {.lex_state = 0, .external_lex_state = 2},
-  [2] = {.lex_state = 3, .external_lex_state = 3},
-  [3] = {.lex_state = 2, .external_lex_state = 4},
-  [4] = {.lex_state = 2, .external_lex_state = 4},
-  [5] = {.lex_state = 4, .external_lex_state = 5},
-  [6] = {.lex_state = 4, .external_lex_state = 6},
-  [7] = {.lex_state = 4, .external_lex_state = 5},
-  [8] = {.lex_state = 4, .external_lex_state = 6},
-  [9] = {.lex_state = 4, .external_lex_state = 5},
-  [10] = {.lex_state = 4, .external_lex_state = 6},
-  [11] = {.lex_state = 4, .external_lex_state = 5},
-  [12] = {.lex_state = 4, .external_lex_state = 6},
-  [13] = {.lex_state = 4, .external_lex_state = 5},
-  [14] = {.lex_state = 4, .external_lex_state = 6},
-  [15] = {.lex_state = 4, .external_lex_state = 5},
-  [16] = {.lex_state = 4, .external_lex_state = 6},
-  [17] = {.lex_state = 4, .external_lex_state = 3},
-  [18] = {.lex_state = 4, .external_lex_state = 3},
-  [19] = {.lex_state = 4, .external_lex_state = 3},
-  [20] = {.lex_state = 4, .external_lex_state = 3},
-  [21] = {.lex_state = 4, .external_lex_state = 3},
-  [22] = {.lex_state = 4, .external_lex_state = 3},
-  [23] = {.lex_state = 4, .external_lex_state = 3},
-  [24] = {.lex_state = 4, .external_lex_state = 3},
-  [25] = {.lex_state = 4, .external_lex_state = 3},
-  [26] = {.lex_state = 4, .external_lex_state = 3},
-  [27] = {.lex_state = 4, .external_lex_state = 3},
-  [28] = {.lex_state = 2, .external_lex_state = 7},
-  [29] = {.lex_state = 2, .external_lex_state = 8},
-  [30] = {.lex_state = 2, .external_lex_state = 8},
-  [31] = {.lex_state = 2, .external_lex_state = 7},
-  [32] = {.lex_state = 4, .external_lex_state = 9},
-  [33] = {.lex_state = 4, .external_lex_state = 10},
-  [34] = {.lex_state = 4, .external_lex_state = 11},
-  [35] = {.lex_state = 4, .external_lex_state = 10},
-  [36] = {.lex_state = 4, .external_lex_state = 11},
-  [37] = {.lex_state = 4, .external_lex_state = 10},
-  [38] = {.lex_state = 4, .external_lex_state = 9},
-  [39] = {.lex_state = 4, .external_lex_state = 10},
-  [40] = {.lex_state = 4, .external_lex_state = 10},
-  [41] = {.lex_state = 4, .external_lex_state = 10},
-  [42] = {.lex_state = 2, .external_lex_state = 4},
-  [43] = {.lex_state = 2, .external_lex_state = 4},
-  [44] = {.lex_state = 2, .external_lex_state = 4},
-  [45] = {.lex_state = 2, .external_lex_state = 4},
-  [46] = {.lex_state = 2, .external_lex_state = 4},
-  [47] = {.lex_state = 2, .external_lex_state = 4},
-  [48] = {.lex_state = 2, .external_lex_state = 4},
-  [49] = {.lex_state = 2, .external_lex_state = 4},
-  [50] = {.lex_state = 2, .external_lex_state = 4},
-  [51] = {.lex_state = 4, .external_lex_state = 6},
-  [52] = {.lex_state = 4, .external_lex_state = 5},
-  [53] = {.lex_state = 4, .external_lex_state = 5},
-  [54] = {.lex_state = 4, .external_lex_state = 5},
-  [55] = {.lex_state = 4, .external_lex_state = 5},
-  [56] = {.lex_state = 4, .external_lex_state = 5},
-  [57] = {.lex_state = 4, .external_lex_state = 5},
-  [58] = {.lex_state = 4, .external_lex_state = 5},
-  [59] = {.lex_state = 4, .external_lex_state = 6},
-  [60] = {.lex_state = 4, .external_lex_state = 6},
-  [61] = {.lex_state = 4, .external_lex_state = 6},
-  [62] = {.lex_state = 4, .external_lex_state = 6},
-  [63] = {.lex_state = 4, .external_lex_state = 6},
-  [64] = {.lex_state = 4, .external_lex_state = 6},
-  [65] = {.lex_state = 4, .external_lex_state = 6},
-  [66] = {.lex_state = 4, .external_lex_state = 6},
-  [67] = {.lex_state = 4, .external_lex_state = 5},
-  [68] = {.lex_state = 2, .external_lex_state = 7},
-  [69] = {.lex_state = 2, .external_lex_state = 7},
-  [70] = {.lex_state = 2, .external_lex_state = 7},
-  [71] = {.lex_state = 2, .external_lex_state = 7},
-  [72] = {.lex_state = 2, .external_lex_state = 7},
-  [73] = {.lex_state = 2, .external_lex_state = 7},
-  [74] = {.lex_state = 2, .external_lex_state = 8},
-  [75] = {.lex_state = 2, .external_lex_state = 8},
-  [76] = {.lex_state = 2, .external_lex_state = 8},
-  [77] = {.lex_state = 2, .external_lex_state = 8},
-  [78] = {.lex_state = 2, .external_lex_state = 8},
-  [79] = {.lex_state = 2, .external_lex_state = 8},
-  [80] = {.lex_state = 4, .external_lex_state = 5},
-  [81] = {.lex_state = 4, .external_lex_state = 9},
-  [82] = {.lex_state = 4, .external_lex_state = 11},
-  [83] = {.lex_state = 4, .external_lex_state = 9},
-  [84] = {.lex_state = 4, .external_lex_state = 11},
-  [85] = {.lex_state = 0, .external_lex_state = 2},
-  [86] = {.lex_state = 0, .external_lex_state = 2},
-  [87] = {.lex_state = 0, .external_lex_state = 2},
-  [88] = {.lex_state = 0, .external_lex_state = 2},
-  [89] = {.lex_state = 0, .external_lex_state = 2},
-  [90] = {.lex_state = 0, .external_lex_state = 2},
-  [91] = {.lex_state = 0, .external_lex_state = 2},
-  [92] = {.lex_state = 0, .external_lex_state = 2},
-  [93] = {.lex_state = 0, .external_lex_state = 2},
-  [94] = {.lex_state = 0, .external_lex_state = 2},
-  [95] = {.lex_state = 0, .external_lex_state = 2},
-  [96] = {.lex_state = 0, .external_lex_state = 2},
-  [97] = {.lex_state = 0, .external_lex_state = 2},
-  [98] = {.lex_state = 0, .external_lex_state = 2},
-  [99] = {.lex_state = 0, .external_lex_state = 2},
-  [100] = {.lex_state = 0, .external_lex_state = 2},
-  [101] = {.lex_state = 0, .external_lex_state = 2},
-  [102] = {.lex_state = 0, .external_lex_state = 2},
-  [103] = {.lex_state = 0, .external_lex_state = 2},
-  [104] = {.lex_state = 0, .external_lex_state = 2},
-  [105] = {.lex_state = 0, .external_lex_state = 2},
-  [106] = {.lex_state = 0, .external_lex_state = 2},
-  [107] = {.lex_state = 0, .external_lex_state = 2},
-  [108] = {.lex_state = 0, .external_lex_state = 2},
-  [109] = {.lex_state = 0, .external_lex_state = 2},
-  [110] = {.lex_state = 0, .external_lex_state = 2},
-  [111] = {.lex_state = 0, .external_lex_state = 2},
-  [112] = {.lex_state = 0, .external_lex_state = 2},
-  [113] = {.lex_state = 0, .external_lex_state = 12},
-  [114] = {.lex_state = 0, .external_lex_state = 12},
-  [115] = {.lex_state = 0, .external_lex_state = 12},
-  [116] = {.lex_state = 0, .external_lex_state = 12},
-  [117] = {.lex_state = 0, .external_lex_state = 12},
-  [118] = {.lex_state = 0, .external_lex_state = 12},
-  [119] = {.lex_state = 0, .external_lex_state = 13},
-  [120] = {.lex_state = 0, .external_lex_state = 14},
-  [121] = {.lex_state = 0},
-  [122] = {.lex_state = 0, .external_lex_state = 15},
-  [123] = {.lex_state = 0, .external_lex_state = 15},
-  [124] = {.lex_state = 0, .external_lex_state = 14},
-  [125] = {.lex_state = 0, .external_lex_state = 14},
-  [126] = {.lex_state = 0, .external_lex_state = 13},
-  [127] = {.lex_state = 0, .external_lex_state = 13},
-  [128] = {.lex_state = 0, .external_lex_state = 15},
+  [2] = {.lex_state = 0, .external_lex_state = 2},
+  [3] = {.lex_state = 0, .external_lex_state = 2},
+  [4] = {.lex_state = 0, .external_lex_state = 2},
+  [5] = {.lex_state = 0, .external_lex_state = 3},
+  [6] = {.lex_state = 0, .external_lex_state = 2},
+  [7] = {.lex_state = 0, .external_lex_state = 2},
+  [8] = {.lex_state = 0, .external_lex_state = 4},
+  [9] = {.lex_state = 0, .external_lex_state = 2},
+  [10] = {.lex_state = 0, .external_lex_state = 2},
+  [11] = {.lex_state = 0, .external_lex_state = 2},
+  [12] = {.lex_state = 0, .external_lex_state = 2},
+  [13] = {.lex_state = 0, .external_lex_state = 2},
+  [14] = {.lex_state = 0, .external_lex_state = 2},
+  [15] = {.lex_state = 0, .external_lex_state = 2},
+  [16] = {.lex_state = 0, .external_lex_state = 2},
+  [17] = {.lex_state = 0, .external_lex_state = 2},
+  [18] = {.lex_state = 0, .external_lex_state = 2},
+  [19] = {.lex_state = 0, .external_lex_state = 2},
+  [20] = {.lex_state = 0, .external_lex_state = 2},
+  [21] = {.lex_state = 0, .external_lex_state = 5},
+  [22] = {.lex_state = 0, .external_lex_state = 5},
+  [23] = {.lex_state = 0, .external_lex_state = 6},
+  [24] = {.lex_state = 0, .external_lex_state = 7},
+  [25] = {.lex_state = 0},
 };
 
 static const uint16_t ts_parse_table[LARGE_STATE_COUNT][SYMBOL_COUNT] = {
   [STATE(0)] = {
     [ts_builtin_sym_end] = ACTIONS(1),
     [sym_comment] = ACTIONS(3),
-    [anon_sym_BSLASH] = ACTIONS(1),
-    [sym_word] = ACTIONS(1),
-    [sym_period] = ACTIONS(1),
-    [sym_comma] = ACTIONS(1),
-    [sym_exclamation] = ACTIONS(1),
-    [sym_question] = ACTIONS(1),
-    [sym_colon] = ACTIONS(1),
-    [sym_semi_colon] = ACTIONS(1),
-    [sym_single_quote] = ACTIONS(1),
-    [sym_double_quote] = ACTIONS(1),
-    [sym_symbols] = ACTIONS(1),
-    [aux_sym_literal_token1] = ACTIONS(1),
-    [anon_sym_POUND] = ACTIONS(1),
-    [anon_sym_POUND_POUND] = ACTIONS(1),
-    [anon_sym_POUND_POUND_POUND] = ACTIONS(1),
-    [anon_sym_POUND_POUND_POUND_POUND] = ACTIONS(1),
-    [anon_sym_POUND_POUND_POUND_POUND_POUND] = ACTIONS(1),
-    [anon_sym_POUND_POUND_POUND_POUND_POUND_POUND] = ACTIONS(1),
-    [sym__line_start] = ACTIONS(1),
     [sym_line_end] = ACTIONS(1),
-    [sym__emph_star_start] = ACTIONS(1),
-    [sym__emph_star_end] = ACTIONS(1),
-    [sym__emph_under_start] = ACTIONS(1),
-    [sym__emph_under_end] = ACTIONS(1),
-    [sym__strong_star_start] = ACTIONS(1),
-    [sym__strong_star_end] = ACTIONS(1),
-    [sym__strong_under_start] = ACTIONS(1),
-    [sym__strong_under_end] = ACTIONS(1),
-    [sym__no_parse] = ACTIONS(1),
+    [sym_inline] = ACTIONS(1),
+    [sym__atx_heading_inline] = ACTIONS(1),
+    [sym__setext_heading_inline] = ACTIONS(1),
+    [sym_atx_h1_marker] = ACTIONS(1),
+    [sym_atx_h2_marker] = ACTIONS(1),
+    [sym_atx_h3_marker] = ACTIONS(1),
+    [sym_atx_h4_marker] = ACTIONS(1),
+    [sym_atx_h5_marker] = ACTIONS(1),
+    [sym_atx_h6_marker] = ACTIONS(1),
+    [sym_setext_h1_underline] = ACTIONS(1),
+    [sym_setext_h2_underline] = ACTIONS(1),
+    [sym__atx_closing_sequence] = ACTIONS(1),
     [sym__unused_error] = ACTIONS(1),
   },
   [STATE(1)] = {
-    [sym_source_file] = STATE(121),
-    [sym_paragraph] = STATE(91),
-    [sym__line] = STATE(92),
-    [sym_content] = STATE(86),
-    [sym__section] = STATE(86),
-    [sym_heading] = STATE(87),
-    [aux_sym_source_file_repeat1] = STATE(86),
-    [aux_sym_paragraph_repeat1] = STATE(92),
-    [aux_sym_paragraph_end_repeat1] = STATE(88),
-    [aux_sym_content_repeat1] = STATE(91),
+    [sym_source_file] = STATE(25),
+    [sym_paragraph] = STATE(6),
+    [sym_content] = STATE(2),
+    [sym__section] = STATE(2),
+    [sym_heading] = STATE(4),
+    [aux_sym_source_file_repeat1] = STATE(2),
+    [aux_sym_paragraph_end_repeat1] = STATE(21),
+    [aux_sym_content_repeat1] = STATE(6),
     [ts_builtin_sym_end] = ACTIONS(5),
     [sym_comment] = ACTIONS(3),
-    [sym__line_start] = ACTIONS(7),
-    [sym_line_end] = ACTIONS(9),
+    [sym_line_end] = ACTIONS(7),
+    [sym_inline] = ACTIONS(9),
+    [sym__setext_heading_inline] = ACTIONS(11),
+    [sym_atx_h1_marker] = ACTIONS(13),
+    [sym_atx_h2_marker] = ACTIONS(13),
+    [sym_atx_h3_marker] = ACTIONS(13),
+    [sym_atx_h4_marker] = ACTIONS(13),
+    [sym_atx_h5_marker] = ACTIONS(13),
+    [sym_atx_h6_marker] = ACTIONS(13),
   },
   [STATE(2)] = {
-    [aux_sym__line_content] = STATE(3),
-    [sym_puncuation] = STATE(3),
-    [sym_quotation] = STATE(50),
-    [sym_literal] = STATE(3),
-    [sym_heading_1] = STATE(111),
-    [sym_heading_2] = STATE(111),
-    [sym_heading_3] = STATE(111),
-    [sym_heading_4] = STATE(111),
-    [sym_heading_5] = STATE(111),
-    [sym_heading_6] = STATE(111),
-    [sym_emph] = STATE(3),
-    [sym__emph_star] = STATE(49),
-    [sym__emph_under] = STATE(49),
-    [sym_strong] = STATE(3),
-    [sym__strong_star] = STATE(43),
-    [sym__strong_under] = STATE(43),
+    [sym_paragraph] = STATE(6),
+    [sym_content] = STATE(3),
+    [sym__section] = STATE(3),
+    [sym_heading] = STATE(4),
+    [aux_sym_source_file_repeat1] = STATE(3),
+    [aux_sym_paragraph_end_repeat1] = STATE(21),
+    [aux_sym_content_repeat1] = STATE(6),
+    [ts_builtin_sym_end] = ACTIONS(15),
     [sym_comment] = ACTIONS(3),
-    [sym_word] = ACTIONS(11),
-    [sym_period] = ACTIONS(13),
-    [sym_comma] = ACTIONS(13),
-    [sym_exclamation] = ACTIONS(13),
-    [sym_question] = ACTIONS(13),
-    [sym_colon] = ACTIONS(13),
-    [sym_semi_colon] = ACTIONS(13),
-    [sym_single_quote] = ACTIONS(15),
-    [sym_double_quote] = ACTIONS(15),
-    [sym_symbols] = ACTIONS(17),
-    [aux_sym_literal_token1] = ACTIONS(19),
-    [anon_sym_POUND] = ACTIONS(21),
-    [anon_sym_POUND_POUND] = ACTIONS(23),
-    [anon_sym_POUND_POUND_POUND] = ACTIONS(25),
-    [anon_sym_POUND_POUND_POUND_POUND] = ACTIONS(27),
-    [anon_sym_POUND_POUND_POUND_POUND_POUND] = ACTIONS(29),
-    [anon_sym_POUND_POUND_POUND_POUND_POUND_POUND] = ACTIONS(31),
-    [sym__emph_star_start] = ACTIONS(33),
-    [sym__emph_under_start] = ACTIONS(35),
-    [sym__strong_star_start] = ACTIONS(37),
-    [sym__strong_under_start] = ACTIONS(39),
-    [sym__no_parse] = ACTIONS(11),
+    [sym_line_end] = ACTIONS(7),
+    [sym_inline] = ACTIONS(9),
+    [sym__setext_heading_inline] = ACTIONS(11),
+    [sym_atx_h1_marker] = ACTIONS(13),
+    [sym_atx_h2_marker] = ACTIONS(13),
+    [sym_atx_h3_marker] = ACTIONS(13),
+    [sym_atx_h4_marker] = ACTIONS(13),
+    [sym_atx_h5_marker] = ACTIONS(13),
+    [sym_atx_h6_marker] = ACTIONS(13),
+  },
+  [STATE(3)] = {
+    [sym_paragraph] = STATE(6),
+    [sym_content] = STATE(3),
+    [sym__section] = STATE(3),
+    [sym_heading] = STATE(4),
+    [aux_sym_source_file_repeat1] = STATE(3),
+    [aux_sym_paragraph_end_repeat1] = STATE(21),
+    [aux_sym_content_repeat1] = STATE(6),
+    [ts_builtin_sym_end] = ACTIONS(17),
+    [sym_comment] = ACTIONS(3),
+    [sym_line_end] = ACTIONS(19),
+    [sym_inline] = ACTIONS(22),
+    [sym__setext_heading_inline] = ACTIONS(25),
+    [sym_atx_h1_marker] = ACTIONS(28),
+    [sym_atx_h2_marker] = ACTIONS(28),
+    [sym_atx_h3_marker] = ACTIONS(28),
+    [sym_atx_h4_marker] = ACTIONS(28),
+    [sym_atx_h5_marker] = ACTIONS(28),
+    [sym_atx_h6_marker] = ACTIONS(28),
+  },
+  [STATE(4)] = {
+    [sym_paragraph] = STATE(6),
+    [sym_content] = STATE(19),
+    [aux_sym_paragraph_end_repeat1] = STATE(21),
+    [aux_sym_content_repeat1] = STATE(6),
+    [ts_builtin_sym_end] = ACTIONS(31),
+    [sym_comment] = ACTIONS(3),
+    [sym_line_end] = ACTIONS(7),
+    [sym_inline] = ACTIONS(9),
+    [sym__setext_heading_inline] = ACTIONS(31),
+    [sym_atx_h1_marker] = ACTIONS(31),
+    [sym_atx_h2_marker] = ACTIONS(31),
+    [sym_atx_h3_marker] = ACTIONS(31),
+    [sym_atx_h4_marker] = ACTIONS(31),
+    [sym_atx_h5_marker] = ACTIONS(31),
+    [sym_atx_h6_marker] = ACTIONS(31),
+  },
+  [STATE(5)] = {
+    [aux_sym_paragraph_end_repeat1] = STATE(12),
+    [ts_builtin_sym_end] = ACTIONS(33),
+    [sym_comment] = ACTIONS(3),
+    [sym_line_end] = ACTIONS(35),
+    [sym_inline] = ACTIONS(33),
+    [sym__atx_heading_inline] = ACTIONS(37),
+    [sym__setext_heading_inline] = ACTIONS(33),
+    [sym_atx_h1_marker] = ACTIONS(33),
+    [sym_atx_h2_marker] = ACTIONS(33),
+    [sym_atx_h3_marker] = ACTIONS(33),
+    [sym_atx_h4_marker] = ACTIONS(33),
+    [sym_atx_h5_marker] = ACTIONS(33),
+    [sym_atx_h6_marker] = ACTIONS(33),
+    [sym__atx_closing_sequence] = ACTIONS(39),
+  },
+  [STATE(6)] = {
+    [sym_paragraph] = STATE(10),
+    [aux_sym_content_repeat1] = STATE(10),
+    [ts_builtin_sym_end] = ACTIONS(41),
+    [sym_comment] = ACTIONS(3),
+    [sym_line_end] = ACTIONS(41),
+    [sym_inline] = ACTIONS(9),
+    [sym__setext_heading_inline] = ACTIONS(41),
+    [sym_atx_h1_marker] = ACTIONS(41),
+    [sym_atx_h2_marker] = ACTIONS(41),
+    [sym_atx_h3_marker] = ACTIONS(41),
+    [sym_atx_h4_marker] = ACTIONS(41),
+    [sym_atx_h5_marker] = ACTIONS(41),
+    [sym_atx_h6_marker] = ACTIONS(41),
+  },
+  [STATE(7)] = {
+    [sym_paragraph_end] = STATE(20),
+    [aux_sym_paragraph_end_repeat1] = STATE(13),
+    [ts_builtin_sym_end] = ACTIONS(43),
+    [sym_comment] = ACTIONS(3),
+    [sym_line_end] = ACTIONS(45),
+    [sym_inline] = ACTIONS(43),
+    [sym__setext_heading_inline] = ACTIONS(43),
+    [sym_atx_h1_marker] = ACTIONS(43),
+    [sym_atx_h2_marker] = ACTIONS(43),
+    [sym_atx_h3_marker] = ACTIONS(43),
+    [sym_atx_h4_marker] = ACTIONS(43),
+    [sym_atx_h5_marker] = ACTIONS(43),
+    [sym_atx_h6_marker] = ACTIONS(43),
+  },
+  [STATE(8)] = {
+    [aux_sym_paragraph_end_repeat1] = STATE(15),
+    [ts_builtin_sym_end] = ACTIONS(47),
+    [sym_comment] = ACTIONS(3),
+    [sym_line_end] = ACTIONS(49),
+    [sym_inline] = ACTIONS(47),
+    [sym__setext_heading_inline] = ACTIONS(47),
+    [sym_atx_h1_marker] = ACTIONS(47),
+    [sym_atx_h2_marker] = ACTIONS(47),
+    [sym_atx_h3_marker] = ACTIONS(47),
+    [sym_atx_h4_marker] = ACTIONS(47),
+    [sym_atx_h5_marker] = ACTIONS(47),
+    [sym_atx_h6_marker] = ACTIONS(47),
+    [sym__atx_closing_sequence] = ACTIONS(51),
+  },
+  [STATE(9)] = {
+    [sym_paragraph] = STATE(10),
+    [aux_sym_content_repeat1] = STATE(10),
+    [ts_builtin_sym_end] = ACTIONS(53),
+    [sym_comment] = ACTIONS(3),
+    [sym_line_end] = ACTIONS(53),
+    [sym_inline] = ACTIONS(9),
+    [sym__setext_heading_inline] = ACTIONS(53),
+    [sym_atx_h1_marker] = ACTIONS(53),
+    [sym_atx_h2_marker] = ACTIONS(53),
+    [sym_atx_h3_marker] = ACTIONS(53),
+    [sym_atx_h4_marker] = ACTIONS(53),
+    [sym_atx_h5_marker] = ACTIONS(53),
+    [sym_atx_h6_marker] = ACTIONS(53),
+  },
+  [STATE(10)] = {
+    [sym_paragraph] = STATE(10),
+    [aux_sym_content_repeat1] = STATE(10),
+    [ts_builtin_sym_end] = ACTIONS(55),
+    [sym_comment] = ACTIONS(3),
+    [sym_line_end] = ACTIONS(55),
+    [sym_inline] = ACTIONS(57),
+    [sym__setext_heading_inline] = ACTIONS(55),
+    [sym_atx_h1_marker] = ACTIONS(55),
+    [sym_atx_h2_marker] = ACTIONS(55),
+    [sym_atx_h3_marker] = ACTIONS(55),
+    [sym_atx_h4_marker] = ACTIONS(55),
+    [sym_atx_h5_marker] = ACTIONS(55),
+    [sym_atx_h6_marker] = ACTIONS(55),
   },
 };
 
 static const uint16_t ts_small_parse_table[] = {
-  [0] = 18,
-    ACTIONS(33), 1,
-      sym__emph_star_start,
-    ACTIONS(35), 1,
-      sym__emph_under_start,
-    ACTIONS(37), 1,
-      sym__strong_star_start,
-    ACTIONS(39), 1,
-      sym__strong_under_start,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(43), 1,
-      anon_sym_BSLASH,
-    ACTIONS(45), 1,
-      anon_sym_,
-    ACTIONS(53), 1,
-      aux_sym_literal_token1,
-    ACTIONS(55), 1,
-      sym_line_end,
-    ACTIONS(57), 1,
-      sym__no_parse,
-    STATE(50), 1,
-      sym_quotation,
-    STATE(112), 1,
-      sym_line_break,
-    ACTIONS(47), 2,
-      sym_word,
-      sym_symbols,
-    ACTIONS(51), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(43), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(49), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(4), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(49), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [68] = 16,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(59), 1,
-      anon_sym_BSLASH,
-    ACTIONS(72), 1,
-      aux_sym_literal_token1,
-    ACTIONS(75), 1,
-      sym__emph_star_start,
-    ACTIONS(78), 1,
-      sym__emph_under_start,
-    ACTIONS(81), 1,
-      sym__strong_star_start,
-    ACTIONS(84), 1,
-      sym__strong_under_start,
-    ACTIONS(87), 1,
-      sym__no_parse,
-    STATE(50), 1,
-      sym_quotation,
-    ACTIONS(61), 2,
-      sym_line_end,
-      anon_sym_,
-    ACTIONS(63), 2,
-      sym_word,
-      sym_symbols,
-    ACTIONS(69), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(43), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(49), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(4), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(66), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [131] = 15,
+  [0] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(96), 1,
-      sym_symbols,
-    ACTIONS(98), 1,
-      aux_sym_literal_token1,
-    ACTIONS(100), 1,
-      sym__emph_star_start,
-    ACTIONS(102), 1,
-      sym__emph_star_end,
-    ACTIONS(104), 1,
-      sym__emph_under_start,
-    ACTIONS(106), 1,
-      sym__strong_star_start,
-    ACTIONS(108), 1,
-      sym__strong_under_start,
-    STATE(80), 1,
-      sym_quotation,
-    ACTIONS(90), 2,
-      sym__no_parse,
-      sym_word,
-    ACTIONS(94), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(53), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(54), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(7), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(92), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [190] = 15,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(116), 1,
-      sym_symbols,
-    ACTIONS(118), 1,
-      aux_sym_literal_token1,
-    ACTIONS(120), 1,
-      sym__emph_star_start,
-    ACTIONS(122), 1,
-      sym__emph_under_start,
-    ACTIONS(124), 1,
-      sym__emph_under_end,
-    ACTIONS(126), 1,
-      sym__strong_star_start,
-    ACTIONS(128), 1,
-      sym__strong_under_start,
-    STATE(59), 1,
-      sym_quotation,
-    ACTIONS(110), 2,
-      sym__no_parse,
-      sym_word,
-    ACTIONS(114), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(62), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(63), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(8), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(112), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [249] = 15,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(61), 1,
-      sym__emph_star_end,
-    ACTIONS(139), 1,
-      sym_symbols,
-    ACTIONS(142), 1,
-      aux_sym_literal_token1,
-    ACTIONS(145), 1,
-      sym__emph_star_start,
-    ACTIONS(148), 1,
-      sym__emph_under_start,
-    ACTIONS(151), 1,
-      sym__strong_star_start,
-    ACTIONS(154), 1,
-      sym__strong_under_start,
-    STATE(80), 1,
-      sym_quotation,
-    ACTIONS(130), 2,
-      sym__no_parse,
-      sym_word,
-    ACTIONS(136), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(53), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(54), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(7), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(133), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [308] = 15,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(61), 1,
-      sym__emph_under_end,
-    ACTIONS(166), 1,
-      sym_symbols,
-    ACTIONS(169), 1,
-      aux_sym_literal_token1,
-    ACTIONS(172), 1,
-      sym__emph_star_start,
-    ACTIONS(175), 1,
-      sym__emph_under_start,
-    ACTIONS(178), 1,
-      sym__strong_star_start,
-    ACTIONS(181), 1,
-      sym__strong_under_start,
-    STATE(59), 1,
-      sym_quotation,
-    ACTIONS(157), 2,
-      sym__no_parse,
-      sym_word,
-    ACTIONS(163), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(62), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(63), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(8), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(160), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [367] = 15,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(96), 1,
-      sym_symbols,
-    ACTIONS(98), 1,
-      aux_sym_literal_token1,
-    ACTIONS(100), 1,
-      sym__emph_star_start,
-    ACTIONS(104), 1,
-      sym__emph_under_start,
-    ACTIONS(106), 1,
-      sym__strong_star_start,
-    ACTIONS(108), 1,
-      sym__strong_under_start,
-    ACTIONS(184), 1,
-      sym__emph_star_end,
-    STATE(80), 1,
-      sym_quotation,
-    ACTIONS(90), 2,
-      sym__no_parse,
-      sym_word,
-    ACTIONS(94), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(53), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(54), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(7), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(92), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [426] = 15,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(116), 1,
-      sym_symbols,
-    ACTIONS(118), 1,
-      aux_sym_literal_token1,
-    ACTIONS(120), 1,
-      sym__emph_star_start,
-    ACTIONS(122), 1,
-      sym__emph_under_start,
-    ACTIONS(126), 1,
-      sym__strong_star_start,
-    ACTIONS(128), 1,
-      sym__strong_under_start,
-    ACTIONS(186), 1,
-      sym__emph_under_end,
-    STATE(59), 1,
-      sym_quotation,
-    ACTIONS(110), 2,
-      sym__no_parse,
-      sym_word,
-    ACTIONS(114), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(62), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(63), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(8), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(112), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [485] = 15,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(96), 1,
-      sym_symbols,
-    ACTIONS(98), 1,
-      aux_sym_literal_token1,
-    ACTIONS(100), 1,
-      sym__emph_star_start,
-    ACTIONS(104), 1,
-      sym__emph_under_start,
-    ACTIONS(106), 1,
-      sym__strong_star_start,
-    ACTIONS(108), 1,
-      sym__strong_under_start,
-    ACTIONS(188), 1,
-      sym__emph_star_end,
-    STATE(80), 1,
-      sym_quotation,
-    ACTIONS(90), 2,
-      sym__no_parse,
-      sym_word,
-    ACTIONS(94), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(53), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(54), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(7), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(92), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [544] = 15,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(116), 1,
-      sym_symbols,
-    ACTIONS(118), 1,
-      aux_sym_literal_token1,
-    ACTIONS(120), 1,
-      sym__emph_star_start,
-    ACTIONS(122), 1,
-      sym__emph_under_start,
-    ACTIONS(126), 1,
-      sym__strong_star_start,
-    ACTIONS(128), 1,
-      sym__strong_under_start,
-    ACTIONS(190), 1,
-      sym__emph_under_end,
-    STATE(59), 1,
-      sym_quotation,
-    ACTIONS(110), 2,
-      sym__no_parse,
-      sym_word,
-    ACTIONS(114), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(62), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(63), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(8), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(112), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [603] = 15,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(96), 1,
-      sym_symbols,
-    ACTIONS(98), 1,
-      aux_sym_literal_token1,
-    ACTIONS(100), 1,
-      sym__emph_star_start,
-    ACTIONS(104), 1,
-      sym__emph_under_start,
-    ACTIONS(106), 1,
-      sym__strong_star_start,
-    ACTIONS(108), 1,
-      sym__strong_under_start,
-    ACTIONS(192), 1,
-      sym__emph_star_end,
-    STATE(80), 1,
-      sym_quotation,
-    ACTIONS(90), 2,
-      sym__no_parse,
-      sym_word,
-    ACTIONS(94), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(53), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(54), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(7), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(92), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [662] = 15,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(116), 1,
-      sym_symbols,
-    ACTIONS(118), 1,
-      aux_sym_literal_token1,
-    ACTIONS(120), 1,
-      sym__emph_star_start,
-    ACTIONS(122), 1,
-      sym__emph_under_start,
-    ACTIONS(126), 1,
-      sym__strong_star_start,
-    ACTIONS(128), 1,
-      sym__strong_under_start,
-    ACTIONS(194), 1,
-      sym__emph_under_end,
-    STATE(59), 1,
-      sym_quotation,
-    ACTIONS(110), 2,
-      sym__no_parse,
-      sym_word,
-    ACTIONS(114), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(62), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(63), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(8), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(112), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [721] = 15,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(96), 1,
-      sym_symbols,
-    ACTIONS(98), 1,
-      aux_sym_literal_token1,
-    ACTIONS(100), 1,
-      sym__emph_star_start,
-    ACTIONS(104), 1,
-      sym__emph_under_start,
-    ACTIONS(106), 1,
-      sym__strong_star_start,
-    ACTIONS(108), 1,
-      sym__strong_under_start,
-    ACTIONS(196), 1,
-      sym__emph_star_end,
-    STATE(80), 1,
-      sym_quotation,
-    ACTIONS(90), 2,
-      sym__no_parse,
-      sym_word,
-    ACTIONS(94), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(53), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(54), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(7), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(92), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [780] = 15,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(116), 1,
-      sym_symbols,
-    ACTIONS(118), 1,
-      aux_sym_literal_token1,
-    ACTIONS(120), 1,
-      sym__emph_star_start,
-    ACTIONS(122), 1,
-      sym__emph_under_start,
-    ACTIONS(126), 1,
-      sym__strong_star_start,
-    ACTIONS(128), 1,
-      sym__strong_under_start,
-    ACTIONS(198), 1,
-      sym__emph_under_end,
-    STATE(59), 1,
-      sym_quotation,
-    ACTIONS(110), 2,
-      sym__no_parse,
-      sym_word,
-    ACTIONS(114), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(62), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(63), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(8), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(112), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [839] = 14,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(118), 1,
-      aux_sym_literal_token1,
-    ACTIONS(120), 1,
-      sym__emph_star_start,
-    ACTIONS(122), 1,
-      sym__emph_under_start,
-    ACTIONS(126), 1,
-      sym__strong_star_start,
-    ACTIONS(128), 1,
-      sym__strong_under_start,
-    ACTIONS(202), 1,
-      sym_symbols,
-    STATE(59), 1,
-      sym_quotation,
-    ACTIONS(114), 2,
-      sym_single_quote,
-      sym_double_quote,
-    ACTIONS(200), 2,
-      sym__no_parse,
-      sym_word,
-    STATE(62), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(63), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(12), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(112), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [895] = 14,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(118), 1,
-      aux_sym_literal_token1,
-    ACTIONS(120), 1,
-      sym__emph_star_start,
-    ACTIONS(122), 1,
-      sym__emph_under_start,
-    ACTIONS(126), 1,
-      sym__strong_star_start,
-    ACTIONS(128), 1,
-      sym__strong_under_start,
-    ACTIONS(206), 1,
-      sym_symbols,
-    STATE(59), 1,
-      sym_quotation,
-    ACTIONS(114), 2,
-      sym_single_quote,
-      sym_double_quote,
-    ACTIONS(204), 2,
-      sym__no_parse,
-      sym_word,
-    STATE(62), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(63), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(6), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(112), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [951] = 14,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(17), 1,
-      sym_symbols,
-    ACTIONS(19), 1,
-      aux_sym_literal_token1,
-    ACTIONS(33), 1,
-      sym__emph_star_start,
-    ACTIONS(35), 1,
-      sym__emph_under_start,
-    ACTIONS(37), 1,
-      sym__strong_star_start,
-    ACTIONS(39), 1,
-      sym__strong_under_start,
-    STATE(50), 1,
-      sym_quotation,
-    ACTIONS(11), 2,
-      sym__no_parse,
-      sym_word,
-    ACTIONS(15), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(43), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(49), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(3), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(13), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [1007] = 14,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(98), 1,
-      aux_sym_literal_token1,
-    ACTIONS(100), 1,
-      sym__emph_star_start,
-    ACTIONS(104), 1,
-      sym__emph_under_start,
-    ACTIONS(106), 1,
-      sym__strong_star_start,
-    ACTIONS(108), 1,
-      sym__strong_under_start,
-    ACTIONS(210), 1,
-      sym_symbols,
-    STATE(80), 1,
-      sym_quotation,
-    ACTIONS(94), 2,
-      sym_single_quote,
-      sym_double_quote,
-    ACTIONS(208), 2,
-      sym__no_parse,
-      sym_word,
-    STATE(53), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(54), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(5), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(92), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [1063] = 14,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(98), 1,
-      aux_sym_literal_token1,
-    ACTIONS(100), 1,
-      sym__emph_star_start,
-    ACTIONS(104), 1,
-      sym__emph_under_start,
-    ACTIONS(106), 1,
-      sym__strong_star_start,
-    ACTIONS(108), 1,
-      sym__strong_under_start,
-    ACTIONS(214), 1,
-      sym_symbols,
-    STATE(80), 1,
-      sym_quotation,
-    ACTIONS(94), 2,
-      sym_single_quote,
-      sym_double_quote,
-    ACTIONS(212), 2,
-      sym__no_parse,
-      sym_word,
-    STATE(53), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(54), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(9), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(92), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [1119] = 14,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(118), 1,
-      aux_sym_literal_token1,
-    ACTIONS(120), 1,
-      sym__emph_star_start,
-    ACTIONS(122), 1,
-      sym__emph_under_start,
-    ACTIONS(126), 1,
-      sym__strong_star_start,
-    ACTIONS(128), 1,
-      sym__strong_under_start,
-    ACTIONS(218), 1,
-      sym_symbols,
-    STATE(59), 1,
-      sym_quotation,
-    ACTIONS(114), 2,
-      sym_single_quote,
-      sym_double_quote,
-    ACTIONS(216), 2,
-      sym__no_parse,
-      sym_word,
-    STATE(62), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(63), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(10), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(112), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [1175] = 14,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(98), 1,
-      aux_sym_literal_token1,
-    ACTIONS(100), 1,
-      sym__emph_star_start,
-    ACTIONS(104), 1,
-      sym__emph_under_start,
-    ACTIONS(106), 1,
-      sym__strong_star_start,
-    ACTIONS(108), 1,
-      sym__strong_under_start,
-    ACTIONS(222), 1,
-      sym_symbols,
-    STATE(80), 1,
-      sym_quotation,
-    ACTIONS(94), 2,
-      sym_single_quote,
-      sym_double_quote,
-    ACTIONS(220), 2,
-      sym__no_parse,
-      sym_word,
-    STATE(53), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(54), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(11), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(92), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [1231] = 14,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(98), 1,
-      aux_sym_literal_token1,
-    ACTIONS(100), 1,
-      sym__emph_star_start,
-    ACTIONS(104), 1,
-      sym__emph_under_start,
-    ACTIONS(106), 1,
-      sym__strong_star_start,
-    ACTIONS(108), 1,
-      sym__strong_under_start,
-    ACTIONS(226), 1,
-      sym_symbols,
-    STATE(80), 1,
-      sym_quotation,
-    ACTIONS(94), 2,
-      sym_single_quote,
-      sym_double_quote,
-    ACTIONS(224), 2,
-      sym__no_parse,
-      sym_word,
-    STATE(53), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(54), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(13), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(92), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [1287] = 14,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(118), 1,
-      aux_sym_literal_token1,
-    ACTIONS(120), 1,
-      sym__emph_star_start,
-    ACTIONS(122), 1,
-      sym__emph_under_start,
-    ACTIONS(126), 1,
-      sym__strong_star_start,
-    ACTIONS(128), 1,
-      sym__strong_under_start,
-    ACTIONS(230), 1,
-      sym_symbols,
-    STATE(59), 1,
-      sym_quotation,
-    ACTIONS(114), 2,
-      sym_single_quote,
-      sym_double_quote,
-    ACTIONS(228), 2,
-      sym__no_parse,
-      sym_word,
-    STATE(62), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(63), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(14), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(112), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [1343] = 14,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(98), 1,
-      aux_sym_literal_token1,
-    ACTIONS(100), 1,
-      sym__emph_star_start,
-    ACTIONS(104), 1,
-      sym__emph_under_start,
-    ACTIONS(106), 1,
-      sym__strong_star_start,
-    ACTIONS(108), 1,
-      sym__strong_under_start,
-    ACTIONS(234), 1,
-      sym_symbols,
-    STATE(80), 1,
-      sym_quotation,
-    ACTIONS(94), 2,
-      sym_single_quote,
-      sym_double_quote,
-    ACTIONS(232), 2,
-      sym__no_parse,
-      sym_word,
-    STATE(53), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(54), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(15), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(92), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [1399] = 14,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(118), 1,
-      aux_sym_literal_token1,
-    ACTIONS(120), 1,
-      sym__emph_star_start,
-    ACTIONS(122), 1,
-      sym__emph_under_start,
-    ACTIONS(126), 1,
-      sym__strong_star_start,
-    ACTIONS(128), 1,
-      sym__strong_under_start,
-    ACTIONS(238), 1,
-      sym_symbols,
-    STATE(59), 1,
-      sym_quotation,
-    ACTIONS(114), 2,
-      sym_single_quote,
-      sym_double_quote,
-    ACTIONS(236), 2,
-      sym__no_parse,
-      sym_word,
-    STATE(62), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(63), 2,
-      sym__strong_star,
-      sym__strong_under,
-    STATE(16), 5,
-      aux_sym__line_content,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      sym_strong,
-    ACTIONS(112), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [1455] = 15,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(240), 1,
-      anon_sym_BSLASH,
-    ACTIONS(242), 1,
-      anon_sym_,
-    ACTIONS(253), 1,
-      aux_sym_literal_token1,
-    ACTIONS(256), 1,
+    ACTIONS(49), 1,
       sym_line_end,
-    ACTIONS(258), 1,
-      sym__emph_star_start,
-    ACTIONS(261), 1,
-      sym__emph_under_start,
-    ACTIONS(264), 1,
-      sym__strong_star_end,
-    STATE(68), 1,
-      sym_quotation,
-    STATE(82), 1,
-      sym_line_break,
-    ACTIONS(244), 2,
-      sym_word,
-      sym_symbols,
-    ACTIONS(250), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(71), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(31), 4,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      aux_sym__strong_content_repeat1,
-    ACTIONS(247), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [1512] = 15,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(264), 1,
-      sym__strong_under_end,
-    ACTIONS(266), 1,
-      anon_sym_BSLASH,
-    ACTIONS(268), 1,
-      anon_sym_,
-    ACTIONS(279), 1,
-      aux_sym_literal_token1,
-    ACTIONS(282), 1,
-      sym_line_end,
-    ACTIONS(284), 1,
-      sym__emph_star_start,
-    ACTIONS(287), 1,
-      sym__emph_under_start,
-    STATE(74), 1,
-      sym_quotation,
-    STATE(83), 1,
-      sym_line_break,
-    ACTIONS(270), 2,
-      sym_word,
-      sym_symbols,
-    ACTIONS(276), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(77), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(30), 4,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      aux_sym__strong_content_repeat1,
-    ACTIONS(273), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [1569] = 12,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(290), 1,
-      anon_sym_BSLASH,
-    ACTIONS(303), 1,
-      aux_sym_literal_token1,
-    ACTIONS(306), 1,
-      sym__emph_star_start,
-    ACTIONS(309), 1,
-      sym__emph_under_start,
-    STATE(74), 1,
-      sym_quotation,
-    ACTIONS(294), 2,
-      sym_word,
-      sym_symbols,
-    ACTIONS(300), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(77), 2,
-      sym__emph_star,
-      sym__emph_under,
-    ACTIONS(292), 3,
-      sym_line_end,
-      sym__strong_under_end,
-      anon_sym_,
-    STATE(30), 4,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      aux_sym__strong_content_repeat1,
-    ACTIONS(297), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [1619] = 12,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(290), 1,
-      anon_sym_BSLASH,
-    ACTIONS(321), 1,
-      aux_sym_literal_token1,
-    ACTIONS(324), 1,
-      sym__emph_star_start,
-    ACTIONS(327), 1,
-      sym__emph_under_start,
-    STATE(68), 1,
-      sym_quotation,
-    ACTIONS(312), 2,
-      sym_word,
-      sym_symbols,
-    ACTIONS(318), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(71), 2,
-      sym__emph_star,
-      sym__emph_under,
-    ACTIONS(292), 3,
-      sym_line_end,
-      sym__strong_star_end,
-      anon_sym_,
-    STATE(31), 4,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      aux_sym__strong_content_repeat1,
-    ACTIONS(315), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [1669] = 13,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(330), 1,
-      sym_word,
-    ACTIONS(339), 1,
-      sym_symbols,
-    ACTIONS(342), 1,
-      aux_sym_literal_token1,
-    ACTIONS(345), 1,
-      sym__emph_star_start,
-    ACTIONS(348), 1,
-      sym__emph_under_start,
-    ACTIONS(351), 1,
-      sym__strong_under_end,
-    STATE(32), 1,
-      aux_sym__strong_content_repeat2,
-    STATE(74), 1,
-      sym_quotation,
-    ACTIONS(336), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(77), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(29), 4,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      aux_sym__strong_content_repeat1,
-    ACTIONS(333), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [1719] = 13,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(353), 1,
-      sym_word,
-    ACTIONS(359), 1,
-      sym_symbols,
-    ACTIONS(361), 1,
-      aux_sym_literal_token1,
-    ACTIONS(363), 1,
-      sym__emph_star_start,
-    ACTIONS(365), 1,
-      sym__emph_under_start,
-    STATE(38), 1,
-      aux_sym__strong_content_repeat2,
-    STATE(74), 1,
-      sym_quotation,
-    STATE(126), 1,
-      sym__strong_content,
-    ACTIONS(357), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(77), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(29), 4,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      aux_sym__strong_content_repeat1,
-    ACTIONS(355), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [1769] = 13,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(367), 1,
-      sym_word,
-    ACTIONS(373), 1,
-      sym_symbols,
-    ACTIONS(375), 1,
-      aux_sym_literal_token1,
-    ACTIONS(377), 1,
-      sym__emph_star_start,
-    ACTIONS(379), 1,
-      sym__emph_under_start,
-    ACTIONS(381), 1,
-      sym__strong_star_end,
-    STATE(36), 1,
-      aux_sym__strong_content_repeat2,
-    STATE(68), 1,
-      sym_quotation,
-    ACTIONS(371), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(71), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(28), 4,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      aux_sym__strong_content_repeat1,
-    ACTIONS(369), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [1819] = 13,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(367), 1,
-      sym_word,
-    ACTIONS(373), 1,
-      sym_symbols,
-    ACTIONS(375), 1,
-      aux_sym_literal_token1,
-    ACTIONS(377), 1,
-      sym__emph_star_start,
-    ACTIONS(379), 1,
-      sym__emph_under_start,
-    STATE(34), 1,
-      aux_sym__strong_content_repeat2,
-    STATE(68), 1,
-      sym_quotation,
-    STATE(124), 1,
-      sym__strong_content,
-    ACTIONS(371), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(71), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(28), 4,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      aux_sym__strong_content_repeat1,
-    ACTIONS(369), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [1869] = 13,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(351), 1,
-      sym__strong_star_end,
-    ACTIONS(383), 1,
-      sym_word,
-    ACTIONS(392), 1,
-      sym_symbols,
-    ACTIONS(395), 1,
-      aux_sym_literal_token1,
-    ACTIONS(398), 1,
-      sym__emph_star_start,
-    ACTIONS(401), 1,
-      sym__emph_under_start,
-    STATE(36), 1,
-      aux_sym__strong_content_repeat2,
-    STATE(68), 1,
-      sym_quotation,
-    ACTIONS(389), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(71), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(28), 4,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      aux_sym__strong_content_repeat1,
-    ACTIONS(386), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [1919] = 13,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(367), 1,
-      sym_word,
-    ACTIONS(373), 1,
-      sym_symbols,
-    ACTIONS(375), 1,
-      aux_sym_literal_token1,
-    ACTIONS(377), 1,
-      sym__emph_star_start,
-    ACTIONS(379), 1,
-      sym__emph_under_start,
-    STATE(34), 1,
-      aux_sym__strong_content_repeat2,
-    STATE(68), 1,
-      sym_quotation,
-    STATE(125), 1,
-      sym__strong_content,
-    ACTIONS(371), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(71), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(28), 4,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      aux_sym__strong_content_repeat1,
-    ACTIONS(369), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [1969] = 13,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(353), 1,
-      sym_word,
-    ACTIONS(359), 1,
-      sym_symbols,
-    ACTIONS(361), 1,
-      aux_sym_literal_token1,
-    ACTIONS(363), 1,
-      sym__emph_star_start,
-    ACTIONS(365), 1,
-      sym__emph_under_start,
-    ACTIONS(381), 1,
-      sym__strong_under_end,
-    STATE(32), 1,
-      aux_sym__strong_content_repeat2,
-    STATE(74), 1,
-      sym_quotation,
-    ACTIONS(357), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(77), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(29), 4,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      aux_sym__strong_content_repeat1,
-    ACTIONS(355), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [2019] = 13,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(367), 1,
-      sym_word,
-    ACTIONS(373), 1,
-      sym_symbols,
-    ACTIONS(375), 1,
-      aux_sym_literal_token1,
-    ACTIONS(377), 1,
-      sym__emph_star_start,
-    ACTIONS(379), 1,
-      sym__emph_under_start,
-    STATE(34), 1,
-      aux_sym__strong_content_repeat2,
-    STATE(68), 1,
-      sym_quotation,
-    STATE(120), 1,
-      sym__strong_content,
-    ACTIONS(371), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(71), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(28), 4,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      aux_sym__strong_content_repeat1,
-    ACTIONS(369), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [2069] = 13,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(353), 1,
-      sym_word,
-    ACTIONS(359), 1,
-      sym_symbols,
-    ACTIONS(361), 1,
-      aux_sym_literal_token1,
-    ACTIONS(363), 1,
-      sym__emph_star_start,
-    ACTIONS(365), 1,
-      sym__emph_under_start,
-    STATE(38), 1,
-      aux_sym__strong_content_repeat2,
-    STATE(74), 1,
-      sym_quotation,
-    STATE(119), 1,
-      sym__strong_content,
-    ACTIONS(357), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(77), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(29), 4,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      aux_sym__strong_content_repeat1,
-    ACTIONS(355), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [2119] = 13,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(353), 1,
-      sym_word,
-    ACTIONS(359), 1,
-      sym_symbols,
-    ACTIONS(361), 1,
-      aux_sym_literal_token1,
-    ACTIONS(363), 1,
-      sym__emph_star_start,
-    ACTIONS(365), 1,
-      sym__emph_under_start,
-    STATE(38), 1,
-      aux_sym__strong_content_repeat2,
-    STATE(74), 1,
-      sym_quotation,
-    STATE(127), 1,
-      sym__strong_content,
-    ACTIONS(357), 2,
-      sym_single_quote,
-      sym_double_quote,
-    STATE(77), 2,
-      sym__emph_star,
-      sym__emph_under,
-    STATE(29), 4,
-      sym_puncuation,
-      sym_literal,
-      sym_emph,
-      aux_sym__strong_content_repeat1,
-    ACTIONS(355), 6,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-  [2169] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(406), 7,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      anon_sym_,
-    ACTIONS(404), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [2196] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(410), 7,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      anon_sym_,
-    ACTIONS(408), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [2223] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(414), 7,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      anon_sym_,
-    ACTIONS(412), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [2250] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(418), 7,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      anon_sym_,
-    ACTIONS(416), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [2277] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(422), 7,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      anon_sym_,
-    ACTIONS(420), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [2304] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(426), 7,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      anon_sym_,
-    ACTIONS(424), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [2331] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(430), 7,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      anon_sym_,
-    ACTIONS(428), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [2358] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(434), 7,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      anon_sym_,
-    ACTIONS(432), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [2385] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(438), 7,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      anon_sym_,
-    ACTIONS(436), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [2412] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(428), 1,
-      sym_symbols,
-    ACTIONS(430), 16,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__emph_under_end,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [2437] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(424), 1,
-      sym_symbols,
-    ACTIONS(426), 16,
-      sym__emph_star_start,
-      sym__emph_star_end,
-      sym__emph_under_start,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [2462] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(432), 1,
-      sym_symbols,
-    ACTIONS(434), 16,
-      sym__emph_star_start,
-      sym__emph_star_end,
-      sym__emph_under_start,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [2487] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(408), 1,
-      sym_symbols,
-    ACTIONS(410), 16,
-      sym__emph_star_start,
-      sym__emph_star_end,
-      sym__emph_under_start,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [2512] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(412), 1,
-      sym_symbols,
-    ACTIONS(414), 16,
-      sym__emph_star_start,
-      sym__emph_star_end,
-      sym__emph_under_start,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [2537] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(416), 1,
-      sym_symbols,
-    ACTIONS(418), 16,
-      sym__emph_star_start,
-      sym__emph_star_end,
-      sym__emph_under_start,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [2562] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(420), 1,
-      sym_symbols,
-    ACTIONS(422), 16,
-      sym__emph_star_start,
-      sym__emph_star_end,
-      sym__emph_under_start,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [2587] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(428), 1,
-      sym_symbols,
-    ACTIONS(430), 16,
-      sym__emph_star_start,
-      sym__emph_star_end,
-      sym__emph_under_start,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [2612] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(436), 1,
-      sym_symbols,
-    ACTIONS(438), 16,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__emph_under_end,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [2637] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(404), 1,
-      sym_symbols,
-    ACTIONS(406), 16,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__emph_under_end,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [2662] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(424), 1,
-      sym_symbols,
-    ACTIONS(426), 16,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__emph_under_end,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [2687] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(432), 1,
-      sym_symbols,
-    ACTIONS(434), 16,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__emph_under_end,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [2712] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(408), 1,
-      sym_symbols,
-    ACTIONS(410), 16,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__emph_under_end,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [2737] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(412), 1,
-      sym_symbols,
-    ACTIONS(414), 16,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__emph_under_end,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [2762] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(416), 1,
-      sym_symbols,
-    ACTIONS(418), 16,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__emph_under_end,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [2787] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(420), 1,
-      sym_symbols,
-    ACTIONS(422), 16,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__emph_under_end,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [2812] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(404), 1,
-      sym_symbols,
-    ACTIONS(406), 16,
-      sym__emph_star_start,
-      sym__emph_star_end,
-      sym__emph_under_start,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [2837] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(438), 5,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_star_end,
-      anon_sym_,
-    ACTIONS(436), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [2862] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(406), 5,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_star_end,
-      anon_sym_,
-    ACTIONS(404), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [2887] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(426), 5,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_star_end,
-      anon_sym_,
-    ACTIONS(424), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [2912] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(434), 5,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_star_end,
-      anon_sym_,
-    ACTIONS(432), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [2937] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(414), 5,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_star_end,
-      anon_sym_,
-    ACTIONS(412), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [2962] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(418), 5,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_star_end,
-      anon_sym_,
-    ACTIONS(416), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [2987] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(438), 5,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_under_end,
-      anon_sym_,
-    ACTIONS(436), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [3012] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(406), 5,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_under_end,
-      anon_sym_,
-    ACTIONS(404), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [3037] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(426), 5,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_under_end,
-      anon_sym_,
-    ACTIONS(424), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [3062] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(434), 5,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_under_end,
-      anon_sym_,
-    ACTIONS(432), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [3087] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(414), 5,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_under_end,
-      anon_sym_,
-    ACTIONS(412), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [3112] = 3,
-    ACTIONS(41), 1,
-      sym_comment,
-    ACTIONS(418), 5,
-      sym_line_end,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_under_end,
-      anon_sym_,
-    ACTIONS(416), 12,
-      anon_sym_BSLASH,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      sym_symbols,
-      aux_sym_literal_token1,
-  [3137] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(436), 1,
-      sym_symbols,
-    ACTIONS(438), 16,
-      sym__emph_star_start,
-      sym__emph_star_end,
-      sym__emph_under_start,
-      sym__strong_star_start,
-      sym__strong_under_start,
-      sym__no_parse,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [3162] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(442), 1,
-      sym_symbols,
-    ACTIONS(440), 13,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_under_end,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [3184] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(444), 1,
-      sym_symbols,
-    ACTIONS(351), 13,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_star_end,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [3206] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(444), 1,
-      sym_symbols,
-    ACTIONS(351), 13,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_under_end,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [3228] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(442), 1,
-      sym_symbols,
-    ACTIONS(440), 13,
-      sym__emph_star_start,
-      sym__emph_under_start,
-      sym__strong_star_end,
-      sym_word,
-      sym_period,
-      sym_comma,
-      sym_exclamation,
-      sym_question,
-      sym_colon,
-      sym_semi_colon,
-      sym_single_quote,
-      sym_double_quote,
-      aux_sym_literal_token1,
-  [3250] = 9,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(446), 1,
-      ts_builtin_sym_end,
-    ACTIONS(448), 1,
-      sym__line_start,
-    ACTIONS(451), 1,
-      sym_line_end,
-    STATE(87), 1,
-      sym_heading,
-    STATE(88), 1,
-      aux_sym_paragraph_end_repeat1,
-    STATE(91), 2,
-      sym_paragraph,
-      aux_sym_content_repeat1,
-    STATE(92), 2,
-      sym__line,
-      aux_sym_paragraph_repeat1,
-    STATE(85), 3,
-      sym_content,
-      sym__section,
-      aux_sym_source_file_repeat1,
-  [3282] = 9,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(7), 1,
-      sym__line_start,
-    ACTIONS(9), 1,
-      sym_line_end,
-    ACTIONS(454), 1,
-      ts_builtin_sym_end,
-    STATE(87), 1,
-      sym_heading,
-    STATE(88), 1,
-      aux_sym_paragraph_end_repeat1,
-    STATE(91), 2,
-      sym_paragraph,
-      aux_sym_content_repeat1,
-    STATE(92), 2,
-      sym__line,
-      aux_sym_paragraph_repeat1,
-    STATE(85), 3,
-      sym_content,
-      sym__section,
-      aux_sym_source_file_repeat1,
-  [3314] = 8,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(9), 1,
-      sym_line_end,
-    ACTIONS(456), 1,
-      ts_builtin_sym_end,
-    ACTIONS(458), 1,
-      sym__line_start,
-    STATE(88), 1,
-      aux_sym_paragraph_end_repeat1,
-    STATE(108), 1,
-      sym_content,
-    STATE(91), 2,
-      sym_paragraph,
-      aux_sym_content_repeat1,
-    STATE(92), 2,
-      sym__line,
-      aux_sym_paragraph_repeat1,
-  [3341] = 6,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(458), 1,
-      sym__line_start,
-    ACTIONS(460), 1,
-      sym_line_end,
-    STATE(100), 1,
+    STATE(15), 1,
       aux_sym_paragraph_end_repeat1,
-    STATE(89), 2,
-      sym_paragraph,
-      aux_sym_content_repeat1,
-    STATE(92), 2,
-      sym__line,
-      aux_sym_paragraph_repeat1,
-  [3362] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(458), 1,
-      sym__line_start,
-    ACTIONS(462), 2,
-      sym_line_end,
-      ts_builtin_sym_end,
-    STATE(90), 2,
-      sym_paragraph,
-      aux_sym_content_repeat1,
-    STATE(92), 2,
-      sym__line,
-      aux_sym_paragraph_repeat1,
-  [3381] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(466), 1,
-      sym__line_start,
-    ACTIONS(464), 2,
-      sym_line_end,
+    ACTIONS(47), 9,
       ts_builtin_sym_end,
-    STATE(90), 2,
-      sym_paragraph,
-      aux_sym_content_repeat1,
-    STATE(92), 2,
-      sym__line,
-      aux_sym_paragraph_repeat1,
-  [3400] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(458), 1,
-      sym__line_start,
-    ACTIONS(469), 2,
-      sym_line_end,
-      ts_builtin_sym_end,
-    STATE(90), 2,
-      sym_paragraph,
-      aux_sym_content_repeat1,
-    STATE(92), 2,
-      sym__line,
-      aux_sym_paragraph_repeat1,
-  [3419] = 6,
+      sym_inline,
+      sym__setext_heading_inline,
+      sym_atx_h1_marker,
+      sym_atx_h2_marker,
+      sym_atx_h3_marker,
+      sym_atx_h4_marker,
+      sym_atx_h5_marker,
+      sym_atx_h6_marker,
+  [21] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(458), 1,
-      sym__line_start,
-    ACTIONS(471), 1,
+    ACTIONS(60), 1,
       sym_line_end,
-    STATE(93), 1,
+    STATE(17), 1,
       aux_sym_paragraph_end_repeat1,
-    STATE(109), 1,
-      sym_paragraph_end,
-    STATE(98), 2,
-      sym__line,
-      aux_sym_paragraph_repeat1,
-  [3439] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    STATE(100), 1,
-      aux_sym_paragraph_end_repeat1,
-    ACTIONS(473), 3,
-      sym__line_start,
-      sym_line_end,
+    ACTIONS(47), 9,
       ts_builtin_sym_end,
-  [3451] = 4,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(460), 1,
-      sym_line_end,
-    STATE(100), 1,
+      sym_inline,
+      sym__setext_heading_inline,
+      sym_atx_h1_marker,
+      sym_atx_h2_marker,
+      sym_atx_h3_marker,
+      sym_atx_h4_marker,
+      sym_atx_h5_marker,
+      sym_atx_h6_marker,
+  [42] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    STATE(17), 1,
       aux_sym_paragraph_end_repeat1,
-    ACTIONS(475), 2,
-      sym__line_start,
+    ACTIONS(62), 10,
       ts_builtin_sym_end,
-  [3465] = 4,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(460), 1,
       sym_line_end,
-    STATE(100), 1,
-      aux_sym_paragraph_end_repeat1,
-    ACTIONS(477), 2,
-      sym__line_start,
-      ts_builtin_sym_end,
-  [3479] = 4,
+      sym_inline,
+      sym__setext_heading_inline,
+      sym_atx_h1_marker,
+      sym_atx_h2_marker,
+      sym_atx_h3_marker,
+      sym_atx_h4_marker,
+      sym_atx_h5_marker,
+      sym_atx_h6_marker,
+  [61] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(481), 1,
+    ACTIONS(64), 1,
       sym_line_end,
-    STATE(94), 1,
+    STATE(16), 1,
       aux_sym_paragraph_end_repeat1,
-    ACTIONS(479), 2,
-      sym__line_start,
+    ACTIONS(66), 9,
       ts_builtin_sym_end,
-  [3493] = 4,
+      sym_inline,
+      sym__setext_heading_inline,
+      sym_atx_h1_marker,
+      sym_atx_h2_marker,
+      sym_atx_h3_marker,
+      sym_atx_h4_marker,
+      sym_atx_h5_marker,
+      sym_atx_h6_marker,
+  [82] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(485), 1,
+    ACTIONS(60), 1,
       sym_line_end,
-    STATE(95), 1,
+    STATE(17), 1,
       aux_sym_paragraph_end_repeat1,
-    ACTIONS(483), 2,
-      sym__line_start,
+    ACTIONS(66), 9,
       ts_builtin_sym_end,
-  [3507] = 4,
+      sym_inline,
+      sym__setext_heading_inline,
+      sym_atx_h1_marker,
+      sym_atx_h2_marker,
+      sym_atx_h3_marker,
+      sym_atx_h4_marker,
+      sym_atx_h5_marker,
+      sym_atx_h6_marker,
+  [103] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(487), 1,
-      sym__line_start,
-    ACTIONS(490), 1,
+    ACTIONS(60), 1,
       sym_line_end,
-    STATE(98), 2,
-      sym__line,
-      aux_sym_paragraph_repeat1,
-  [3521] = 4,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(494), 1,
-      sym_line_end,
-    STATE(103), 1,
+    STATE(17), 1,
       aux_sym_paragraph_end_repeat1,
-    ACTIONS(492), 2,
-      sym__line_start,
+    ACTIONS(68), 9,
       ts_builtin_sym_end,
-  [3535] = 4,
+      sym_inline,
+      sym__setext_heading_inline,
+      sym_atx_h1_marker,
+      sym_atx_h2_marker,
+      sym_atx_h3_marker,
+      sym_atx_h4_marker,
+      sym_atx_h5_marker,
+      sym_atx_h6_marker,
+  [124] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(498), 1,
+    ACTIONS(70), 1,
       sym_line_end,
-    STATE(100), 1,
+    STATE(17), 1,
       aux_sym_paragraph_end_repeat1,
-    ACTIONS(496), 2,
-      sym__line_start,
+    ACTIONS(73), 9,
       ts_builtin_sym_end,
-  [3549] = 4,
+      sym_inline,
+      sym__setext_heading_inline,
+      sym_atx_h1_marker,
+      sym_atx_h2_marker,
+      sym_atx_h3_marker,
+      sym_atx_h4_marker,
+      sym_atx_h5_marker,
+      sym_atx_h6_marker,
+  [145] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(460), 1,
+    ACTIONS(75), 1,
       sym_line_end,
-    STATE(100), 1,
-      aux_sym_paragraph_end_repeat1,
-    ACTIONS(501), 2,
-      sym__line_start,
+    ACTIONS(77), 9,
       ts_builtin_sym_end,
-  [3563] = 4,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(460), 1,
-      sym_line_end,
-    STATE(100), 1,
-      aux_sym_paragraph_end_repeat1,
-    ACTIONS(503), 2,
-      sym__line_start,
+      sym_inline,
+      sym__setext_heading_inline,
+      sym_atx_h1_marker,
+      sym_atx_h2_marker,
+      sym_atx_h3_marker,
+      sym_atx_h4_marker,
+      sym_atx_h5_marker,
+      sym_atx_h6_marker,
+  [163] = 2,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(79), 10,
       ts_builtin_sym_end,
-  [3577] = 4,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(460), 1,
       sym_line_end,
-    STATE(100), 1,
-      aux_sym_paragraph_end_repeat1,
-    ACTIONS(505), 2,
-      sym__line_start,
-      ts_builtin_sym_end,
-  [3591] = 4,
+      sym_inline,
+      sym__setext_heading_inline,
+      sym_atx_h1_marker,
+      sym_atx_h2_marker,
+      sym_atx_h3_marker,
+      sym_atx_h4_marker,
+      sym_atx_h5_marker,
+      sym_atx_h6_marker,
+  [179] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(460), 1,
-      sym_line_end,
-    STATE(100), 1,
-      aux_sym_paragraph_end_repeat1,
-    ACTIONS(507), 2,
-      sym__line_start,
+    ACTIONS(81), 10,
       ts_builtin_sym_end,
-  [3605] = 4,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(511), 1,
       sym_line_end,
-    STATE(101), 1,
-      aux_sym_paragraph_end_repeat1,
-    ACTIONS(509), 2,
-      sym__line_start,
-      ts_builtin_sym_end,
-  [3619] = 4,
+      sym_inline,
+      sym__setext_heading_inline,
+      sym_atx_h1_marker,
+      sym_atx_h2_marker,
+      sym_atx_h3_marker,
+      sym_atx_h4_marker,
+      sym_atx_h5_marker,
+      sym_atx_h6_marker,
+  [195] = 5,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(515), 1,
+    ACTIONS(9), 1,
+      sym_inline,
+    ACTIONS(83), 1,
       sym_line_end,
-    STATE(102), 1,
+    STATE(22), 1,
       aux_sym_paragraph_end_repeat1,
-    ACTIONS(513), 2,
-      sym__line_start,
-      ts_builtin_sym_end,
-  [3633] = 4,
+    STATE(9), 2,
+      sym_paragraph,
+      aux_sym_content_repeat1,
+  [212] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(519), 1,
+    ACTIONS(73), 1,
+      sym_inline,
+    ACTIONS(85), 1,
       sym_line_end,
-    STATE(104), 1,
+    STATE(22), 1,
       aux_sym_paragraph_end_repeat1,
-    ACTIONS(517), 2,
-      sym__line_start,
-      ts_builtin_sym_end,
-  [3647] = 2,
+  [225] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(521), 3,
-      sym__line_start,
-      sym_line_end,
-      ts_builtin_sym_end,
-  [3656] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(523), 3,
-      sym__line_start,
-      sym_line_end,
-      ts_builtin_sym_end,
-  [3665] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(440), 3,
-      sym__line_start,
-      sym_line_end,
-      ts_builtin_sym_end,
-  [3674] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(525), 3,
-      sym__line_start,
-      sym_line_end,
-      ts_builtin_sym_end,
-  [3683] = 2,
+    ACTIONS(51), 2,
+      sym_setext_h1_underline,
+      sym_setext_h2_underline,
+  [233] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(527), 3,
-      sym__line_start,
+    ACTIONS(88), 1,
       sym_line_end,
-      ts_builtin_sym_end,
-  [3692] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(458), 1,
-      sym__line_start,
-    STATE(107), 1,
-      sym__line,
-  [3702] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(458), 1,
-      sym__line_start,
-    STATE(99), 1,
-      sym__line,
-  [3712] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(458), 1,
-      sym__line_start,
-    STATE(105), 1,
-      sym__line,
-  [3722] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(458), 1,
-      sym__line_start,
-    STATE(106), 1,
-      sym__line,
-  [3732] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(458), 1,
-      sym__line_start,
-    STATE(96), 1,
-      sym__line,
-  [3742] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(458), 1,
-      sym__line_start,
-    STATE(97), 1,
-      sym__line,
-  [3752] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(529), 1,
-      sym__strong_under_end,
-  [3759] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(531), 1,
-      sym__strong_star_end,
-  [3766] = 2,
+  [240] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(533), 1,
+    ACTIONS(90), 1,
       ts_builtin_sym_end,
-  [3773] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(535), 1,
-      sym_line_end,
-  [3780] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(537), 1,
-      sym_line_end,
-  [3787] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(539), 1,
-      sym__strong_star_end,
-  [3794] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(541), 1,
-      sym__strong_star_end,
-  [3801] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(543), 1,
-      sym__strong_under_end,
-  [3808] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(545), 1,
-      sym__strong_under_end,
-  [3815] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(547), 1,
-      sym_line_end,
 };
 
 static const uint32_t ts_small_parse_table_map[] = {
-  [SMALL_STATE(3)] = 0,
-  [SMALL_STATE(4)] = 68,
-  [SMALL_STATE(5)] = 131,
-  [SMALL_STATE(6)] = 190,
-  [SMALL_STATE(7)] = 249,
-  [SMALL_STATE(8)] = 308,
-  [SMALL_STATE(9)] = 367,
-  [SMALL_STATE(10)] = 426,
-  [SMALL_STATE(11)] = 485,
-  [SMALL_STATE(12)] = 544,
-  [SMALL_STATE(13)] = 603,
-  [SMALL_STATE(14)] = 662,
-  [SMALL_STATE(15)] = 721,
-  [SMALL_STATE(16)] = 780,
-  [SMALL_STATE(17)] = 839,
-  [SMALL_STATE(18)] = 895,
-  [SMALL_STATE(19)] = 951,
-  [SMALL_STATE(20)] = 1007,
-  [SMALL_STATE(21)] = 1063,
-  [SMALL_STATE(22)] = 1119,
-  [SMALL_STATE(23)] = 1175,
-  [SMALL_STATE(24)] = 1231,
-  [SMALL_STATE(25)] = 1287,
-  [SMALL_STATE(26)] = 1343,
-  [SMALL_STATE(27)] = 1399,
-  [SMALL_STATE(28)] = 1455,
-  [SMALL_STATE(29)] = 1512,
-  [SMALL_STATE(30)] = 1569,
-  [SMALL_STATE(31)] = 1619,
-  [SMALL_STATE(32)] = 1669,
-  [SMALL_STATE(33)] = 1719,
-  [SMALL_STATE(34)] = 1769,
-  [SMALL_STATE(35)] = 1819,
-  [SMALL_STATE(36)] = 1869,
-  [SMALL_STATE(37)] = 1919,
-  [SMALL_STATE(38)] = 1969,
-  [SMALL_STATE(39)] = 2019,
-  [SMALL_STATE(40)] = 2069,
-  [SMALL_STATE(41)] = 2119,
-  [SMALL_STATE(42)] = 2169,
-  [SMALL_STATE(43)] = 2196,
-  [SMALL_STATE(44)] = 2223,
-  [SMALL_STATE(45)] = 2250,
-  [SMALL_STATE(46)] = 2277,
-  [SMALL_STATE(47)] = 2304,
-  [SMALL_STATE(48)] = 2331,
-  [SMALL_STATE(49)] = 2358,
-  [SMALL_STATE(50)] = 2385,
-  [SMALL_STATE(51)] = 2412,
-  [SMALL_STATE(52)] = 2437,
-  [SMALL_STATE(53)] = 2462,
-  [SMALL_STATE(54)] = 2487,
-  [SMALL_STATE(55)] = 2512,
-  [SMALL_STATE(56)] = 2537,
-  [SMALL_STATE(57)] = 2562,
-  [SMALL_STATE(58)] = 2587,
-  [SMALL_STATE(59)] = 2612,
-  [SMALL_STATE(60)] = 2637,
-  [SMALL_STATE(61)] = 2662,
-  [SMALL_STATE(62)] = 2687,
-  [SMALL_STATE(63)] = 2712,
-  [SMALL_STATE(64)] = 2737,
-  [SMALL_STATE(65)] = 2762,
-  [SMALL_STATE(66)] = 2787,
-  [SMALL_STATE(67)] = 2812,
-  [SMALL_STATE(68)] = 2837,
-  [SMALL_STATE(69)] = 2862,
-  [SMALL_STATE(70)] = 2887,
-  [SMALL_STATE(71)] = 2912,
-  [SMALL_STATE(72)] = 2937,
-  [SMALL_STATE(73)] = 2962,
-  [SMALL_STATE(74)] = 2987,
-  [SMALL_STATE(75)] = 3012,
-  [SMALL_STATE(76)] = 3037,
-  [SMALL_STATE(77)] = 3062,
-  [SMALL_STATE(78)] = 3087,
-  [SMALL_STATE(79)] = 3112,
-  [SMALL_STATE(80)] = 3137,
-  [SMALL_STATE(81)] = 3162,
-  [SMALL_STATE(82)] = 3184,
-  [SMALL_STATE(83)] = 3206,
-  [SMALL_STATE(84)] = 3228,
-  [SMALL_STATE(85)] = 3250,
-  [SMALL_STATE(86)] = 3282,
-  [SMALL_STATE(87)] = 3314,
-  [SMALL_STATE(88)] = 3341,
-  [SMALL_STATE(89)] = 3362,
-  [SMALL_STATE(90)] = 3381,
-  [SMALL_STATE(91)] = 3400,
-  [SMALL_STATE(92)] = 3419,
-  [SMALL_STATE(93)] = 3439,
-  [SMALL_STATE(94)] = 3451,
-  [SMALL_STATE(95)] = 3465,
-  [SMALL_STATE(96)] = 3479,
-  [SMALL_STATE(97)] = 3493,
-  [SMALL_STATE(98)] = 3507,
-  [SMALL_STATE(99)] = 3521,
-  [SMALL_STATE(100)] = 3535,
-  [SMALL_STATE(101)] = 3549,
-  [SMALL_STATE(102)] = 3563,
-  [SMALL_STATE(103)] = 3577,
-  [SMALL_STATE(104)] = 3591,
-  [SMALL_STATE(105)] = 3605,
-  [SMALL_STATE(106)] = 3619,
-  [SMALL_STATE(107)] = 3633,
-  [SMALL_STATE(108)] = 3647,
-  [SMALL_STATE(109)] = 3656,
-  [SMALL_STATE(110)] = 3665,
-  [SMALL_STATE(111)] = 3674,
-  [SMALL_STATE(112)] = 3683,
-  [SMALL_STATE(113)] = 3692,
-  [SMALL_STATE(114)] = 3702,
-  [SMALL_STATE(115)] = 3712,
-  [SMALL_STATE(116)] = 3722,
-  [SMALL_STATE(117)] = 3732,
-  [SMALL_STATE(118)] = 3742,
-  [SMALL_STATE(119)] = 3752,
-  [SMALL_STATE(120)] = 3759,
-  [SMALL_STATE(121)] = 3766,
-  [SMALL_STATE(122)] = 3773,
-  [SMALL_STATE(123)] = 3780,
-  [SMALL_STATE(124)] = 3787,
-  [SMALL_STATE(125)] = 3794,
-  [SMALL_STATE(126)] = 3801,
-  [SMALL_STATE(127)] = 3808,
-  [SMALL_STATE(128)] = 3815,
+  [SMALL_STATE(11)] = 0,
+  [SMALL_STATE(12)] = 21,
+  [SMALL_STATE(13)] = 42,
+  [SMALL_STATE(14)] = 61,
+  [SMALL_STATE(15)] = 82,
+  [SMALL_STATE(16)] = 103,
+  [SMALL_STATE(17)] = 124,
+  [SMALL_STATE(18)] = 145,
+  [SMALL_STATE(19)] = 163,
+  [SMALL_STATE(20)] = 179,
+  [SMALL_STATE(21)] = 195,
+  [SMALL_STATE(22)] = 212,
+  [SMALL_STATE(23)] = 225,
+  [SMALL_STATE(24)] = 233,
+  [SMALL_STATE(25)] = 240,
 };
 
 static const TSParseActionEntry ts_parse_actions[] = {
@@ -4316,361 +739,144 @@ static const TSParseActionEntry ts_parse_actions[] = {
   [1] = {.entry = {.count = 1, .reusable = false}}, RECOVER(),
   [3] = {.entry = {.count = 1, .reusable = true}}, SHIFT_EXTRA(),
   [5] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_source_file, 0, 0, 0),
-  [7] = {.entry = {.count = 1, .reusable = true}}, SHIFT(2),
-  [9] = {.entry = {.count = 1, .reusable = true}}, SHIFT(88),
-  [11] = {.entry = {.count = 1, .reusable = true}}, SHIFT(3),
-  [13] = {.entry = {.count = 1, .reusable = true}}, SHIFT(50),
-  [15] = {.entry = {.count = 1, .reusable = true}}, SHIFT(42),
-  [17] = {.entry = {.count = 1, .reusable = false}}, SHIFT(3),
-  [19] = {.entry = {.count = 1, .reusable = true}}, SHIFT(47),
-  [21] = {.entry = {.count = 1, .reusable = false}}, SHIFT(115),
-  [23] = {.entry = {.count = 1, .reusable = false}}, SHIFT(116),
-  [25] = {.entry = {.count = 1, .reusable = false}}, SHIFT(114),
-  [27] = {.entry = {.count = 1, .reusable = false}}, SHIFT(113),
-  [29] = {.entry = {.count = 1, .reusable = false}}, SHIFT(117),
-  [31] = {.entry = {.count = 1, .reusable = true}}, SHIFT(118),
-  [33] = {.entry = {.count = 1, .reusable = true}}, SHIFT(20),
-  [35] = {.entry = {.count = 1, .reusable = true}}, SHIFT(18),
-  [37] = {.entry = {.count = 1, .reusable = true}}, SHIFT(35),
-  [39] = {.entry = {.count = 1, .reusable = true}}, SHIFT(33),
-  [41] = {.entry = {.count = 1, .reusable = false}}, SHIFT_EXTRA(),
-  [43] = {.entry = {.count = 1, .reusable = false}}, SHIFT(123),
-  [45] = {.entry = {.count = 1, .reusable = true}}, SHIFT(123),
-  [47] = {.entry = {.count = 1, .reusable = false}}, SHIFT(4),
-  [49] = {.entry = {.count = 1, .reusable = false}}, SHIFT(50),
-  [51] = {.entry = {.count = 1, .reusable = false}}, SHIFT(42),
-  [53] = {.entry = {.count = 1, .reusable = false}}, SHIFT(47),
-  [55] = {.entry = {.count = 1, .reusable = true}}, SHIFT(112),
-  [57] = {.entry = {.count = 1, .reusable = true}}, SHIFT(4),
-  [59] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym__line_content, 2, 0, 0),
-  [61] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0),
-  [63] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(4),
-  [66] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(50),
-  [69] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(42),
-  [72] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(47),
-  [75] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(20),
-  [78] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(18),
-  [81] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(35),
-  [84] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(33),
-  [87] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(4),
-  [90] = {.entry = {.count = 1, .reusable = true}}, SHIFT(7),
-  [92] = {.entry = {.count = 1, .reusable = true}}, SHIFT(80),
-  [94] = {.entry = {.count = 1, .reusable = true}}, SHIFT(67),
-  [96] = {.entry = {.count = 1, .reusable = false}}, SHIFT(7),
-  [98] = {.entry = {.count = 1, .reusable = true}}, SHIFT(52),
-  [100] = {.entry = {.count = 1, .reusable = true}}, SHIFT(21),
-  [102] = {.entry = {.count = 1, .reusable = true}}, SHIFT(44),
-  [104] = {.entry = {.count = 1, .reusable = true}}, SHIFT(22),
-  [106] = {.entry = {.count = 1, .reusable = true}}, SHIFT(37),
-  [108] = {.entry = {.count = 1, .reusable = true}}, SHIFT(41),
-  [110] = {.entry = {.count = 1, .reusable = true}}, SHIFT(8),
-  [112] = {.entry = {.count = 1, .reusable = true}}, SHIFT(59),
-  [114] = {.entry = {.count = 1, .reusable = true}}, SHIFT(60),
-  [116] = {.entry = {.count = 1, .reusable = false}}, SHIFT(8),
-  [118] = {.entry = {.count = 1, .reusable = true}}, SHIFT(61),
-  [120] = {.entry = {.count = 1, .reusable = true}}, SHIFT(23),
-  [122] = {.entry = {.count = 1, .reusable = true}}, SHIFT(17),
-  [124] = {.entry = {.count = 1, .reusable = true}}, SHIFT(45),
-  [126] = {.entry = {.count = 1, .reusable = true}}, SHIFT(39),
-  [128] = {.entry = {.count = 1, .reusable = true}}, SHIFT(40),
-  [130] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(7),
-  [133] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(80),
-  [136] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(67),
-  [139] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(7),
-  [142] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(52),
-  [145] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(21),
-  [148] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(22),
-  [151] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(37),
-  [154] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(41),
-  [157] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(8),
-  [160] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(59),
-  [163] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(60),
-  [166] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(8),
-  [169] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(61),
-  [172] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(23),
-  [175] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(17),
-  [178] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(39),
-  [181] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__line_content, 2, 0, 0), SHIFT_REPEAT(40),
-  [184] = {.entry = {.count = 1, .reusable = true}}, SHIFT(55),
-  [186] = {.entry = {.count = 1, .reusable = true}}, SHIFT(56),
-  [188] = {.entry = {.count = 1, .reusable = true}}, SHIFT(64),
-  [190] = {.entry = {.count = 1, .reusable = true}}, SHIFT(65),
-  [192] = {.entry = {.count = 1, .reusable = true}}, SHIFT(72),
-  [194] = {.entry = {.count = 1, .reusable = true}}, SHIFT(73),
-  [196] = {.entry = {.count = 1, .reusable = true}}, SHIFT(78),
-  [198] = {.entry = {.count = 1, .reusable = true}}, SHIFT(79),
-  [200] = {.entry = {.count = 1, .reusable = true}}, SHIFT(12),
-  [202] = {.entry = {.count = 1, .reusable = false}}, SHIFT(12),
-  [204] = {.entry = {.count = 1, .reusable = true}}, SHIFT(6),
-  [206] = {.entry = {.count = 1, .reusable = false}}, SHIFT(6),
-  [208] = {.entry = {.count = 1, .reusable = true}}, SHIFT(5),
-  [210] = {.entry = {.count = 1, .reusable = false}}, SHIFT(5),
-  [212] = {.entry = {.count = 1, .reusable = true}}, SHIFT(9),
-  [214] = {.entry = {.count = 1, .reusable = false}}, SHIFT(9),
-  [216] = {.entry = {.count = 1, .reusable = true}}, SHIFT(10),
-  [218] = {.entry = {.count = 1, .reusable = false}}, SHIFT(10),
-  [220] = {.entry = {.count = 1, .reusable = true}}, SHIFT(11),
-  [222] = {.entry = {.count = 1, .reusable = false}}, SHIFT(11),
-  [224] = {.entry = {.count = 1, .reusable = true}}, SHIFT(13),
-  [226] = {.entry = {.count = 1, .reusable = false}}, SHIFT(13),
-  [228] = {.entry = {.count = 1, .reusable = true}}, SHIFT(14),
-  [230] = {.entry = {.count = 1, .reusable = false}}, SHIFT(14),
-  [232] = {.entry = {.count = 1, .reusable = true}}, SHIFT(15),
-  [234] = {.entry = {.count = 1, .reusable = false}}, SHIFT(15),
-  [236] = {.entry = {.count = 1, .reusable = true}}, SHIFT(16),
-  [238] = {.entry = {.count = 1, .reusable = false}}, SHIFT(16),
-  [240] = {.entry = {.count = 1, .reusable = false}}, SHIFT(128),
-  [242] = {.entry = {.count = 1, .reusable = true}}, SHIFT(128),
-  [244] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat2, 1, 0, 0), SHIFT(31),
-  [247] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat2, 1, 0, 0), SHIFT(68),
-  [250] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat2, 1, 0, 0), SHIFT(69),
-  [253] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat2, 1, 0, 0), SHIFT(70),
-  [256] = {.entry = {.count = 1, .reusable = true}}, SHIFT(82),
-  [258] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat2, 1, 0, 0), SHIFT(24),
-  [261] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat2, 1, 0, 0), SHIFT(25),
-  [264] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat2, 1, 0, 0),
-  [266] = {.entry = {.count = 1, .reusable = false}}, SHIFT(122),
-  [268] = {.entry = {.count = 1, .reusable = true}}, SHIFT(122),
-  [270] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat2, 1, 0, 0), SHIFT(30),
-  [273] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat2, 1, 0, 0), SHIFT(74),
-  [276] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat2, 1, 0, 0), SHIFT(75),
-  [279] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat2, 1, 0, 0), SHIFT(76),
-  [282] = {.entry = {.count = 1, .reusable = true}}, SHIFT(83),
-  [284] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat2, 1, 0, 0), SHIFT(26),
-  [287] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat2, 1, 0, 0), SHIFT(27),
-  [290] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat1, 2, 0, 0),
-  [292] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat1, 2, 0, 0),
-  [294] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat1, 2, 0, 0), SHIFT_REPEAT(30),
-  [297] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat1, 2, 0, 0), SHIFT_REPEAT(74),
-  [300] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat1, 2, 0, 0), SHIFT_REPEAT(75),
-  [303] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat1, 2, 0, 0), SHIFT_REPEAT(76),
-  [306] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat1, 2, 0, 0), SHIFT_REPEAT(26),
-  [309] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat1, 2, 0, 0), SHIFT_REPEAT(27),
-  [312] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat1, 2, 0, 0), SHIFT_REPEAT(31),
-  [315] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat1, 2, 0, 0), SHIFT_REPEAT(68),
-  [318] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat1, 2, 0, 0), SHIFT_REPEAT(69),
-  [321] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat1, 2, 0, 0), SHIFT_REPEAT(70),
-  [324] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat1, 2, 0, 0), SHIFT_REPEAT(24),
-  [327] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat1, 2, 0, 0), SHIFT_REPEAT(25),
-  [330] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat2, 2, 0, 0), SHIFT_REPEAT(29),
-  [333] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat2, 2, 0, 0), SHIFT_REPEAT(74),
-  [336] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat2, 2, 0, 0), SHIFT_REPEAT(75),
-  [339] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat2, 2, 0, 0), SHIFT_REPEAT(29),
-  [342] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat2, 2, 0, 0), SHIFT_REPEAT(76),
-  [345] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat2, 2, 0, 0), SHIFT_REPEAT(26),
-  [348] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat2, 2, 0, 0), SHIFT_REPEAT(27),
-  [351] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat2, 2, 0, 0),
-  [353] = {.entry = {.count = 1, .reusable = true}}, SHIFT(29),
-  [355] = {.entry = {.count = 1, .reusable = true}}, SHIFT(74),
-  [357] = {.entry = {.count = 1, .reusable = true}}, SHIFT(75),
-  [359] = {.entry = {.count = 1, .reusable = false}}, SHIFT(29),
-  [361] = {.entry = {.count = 1, .reusable = true}}, SHIFT(76),
-  [363] = {.entry = {.count = 1, .reusable = true}}, SHIFT(26),
-  [365] = {.entry = {.count = 1, .reusable = true}}, SHIFT(27),
-  [367] = {.entry = {.count = 1, .reusable = true}}, SHIFT(28),
-  [369] = {.entry = {.count = 1, .reusable = true}}, SHIFT(68),
-  [371] = {.entry = {.count = 1, .reusable = true}}, SHIFT(69),
-  [373] = {.entry = {.count = 1, .reusable = false}}, SHIFT(28),
-  [375] = {.entry = {.count = 1, .reusable = true}}, SHIFT(70),
-  [377] = {.entry = {.count = 1, .reusable = true}}, SHIFT(24),
-  [379] = {.entry = {.count = 1, .reusable = true}}, SHIFT(25),
-  [381] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__strong_content, 1, 0, 0),
-  [383] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat2, 2, 0, 0), SHIFT_REPEAT(28),
-  [386] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat2, 2, 0, 0), SHIFT_REPEAT(68),
-  [389] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat2, 2, 0, 0), SHIFT_REPEAT(69),
-  [392] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat2, 2, 0, 0), SHIFT_REPEAT(28),
-  [395] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat2, 2, 0, 0), SHIFT_REPEAT(70),
-  [398] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat2, 2, 0, 0), SHIFT_REPEAT(24),
-  [401] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__strong_content_repeat2, 2, 0, 0), SHIFT_REPEAT(25),
-  [404] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_quotation, 1, 0, 0),
-  [406] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_quotation, 1, 0, 0),
-  [408] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_strong, 1, 0, 0),
-  [410] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_strong, 1, 0, 0),
-  [412] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym__emph_star, 3, 0, 0),
-  [414] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__emph_star, 3, 0, 0),
-  [416] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym__emph_under, 3, 0, 0),
-  [418] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__emph_under, 3, 0, 0),
-  [420] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym__strong_star, 3, 0, 0),
-  [422] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__strong_star, 3, 0, 0),
-  [424] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_literal, 1, 0, 0),
-  [426] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_literal, 1, 0, 0),
-  [428] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym__strong_under, 3, 0, 0),
-  [430] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__strong_under, 3, 0, 0),
-  [432] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_emph, 1, 0, 0),
-  [434] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_emph, 1, 0, 0),
-  [436] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_puncuation, 1, 0, 0),
-  [438] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_puncuation, 1, 0, 0),
-  [440] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_line_break, 2, 0, 0),
-  [442] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_line_break, 2, 0, 0),
-  [444] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym__strong_content_repeat2, 2, 0, 0),
-  [446] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_source_file_repeat1, 2, 0, 0),
-  [448] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_source_file_repeat1, 2, 0, 0), SHIFT_REPEAT(2),
-  [451] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_source_file_repeat1, 2, 0, 0), SHIFT_REPEAT(88),
-  [454] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_source_file, 1, 0, 0),
-  [456] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__section, 1, 0, 0),
-  [458] = {.entry = {.count = 1, .reusable = true}}, SHIFT(19),
-  [460] = {.entry = {.count = 1, .reusable = true}}, SHIFT(100),
-  [462] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_content, 2, 0, 0),
-  [464] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_content_repeat1, 2, 0, 0),
-  [466] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_content_repeat1, 2, 0, 0), SHIFT_REPEAT(19),
-  [469] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_content, 1, 0, 0),
-  [471] = {.entry = {.count = 1, .reusable = true}}, SHIFT(93),
-  [473] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_paragraph_end, 1, 0, 0),
-  [475] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_heading_5, 3, 0, 0),
-  [477] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_heading_6, 3, 0, 0),
-  [479] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_heading_5, 2, 0, 0),
-  [481] = {.entry = {.count = 1, .reusable = true}}, SHIFT(94),
-  [483] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_heading_6, 2, 0, 0),
-  [485] = {.entry = {.count = 1, .reusable = true}}, SHIFT(95),
-  [487] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_paragraph_repeat1, 2, 0, 0), SHIFT_REPEAT(19),
-  [490] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_paragraph_repeat1, 2, 0, 0),
-  [492] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_heading_3, 2, 0, 0),
-  [494] = {.entry = {.count = 1, .reusable = true}}, SHIFT(103),
-  [496] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_paragraph_end_repeat1, 2, 0, 0),
-  [498] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_paragraph_end_repeat1, 2, 0, 0), SHIFT_REPEAT(100),
-  [501] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_heading_1, 3, 0, 0),
-  [503] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_heading_2, 3, 0, 0),
-  [505] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_heading_3, 3, 0, 0),
-  [507] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_heading_4, 3, 0, 0),
-  [509] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_heading_1, 2, 0, 0),
-  [511] = {.entry = {.count = 1, .reusable = true}}, SHIFT(101),
-  [513] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_heading_2, 2, 0, 0),
-  [515] = {.entry = {.count = 1, .reusable = true}}, SHIFT(102),
-  [517] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_heading_4, 2, 0, 0),
-  [519] = {.entry = {.count = 1, .reusable = true}}, SHIFT(104),
-  [521] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__section, 2, 0, 0),
-  [523] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_paragraph, 2, 0, 0),
-  [525] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_heading, 2, 0, 0),
-  [527] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__line, 3, 0, 0),
-  [529] = {.entry = {.count = 1, .reusable = true}}, SHIFT(51),
-  [531] = {.entry = {.count = 1, .reusable = true}}, SHIFT(66),
-  [533] = {.entry = {.count = 1, .reusable = true}},  ACCEPT_INPUT(),
-  [535] = {.entry = {.count = 1, .reusable = true}}, SHIFT(81),
-  [537] = {.entry = {.count = 1, .reusable = true}}, SHIFT(110),
-  [539] = {.entry = {.count = 1, .reusable = true}}, SHIFT(46),
-  [541] = {.entry = {.count = 1, .reusable = true}}, SHIFT(57),
-  [543] = {.entry = {.count = 1, .reusable = true}}, SHIFT(48),
-  [545] = {.entry = {.count = 1, .reusable = true}}, SHIFT(58),
-  [547] = {.entry = {.count = 1, .reusable = true}}, SHIFT(84),
+  [7] = {.entry = {.count = 1, .reusable = true}}, SHIFT(21),
+  [9] = {.entry = {.count = 1, .reusable = true}}, SHIFT(18),
+  [11] = {.entry = {.count = 1, .reusable = true}}, SHIFT(24),
+  [13] = {.entry = {.count = 1, .reusable = true}}, SHIFT(5),
+  [15] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_source_file, 1, 0, 0),
+  [17] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_source_file_repeat1, 2, 0, 0),
+  [19] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_source_file_repeat1, 2, 0, 0), SHIFT_REPEAT(21),
+  [22] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_source_file_repeat1, 2, 0, 0), SHIFT_REPEAT(18),
+  [25] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_source_file_repeat1, 2, 0, 0), SHIFT_REPEAT(24),
+  [28] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_source_file_repeat1, 2, 0, 0), SHIFT_REPEAT(5),
+  [31] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__section, 1, 0, 0),
+  [33] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_heading, 1, 0, 0),
+  [35] = {.entry = {.count = 1, .reusable = true}}, SHIFT(12),
+  [37] = {.entry = {.count = 1, .reusable = true}}, SHIFT(8),
+  [39] = {.entry = {.count = 1, .reusable = true}}, SHIFT(11),
+  [41] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_content, 1, 0, 0),
+  [43] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_paragraph, 2, 0, 0),
+  [45] = {.entry = {.count = 1, .reusable = true}}, SHIFT(13),
+  [47] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_heading, 2, 0, 0),
+  [49] = {.entry = {.count = 1, .reusable = true}}, SHIFT(15),
+  [51] = {.entry = {.count = 1, .reusable = true}}, SHIFT(14),
+  [53] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_content, 2, 0, 0),
+  [55] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_content_repeat1, 2, 0, 0),
+  [57] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_content_repeat1, 2, 0, 0), SHIFT_REPEAT(18),
+  [60] = {.entry = {.count = 1, .reusable = true}}, SHIFT(17),
+  [62] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_paragraph_end, 1, 0, 0),
+  [64] = {.entry = {.count = 1, .reusable = true}}, SHIFT(16),
+  [66] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_heading, 3, 0, 0),
+  [68] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_heading, 4, 0, 0),
+  [70] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_paragraph_end_repeat1, 2, 0, 0), SHIFT_REPEAT(17),
+  [73] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_paragraph_end_repeat1, 2, 0, 0),
+  [75] = {.entry = {.count = 1, .reusable = true}}, SHIFT(7),
+  [77] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_paragraph, 1, 0, 0),
+  [79] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__section, 2, 0, 0),
+  [81] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_paragraph, 3, 0, 0),
+  [83] = {.entry = {.count = 1, .reusable = true}}, SHIFT(22),
+  [85] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_paragraph_end_repeat1, 2, 0, 0), SHIFT_REPEAT(22),
+  [88] = {.entry = {.count = 1, .reusable = true}}, SHIFT(23),
+  [90] = {.entry = {.count = 1, .reusable = true}},  ACCEPT_INPUT(),
 };
 
 enum ts_external_scanner_symbol_identifiers {
-  ts_external_token__line_start = 0,
-  ts_external_token_line_end = 1,
-  ts_external_token__emph_star_start = 2,
-  ts_external_token__emph_star_end = 3,
-  ts_external_token__emph_under_start = 4,
-  ts_external_token__emph_under_end = 5,
-  ts_external_token__strong_star_start = 6,
-  ts_external_token__strong_star_end = 7,
-  ts_external_token__strong_under_start = 8,
-  ts_external_token__strong_under_end = 9,
-  ts_external_token__no_parse = 10,
-  ts_external_token__unused_error = 11,
+  ts_external_token_line_end = 0,
+  ts_external_token_inline = 1,
+  ts_external_token__atx_heading_inline = 2,
+  ts_external_token__setext_heading_inline = 3,
+  ts_external_token_atx_h1_marker = 4,
+  ts_external_token_atx_h2_marker = 5,
+  ts_external_token_atx_h3_marker = 6,
+  ts_external_token_atx_h4_marker = 7,
+  ts_external_token_atx_h5_marker = 8,
+  ts_external_token_atx_h6_marker = 9,
+  ts_external_token_setext_h1_underline = 10,
+  ts_external_token_setext_h2_underline = 11,
+  ts_external_token__atx_closing_sequence = 12,
+  ts_external_token__unused_error = 13,
 };
 
 static const TSSymbol ts_external_scanner_symbol_map[EXTERNAL_TOKEN_COUNT] = {
-  [ts_external_token__line_start] = sym__line_start,
   [ts_external_token_line_end] = sym_line_end,
-  [ts_external_token__emph_star_start] = sym__emph_star_start,
-  [ts_external_token__emph_star_end] = sym__emph_star_end,
-  [ts_external_token__emph_under_start] = sym__emph_under_start,
-  [ts_external_token__emph_under_end] = sym__emph_under_end,
-  [ts_external_token__strong_star_start] = sym__strong_star_start,
-  [ts_external_token__strong_star_end] = sym__strong_star_end,
-  [ts_external_token__strong_under_start] = sym__strong_under_start,
-  [ts_external_token__strong_under_end] = sym__strong_under_end,
-  [ts_external_token__no_parse] = sym__no_parse,
+  [ts_external_token_inline] = sym_inline,
+  [ts_external_token__atx_heading_inline] = sym__atx_heading_inline,
+  [ts_external_token__setext_heading_inline] = sym__setext_heading_inline,
+  [ts_external_token_atx_h1_marker] = sym_atx_h1_marker,
+  [ts_external_token_atx_h2_marker] = sym_atx_h2_marker,
+  [ts_external_token_atx_h3_marker] = sym_atx_h3_marker,
+  [ts_external_token_atx_h4_marker] = sym_atx_h4_marker,
+  [ts_external_token_atx_h5_marker] = sym_atx_h5_marker,
+  [ts_external_token_atx_h6_marker] = sym_atx_h6_marker,
+  [ts_external_token_setext_h1_underline] = sym_setext_h1_underline,
+  [ts_external_token_setext_h2_underline] = sym_setext_h2_underline,
+  [ts_external_token__atx_closing_sequence] = sym__atx_closing_sequence,
   [ts_external_token__unused_error] = sym__unused_error,
 };
 
-static const bool ts_external_scanner_states[16][EXTERNAL_TOKEN_COUNT] = {
+static const bool ts_external_scanner_states[8][EXTERNAL_TOKEN_COUNT] = {
   [1] = {
-    [ts_external_token__line_start] = true,
     [ts_external_token_line_end] = true,
-    [ts_external_token__emph_star_start] = true,
-    [ts_external_token__emph_star_end] = true,
-    [ts_external_token__emph_under_start] = true,
-    [ts_external_token__emph_under_end] = true,
-    [ts_external_token__strong_star_start] = true,
-    [ts_external_token__strong_star_end] = true,
-    [ts_external_token__strong_under_start] = true,
-    [ts_external_token__strong_under_end] = true,
-    [ts_external_token__no_parse] = true,
+    [ts_external_token_inline] = true,
+    [ts_external_token__atx_heading_inline] = true,
+    [ts_external_token__setext_heading_inline] = true,
+    [ts_external_token_atx_h1_marker] = true,
+    [ts_external_token_atx_h2_marker] = true,
+    [ts_external_token_atx_h3_marker] = true,
+    [ts_external_token_atx_h4_marker] = true,
+    [ts_external_token_atx_h5_marker] = true,
+    [ts_external_token_atx_h6_marker] = true,
+    [ts_external_token_setext_h1_underline] = true,
+    [ts_external_token_setext_h2_underline] = true,
+    [ts_external_token__atx_closing_sequence] = true,
     [ts_external_token__unused_error] = true,
   },
   [2] = {
-    [ts_external_token__line_start] = true,
     [ts_external_token_line_end] = true,
+    [ts_external_token_inline] = true,
+    [ts_external_token__setext_heading_inline] = true,
+    [ts_external_token_atx_h1_marker] = true,
+    [ts_external_token_atx_h2_marker] = true,
+    [ts_external_token_atx_h3_marker] = true,
+    [ts_external_token_atx_h4_marker] = true,
+    [ts_external_token_atx_h5_marker] = true,
+    [ts_external_token_atx_h6_marker] = true,
   },
   [3] = {
-    [ts_external_token__emph_star_start] = true,
-    [ts_external_token__emph_under_start] = true,
-    [ts_external_token__strong_star_start] = true,
-    [ts_external_token__strong_under_start] = true,
-    [ts_external_token__no_parse] = true,
+    [ts_external_token_line_end] = true,
+    [ts_external_token_inline] = true,
+    [ts_external_token__atx_heading_inline] = true,
+    [ts_external_token__setext_heading_inline] = true,
+    [ts_external_token_atx_h1_marker] = true,
+    [ts_external_token_atx_h2_marker] = true,
+    [ts_external_token_atx_h3_marker] = true,
+    [ts_external_token_atx_h4_marker] = true,
+    [ts_external_token_atx_h5_marker] = true,
+    [ts_external_token_atx_h6_marker] = true,
+    [ts_external_token__atx_closing_sequence] = true,
   },
   [4] = {
     [ts_external_token_line_end] = true,
-    [ts_external_token__emph_star_start] = true,
-    [ts_external_token__emph_under_start] = true,
-    [ts_external_token__strong_star_start] = true,
-    [ts_external_token__strong_under_start] = true,
-    [ts_external_token__no_parse] = true,
+    [ts_external_token_inline] = true,
+    [ts_external_token__setext_heading_inline] = true,
+    [ts_external_token_atx_h1_marker] = true,
+    [ts_external_token_atx_h2_marker] = true,
+    [ts_external_token_atx_h3_marker] = true,
+    [ts_external_token_atx_h4_marker] = true,
+    [ts_external_token_atx_h5_marker] = true,
+    [ts_external_token_atx_h6_marker] = true,
+    [ts_external_token__atx_closing_sequence] = true,
   },
   [5] = {
-    [ts_external_token__emph_star_start] = true,
-    [ts_external_token__emph_star_end] = true,
-    [ts_external_token__emph_under_start] = true,
-    [ts_external_token__strong_star_start] = true,
-    [ts_external_token__strong_under_start] = true,
-    [ts_external_token__no_parse] = true,
+    [ts_external_token_line_end] = true,
+    [ts_external_token_inline] = true,
   },
   [6] = {
-    [ts_external_token__emph_star_start] = true,
-    [ts_external_token__emph_under_start] = true,
-    [ts_external_token__emph_under_end] = true,
-    [ts_external_token__strong_star_start] = true,
-    [ts_external_token__strong_under_start] = true,
-    [ts_external_token__no_parse] = true,
+    [ts_external_token_setext_h1_underline] = true,
+    [ts_external_token_setext_h2_underline] = true,
   },
   [7] = {
     [ts_external_token_line_end] = true,
-    [ts_external_token__emph_star_start] = true,
-    [ts_external_token__emph_under_start] = true,
-    [ts_external_token__strong_star_end] = true,
-  },
-  [8] = {
-    [ts_external_token_line_end] = true,
-    [ts_external_token__emph_star_start] = true,
-    [ts_external_token__emph_under_start] = true,
-    [ts_external_token__strong_under_end] = true,
-  },
-  [9] = {
-    [ts_external_token__emph_star_start] = true,
-    [ts_external_token__emph_under_start] = true,
-    [ts_external_token__strong_under_end] = true,
-  },
-  [10] = {
-    [ts_external_token__emph_star_start] = true,
-    [ts_external_token__emph_under_start] = true,
-  },
-  [11] = {
-    [ts_external_token__emph_star_start] = true,
-    [ts_external_token__emph_under_start] = true,
-    [ts_external_token__strong_star_end] = true,
-  },
-  [12] = {
-    [ts_external_token__line_start] = true,
-  },
-  [13] = {
-    [ts_external_token__strong_under_end] = true,
-  },
-  [14] = {
-    [ts_external_token__strong_star_end] = true,
-  },
-  [15] = {
-    [ts_external_token_line_end] = true,
   },
 };
 
@@ -0,0 +1,238 @@
+// libFuzzer target: parses arbitrary bytes, then edits them a few times
+// and reparses each edit from the previous tree, as an editor would. Built
+// with clang and the TREE_SITTER_QUARTO_FUZZ CMake option, which also
+// builds the scanners with AddressSanitizer, UndefinedBehaviorSanitizer
+// and their asserts.
+//
+//   cmake --build build --target quarto-fuzz-seeds
+//   mkdir -p fuzz-corpus
+//   build/quarto-fuzz -max_len=65536 fuzz-corpus build/fuzz-seeds
+//
+// An input is a flags byte, an edit byte, then the document:
+// - flags bit 0 parses the document with the inline grammar alone.
+//   Otherwise it is parsed with the block grammar, then each `inline`
+//   node with the inline grammar.
+// - the edit byte seeds the edits: their count, positions, lengths and
+//   the text inserted, which is markdown syntax or a piece of the
+//   document itself.
+//
+// Besides crashes, an input is a finding when parsing it and its edits
+// takes longer than QUARTO_FUZZ_NS_PER_BYTE for each byte parsed, plus
+// 10 ms. The harness then aborts, so libFuzzer saves the input like a
+// crash and performance cliffs are caught too. By default the budget is
+// 5 times the time per byte of a linear document, plain paragraphs and
+// headings, timed at startup with the same sanitizers. A quadratic cost
+// only shows past that at a few KB, so use a -max_len well over
+// libFuzzer's default of 4096, as above.
+//
+// The seeds, written by test/fuzz_seeds.py, are the examples of
+// test/corpus and inline/test/corpus and example-file.qmd.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "tree_sitter/tree-sitter-quarto.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <tree_sitter/api.h>
+
+#define MAX_EDITS 8
+#define MAX_DELETED 16
+#define BUDGET_BASE_SECONDS 0.01
+#define BASELINE_SIZE (64 * 1024)
+#define BASELINE_REPEATS 3
+#define BASELINE_FACTOR 5
+
+static TSParser *block;
+static TSParser *inline_;
+static TSSymbol inline_symbol;
+static double ns_per_byte;
+
+// inserted by edits: the syntax the scanners look at
+static const char *const snippets[] = {
+  "*", "**", "_", "__", "[", "]", "![", "](", ")", "{", "}", "{#", "{.", "=\"", "\"",
+  "`", "```", "$", "$$", "@", "[@", "; ", "-", "\\", "{{< ", " >}}", "{{{< ", "<!-- ",
+  " -->", "# ", "---\n", "===\n", "\n", "\n\n", " ", "\t",
+};
+
+typedef struct {
+  char *text;
+  uint32_t length;
+  uint32_t capacity;
+} Text;
+
+static double now(void) {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+static uint32_t next_random(uint64_t *state, uint32_t bound) {
+  // xorshift64
+  *state ^= *state << 13;
+  *state ^= *state >> 7;
+  *state ^= *state << 17;
+  return bound ? (uint32_t)(*state % bound) : 0;
+}
+
+static TSPoint point_at(const Text *text, uint32_t byte) {
+  TSPoint point = {0, 0};
+  for (uint32_t i = 0; i < byte; i++) {
+    if (text->text[i] == '\n') {
+      point.row++;
+      point.column = 0;
+    } else {
+      point.column++;
+    }
+  }
+  return point;
+}
+
+/// replaces [start, start + deleted) of `text` with `inserted`
+static TSInputEdit replace(Text *text, uint32_t start, uint32_t deleted, const char *inserted,
+                           uint32_t length) {
+  TSInputEdit edit = {
+    .start_byte = start,
+    .old_end_byte = start + deleted,
+    .new_end_byte = start + length,
+    .start_point = point_at(text, start),
+    .old_end_point = point_at(text, start + deleted),
+  };
+  if (text->length - deleted + length > text->capacity) {
+    text->capacity = 2 * (text->length - deleted + length);
+    text->text = realloc(text->text, text->capacity);
+  }
+  memmove(text->text + start + length, text->text + start + deleted,
+          text->length - start - deleted);
+  memmove(text->text + start, inserted, length);
+  text->length = text->length - deleted + length;
+  edit.new_end_point = point_at(text, start + length);
+  return edit;
+}
+
+/// parses each `inline` node of `tree` and returns the bytes parsed
+static uint64_t parse_inline_nodes(const Text *text, TSTree *tree) {
+  uint64_t bytes = 0;
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  bool descend = true;
+  while (true) {
+    if (descend && ts_tree_cursor_goto_first_child(&cursor)) {
+      // moved down
+    } else if (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) break;
+      descend = false;
+      continue;
+    }
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    descend = ts_node_symbol(node) != inline_symbol;
+    if (!descend) {
+      uint32_t start = ts_node_start_byte(node), end = ts_node_end_byte(node);
+      TSTree *inline_tree = ts_parser_parse_string(inline_, NULL, text->text + start, end - start);
+      if (!inline_tree) abort();
+      ts_tree_delete(inline_tree);
+      bytes += end - start;
+    }
+  }
+  ts_tree_cursor_delete(&cursor);
+  return bytes;
+}
+
+/// parses `text`, reusing `old_tree` if it is not NULL, and returns the
+/// bytes parsed
+static uint64_t parse(bool is_inline, const Text *text, TSTree **tree, TSTree *old_tree) {
+  *tree = ts_parser_parse_string(is_inline ? inline_ : block, old_tree, text->text, text->length);
+  if (!*tree) abort();
+  return text->length + (is_inline ? 0 : parse_inline_nodes(text, *tree));
+}
+
+/// returns the best time per byte of parsing a document that every
+/// parser should get through in linear time
+static double baseline_ns_per_byte(void) {
+  static const char paragraph[] =
+    "## A heading\n\nSome text with *emphasis*, `code`, a [link](https://quarto.org)\n"
+    "and a citation [@knuth84], then more words on a second line.\n\n";
+  Text text = {malloc(BASELINE_SIZE), 0, BASELINE_SIZE};
+  while (text.length + sizeof(paragraph) - 1 <= BASELINE_SIZE) {
+    memcpy(text.text + text.length, paragraph, sizeof(paragraph) - 1);
+    text.length += sizeof(paragraph) - 1;
+  }
+  double best = 1e9;
+  for (int repeat = 0; repeat < BASELINE_REPEATS; repeat++) {
+    double start = now();
+    TSTree *tree;
+    uint64_t bytes = parse(false, &text, &tree, NULL);
+    double seconds = (now() - start) / bytes;
+    ts_tree_delete(tree);
+    if (seconds < best) best = seconds;
+  }
+  free(text.text);
+  return best * 1e9;
+}
+
+int LLVMFuzzerInitialize(int *argc, char ***argv) {
+  (void)argc;
+  (void)argv;
+  block = ts_parser_new();
+  inline_ = ts_parser_new();
+  ts_parser_set_language(block, tree_sitter_quarto());
+  ts_parser_set_language(inline_, tree_sitter_quarto_inline());
+  inline_symbol =
+    ts_language_symbol_for_name(tree_sitter_quarto(), "inline", sizeof("inline") - 1, true);
+  const char *budget = getenv("QUARTO_FUZZ_NS_PER_BYTE");
+  if (budget && atof(budget) > 0) {
+    ns_per_byte = atof(budget);
+  } else {
+    ns_per_byte = BASELINE_FACTOR * baseline_ns_per_byte();
+    fprintf(stderr, "quarto-fuzz: budget of %.0f ns per byte parsed\n", ns_per_byte);
+  }
+  return 0;
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  if (size < 2 || size > UINT32_MAX / 4) return 0;
+  bool is_inline = data[0] & 1;
+  uint64_t state = 0x9e3779b97f4a7c15ull ^ ((uint64_t)data[1] << 32 | size);
+  Text text = {malloc(size), (uint32_t)(size - 2), (uint32_t)size};
+  memcpy(text.text, data + 2, size - 2);
+  // edits paste pieces of the unedited document
+  const char *original = (const char *)data + 2;
+  uint32_t original_length = text.length;
+
+  double start = now();
+  TSTree *tree;
+  uint64_t bytes = parse(is_inline, &text, &tree, NULL);
+  for (uint32_t edits = 1 + next_random(&state, MAX_EDITS); edits > 0; edits--) {
+    uint32_t position = next_random(&state, text.length + 1);
+    uint32_t deleted = next_random(&state, MAX_DELETED + 1);
+    if (deleted > text.length - position) deleted = text.length - position;
+    const char *inserted;
+    uint32_t length;
+    if (next_random(&state, 4) == 0 && original_length > 0) {
+      uint32_t from = next_random(&state, original_length);
+      inserted = original + from;
+      length = 1 + next_random(&state, original_length - from);
+    } else {
+      inserted = snippets[next_random(&state, sizeof(snippets) / sizeof(snippets[0]))];
+      length = (uint32_t)strlen(inserted);
+    }
+    TSInputEdit edit = replace(&text, position, deleted, inserted, length);
+    ts_tree_edit(tree, &edit);
+    TSTree *edited;
+    bytes += parse(is_inline, &text, &edited, tree);
+    ts_tree_delete(tree);
+    tree = edited;
+  }
+  ts_tree_delete(tree);
+  free(text.text);
+
+  double seconds = now() - start, budget = BUDGET_BASE_SECONDS + bytes * ns_per_byte * 1e-9;
+  if (seconds > budget) {
+    fprintf(stderr, "slow input: %llu bytes parsed in %.1f ms, over the budget of %.1f ms\n",
+            (unsigned long long)bytes, seconds * 1e3, budget * 1e3);
+    abort();
+  }
+  return 0;
+}
@@ -0,0 +1,53 @@
+"""Seed corpus for the quarto-fuzz libFuzzer target, see test/fuzz.c.
+
+    python test/fuzz_seeds.py <source dir> <seed dir>
+
+Writes one seed per example of test/corpus and inline/test/corpus, and
+one for example-file.qmd. A seed is the flags byte, 1 for the inline
+grammar, an edit byte of 0, then the example.
+"""
+
+import sys
+from pathlib import Path
+
+
+def is_rule(line, marker):
+    return len(line) >= 3 and line == marker * len(line)
+
+
+def examples(path):
+    """the input of every example in a corpus file: the text between the
+    header's closing `===` line and the `---` line"""
+    rules = 0
+    example = None
+    for line in path.read_bytes().splitlines(keepends=True):
+        stripped = line.rstrip(b"\n").decode("utf-8", "replace")
+        if is_rule(stripped, "="):
+            rules += 1
+            if rules % 2 == 0:
+                example = b""
+        elif example is not None and is_rule(stripped, "-"):
+            yield example
+            example = None
+        elif example is not None:
+            example += line
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    source, seeds = Path(sys.argv[1]), Path(sys.argv[2])
+    seeds.mkdir(parents=True, exist_ok=True)
+    count = 0
+    for corpus, flags in [("test/corpus", 0), ("inline/test/corpus", 1)]:
+        for path in sorted(Path(source, corpus).glob("*.txt")):
+            for i, example in enumerate(examples(path)):
+                name = f"{'inline-' if flags else ''}{path.stem}-{i}"
+                Path(seeds, name).write_bytes(bytes([flags, 0]) + example)
+                count += 1
+    Path(seeds, "example-file").write_bytes(bytes([0, 0]) + Path(source, "example-file.qmd").read_bytes())
+    print(f"wrote {count + 1} seeds to {seeds}")
+
+
+if __name__ == "__main__":
+    main()
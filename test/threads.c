@@ -0,0 +1,181 @@
+// ThreadSanitizer stress test: every thread parses every corpus example
+// with its own parsers, and each tree must print the same as when it is
+// parsed on one thread. Built with the TREE_SITTER_QUARTO_TSAN CMake
+// option.
+//
+//   quarto-thread-test <corpus dir> <inline corpus dir>
+
+#define _DEFAULT_SOURCE
+
+#include "tree_sitter/tree-sitter-quarto.h"
+
+#include <dirent.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <tree_sitter/api.h>
+
+#define THREAD_COUNT 32
+#define ROUNDS 20
+
+typedef struct {
+  char *input;
+  bool is_inline;
+  char *expected;
+} Example;
+
+typedef struct {
+  Example *contents;
+  uint32_t size;
+  uint32_t capacity;
+} Examples;
+
+static Examples examples;
+
+static char *read_file(const char *path) {
+  FILE *file = fopen(path, "rb");
+  if (!file) return NULL;
+  fseek(file, 0, SEEK_END);
+  long length = ftell(file);
+  rewind(file);
+  char *text = malloc(length + 1);
+  if (text && fread(text, 1, length, file) != (size_t)length) {
+    free(text);
+    text = NULL;
+  }
+  if (text) text[length] = '\0';
+  fclose(file);
+  return text;
+}
+
+static bool is_rule(const char *line, char marker) {
+  int count = 0;
+  while (*line == marker) {
+    line++;
+    count++;
+  }
+  return count >= 3 && (*line == '\n' || *line == '\0');
+}
+
+static void add_example(char *input, bool is_inline) {
+  if (examples.size == examples.capacity) {
+    examples.capacity = examples.capacity ? 2 * examples.capacity : 64;
+    examples.contents = realloc(examples.contents, examples.capacity * sizeof(Example));
+  }
+  examples.contents[examples.size++] = (Example){input, is_inline, NULL};
+}
+
+/// collects the input of every example in a corpus file: the text
+/// between the header's closing `===` line and the `---` line
+static void read_corpus_file(const char *path, bool is_inline) {
+  char *text = read_file(path);
+  if (!text) return;
+  int rules = 0;
+  char *input = NULL;
+  for (char *line = text; *line; ) {
+    char *end = strchr(line, '\n');
+    char *next = end ? end + 1 : line + strlen(line);
+    if (is_rule(line, '=')) {
+      rules++;
+      if (rules % 2 == 0) input = next;
+    } else if (input && is_rule(line, '-')) {
+      add_example(strndup(input, line - input), is_inline);
+      input = NULL;
+    }
+    line = next;
+  }
+  free(text);
+}
+
+static void read_corpus(const char *dir, bool is_inline) {
+  DIR *directory = opendir(dir);
+  if (!directory) {
+    fprintf(stderr, "cannot open %s\n", dir);
+    exit(1);
+  }
+  struct dirent *entry;
+  while ((entry = readdir(directory))) {
+    if (!strstr(entry->d_name, ".txt")) continue;
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s", dir, entry->d_name);
+    read_corpus_file(path, is_inline);
+  }
+  closedir(directory);
+}
+
+static char *parse(TSParser *block, TSParser *inline_, const Example *example) {
+  TSParser *parser = example->is_inline ? inline_ : block;
+  TSTree *tree = ts_parser_parse_string(parser, NULL, example->input, strlen(example->input));
+  char *string = ts_node_string(ts_tree_root_node(tree));
+  ts_tree_delete(tree);
+  return string;
+}
+
+static void *run(void *payload) {
+  uint32_t offset = (uint32_t)(uintptr_t)payload;
+  TSParser *block = ts_parser_new();
+  TSParser *inline_ = ts_parser_new();
+  ts_parser_set_language(block, tree_sitter_quarto());
+  ts_parser_set_language(inline_, tree_sitter_quarto_inline());
+  uintptr_t failures = 0;
+  for (uint32_t round = 0; round < ROUNDS; round++) {
+    for (uint32_t i = 0; i < examples.size; i++) {
+      // threads start at different examples, so different ones run at once
+      const Example *example = &examples.contents[(i + offset) % examples.size];
+      char *string = parse(block, inline_, example);
+      if (strcmp(string, example->expected) != 0) {
+        fprintf(stderr, "thread %u: %s\nexpected %s\n     got %s\n",
+                offset, example->input, example->expected, string);
+        failures++;
+      }
+      free(string);
+    }
+  }
+  ts_parser_delete(block);
+  ts_parser_delete(inline_);
+  return (void *)failures;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    fprintf(stderr, "usage: %s <corpus dir> <inline corpus dir>\n", argv[0]);
+    return 2;
+  }
+  read_corpus(argv[1], false);
+  read_corpus(argv[2], true);
+  if (examples.size == 0) {
+    fprintf(stderr, "no examples found\n");
+    return 2;
+  }
+
+  TSParser *block = ts_parser_new();
+  TSParser *inline_ = ts_parser_new();
+  ts_parser_set_language(block, tree_sitter_quarto());
+  ts_parser_set_language(inline_, tree_sitter_quarto_inline());
+  for (uint32_t i = 0; i < examples.size; i++) {
+    examples.contents[i].expected = parse(block, inline_, &examples.contents[i]);
+  }
+  ts_parser_delete(block);
+  ts_parser_delete(inline_);
+
+  pthread_t threads[THREAD_COUNT];
+  for (uintptr_t i = 0; i < THREAD_COUNT; i++) {
+    pthread_create(&threads[i], NULL, run, (void *)i);
+  }
+  uintptr_t failures = 0;
+  for (uint32_t i = 0; i < THREAD_COUNT; i++) {
+    void *result;
+    pthread_join(threads[i], &result);
+    failures += (uintptr_t)result;
+  }
+
+  printf("%u examples, %d threads, %d rounds, %lu failures\n",
+         examples.size, THREAD_COUNT, ROUNDS, (unsigned long)failures);
+  for (uint32_t i = 0; i < examples.size; i++) {
+    free(examples.contents[i].input);
+    free(examples.contents[i].expected);
+  }
+  free(examples.contents);
+  return failures == 0 ? 0 : 1;
+}